@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -153,6 +153,45 @@ uint32_t cli_init(void);
  */
 uint32_t cli_start(void);
 
+/*
+ * cli_run_batch
+ *   Description
+ *     Runs a batch of commands without entering the interactive CLI. Commands
+ *     are separated by CLI_CONFIG_BATCH_SEPARATOR or newlines. The output of
+ *     the commands is stored in the print buffer and sent to the UART in the
+ *     background by cli_flush_nowait, so running a batch does not wait on the
+ *     UART. Output that does not fit in the print buffer is dropped, and
+ *     cli_flush_nowait then ends the output with a notice.
+ *   Parameters
+ *     const char *batch
+ *       Null-terminated string holding the commands to run.
+ *   Return
+ *     Platform return codes defined in cli_config.h, the status of the first
+ *     command which failed if any, FWK_E_NOMEM if the output was truncated.
+ */
+uint32_t cli_run_batch(const char *batch);
+
+/*
+ * cli_flush_nowait
+ *   Description
+ *     Sends as much of the print buffer to the UART as can be accepted
+ *     without waiting.
+ *   Return
+ *     FWK_SUCCESS if the print buffer is empty, FWK_PENDING if some data is
+ *     still waiting to be sent.
+ */
+uint32_t cli_flush_nowait(void);
+
+/*
+ * cli_output_pending
+ *   Description
+ *     Tells whether the print buffer holds data waiting to be sent while the
+ *     interactive CLI is not running.
+ *   Return
+ *     true if cli_flush_nowait should be called, false otherwise.
+ */
+bool cli_output_pending(void);
+
 /*
  * cli_bprintf
  *   Description
@@ -206,8 +245,9 @@ uint32_t cli_printf(cli_option_et options, const char *format, ...);
 /*
  * cli_print
  *   Description
- *     Sends a string directly to the debug terminal with no special formatting
- *     or extra processing.
+ *     Sends a string to the debug terminal with no special formatting or extra
+ *     processing. The string goes through the print buffer, which is sent to
+ *     the UART before returning, except while a batch runs.
  *   Parameters
  *     const char *string
  *       Null-terminated string to be printed.
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -37,12 +37,17 @@
  *
  * CLI_CONFIG_PRINT_BUFFER_SIZE
  *   Size of the debug print buffer used to store characters before they can
- *   be sent to the UART.
+ *   be sent to the UART. Output of command batches is also stored here and
+ *   sent in the background, so this should hold a full batch output.
  *
  * CLI_CONFIG_SCRATCH_BUFFER_SIZE
  *   Number of stack bytes used as scratch space by print statements, size of
  *   this buffer determines the maximum length of a single print.  Threads using
  *   CLI print functionality must have this much extra stack space.
+ *
+ * CLI_CONFIG_BATCH_SEPARATOR
+ *   Character separating the commands of a batch. Commands typed on a single
+ *   line can also be separated with it.
  */
 
 #define CLI_CONFIG_COMMAND_BUF_SIZE (256)
@@ -52,8 +57,9 @@
 #define CLI_CONFIG_DEFAULT_TERM_W (80)
 #define CLI_CONFIG_DEFAULT_TERM_H (24)
 #define CLI_CONFIG_STACK_SIZE (2048)
-#define CLI_CONFIG_PRINT_BUFFER_SIZE (1024)
+#define CLI_CONFIG_PRINT_BUFFER_SIZE (4096)
 #define CLI_CONFIG_SCRATCH_BUFFER_SIZE (256)
+#define CLI_CONFIG_BATCH_SEPARATOR ';'
 
 #define CLI_PROMPT  "> "
 
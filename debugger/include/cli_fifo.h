@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -73,6 +73,35 @@ uint32_t fifo_get(fifo_st *fifo, char *val);
  */
 uint32_t fifo_put(fifo_st *fifo, char *val);
 
+/*
+ * fifo_peek
+ *   Description
+ *     Gets the address of the oldest bytes in a FIFO without removing them.
+ *   Parameters
+ *     fifo_st *fifo
+ *       Pointer to fifo_st structure to peek into.
+ *     char **val
+ *       Pointer to location in which to place the address of the bytes.
+ *   Return
+ *     Number of bytes that can be read contiguously from the address, 0 if
+ *     the FIFO is empty.
+ */
+uint32_t fifo_peek(fifo_st *fifo, char **val);
+
+/*
+ * fifo_drop
+ *   Description
+ *     Removes bytes from a FIFO, usually after reading them with fifo_peek.
+ *   Parameters
+ *     fifo_st *fifo
+ *       Pointer to fifo_st structure to remove the bytes from.
+ *     uint32_t count
+ *       Number of bytes to remove.
+ *   Return
+ *     Platform return codes defined in cli_config.h.
+ */
+uint32_t fifo_drop(fifo_st *fifo, uint32_t count);
+
 /*
  * fifo_free_space
  *   Description
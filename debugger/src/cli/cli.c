@@ -52,6 +52,16 @@ static fifo_st cli_print_fifo = { 0 };
 static char cli_print_fifo_buffer[CLI_CONFIG_PRINT_BUFFER_SIZE] = { 0 };
 static bool overflow = false;
 
+/* Set while a batch of commands runs, its output goes to the print buffer. */
+static bool cli_batch_running = false;
+/* Buffer holding a batch of commands while it runs. */
+static char cli_batch_buffer[CLI_CONFIG_COMMAND_BUF_SIZE] = { 0 };
+/* Set when the output of a batch did not fit in the print buffer. */
+static bool cli_batch_truncated = false;
+
+static const char str_batch_truncated[] =
+    "\x1B[31mCONSOLE ERROR:\x1B[0m Batch output truncated.\n";
+
 size_t strnlen(s, maxlen) register const char *s;
 size_t maxlen;
 {
@@ -267,6 +277,74 @@ static uint32_t cli_split(
  */
 static uint32_t cli_command_dispatch(char **args);
 
+/*
+ * cli_run_commands
+ *   Description
+ *     Splits a string into commands and dispatches each of them in turn.
+ *   Parameters
+ *     char *commands
+ *       Null-terminated string holding the commands, it is modified by the
+ *       parser.
+ *     const char *separators
+ *       Null-terminated list of characters separating the commands.
+ *   Return
+ *     Platform return codes defined in cli_config.h, the status of the first
+ *     command which failed if any.
+ */
+static uint32_t cli_run_commands(char *commands, const char *separators);
+
+/*
+ * cli_buffer_print
+ *   Description
+ *     Puts a string into the print buffer, adding carriage returns before
+ *     newlines as cli_print does.
+ *   Parameters
+ *     const char *string
+ *       Null-terminated string to be buffered.
+ *   Return
+ *     Platform return codes defined in cli_config.h.
+ */
+static uint32_t cli_buffer_print(const char *string);
+
+/*
+ * cli_buffer_putch
+ *   Description
+ *     Puts a character into the print buffer, adding a carriage return before
+ *     a newline.
+ *   Parameters
+ *     char c
+ *       Character to be buffered.
+ *   Return
+ *     Platform return codes defined in cli_config.h.
+ */
+static uint32_t cli_buffer_putch(char c);
+
+/*
+ * cli_putch
+ *   Description
+ *     Echoes a character to the debug terminal through the print buffer.
+ *   Parameters
+ *     char c
+ *       Character to be printed.
+ *   Return
+ *     Platform return codes defined in cli_config.h.
+ */
+static uint32_t cli_putch(char c);
+
+/*
+ * cli_flush
+ *   Description
+ *     Sends the print buffer to the UART until it is empty. A notice is added
+ *     at the end of the output of a batch that did not fit in the buffer.
+ *   Parameters
+ *     bool wait
+ *       Whether to wait for the UART, or to stop as soon as it is busy.
+ *   Return
+ *     FWK_SUCCESS if the print buffer is empty, FWK_PENDING if the UART was
+ *     busy before it could be emptied, or another platform return code.
+ */
+static uint32_t cli_flush(bool wait);
+
 /*
  * cli_debug_output
  *   Description
@@ -383,6 +461,49 @@ uint32_t cli_start(void)
     return FWK_SUCCESS;
 }
 
+uint32_t cli_run_batch(const char *batch)
+{
+    static const char separators[] = { CLI_CONFIG_BATCH_SEPARATOR, '\n', 0 };
+    uint32_t status;
+
+    /* Check parameters. */
+    if (batch == NULL)
+        return FWK_E_PARAM;
+
+    /* Batches cannot run alongside the interactive CLI. */
+    if (cli_state != CLI_READY)
+        return FWK_E_STATE;
+
+    if (strnlen(batch, CLI_CONFIG_COMMAND_BUF_SIZE) >=
+        CLI_CONFIG_COMMAND_BUF_SIZE)
+        return FWK_E_NOMEM;
+
+    strncpy(cli_batch_buffer, batch, CLI_CONFIG_COMMAND_BUF_SIZE);
+
+    cli_batch_running = true;
+    status = cli_run_commands(cli_batch_buffer, separators);
+    cli_batch_running = false;
+
+    /* The notice is queued by cli_flush_nowait once there is room for it. */
+    if (overflow)
+        cli_batch_truncated = true;
+
+    if ((status == FWK_SUCCESS) && overflow)
+        return FWK_E_NOMEM;
+
+    return status;
+}
+
+uint32_t cli_flush_nowait(void)
+{
+    return cli_flush(false);
+}
+
+bool cli_output_pending(void)
+{
+    return (cli_state == CLI_READY) && (fifo_count(&cli_print_fifo) != 0);
+}
+
 uint32_t cli_bprintf(cli_option_et options, const char *format, ...)
 {
     va_list arg;
@@ -520,22 +641,35 @@ uint32_t cli_printf(cli_option_et options, const char *format, ...)
 
 uint32_t cli_print(const char *string)
 {
-    uint32_t index = 0;
-    int32_t status = FWK_SUCCESS;
+    uint32_t index;
+    uint32_t status;
 
+    /* The print buffer is set up by cli_init. */
+    if (cli_state == CLI_NOT_READY)
+        return FWK_E_STATE;
+
+    /* Output of a batch is sent in the background. */
+    if (cli_batch_running)
+        return cli_buffer_print(string);
+
+    /*
+     * Interactive output goes through the print buffer too, so the UART gets
+     * whole runs of characters rather than one character at a time. It is
+     * sent before returning, and whenever the buffer fills up.
+     */
     for (index = 0; string[index] != 0; index++) {
-        if (string[index] == '\n') {
-            status = fwk_io_putch(fwk_io_stdout, '\r');
-            if (status != FWK_SUCCESS) {
+        if (fifo_free_space(&cli_print_fifo) < 2) {
+            status = cli_flush(true);
+            if (status != FWK_SUCCESS)
                 return status;
-            }
         }
-        status = fwk_io_putch(fwk_io_stdout, string[index]);
-        if (status != FWK_SUCCESS) {
+
+        status = cli_buffer_putch(string[index]);
+        if (status != FWK_SUCCESS)
             return status;
-        }
     }
-    return status;
+
+    return cli_flush(true);
 }
 
 void cli_snprintf(char *s, char *smax, const char *fmt, ...)
@@ -634,9 +768,7 @@ uint32_t cli_getline(
         }
 
         /* Echo received character to console. */
-        do {
-            status = fwk_io_putch(fwk_io_stdout, c);
-        } while (status == FWK_PENDING);
+        status = cli_putch(c);
 
         if (status != FWK_SUCCESS)
             return status;
@@ -672,6 +804,7 @@ uint32_t cli_getline(
 
 static void cli_main(void const *argument)
 {
+    static const char separators[] = { CLI_CONFIG_BATCH_SEPARATOR, 0 };
     int32_t status;
     uint32_t last_history_index = CLI_CONFIG_HISTORY_LENGTH - 1;
     uint32_t command_length = 0;
@@ -731,27 +864,129 @@ static void cli_main(void const *argument)
                 (last_history_index + 1) % CLI_CONFIG_HISTORY_LENGTH;
         }
 
+        /* Dispatching each command typed on the line for processing. */
+        cli_run_commands(cli_input_buffer, separators);
+    }
+}
+
+static uint32_t cli_run_commands(char *commands, const char *separators)
+{
+    uint32_t status;
+    uint32_t first_error = FWK_SUCCESS;
+    char *command = commands;
+    char *next;
+
+    while (command != NULL) {
+        /* Terminate the current command at the next separator. */
+        next = strpbrk(command, separators);
+        if (next != NULL)
+            *next++ = 0;
+
         /* Splitting up command into individual argument strings. */
         status = cli_split(
             cli_args,
             CLI_CONFIG_MAX_NUM_ARGUMENTS,
-            cli_input_buffer,
-            command_length,
+            command,
+            strlen(command),
             " ");
+
+        /* If the user didn't type any valid arguments, don't process it. */
+        if ((status == FWK_SUCCESS) && (cli_args[0] != 0))
+            status = cli_command_dispatch(cli_args);
+
         if (status != FWK_SUCCESS) {
             cli_error_handler(status);
-            continue;
+            if (first_error == FWK_SUCCESS)
+                first_error = status;
         }
 
-        /* If the user didn't type any valid arguments, don't process it. */
-        if (cli_args[0] == 0)
-            continue;
+        command = next;
+    }
+
+    return first_error;
+}
+
+static uint32_t cli_buffer_print(const char *string)
+{
+    uint32_t status = FWK_SUCCESS;
+    uint32_t i;
+
+    /* Once the buffer has overflowed, drop the rest of the output. */
+    if (overflow)
+        return FWK_E_NOMEM;
+
+    for (i = 0; string[i] != 0; i++) {
+        status = cli_buffer_putch(string[i]);
+        if (status != FWK_SUCCESS) {
+            overflow = true;
+            return status;
+        }
+    }
 
-        /* Dispatching command for processing. */
-        status = cli_command_dispatch(cli_args);
+    return status;
+}
+
+static uint32_t cli_buffer_putch(char c)
+{
+    static char cr = '\r';
+    uint32_t status;
+
+    if (c == '\n') {
+        status = fifo_put(&cli_print_fifo, &cr);
         if (status != FWK_SUCCESS)
-            cli_error_handler(status);
+            return status;
+    }
+
+    return fifo_put(&cli_print_fifo, &c);
+}
+
+static uint32_t cli_putch(char c)
+{
+    char string[2] = { c, 0 };
+
+    return cli_print(string);
+}
+
+static uint32_t cli_flush(bool wait)
+{
+    uint32_t count;
+    size_t written;
+    char *data;
+    int status;
+
+    for (;;) {
+        /* Send runs of characters until the buffer is empty. */
+        while ((count = fifo_peek(&cli_print_fifo, &data)) != 0) {
+            if (wait) {
+                status = fwk_io_write(
+                    fwk_io_stdout, &written, data, sizeof(char), count);
+                if (status != FWK_SUCCESS)
+                    return status;
+            } else {
+                status =
+                    fwk_io_write_nowait(fwk_io_stdout, &written, data, count);
+                if ((status != FWK_SUCCESS) && (status != FWK_E_BUSY))
+                    return status;
+            }
+
+            fifo_drop(&cli_print_fifo, (uint32_t)written);
+
+            /* Stop once the UART does not take any more characters. */
+            if (written < count)
+                return FWK_PENDING;
+        }
+
+        overflow = false;
+
+        if (!cli_batch_truncated)
+            break;
+
+        /* Tell the user that the end of the batch output was dropped. */
+        cli_batch_truncated = false;
+        (void)cli_buffer_print(str_batch_truncated);
     }
+
+    return FWK_SUCCESS;
 }
 
 uint32_t cli_format(cli_option_et options, char *buffer, uint32_t size)
@@ -1016,8 +1251,7 @@ static uint32_t cli_get_command(
 
                             /* Printing history command to screen. */
                             while (buffer[index] != 0) {
-                                status =
-                                    fwk_io_putch(fwk_io_stdout, buffer[index]);
+                                status = cli_putch(buffer[index]);
                                 if (status != FWK_SUCCESS)
                                     return status;
                                 index = index + 1;
@@ -1054,8 +1288,7 @@ static uint32_t cli_get_command(
 
                             /* Printing history command to screen. */
                             while (buffer[index] != 0) {
-                                status =
-                                    fwk_io_putch(fwk_io_stdout, buffer[index]);
+                                status = cli_putch(buffer[index]);
                                 if (status != FWK_SUCCESS)
                                     return status;
 
@@ -1106,7 +1339,7 @@ static uint32_t cli_get_command(
         }
 
         /* Printing received character to console. */
-        status = fwk_io_putch(fwk_io_stdout, c);
+        status = cli_putch(c);
         if (status != FWK_SUCCESS)
             return status;
 
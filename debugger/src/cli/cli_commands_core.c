@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -56,7 +56,10 @@
 #include <cli_fifo.h>
 #include <cli_platform.h>
 
-#include <fwk_io.h>
+#include <fwk_core.h>
+#include <fwk_id.h>
+#include <fwk_module.h>
+#include <fwk_time.h>
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -75,6 +78,7 @@ static const char dump_memory_help[] =
 static int32_t dump_memory_f(int32_t argc, char **argv)
 {
     uint8_t bytes[8] = { 0 };
+    char ascii[NUM_BYTES_PER_LINE + 1];
 
     /*
      * Reads aligned to 8 byte bondaries so remove lower 3 bits of address and
@@ -104,16 +108,16 @@ static int32_t dump_memory_f(int32_t argc, char **argv)
             cli_printf(NONE, " %02x", bytes[j]);
 
         /* Print ASCII representation. */
-        cli_print(" \"");
         for (j = 0; j < NUM_BYTES_PER_LINE; j++) {
             if ((bytes[j] >= 0x20) && (bytes[j] <= 0x7E))
                 /* Character is printing. */
-                fwk_io_putch(fwk_io_stdout, bytes[j]);
+                ascii[j] = (char)bytes[j];
             else
                 /* Character is non-printing so put a period. */
-                fwk_io_putch(fwk_io_stdout, '.');
+                ascii[j] = '.';
         }
-        cli_print("\"\n");
+        ascii[NUM_BYTES_PER_LINE] = '\0';
+        cli_printf(NONE, " \"%s\"\n", ascii);
     }
 
     return FWK_SUCCESS;
@@ -309,6 +313,69 @@ static int32_t uptime_f(int32_t argc, char **argv)
     return FWK_SUCCESS;
 }
 
+/*
+ * perf
+ * Prints the framework performance counters.
+ */
+static const char perf_call[] = "perf";
+static const char perf_help[] =
+    "  Prints the event queue depth and high-water mark, the free event\n"
+    "  pool, the number of events raised from interrupts and the time spent\n"
+    "  by each module handling events.\n"
+    "    Usage: perf [reset]\n"
+    "  See also timerperf and scmiperf when these modules are present.";
+static int32_t perf_f(int32_t argc, char **argv)
+{
+    struct fwk_core_counters counters;
+    struct fwk_core_module_counters module_counters;
+    fwk_id_t module_id;
+    unsigned int module_idx;
+    int status;
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        fwk_core_reset_counters();
+        return FWK_SUCCESS;
+    }
+
+    status = fwk_core_get_counters(&counters);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    cli_printf(
+        NONE,
+        "Event queue: %u (high-water %u), ISR event queue: %u\n",
+        counters.event_queue_depth,
+        counters.event_queue_high_water,
+        counters.isr_event_queue_depth);
+    cli_printf(
+        NONE,
+        "Free events: %u (low-water %u), events from ISRs: %u\n",
+        counters.free_event_count,
+        counters.free_event_low_water,
+        (unsigned int)counters.isr_event_count);
+
+    for (module_idx = 0;; module_idx++) {
+        module_id = FWK_ID_MODULE(module_idx);
+        if (!fwk_module_is_valid_module_id(module_id))
+            break;
+
+        status = fwk_core_get_module_counters(module_id, &module_counters);
+        if ((status != FWK_SUCCESS) || (module_counters.event_count == 0))
+            continue;
+
+        cli_printf(
+            NONE,
+            "  %s: %u events, %u us total, %u us max\n",
+            FWK_ID_STR(module_id),
+            (unsigned int)module_counters.event_count,
+            (unsigned int)fwk_time_duration_us(module_counters.handler_time),
+            (unsigned int)fwk_time_duration_us(
+                module_counters.handler_time_max));
+    }
+
+    return FWK_SUCCESS;
+}
+
 /*
  * reset_system
  * Performs a software reset.
@@ -340,6 +407,7 @@ cli_command_st cli_commands[] = {
     { write_memory_call, write_memory_help, &write_memory_f, false },
     { reset_sys_call, reset_sys_help, &reset_sys_f, false },
     { uptime_call, uptime_help, &uptime_f, false },
+    { perf_call, perf_help, &perf_f, false },
     { checkpoint_call, checkpoint_help, &checkpoint_f, false },
 
     /* End of commands. */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -71,6 +71,38 @@ uint32_t fifo_put(fifo_st *fifo, char *val)
     return FWK_E_NOMEM;
 }
 
+uint32_t fifo_peek(fifo_st *fifo, char **val)
+{
+    /* Checking parameters. */
+    if (fifo == 0 || val == 0)
+        return 0;
+
+    *val = &fifo->buf[fifo->get_ptr];
+
+    /* Bytes are contiguous up to the put pointer or the end of the buffer. */
+    if (fifo->put_ptr >= fifo->get_ptr)
+        return fifo->put_ptr - fifo->get_ptr;
+
+    return fifo->buf_size - fifo->get_ptr;
+}
+
+uint32_t fifo_drop(fifo_st *fifo, uint32_t count)
+{
+    /* Checking parameters. */
+    if (fifo == 0 || count > fifo->count)
+        return FWK_E_PARAM;
+
+    fifo->get_ptr = (fifo->get_ptr + count) % fifo->buf_size;
+    fifo->count = fifo->count - count;
+    /* Tracking FIFO high-water mark. */
+    if ((fifo->reset_high_water == true) && (fifo->count == 0)) {
+        fifo->high_water = 0;
+        fifo->reset_high_water = false;
+    }
+
+    return FWK_SUCCESS;
+}
+
 uint32_t fifo_free_space(fifo_st *fifo)
 {
     /* Checking parameters. */
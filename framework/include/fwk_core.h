@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,6 +15,7 @@
 
 #include <fwk_event.h>
 #include <fwk_id.h>
+#include <fwk_time.h>
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -147,6 +148,84 @@ int fwk_is_delayed_response_list_empty(fwk_id_t id, bool *is_empty);
  */
 int fwk_get_first_delayed_response(fwk_id_t id, struct fwk_event *event);
 
+#if defined(BUILD_HAS_DEBUGGER) || defined(__DOXYGEN__)
+
+/*!
+ * \brief Framework core performance counters.
+ *
+ * \note Only available when the debugger is included in the build.
+ */
+struct fwk_core_counters {
+    /*! Number of events waiting in the event queue */
+    unsigned int event_queue_depth;
+
+    /*! Highest number of events seen waiting in the event queue */
+    unsigned int event_queue_high_water;
+
+    /*! Number of events raised by ISRs waiting to be processed */
+    unsigned int isr_event_queue_depth;
+
+    /*! Number of events raised from interrupt context */
+    uint32_t isr_event_count;
+
+    /*! Number of event structures free to be used */
+    unsigned int free_event_count;
+
+    /*! Lowest number of event structures seen free to be used */
+    unsigned int free_event_low_water;
+};
+
+/*!
+ * \brief Event handling counters of a module.
+ *
+ * \note Only available when the debugger is included in the build.
+ */
+struct fwk_core_module_counters {
+    /*! Number of events and notifications processed by the module */
+    uint32_t event_count;
+
+    /*! Total time spent in the event and notification handlers */
+    fwk_duration_ns_t handler_time;
+
+    /*! Longest time spent in a single call to a handler */
+    fwk_duration_ns_t handler_time_max;
+};
+
+/*!
+ * \brief Get a copy of the framework core performance counters.
+ *
+ * \param[out] counters The copy of the counters.
+ *
+ * \retval ::FWK_SUCCESS The counters were returned.
+ * \retval ::FWK_E_PARAM The `counters` parameter was a null pointer value.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_core_get_counters(struct fwk_core_counters *counters);
+
+/*!
+ * \brief Get a copy of the event handling counters of a module.
+ *
+ * \param[in] module_id Module identifier.
+ * \param[out] counters The copy of the counters.
+ *
+ * \retval ::FWK_SUCCESS The counters were returned.
+ * \retval ::FWK_E_PARAM One or more parameters were invalid.
+ *
+ * \return Status code representing the result of the operation.
+ */
+int fwk_core_get_module_counters(
+    fwk_id_t module_id,
+    struct fwk_core_module_counters *counters);
+
+/*!
+ * \brief Reset the high and low water marks, the ISR event count and the
+ *      event handling counters of all the modules.
+ */
+void fwk_core_reset_counters(void);
+
+#endif
+
 /*!
  * \}
  */
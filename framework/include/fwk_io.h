@@ -182,6 +182,67 @@ struct fwk_io_adapter {
      */
     int (*putch)(const struct fwk_io_stream *stream, char ch);
 
+    /*!
+     * \brief Read a block of characters from the stream.
+     *
+     * \details Fetch up to `size` characters from the stream in a single call.
+     *      The function stores the number of characters fetched in `read`, and
+     *      may return ::FWK_PENDING to indicate that there are no characters
+     *      to fetch.
+     *
+     *      The `stream`, `read` and `buffer` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case the
+     *      framework falls back to ::fwk_io_adapter::getch for each character.
+     *
+     * \param[in] stream Stream to read from.
+     * \param[out] read Number of characters read from the stream.
+     * \param[out] buffer Storage for the characters read from the stream.
+     * \param[in] size Maximum number of characters to read.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully read.
+     * \retval ::FWK_PENDING There are no more characters to read.
+     */
+    int (*read)(
+        const struct fwk_io_stream *stream,
+        size_t *read,
+        char *buffer,
+        size_t size);
+
+    /*!
+     * \brief Write a block of characters to the stream.
+     *
+     * \details Write up to `size` characters to the stream in a single call.
+     *      The function stores the number of characters accepted in `written`,
+     *      which may be less than `size` if the resource cannot accept all of
+     *      them at once.
+     *
+     *      The `stream`, `written` and `buffer` parameters are guaranteed to be
+     *      non-null, and `size` is guaranteed to be non-zero.
+     *
+     * \note This field may be set to a null pointer value, in which case the
+     *      framework falls back to ::fwk_io_adapter::putch for each character.
+     *
+     * \param[in] stream Stream to write to.
+     * \param[out] written Number of characters written to the stream.
+     * \param[in] buffer Characters to write to the stream.
+     * \param[in] size Number of characters to write.
+     *
+     * \return Status code representing the result of the operation.
+     *
+     * \retval ::FWK_SUCCESS At least one character was successfully written.
+     * \retval ::FWK_E_BUSY The resource is currently unavailable and it cannot
+     *      accept new characters.
+     */
+    int (*write)(
+        const struct fwk_io_stream *stream,
+        size_t *written,
+        const char *buffer,
+        size_t size);
+
     /*!
      * \brief Close the stream.
      *
@@ -353,6 +414,11 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
  *      the number of objects read is less than `count`. This error is not
  *      returned if the `read` parameter is not a null pointer value.
  *
+ *      Only whole objects are counted in `read`. If the stream runs out of
+ *      characters in the middle of an object, the characters of that object
+ *      are stored in `buffer` but not counted, and the function does not wait
+ *      for the rest of the object.
+ *
  * \param[in] stream Input stream.
  * \param[out] read Number of objects read.
  * \param[out] buffer Pointer to the array of uninitialized objects to write to.
@@ -362,6 +428,7 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch);
  * \return Status code representing the result of the operation.
  *
  * \retval ::FWK_SUCCESS The read completed successfully.
+ * \retval ::FWK_PENDING Fewer than `count` objects were available.
  * \retval ::FWK_E_PARAM An invalid parameter was encountered:
  *      - The `stream` parameter was a null pointer value.
  *      - The `buffer` parameter was a null pointer value.
@@ -409,6 +476,41 @@ int fwk_io_write(
     size_t size,
     size_t count);
 
+/*!
+ * \brief Write as many characters as possible to a stream without waiting.
+ *
+ * \details Writes up to `size` characters from `buffer` to the output stream
+ *      `stream`, stopping as soon as the driver cannot accept any more. The
+ *      `written` parameter is updated with the number of characters that were
+ *      accepted. If the stream adapter implements ::fwk_io_adapter::write the
+ *      characters are handed over in bulk, otherwise they are written one by
+ *      one as if by ::fwk_io_putch_nowait.
+ *
+ * \param[in] stream Output stream.
+ * \param[out] written Number of characters written.
+ * \param[in] buffer Characters to write.
+ * \param[in] size Number of characters to write.
+ *
+ * \return Status code representing the result of the operation.
+ *
+ * \retval ::FWK_SUCCESS At least one character was successfully written, or
+ *      `size` was zero.
+ * \retval ::FWK_E_BUSY The `stream` resource is currently busy and no
+ *      characters were written.
+ * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+ *      - The `stream` parameter was a null pointer value.
+ *      - The `written` parameter was a null pointer value.
+ *      - The `buffer` parameter was a null pointer value.
+ * \retval ::FWK_E_STATE The `stream` has already been closed.
+ * \retval ::FWK_E_SUPPORT The `stream` was not opened with write access.
+ * \retval ::FWK_E_HANDLER The `stream` adapter encountered an error.
+ */
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size);
+
 /*!
  * \brief Write a string to a stream.
  *
@@ -321,15 +321,15 @@ void fwk_log_flush(void);
 /*!
  * \internal
  *
- * \brief Unbuffer a single character and send it to the logging backend.
+ * \brief Unbuffer pending characters and send them to the logging backend.
  *
  * \details This function is reserved for the framework implementation, and is
  *      used by the scheduler to print opportunistically when idling, and when
  *      flushing to flush the buffer to the logging backend.
  *
- * \retval ::FWK_PENDING The character was unbuffered successfully but there are
+ * \retval ::FWK_PENDING Characters were unbuffered successfully but there are
  *      still characters remaining in the buffer.
- * \retval ::FWK_SUCCESS The character was unbuffered successfully and the
+ * \retval ::FWK_SUCCESS Characters were unbuffered successfully and the
  *      buffer is now empty.
  * \retval ::FWK_E_DEVICE The backend returned an error.
  *
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -222,6 +222,28 @@ struct fwk_module {
      */
     int (*start)(fwk_id_t id);
 
+    /*!
+     * \brief Pointer to the deferred start function.
+     *
+     * \details This function is called by the framework once for the module,
+     *      after all the modules have started and the events queued during
+     *      the start stage have been processed, which is when the SCMI
+     *      services are up and able to respond to agents. Modules are called
+     *      in the order of their indices.
+     *
+     *      It may be used to move work that is not needed to reach the first
+     *      SCMI response out of the start stage, such as populating caches or
+     *      publishing diagnostic data.
+     *
+     * \note This function is \b optional.
+     *
+     * \param id Identifier of the module.
+     *
+     * \retval ::FWK_SUCCESS The deferred work was successfully completed.
+     * \return One of the other module-defined error codes.
+     */
+    int (*deferred_start)(fwk_id_t id);
+
     /*!
      * \brief Pointer to the stop function.
      *
@@ -591,6 +613,42 @@ int fwk_module_bind(fwk_id_t target_id, fwk_id_t api_id, const void *api);
  */
 int fwk_module_adapter(const struct fwk_io_adapter **adapter, fwk_id_t id);
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+/*!
+ * \brief Boot-time profile of a module.
+ *
+ * \details Time spent in each pre-runtime stage by the module and its
+ *      elements, in microseconds.
+ */
+struct fwk_module_boot_profile {
+    /*! Time spent in the initialization stage */
+    uint32_t init_us;
+
+    /*! Time spent in the bind stage, over all the bind rounds */
+    uint32_t bind_us;
+
+    /*! Time spent in the start stage */
+    uint32_t start_us;
+
+    /*! Time spent in the deferred start function */
+    uint32_t deferred_start_us;
+};
+
+/*!
+ * \brief Get the boot-time profile of a module.
+ *
+ * \param id Identifier of the module.
+ * \param[out] profile Boot-time profile of the module.
+ *
+ * \retval ::FWK_SUCCESS The profile was returned.
+ * \retval ::FWK_E_PARAM The identifier is not a valid module identifier or
+ *      `profile` is a null pointer value.
+ */
+int fwk_module_get_boot_profile(
+    fwk_id_t id,
+    struct fwk_module_boot_profile *profile);
+#endif
+
 /*!
  * \internal
  *
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #ifndef FWK_INTERNAL_CONTEXT_H
 #define FWK_INTERNAL_CONTEXT_H
 
+#include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_list.h>
 
@@ -40,6 +41,11 @@ struct __fwk_ctx {
 
     /* The event currently being processed */
     struct fwk_event *current_event;
+
+#ifdef BUILD_HAS_DEBUGGER
+    /* Performance counters */
+    struct fwk_core_counters counters;
+#endif
 };
 
 /*
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -13,6 +13,7 @@
 
 #include <internal/fwk_notification.h>
 
+#include <fwk_core.h>
 #include <fwk_id.h>
 #include <fwk_module.h>
 #include <fwk_slist.h>
@@ -51,6 +52,16 @@ struct fwk_module_context {
 
     /* List of delayed response events */
     struct fwk_slist delayed_response_list;
+
+#ifdef BUILD_HAS_DEBUGGER
+    /* Event handling counters */
+    struct fwk_core_module_counters counters;
+#endif
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+    /* Time spent in each pre-runtime stage */
+    struct fwk_module_boot_profile boot_profile;
+#endif
 };
 
 /*
@@ -102,6 +113,8 @@ int fwk_module_start(void);
  */
 int fwk_module_stop(void);
 
+int fwk_module_deferred_start(void);
+
 /*
  * \brief Get a pointer to the context of a module or element.
  *
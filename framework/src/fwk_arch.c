@@ -96,6 +96,8 @@ int fwk_arch_init(const struct fwk_arch_init_driver *driver)
      * in a forever loop.
      */
 #if defined(BUILD_HAS_SUB_SYSTEM_MODE)
+    fwk_process_event_queue();
+    (void)fwk_module_deferred_start();
     fwk_process_event_queue();
     fwk_log_flush();
 #else
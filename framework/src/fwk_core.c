@@ -25,6 +25,11 @@
 #include <fwk_noreturn.h>
 #include <fwk_status.h>
 #include <fwk_string.h>
+#include <fwk_time.h>
+
+#ifdef BUILD_HAS_DEBUGGER
+#    include <fwk_module_idx.h>
+#endif
 
 #include <inttypes.h>
 #include <stdbool.h>
@@ -46,6 +51,40 @@ enum interrupt_states {
  * Static functions
  */
 
+#ifdef BUILD_HAS_DEBUGGER
+static void counters_event_queued(void)
+{
+    ctx.counters.event_queue_depth++;
+    if (ctx.counters.event_queue_depth > ctx.counters.event_queue_high_water) {
+        ctx.counters.event_queue_high_water = ctx.counters.event_queue_depth;
+    }
+}
+
+static void counters_event_allocated(void)
+{
+    ctx.counters.free_event_count--;
+    if (ctx.counters.free_event_count < ctx.counters.free_event_low_water) {
+        ctx.counters.free_event_low_water = ctx.counters.free_event_count;
+    }
+}
+
+static void counters_event_processed(
+    fwk_id_t module_id,
+    fwk_timestamp_t start,
+    fwk_timestamp_t end)
+{
+    struct fwk_core_module_counters *counters;
+    fwk_duration_ns_t duration = fwk_time_duration(start, end);
+
+    counters = &fwk_module_get_ctx(module_id)->counters;
+    counters->event_count++;
+    counters->handler_time += duration;
+    if (duration > counters->handler_time_max) {
+        counters->handler_time_max = duration;
+    }
+}
+#endif
+
 /*
  * Duplicate an event.
  *
@@ -70,6 +109,11 @@ static struct fwk_event *duplicate_event(
     flags = fwk_interrupt_global_disable();
     allocated_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx.free_event_queue), struct fwk_event, slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+    if (allocated_event != NULL) {
+        counters_event_allocated();
+    }
+#endif
     (void)fwk_interrupt_global_enable(flags);
 
     if (allocated_event == NULL) {
@@ -147,8 +191,15 @@ static int put_event(
     }
     if (intr_state == NOT_INTERRUPT_STATE) {
         fwk_list_push_tail(&ctx.event_queue, &allocated_event->slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+        counters_event_queued();
+#endif
     } else {
         fwk_list_push_tail(&ctx.isr_event_queue, &allocated_event->slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+        ctx.counters.isr_event_queue_depth++;
+        ctx.counters.isr_event_count++;
+#endif
     }
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
@@ -169,6 +220,9 @@ static void free_event(struct fwk_event *event)
 
     flags = fwk_interrupt_global_disable();
     fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+    ctx.counters.free_event_count++;
+#endif
     (void)fwk_interrupt_global_enable(flags);
 }
 
@@ -179,9 +233,16 @@ static void process_next_event(void)
     const struct fwk_module *module;
     int (*process_event)(
         const struct fwk_event *event, struct fwk_event *resp_event);
+#ifdef BUILD_HAS_DEBUGGER
+    fwk_timestamp_t start;
+#endif
 
     ctx.current_event = event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx.event_queue), struct fwk_event, slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+    ctx.counters.event_queue_depth--;
+    start = fwk_time_current();
+#endif
 
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
     FWK_LOG_DEBUG(
@@ -235,6 +296,10 @@ static void process_next_event(void)
         }
     }
 
+#ifdef BUILD_HAS_DEBUGGER
+    counters_event_processed(event->target_id, start, fwk_time_current());
+#endif
+
     ctx.current_event = NULL;
     free_event(event);
     return;
@@ -248,6 +313,11 @@ static bool process_isr(void)
     flags = fwk_interrupt_global_disable();
     isr_event = FWK_LIST_GET(
         fwk_list_pop_head(&ctx.isr_event_queue), struct fwk_event, slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+    if (isr_event != NULL) {
+        ctx.counters.isr_event_queue_depth--;
+    }
+#endif
     (void)fwk_interrupt_global_enable(flags);
 
     if (isr_event == NULL) {
@@ -263,6 +333,9 @@ static bool process_isr(void)
 #endif
 
     fwk_list_push_tail(&ctx.event_queue, &isr_event->slist_node);
+#ifdef BUILD_HAS_DEBUGGER
+    counters_event_queued();
+#endif
 
     return true;
 }
@@ -286,6 +359,11 @@ int __fwk_init(size_t event_count)
         fwk_list_push_tail(&ctx.free_event_queue, &event->slist_node);
     }
 
+#ifdef BUILD_HAS_DEBUGGER
+    ctx.counters.free_event_count = (unsigned int)event_count;
+    ctx.counters.free_event_low_water = (unsigned int)event_count;
+#endif
+
     ctx.initialized = true;
 
     return FWK_SUCCESS;
@@ -306,6 +384,13 @@ void fwk_process_event_queue(void)
 
 noreturn void __fwk_run_main_loop(void)
 {
+    /*
+     * Process the events queued during the start stage before running the
+     * work the modules have deferred until the system is up.
+     */
+    fwk_process_event_queue();
+    (void)fwk_module_deferred_start();
+
     for (;;) {
         fwk_process_event_queue();
         if (fwk_log_unbuffer() == FWK_SUCCESS) {
@@ -460,3 +545,50 @@ error:
     FWK_LOG_CRIT(err_msg_func, status, __func__);
     return status;
 }
+
+#ifdef BUILD_HAS_DEBUGGER
+int fwk_core_get_counters(struct fwk_core_counters *counters)
+{
+    unsigned int flags;
+
+    if (counters == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    flags = fwk_interrupt_global_disable();
+    *counters = ctx.counters;
+    (void)fwk_interrupt_global_enable(flags);
+
+    return FWK_SUCCESS;
+}
+
+int fwk_core_get_module_counters(
+    fwk_id_t module_id,
+    struct fwk_core_module_counters *counters)
+{
+    if ((counters == NULL) || !fwk_module_is_valid_module_id(module_id)) {
+        return FWK_E_PARAM;
+    }
+
+    *counters = fwk_module_get_ctx(module_id)->counters;
+
+    return FWK_SUCCESS;
+}
+
+void fwk_core_reset_counters(void)
+{
+    unsigned int flags;
+    unsigned int module_idx;
+
+    flags = fwk_interrupt_global_disable();
+    ctx.counters.event_queue_high_water = ctx.counters.event_queue_depth;
+    ctx.counters.free_event_low_water = ctx.counters.free_event_count;
+    ctx.counters.isr_event_count = 0;
+    (void)fwk_interrupt_global_enable(flags);
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        fwk_module_get_ctx(FWK_ID_MODULE(module_idx))->counters =
+            (struct fwk_core_module_counters){ 0 };
+    }
+}
+#endif
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <fwk_assert.h>
 #include <fwk_attributes.h>
 #include <fwk_io.h>
 #include <fwk_mm.h>
@@ -158,6 +159,25 @@ int fwk_io_open(
     return FWK_SUCCESS;
 }
 
+static int fwk_io_check_mode(
+    const struct fwk_io_stream *stream,
+    enum fwk_io_mode mode)
+{
+    if (stream == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (stream->adapter == NULL) {
+        return FWK_E_STATE; /* The stream is not open */
+    }
+
+    if ((((unsigned int)stream->mode) & ((unsigned int)mode)) == 0U) {
+        return FWK_E_SUPPORT; /* Stream not open for this kind of operation */
+    }
+
+    return FWK_SUCCESS;
+}
+
 int fwk_io_getch(const struct fwk_io_stream *stream, char *ch)
 {
     int status;
@@ -172,13 +192,9 @@ int fwk_io_getch(const struct fwk_io_stream *stream, char *ch)
 
     *ch = '\0';
 
-    if (stream->adapter == NULL) {
-        return FWK_E_STATE; /* The stream is not open */
-    }
-
-    if ((((unsigned int)stream->mode) & ((unsigned int)FWK_IO_MODE_READ)) ==
-        0U) {
-        return FWK_E_SUPPORT; /* Stream not open for read operations */
+    status = fwk_io_check_mode(stream, FWK_IO_MODE_READ);
+    if (status != FWK_SUCCESS) {
+        return status;
     }
 
     if (stream->adapter->getch == NULL) {
@@ -199,17 +215,9 @@ int fwk_io_putch(const struct fwk_io_stream *stream, char ch)
 {
     int status;
 
-    if (stream == NULL) {
-        return FWK_E_PARAM;
-    }
-
-    if (stream->adapter == NULL) {
-        return FWK_E_STATE; /* The stream is not open */
-    }
-
-    if ((((unsigned int)stream->mode) & ((unsigned int)FWK_IO_MODE_WRITE)) ==
-        0U) {
-        return FWK_E_SUPPORT; /* Stream not open for write operations */
+    status = fwk_io_check_mode(stream, FWK_IO_MODE_WRITE);
+    if (status != FWK_SUCCESS) {
+        return status;
     }
 
     if (stream->adapter->putch == NULL) {
@@ -232,17 +240,9 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch)
 {
     int status;
 
-    if (stream == NULL) {
-        return FWK_E_PARAM;
-    }
-
-    if (stream->adapter == NULL) {
-        return FWK_E_STATE; /* The stream is not open */
-    }
-
-    if ((((unsigned int)stream->mode) & ((unsigned int)FWK_IO_MODE_WRITE)) ==
-        0U) {
-        return FWK_E_SUPPORT; /* Stream not open for write operations */
+    status = fwk_io_check_mode(stream, FWK_IO_MODE_WRITE);
+    if (status != FWK_SUCCESS) {
+        return status;
     }
 
     if (stream->adapter->putch == NULL) {
@@ -258,6 +258,67 @@ int fwk_io_putch_nowait(const struct fwk_io_stream *stream, char ch)
     return status;
 }
 
+static int fwk_io_read_bulk(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict read,
+    char *restrict buffer,
+    size_t size)
+{
+    int status = FWK_SUCCESS;
+
+    size_t fetched;
+
+    *read = 0;
+
+    while ((*read < size) && (status == FWK_SUCCESS)) {
+        fetched = 0;
+
+        status = stream->adapter->read(
+            stream, &fetched, buffer + *read, size - *read);
+        if (status == FWK_SUCCESS) {
+            fwk_assert(fetched <= (size - *read));
+
+            *read += fetched;
+        } else if (status != FWK_PENDING) {
+            status = FWK_E_HANDLER;
+        }
+    }
+
+    return status;
+}
+
+static int fwk_io_write_bulk(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size)
+{
+    int status = FWK_SUCCESS;
+
+    size_t accepted;
+
+    *written = 0;
+
+    while ((*written < size) && (status == FWK_SUCCESS)) {
+        accepted = 0;
+
+        /* Wait for the adapter to accept new characters */
+        status = stream->adapter->write(
+            stream, &accepted, buffer + *written, size - *written);
+        if (status == FWK_SUCCESS) {
+            fwk_assert(accepted <= (size - *written));
+
+            *written += accepted;
+        } else if (status == FWK_E_BUSY) {
+            status = FWK_SUCCESS;
+        } else {
+            status = FWK_E_HANDLER;
+        }
+    }
+
+    return status;
+}
+
 int fwk_io_read(
     const struct fwk_io_stream *restrict stream,
     size_t *restrict read,
@@ -268,18 +329,58 @@ int fwk_io_read(
     int status = FWK_SUCCESS;
 
     char *cbuffer = buffer;
+    size_t fetched = 0;
+    size_t remainder;
 
     if (read != NULL) {
         *read = 0;
     }
 
-    for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
-        for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
-            status = fwk_io_getch(stream, cbuffer++);
+    if ((stream != NULL) && (stream->adapter != NULL) &&
+        (stream->adapter->read != NULL) && (count > 0) && (size > 0)) {
+        status = fwk_io_check_mode(stream, FWK_IO_MODE_READ);
+        if (status != FWK_SUCCESS) {
+            return status;
         }
 
-        if ((status == FWK_SUCCESS) && (read != NULL)) {
-            *read += 1;
+        if (cbuffer == NULL) {
+            return FWK_E_PARAM;
+        }
+
+        status = fwk_io_read_bulk(stream, &fetched, cbuffer, size * count);
+
+        /*
+         * Try to finish reading an object that has only partially been fetched,
+         * for as long as the stream provides more characters for it.
+         */
+        remainder = 1;
+        while ((status == FWK_PENDING) && ((fetched % size) != 0) &&
+               (remainder != 0)) {
+            status = fwk_io_read_bulk(
+                stream,
+                &remainder,
+                cbuffer + fetched,
+                size - (fetched % size));
+
+            fetched += remainder;
+
+            if (status == FWK_SUCCESS) {
+                status = FWK_PENDING; /* Fewer than `count` objects read */
+            }
+        }
+
+        if (read != NULL) {
+            *read = fetched / size;
+        }
+    } else {
+        for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
+            for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
+                status = fwk_io_getch(stream, cbuffer++);
+            }
+
+            if ((status == FWK_SUCCESS) && (read != NULL)) {
+                *read += 1;
+            }
         }
     }
 
@@ -300,6 +401,7 @@ int fwk_io_write(
     int status = FWK_SUCCESS;
 
     const char *cbuffer = buffer;
+    size_t accepted = 0;
 
     if (cbuffer == NULL) {
         return FWK_E_PARAM;
@@ -309,6 +411,22 @@ int fwk_io_write(
         *written = 0;
     }
 
+    if ((stream != NULL) && (stream->adapter != NULL) &&
+        (stream->adapter->write != NULL) && (count > 0) && (size > 0)) {
+        status = fwk_io_check_mode(stream, FWK_IO_MODE_WRITE);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        status = fwk_io_write_bulk(stream, &accepted, cbuffer, size * count);
+
+        if (written != NULL) {
+            *written = accepted / size;
+        }
+
+        return status;
+    }
+
     for (size_t i = 0; (i < count) && (status == FWK_SUCCESS); i++) {
         for (size_t j = 0; (j < size) && (status == FWK_SUCCESS); j++) {
             status = fwk_io_putch(stream, *cbuffer++);
@@ -322,6 +440,57 @@ int fwk_io_write(
     return status;
 }
 
+int fwk_io_write_nowait(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size)
+{
+    int status;
+
+    if ((written == NULL) || (buffer == NULL)) {
+        return FWK_E_PARAM;
+    }
+
+    *written = 0;
+
+    status = fwk_io_check_mode(stream, FWK_IO_MODE_WRITE);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    if (size == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if (stream->adapter->write != NULL) {
+        status = stream->adapter->write(stream, written, buffer, size);
+        if (status == FWK_SUCCESS) {
+            fwk_assert(*written <= size);
+        } else if (status == FWK_E_BUSY) {
+            *written = 0;
+        } else {
+            *written = 0;
+            status = FWK_E_HANDLER;
+        }
+
+        return status;
+    }
+
+    do {
+        status = fwk_io_putch_nowait(stream, buffer[*written]);
+        if (status == FWK_SUCCESS) {
+            *written += 1;
+        }
+    } while ((*written < size) && (status == FWK_SUCCESS));
+
+    if ((status == FWK_E_BUSY) && (*written > 0)) {
+        status = FWK_SUCCESS; /* Partial writes are not an error */
+    }
+
+    return status;
+}
+
 int fwk_io_close(struct fwk_io_stream *stream)
 {
     int status;
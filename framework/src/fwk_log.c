@@ -36,6 +36,15 @@ static struct {
 
 static struct fwk_io_stream *fwk_log_stream;
 
+#ifdef FWK_LOG_BUFFERED
+/*
+ * Maximum number of characters handed to the log drain on each call to
+ * `fwk_log_unbuffer()`. Drains implementing a bulk write can accept a whole
+ * hardware FIFO worth of characters at once.
+ */
+#    define FWK_LOG_UNBUFFER_CHUNK_SIZE 32
+#endif
+
 #ifdef FWK_LOG_BUFFERED
 static FWK_CONSTRUCTOR void fwk_log_stream_init(void)
 {
@@ -248,8 +257,9 @@ int fwk_log_unbuffer(void)
 
 #ifdef FWK_LOG_BUFFERED
     unsigned int flags;
-    unsigned char fetched;
-    char ch;
+    size_t fetched;
+    size_t written = 0;
+    char chunk[FWK_LOG_UNBUFFER_CHUNK_SIZE];
 
     flags = fwk_interrupt_global_disable();
 
@@ -285,28 +295,32 @@ int fwk_log_unbuffer(void)
     }
 
     /*
-     * Grab the next character from the ring buffer and try to print it.
-     * Printing the character successfully will result in a pending return value
-     * even if it is the last character in the message - the next call to this
-     * function will run the logic above to finalize the message.
+     * Grab as much of the current message as we can from the ring buffer and
+     * try to print it in one go. Printing successfully will result in a
+     * pending return value even if we reached the end of the message - the
+     * next call to this function will run the logic above to finalize the
+     * message.
      */
 
-    fetched = fwk_ring_peek(&fwk_log_ctx.ring, &ch, sizeof(ch));
-    fwk_assert(fetched == sizeof(char));
+    fetched = fwk_ring_peek(
+        &fwk_log_ctx.ring,
+        chunk,
+        FWK_MIN((size_t)fwk_log_ctx.remaining, sizeof(chunk)));
+    fwk_assert(fetched > 0);
 
-    status = fwk_io_putch_nowait(fwk_log_stream, ch);
+    status = fwk_io_write_nowait(fwk_log_stream, &written, chunk, fetched);
     switch (status) {
     case FWK_SUCCESS:
         /*
-         * If the character was successfully printed, then we remove it from
-         * the buffer.
+         * If the characters were successfully printed, then we remove them
+         * from the buffer.
          */
-        fwk_ring_pop(&fwk_log_ctx.ring, &ch, sizeof(ch));
-        fwk_log_ctx.remaining--;
+        fwk_ring_pop(&fwk_log_ctx.ring, NULL, written);
+        fwk_log_ctx.remaining -= (unsigned char)written;
         status = FWK_PENDING;
         break;
     case FWK_E_BUSY:
-        /* If the resource is busy, we keep the character in the buffer. */
+        /* If the resource is busy, we keep the characters in the buffer. */
         status = FWK_PENDING;
         break;
     default:
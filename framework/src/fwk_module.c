@@ -22,6 +22,12 @@
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+#    include <fwk_time.h>
+
+#    include <inttypes.h>
+#endif
+
 #include <stdbool.h>
 
 #if FMW_NOTIFICATION_MAX > 64
@@ -44,6 +50,9 @@ static struct {
     /* Flag indicating whether all modules have been initialized */
     bool initialized;
 
+    /* Flag indicating whether the deferred start functions have been run */
+    bool deferred_started;
+
     /* Table of module contexts */
     struct fwk_module_context module_ctx_table[FWK_MODULE_IDX_COUNT];
 
@@ -66,6 +75,43 @@ static const char fwk_module_err_msg_line[] = "[MOD] Error %d in %s @%d";
 static const char fwk_module_err_msg_func[] = "[MOD] Error %d in %s";
 #endif
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+static uint32_t fwk_module_elapsed_us(fwk_timestamp_t start)
+{
+    return (uint32_t)fwk_time_duration_us(
+        fwk_time_duration(start, fwk_time_current()));
+}
+
+static void fwk_module_log_boot_profile(void)
+{
+    unsigned int module_idx;
+    const struct fwk_module_context *fwk_mod_ctx;
+    const struct fwk_module_boot_profile *profile;
+    uint32_t total_us = 0;
+
+    FWK_LOG_INFO(
+        "[FWK] Boot profile (us): module init bind start deferred_start");
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+        profile = &fwk_mod_ctx->boot_profile;
+
+        FWK_LOG_INFO(
+            "[FWK]   %s %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32,
+            FWK_ID_STR(fwk_mod_ctx->id),
+            profile->init_us,
+            profile->bind_us,
+            profile->start_us,
+            profile->deferred_start_us);
+
+        total_us += profile->init_us + profile->bind_us + profile->start_us +
+            profile->deferred_start_us;
+    }
+
+    FWK_LOG_INFO("[FWK] Boot profile total: %" PRIu32 " us", total_us);
+}
+#endif
+
 static size_t fwk_module_count_elements(const struct fwk_element *elements)
 {
     size_t count = 0;
@@ -133,6 +179,8 @@ static void fwk_module_init_element_ctxs(
 
 void fwk_module_init(void)
 {
+    fwk_module_ctx.deferred_started = false;
+
     /*
      * The loop index i gets the values corresponding to the
      * enum fwk_module_idx
@@ -270,8 +318,23 @@ static void fwk_module_init_module(struct fwk_module_context *ctx)
 
 static void fwk_module_init_modules(void)
 {
+    struct fwk_module_context *fwk_mod_ctx;
+#ifdef BUILD_HAS_BOOT_PROFILE
+    fwk_timestamp_t start;
+#endif
+
     for (unsigned int i = 0U; i < (unsigned int)FWK_MODULE_IDX_COUNT; i++) {
-        fwk_module_init_module(&fwk_module_ctx.module_ctx_table[i]);
+        fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[i];
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        start = fwk_time_current();
+#endif
+
+        fwk_module_init_module(fwk_mod_ctx);
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        fwk_mod_ctx->boot_profile.init_us = fwk_module_elapsed_us(start);
+#endif
     }
 }
 
@@ -336,13 +399,25 @@ static int fwk_module_bind_modules(unsigned int round)
     int status;
     unsigned int module_idx;
     struct fwk_module_context *fwk_mod_ctx;
+#ifdef BUILD_HAS_BOOT_PROFILE
+    fwk_timestamp_t start;
+#endif
 
     for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
         fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        start = fwk_time_current();
+#endif
+
         status = fwk_module_bind_module(fwk_mod_ctx, round);
         if (status != FWK_SUCCESS) {
             return status;
         }
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        fwk_mod_ctx->boot_profile.bind_us += fwk_module_elapsed_us(start);
+#endif
     }
 
     return FWK_SUCCESS;
@@ -398,13 +473,25 @@ static int start_modules(void)
     int status;
     unsigned int module_idx;
     struct fwk_module_context *fwk_mod_ctx;
+#ifdef BUILD_HAS_BOOT_PROFILE
+    fwk_timestamp_t start;
+#endif
 
     for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
         fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        start = fwk_time_current();
+#endif
+
         status = fwk_module_start_module(fwk_mod_ctx);
         if (status != FWK_SUCCESS) {
             return status;
         }
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        fwk_mod_ctx->boot_profile.start_us = fwk_module_elapsed_us(start);
+#endif
     }
 
     return FWK_SUCCESS;
@@ -452,6 +539,57 @@ int fwk_module_start(void)
     return FWK_SUCCESS;
 }
 
+int fwk_module_deferred_start(void)
+{
+    int status;
+    int result = FWK_SUCCESS;
+    unsigned int module_idx;
+    struct fwk_module_context *fwk_mod_ctx;
+#ifdef BUILD_HAS_BOOT_PROFILE
+    fwk_timestamp_t start;
+#endif
+
+    if (!fwk_module_ctx.initialized || fwk_module_ctx.deferred_started) {
+        return FWK_E_STATE;
+    }
+
+    fwk_module_ctx.deferred_started = true;
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        fwk_mod_ctx = &fwk_module_ctx.module_ctx_table[module_idx];
+
+        if (fwk_mod_ctx->desc->deferred_start == NULL) {
+            continue;
+        }
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        start = fwk_time_current();
+#endif
+
+        /*
+         * The other modules are already running, so a failure is reported
+         * without preventing the remaining deferred work from running.
+         */
+        status = fwk_mod_ctx->desc->deferred_start(fwk_mod_ctx->id);
+        if (!fwk_expect(status == FWK_SUCCESS)) {
+            FWK_LOG_CRIT(fwk_module_err_msg_func, status, __func__);
+            result = status;
+        }
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+        fwk_mod_ctx->boot_profile.deferred_start_us =
+            fwk_module_elapsed_us(start);
+#endif
+    }
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+    /* The profile is complete once the deferred work has run */
+    fwk_module_log_boot_profile();
+#endif
+
+    return result;
+}
+
 static int fwk_module_stop_elements(struct fwk_module_context *fwk_mod_ctx)
 {
     int status;
@@ -570,6 +708,21 @@ void fwk_module_reset(void)
     fwk_module_init();
 }
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+int fwk_module_get_boot_profile(
+    fwk_id_t id,
+    struct fwk_module_boot_profile *profile)
+{
+    if ((profile == NULL) || !fwk_module_is_valid_module_id(id)) {
+        return FWK_E_PARAM;
+    }
+
+    *profile = fwk_module_get_ctx(id)->boot_profile;
+
+    return FWK_SUCCESS;
+}
+#endif
+
 bool fwk_module_is_valid_module_id(fwk_id_t id)
 {
     if (!fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
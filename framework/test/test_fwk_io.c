@@ -0,0 +1,201 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fwk_io.h>
+#include <fwk_macros.h>
+#include <fwk_status.h>
+#include <fwk_test.h>
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Characters available from the fake stream */
+static const char *input;
+static size_t input_length;
+static size_t input_offset;
+
+/* Largest number of characters the fake adapter returns per call */
+static size_t burst_size;
+
+/* Offset at which the fake adapter reports no characters once */
+static size_t stall_offset;
+static bool stalled;
+
+/* Number of calls made to the fake adapter */
+static unsigned int read_call_count;
+static unsigned int getch_call_count;
+
+static int fake_open(const struct fwk_io_stream *stream)
+{
+    return FWK_SUCCESS;
+}
+
+static int fake_getch(const struct fwk_io_stream *stream, char *ch)
+{
+    getch_call_count++;
+
+    if (input_offset == input_length) {
+        return FWK_PENDING;
+    }
+
+    *ch = input[input_offset++];
+
+    return FWK_SUCCESS;
+}
+
+static int fake_read(
+    const struct fwk_io_stream *stream,
+    size_t *read,
+    char *buffer,
+    size_t size)
+{
+    read_call_count++;
+
+    /* Give up rather than spin if the framework keeps polling */
+    assert(read_call_count < 64);
+
+    if (input_offset == input_length) {
+        return FWK_PENDING;
+    }
+
+    if ((input_offset == stall_offset) && !stalled) {
+        stalled = true;
+
+        return FWK_PENDING;
+    }
+
+    *read = FWK_MIN(FWK_MIN(size, burst_size), input_length - input_offset);
+
+    memcpy(buffer, input + input_offset, *read);
+    input_offset += *read;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_putch(const struct fwk_io_stream *stream, char ch)
+{
+    return FWK_SUCCESS;
+}
+
+static const struct fwk_io_adapter fake_adapter = {
+    .open = fake_open,
+    .getch = fake_getch,
+    .read = fake_read,
+    .putch = fake_putch,
+};
+
+static struct fwk_io_stream stream = {
+    .adapter = &fake_adapter,
+    .mode = FWK_IO_MODE_READ,
+};
+
+static void set_input(const char *str, size_t burst)
+{
+    input = str;
+    input_length = strlen(str);
+    input_offset = 0;
+    burst_size = burst;
+    stall_offset = SIZE_MAX;
+    stalled = false;
+
+    read_call_count = 0;
+    getch_call_count = 0;
+}
+
+static void test_fwk_io_read_whole_objects(void)
+{
+    int status;
+    size_t read;
+    char buffer[8];
+
+    set_input("abcdef", 4);
+
+    status = fwk_io_read(&stream, &read, buffer, 2, 3);
+    assert(status == FWK_SUCCESS);
+    assert(read == 3);
+    assert(memcmp(buffer, "abcdef", 6) == 0);
+    assert(getch_call_count == 0);
+}
+
+static void test_fwk_io_read_fewer_objects(void)
+{
+    int status;
+    size_t read;
+    char buffer[8];
+
+    set_input("abcd", 4);
+
+    status = fwk_io_read(&stream, &read, buffer, 2, 4);
+    assert(status == FWK_PENDING);
+    assert(read == 2);
+    assert(memcmp(buffer, "abcd", 4) == 0);
+}
+
+static void test_fwk_io_read_partial_object_completed(void)
+{
+    int status;
+    size_t read;
+    char buffer[16];
+
+    /* The stream stalls once in the middle of the second object */
+    set_input("abcdefghij", 3);
+    stall_offset = 6;
+
+    status = fwk_io_read(&stream, &read, buffer, 4, 4);
+    assert(status == FWK_PENDING);
+    assert(read == 2);
+    assert(memcmp(buffer, "abcdefgh", 8) == 0);
+
+    /* Only the rest of the partial object has been fetched */
+    assert(input_offset == 8);
+}
+
+static void test_fwk_io_read_partial_object_no_progress(void)
+{
+    int status;
+    size_t read;
+    char buffer[8];
+
+    /* The stream runs dry in the middle of the second object */
+    set_input("abcdef", 8);
+
+    status = fwk_io_read(&stream, &read, buffer, 4, 2);
+    assert(status == FWK_PENDING);
+    assert(read == 1);
+    assert(memcmp(buffer, "abcdef", 6) == 0);
+
+    /* The framework gives up once the stream stops providing characters */
+    assert(read_call_count <= 3);
+}
+
+static void test_fwk_io_read_partial_object_no_read_count(void)
+{
+    int status;
+    char buffer[8];
+
+    set_input("abc", 8);
+
+    status = fwk_io_read(&stream, NULL, buffer, 4, 1);
+    assert(status == FWK_E_DATA);
+}
+
+static const struct fwk_test_case_desc test_case_table[] = {
+    FWK_TEST_CASE(test_fwk_io_read_whole_objects),
+    FWK_TEST_CASE(test_fwk_io_read_fewer_objects),
+    FWK_TEST_CASE(test_fwk_io_read_partial_object_completed),
+    FWK_TEST_CASE(test_fwk_io_read_partial_object_no_progress),
+    FWK_TEST_CASE(test_fwk_io_read_partial_object_no_read_count),
+};
+
+struct fwk_test_suite_desc test_suite = {
+    .name = "fwk_io",
+
+    .test_case_count = FWK_ARRAY_SIZE(test_case_table),
+    .test_case_table = test_case_table,
+};
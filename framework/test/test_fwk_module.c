@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -91,6 +91,8 @@ static int bind_return_val;
 static int bind_count_call;
 static int start_return_val;
 static int start_count_call;
+static int deferred_start_return_val;
+static int deferred_start_count_call;
 static int process_bind_request_return_val;
 static bool process_bind_request_return_api;
 static bool get_element_table0_return_val;
@@ -136,6 +138,13 @@ static int start(fwk_id_t id)
     return start_return_val;
 }
 
+static int deferred_start(fwk_id_t id)
+{
+    (void) id;
+    deferred_start_count_call++;
+    return deferred_start_return_val;
+}
+
 static struct fake_api fake_api = {
     .init = init,
     .element_init = element_init
@@ -221,6 +230,7 @@ static void test_case_setup(void)
     post_init_return_val = FWK_SUCCESS;
     bind_return_val = FWK_SUCCESS;
     start_return_val = FWK_SUCCESS;
+    deferred_start_return_val = FWK_SUCCESS;
     process_bind_request_return_val = FWK_SUCCESS;
     process_bind_request_return_api = true;
     process_event_return_val = FWK_SUCCESS;
@@ -228,6 +238,7 @@ static void test_case_setup(void)
 
     bind_count_call = 0;
     start_count_call = 0;
+    deferred_start_count_call = 0;
 
     config_elem0.fake_val = 5;
     config_elem0.ref = fwk_id_build_element_id(fwk_module_id_fake0, ELEM0_IDX);
@@ -250,6 +261,7 @@ static void test_case_setup(void)
     fake_module_desc0.post_init = post_init;
     fake_module_desc0.bind = bind;
     fake_module_desc0.start = start;
+    fake_module_desc0.deferred_start = deferred_start;
     fake_module_desc0.process_bind_request = process_bind_request;
 
     fake_module_desc1.api_count = 0;
@@ -393,10 +405,38 @@ static void test_fwk_module_is_valid_notification_id(void)
     assert(!result);
 }
 
+static void test_fwk_module_deferred_start(void)
+{
+    int status;
+
+    /* Only the module with a deferred start function is called */
+    status = fwk_module_deferred_start();
+    assert(status == FWK_SUCCESS);
+    assert(deferred_start_count_call == 1);
+
+    /* The deferred start functions are only called once */
+    status = fwk_module_deferred_start();
+    assert(status == FWK_E_STATE);
+    assert(deferred_start_count_call == 1);
+}
+
+static void test_fwk_module_deferred_start_error(void)
+{
+    int status;
+
+    deferred_start_return_val = FWK_E_DEVICE;
+
+    status = fwk_module_deferred_start();
+    assert(status == FWK_E_DEVICE);
+    assert(deferred_start_count_call == 1);
+}
+
 static const struct fwk_test_case_desc test_case_table[] = {
     FWK_TEST_CASE(test_fwk_module_is_valid_module_id),
     FWK_TEST_CASE(test_fwk_module_is_valid_event_id),
     FWK_TEST_CASE(test_fwk_module_is_valid_notification_id),
+    FWK_TEST_CASE(test_fwk_module_deferred_start),
+    FWK_TEST_CASE(test_fwk_module_deferred_start_error),
 };
 
 struct fwk_test_suite_desc test_suite = {
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 #define MOD_BOOTLOADER_H
 
 #include <fwk_element.h>
+#include <fwk_id.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -26,6 +27,84 @@
  * \{
  */
 
+/*!
+ * \brief Copy engine interface.
+ *
+ * \details Optional interface of a copy engine (e.g. a DMA controller) used
+ *      by the bootloader to copy the image in bursts. See
+ *      ::mod_bootloader_config::burst_size.
+ */
+struct mod_bootloader_copy_api {
+    /*!
+     * \brief Start copying a burst of data.
+     *
+     * \param id Identifier of the copy engine.
+     * \param destination Destination address, aligned to 4 bytes.
+     * \param source Source address, aligned to 4 bytes.
+     * \param size Number of bytes to copy.
+     *
+     * \retval ::FWK_SUCCESS The copy has been started.
+     * \return One of the standard framework error codes.
+     */
+    int (*start)(
+        fwk_id_t id,
+        void *destination,
+        const void *source,
+        size_t size);
+
+    /*!
+     * \brief Wait for the completion of the copy started last.
+     *
+     * \param id Identifier of the copy engine.
+     *
+     * \retval ::FWK_SUCCESS The copy has completed.
+     * \return One of the standard framework error codes.
+     */
+    int (*wait)(fwk_id_t id);
+};
+
+/*!
+ * \brief Image verification interface.
+ *
+ * \details Optional interface computing a checksum or hash of the image as
+ *      it is copied, and checking it once the whole image has been copied.
+ */
+struct mod_bootloader_verify_api {
+    /*!
+     * \brief Start the verification of an image.
+     *
+     * \param id Identifier of the verification entity.
+     * \param size Size of the image in bytes.
+     *
+     * \retval ::FWK_SUCCESS The verification has been started.
+     * \return One of the standard framework error codes.
+     */
+    int (*start)(fwk_id_t id, size_t size);
+
+    /*!
+     * \brief Add the next part of the image to the verification.
+     *
+     * \param id Identifier of the verification entity.
+     * \param data Next part of the image, at its destination.
+     * \param size Size of the part in bytes.
+     *
+     * \retval ::FWK_SUCCESS The part has been added.
+     * \return One of the standard framework error codes.
+     */
+    int (*update)(fwk_id_t id, const void *data, size_t size);
+
+    /*!
+     * \brief Complete the verification of the image.
+     *
+     * \param id Identifier of the verification entity.
+     *
+     * \retval ::FWK_SUCCESS The image is valid.
+     * \retval ::FWK_E_DATA The image is not valid.
+     * \return One of the standard framework error codes.
+     */
+    int (*finish)(fwk_id_t id);
+};
+
 /*!
  * \brief Module configuration.
  */
@@ -58,6 +137,49 @@ struct mod_bootloader_config {
      */
     uint32_t destination_size;
 
+    /*!
+     * \brief Size of the bursts in which the image is copied, in bytes.
+     *
+     * \details When zero, the image is copied by the boot routine right before
+     *      jumping to it. This is always safe, even if the destination overlaps
+     *      memory used by the bootloader.
+     *
+     *      When non-zero, the image is copied by the bootloader in bursts of
+     *      this size, through the copy engine if there is one, and each burst
+     *      is verified while the next one is being copied. This must only be
+     *      used if the destination does not overlap memory used by the
+     *      bootloader. The burst size must be a multiple of 4.
+     */
+    uint32_t burst_size;
+
+    /*!
+     * \brief Identifier of the copy engine. Leave unset or use ::FWK_ID_NONE
+     *      to copy with the processor.
+     *
+     * \details Only used when ::mod_bootloader_config::burst_size is not zero.
+     */
+    fwk_id_t copy_id;
+
+    /*!
+     * \brief Identifier of the ::mod_bootloader_copy_api API of the copy
+     *      engine.
+     */
+    fwk_id_t copy_api_id;
+
+    /*!
+     * \brief Identifier of the entity verifying the image. Leave unset or use
+     *      ::FWK_ID_NONE to skip the verification.
+     *
+     * \details Only used when ::mod_bootloader_config::burst_size is not zero.
+     */
+    fwk_id_t verify_id;
+
+    /*!
+     * \brief Identifier of the ::mod_bootloader_verify_api API of the entity
+     *      verifying the image.
+     */
+    fwk_id_t verify_api_id;
+
 #ifdef BUILD_HAS_MOD_SDS
     /*!
      * Identifier of the SDS structure containing image metadata, such as the
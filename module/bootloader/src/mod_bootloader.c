@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -10,6 +10,7 @@
 #include <fwk_id.h>
 #include <fwk_interrupt.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_noreturn.h>
@@ -18,6 +19,7 @@
 #include <fmw_cmsis.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -43,10 +45,93 @@ struct bootloader_ctx {
 #ifdef BUILD_HAS_MOD_SDS
     const struct mod_sds_api *sds_api;
 #endif
+
+    /* Copy engine API, or NULL if bursts are copied by the processor */
+    const struct mod_bootloader_copy_api *copy_api;
+
+    /* Verification API, or NULL if the image is not verified */
+    const struct mod_bootloader_verify_api *verify_api;
 };
 
 static struct bootloader_ctx mod_bootloader_ctx;
 
+/*
+ * Copy the image in bursts, verifying each burst while the next one is being
+ * copied.
+ */
+static int stream_image(
+    uint8_t *destination,
+    const uint8_t *source,
+    size_t size)
+{
+    const struct mod_bootloader_config *config =
+        mod_bootloader_ctx.module_config;
+    const struct mod_bootloader_copy_api *copy_api =
+        mod_bootloader_ctx.copy_api;
+    const struct mod_bootloader_verify_api *verify_api =
+        mod_bootloader_ctx.verify_api;
+    int status;
+    size_t offset = 0;
+    size_t burst;
+    size_t last_offset = 0;
+    size_t last_burst = 0;
+
+    if (verify_api != NULL) {
+        status = verify_api->start(config->verify_id, size);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    while (offset < size) {
+        burst = FWK_MIN((size_t)config->burst_size, size - offset);
+
+        if (copy_api != NULL) {
+            status = copy_api->start(
+                config->copy_id, destination + offset, source + offset, burst);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        } else {
+            memcpy(destination + offset, source + offset, burst);
+        }
+
+        /* Verify the previous burst while the current one is in flight */
+        if ((verify_api != NULL) && (last_burst != 0)) {
+            status = verify_api->update(
+                config->verify_id, destination + last_offset, last_burst);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+
+        if (copy_api != NULL) {
+            status = copy_api->wait(config->copy_id);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+
+        last_offset = offset;
+        last_burst = burst;
+        offset += burst;
+    }
+
+    if (verify_api == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    if (last_burst != 0) {
+        status = verify_api->update(
+            config->verify_id, destination + last_offset, last_burst);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    return verify_api->finish(config->verify_id);
+}
+
 /*
  * Module API
  */
@@ -67,6 +152,7 @@ static int load_image(void)
     uint32_t zero_flag = 0;
 #endif
 
+    int copy_status;
     const uint8_t *image_base;
     uint32_t image_size;
 
@@ -173,6 +259,20 @@ static int load_image(void)
         }
     }
 
+    if (mod_bootloader_ctx.module_config->burst_size != 0) {
+        copy_status = stream_image(
+            (uint8_t *)mod_bootloader_ctx.module_config->destination_base,
+            image_base,
+            image_size);
+        if (copy_status != FWK_SUCCESS) {
+            FWK_LOG_ERR("[BOOTLOADER] Image load failed");
+            return copy_status;
+        }
+
+        /* The image is in place, the boot routine has nothing left to copy */
+        image_size = 0;
+    }
+
     (void)
         fwk_interrupt_global_disable(); /* We are relocating the vector table */
 
@@ -197,16 +297,23 @@ static const struct mod_bootloader_api bootloader_api = {
 static int bootloader_init(fwk_id_t module_id, unsigned int element_count,
     const void *data)
 {
+    const struct mod_bootloader_config *config = data;
+
+    if ((config != NULL) && ((config->burst_size % 4) != 0)) {
+        return FWK_E_PARAM;
+    }
+
     /* Store a pointer to the module config within the module context */
-    mod_bootloader_ctx.module_config = data;
+    mod_bootloader_ctx.module_config = config;
 
     return FWK_SUCCESS;
 }
 
-#ifdef BUILD_HAS_MOD_SDS
 static int bootloader_bind(fwk_id_t id, unsigned int call_number)
 {
-    int status;
+    const struct mod_bootloader_config *config =
+        mod_bootloader_ctx.module_config;
+    int status = FWK_SUCCESS;
 
     /* Only the first round of binding is used (round number is zero-indexed) */
     if (call_number == 1) {
@@ -218,14 +325,39 @@ static int bootloader_bind(fwk_id_t id, unsigned int call_number)
         return FWK_SUCCESS;
     }
 
+#ifdef BUILD_HAS_MOD_SDS
     status = fwk_module_bind(
         FWK_ID_MODULE(FWK_MODULE_IDX_SDS),
         FWK_ID_API(FWK_MODULE_IDX_SDS, 0),
         &mod_bootloader_ctx.sds_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+    if ((config == NULL) || (config->burst_size == 0)) {
+        return status;
+    }
+
+    if (fwk_module_is_valid_entity_id(config->copy_id)) {
+        status = fwk_module_bind(
+            config->copy_id,
+            config->copy_api_id,
+            &mod_bootloader_ctx.copy_api);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (fwk_module_is_valid_entity_id(config->verify_id)) {
+        status = fwk_module_bind(
+            config->verify_id,
+            config->verify_api_id,
+            &mod_bootloader_ctx.verify_api);
+    }
 
     return status;
 }
-#endif
 
 static int bootloader_process_bind_request(fwk_id_t requester_id, fwk_id_t id,
     fwk_id_t api_id, const void **api)
@@ -247,9 +379,6 @@ const struct fwk_module module_bootloader = {
     .api_count = 1,
     .event_count = 0,
     .init = bootloader_init,
-    .process_bind_request = bootloader_process_bind_request,
-
-#ifdef BUILD_HAS_MOD_SDS
     .bind = bootloader_bind,
-#endif
+    .process_bind_request = bootloader_process_bind_request,
 };
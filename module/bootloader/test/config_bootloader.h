@@ -0,0 +1,35 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_bootloader.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+/* Size of the fake image, not a multiple of the burst size */
+#define FAKE_IMAGE_SIZE 40
+
+#define FAKE_BURST_SIZE 16
+
+/* Number of bursts needed to copy the fake image */
+#define FAKE_BURST_COUNT \
+    ((FAKE_IMAGE_SIZE + FAKE_BURST_SIZE - 1) / FAKE_BURST_SIZE)
+
+static uint8_t fake_source[FAKE_IMAGE_SIZE];
+static uint8_t fake_destination[FAKE_IMAGE_SIZE];
+
+static const struct mod_bootloader_config fake_bootloader_config = {
+    .source_base = (uintptr_t)fake_source,
+    .source_size = sizeof(fake_source),
+    .destination_base = (uintptr_t)fake_destination,
+    .destination_size = sizeof(fake_destination),
+    .burst_size = FAKE_BURST_SIZE,
+    .copy_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_FAKE_COPY),
+    .copy_api_id = FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_COPY, 0),
+    .verify_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_FAKE_VERIFY),
+    .verify_api_id = FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_VERIFY, 0),
+};
@@ -0,0 +1,22 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FMW_CMSIS_H
+#define TEST_FMW_CMSIS_H
+
+#include <stdint.h>
+
+/* System control block, only the vector table offset is used */
+typedef struct {
+    volatile uint32_t VTOR;
+} SCB_Type;
+
+static SCB_Type fake_scb;
+
+#define SCB (&fake_scb)
+
+#endif /* TEST_FMW_CMSIS_H */
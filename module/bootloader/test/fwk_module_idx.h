@@ -0,0 +1,29 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FWK_MODULE_MODULE_IDX_H
+#define TEST_FWK_MODULE_MODULE_IDX_H
+
+#include <fwk_id.h>
+
+enum fwk_module_idx {
+    FWK_MODULE_IDX_BOOTLOADER,
+    FWK_MODULE_IDX_FAKE_COPY,
+    FWK_MODULE_IDX_FAKE_VERIFY,
+    FWK_MODULE_IDX_COUNT,
+};
+
+static const fwk_id_t fwk_module_id_bootloader =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_BOOTLOADER);
+
+static const fwk_id_t fwk_module_id_fake_copy =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_FAKE_COPY);
+
+static const fwk_id_t fwk_module_id_fake_verify =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_FAKE_VERIFY);
+
+#endif /* TEST_FWK_MODULE_MODULE_IDX_H */
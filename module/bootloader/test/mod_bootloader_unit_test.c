@@ -0,0 +1,360 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <mod_bootloader.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include <setjmp.h>
+
+#include UNIT_TEST_SRC
+#include "config_bootloader.h"
+
+/* Operations of the fake copy engine and verification entity */
+enum fake_op_type {
+    FAKE_OP_COPY_START,
+    FAKE_OP_COPY_WAIT,
+    FAKE_OP_VERIFY_START,
+    FAKE_OP_VERIFY_UPDATE,
+    FAKE_OP_VERIFY_FINISH,
+};
+
+struct fake_op {
+    enum fake_op_type type;
+    size_t offset;
+    size_t size;
+};
+
+/* Maximum number of operations a test can record */
+#define FAKE_OP_COUNT_MAX 16
+
+static struct fake_op fake_ops[FAKE_OP_COUNT_MAX];
+static unsigned int fake_op_count;
+
+/* Operation number failing with fake_op_fail_status, if not FAKE_OP_COUNT_MAX */
+static unsigned int fake_op_fail_idx;
+static int fake_op_fail_status;
+
+static struct mod_bootloader_config test_config;
+
+/* Arguments of the boot routine, which returns to the test */
+static jmp_buf boot_env;
+static bool boot_called;
+static size_t boot_size;
+
+noreturn void mod_bootloader_boot(
+    uint8_t *destination,
+    const uint8_t *source,
+    size_t size,
+    volatile uint32_t *vtor)
+{
+    boot_called = true;
+    boot_size = size;
+
+    longjmp(boot_env, 1);
+}
+
+static int fake_op_record(enum fake_op_type type, size_t offset, size_t size)
+{
+    unsigned int idx = fake_op_count++;
+
+    TEST_ASSERT_LESS_THAN(FAKE_OP_COUNT_MAX, idx);
+
+    fake_ops[idx].type = type;
+    fake_ops[idx].offset = offset;
+    fake_ops[idx].size = size;
+
+    return (idx == fake_op_fail_idx) ? fake_op_fail_status : FWK_SUCCESS;
+}
+
+static void fake_op_check(
+    unsigned int idx,
+    enum fake_op_type type,
+    size_t offset,
+    size_t size)
+{
+    TEST_ASSERT_EQUAL(type, fake_ops[idx].type);
+    TEST_ASSERT_EQUAL(offset, fake_ops[idx].offset);
+    TEST_ASSERT_EQUAL(size, fake_ops[idx].size);
+}
+
+static int fake_copy_start(
+    fwk_id_t id,
+    void *destination,
+    const void *source,
+    size_t size)
+{
+    memcpy(destination, source, size);
+
+    return fake_op_record(
+        FAKE_OP_COPY_START,
+        (size_t)((uint8_t *)destination - fake_destination),
+        size);
+}
+
+static int fake_copy_wait(fwk_id_t id)
+{
+    return fake_op_record(FAKE_OP_COPY_WAIT, 0, 0);
+}
+
+static int fake_verify_start(fwk_id_t id, size_t size)
+{
+    return fake_op_record(FAKE_OP_VERIFY_START, 0, size);
+}
+
+static int fake_verify_update(fwk_id_t id, const void *data, size_t size)
+{
+    /* The burst being verified has been fully copied */
+    TEST_ASSERT_EQUAL_MEMORY(
+        fake_source + ((const uint8_t *)data - fake_destination), data, size);
+
+    return fake_op_record(
+        FAKE_OP_VERIFY_UPDATE,
+        (size_t)((const uint8_t *)data - fake_destination),
+        size);
+}
+
+static int fake_verify_finish(fwk_id_t id)
+{
+    return fake_op_record(FAKE_OP_VERIFY_FINISH, 0, 0);
+}
+
+static const struct mod_bootloader_copy_api fake_copy_api = {
+    .start = fake_copy_start,
+    .wait = fake_copy_wait,
+};
+
+static const struct mod_bootloader_verify_api fake_verify_api = {
+    .start = fake_verify_start,
+    .update = fake_verify_update,
+    .finish = fake_verify_finish,
+};
+
+void setUp(void)
+{
+    unsigned int i;
+    int status;
+
+    for (i = 0; i < FAKE_IMAGE_SIZE; i++) {
+        fake_source[i] = (uint8_t)(i + 1);
+    }
+    memset(fake_destination, 0, sizeof(fake_destination));
+
+    memset(fake_ops, 0, sizeof(fake_ops));
+    fake_op_count = 0;
+    fake_op_fail_idx = FAKE_OP_COUNT_MAX;
+    fake_op_fail_status = FWK_SUCCESS;
+
+    boot_called = false;
+    boot_size = 0;
+
+    test_config = fake_bootloader_config;
+
+    memset(&mod_bootloader_ctx, 0, sizeof(mod_bootloader_ctx));
+    status = bootloader_init(fwk_module_id_bootloader, 0, &test_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    mod_bootloader_ctx.copy_api = &fake_copy_api;
+    mod_bootloader_ctx.verify_api = &fake_verify_api;
+}
+
+void tearDown(void)
+{
+}
+
+void test_bootloader_init_unaligned_burst(void)
+{
+    int status;
+
+    test_config.burst_size = FAKE_BURST_SIZE + 2;
+
+    status = bootloader_init(fwk_module_id_bootloader, 0, &test_config);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_bootloader_bind_copy_and_verify(void)
+{
+    int status;
+
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(false);
+    fwk_module_is_valid_entity_id_ExpectAnyArgsAndReturn(true);
+    fwk_module_bind_ExpectAndReturn(
+        test_config.copy_id,
+        test_config.copy_api_id,
+        &mod_bootloader_ctx.copy_api,
+        FWK_SUCCESS);
+    fwk_module_is_valid_entity_id_ExpectAnyArgsAndReturn(true);
+    fwk_module_bind_ExpectAndReturn(
+        test_config.verify_id,
+        test_config.verify_api_id,
+        &mod_bootloader_ctx.verify_api,
+        FWK_SUCCESS);
+
+    status = bootloader_bind(fwk_module_id_bootloader, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_bootloader_bind_no_burst(void)
+{
+    int status;
+
+    test_config.burst_size = 0;
+
+    fwk_module_is_valid_element_id_ExpectAnyArgsAndReturn(false);
+
+    status = bootloader_bind(fwk_module_id_bootloader, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_stream_image_processor_copy(void)
+{
+    int status;
+
+    mod_bootloader_ctx.copy_api = NULL;
+    mod_bootloader_ctx.verify_api = NULL;
+
+    status = stream_image(fake_destination, fake_source, FAKE_IMAGE_SIZE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_MEMORY(fake_source, fake_destination, FAKE_IMAGE_SIZE);
+    TEST_ASSERT_EQUAL(0, fake_op_count);
+}
+
+void test_stream_image_overlaps_copy_and_verify(void)
+{
+    int status;
+    unsigned int idx = 0;
+
+    status = stream_image(fake_destination, fake_source, FAKE_IMAGE_SIZE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_MEMORY(fake_source, fake_destination, FAKE_IMAGE_SIZE);
+
+    /* Each burst is verified while the next one is being copied */
+    fake_op_check(idx++, FAKE_OP_VERIFY_START, 0, FAKE_IMAGE_SIZE);
+    fake_op_check(idx++, FAKE_OP_COPY_START, 0, FAKE_BURST_SIZE);
+    fake_op_check(idx++, FAKE_OP_COPY_WAIT, 0, 0);
+    fake_op_check(idx++, FAKE_OP_COPY_START, FAKE_BURST_SIZE, FAKE_BURST_SIZE);
+    fake_op_check(idx++, FAKE_OP_VERIFY_UPDATE, 0, FAKE_BURST_SIZE);
+    fake_op_check(idx++, FAKE_OP_COPY_WAIT, 0, 0);
+    fake_op_check(
+        idx++,
+        FAKE_OP_COPY_START,
+        2 * FAKE_BURST_SIZE,
+        FAKE_IMAGE_SIZE - (2 * FAKE_BURST_SIZE));
+    fake_op_check(
+        idx++, FAKE_OP_VERIFY_UPDATE, FAKE_BURST_SIZE, FAKE_BURST_SIZE);
+    fake_op_check(idx++, FAKE_OP_COPY_WAIT, 0, 0);
+
+    /* The last burst is verified once it has been copied */
+    fake_op_check(
+        idx++,
+        FAKE_OP_VERIFY_UPDATE,
+        2 * FAKE_BURST_SIZE,
+        FAKE_IMAGE_SIZE - (2 * FAKE_BURST_SIZE));
+    fake_op_check(idx++, FAKE_OP_VERIFY_FINISH, 0, 0);
+
+    TEST_ASSERT_EQUAL(idx, fake_op_count);
+}
+
+void test_stream_image_copy_error(void)
+{
+    int status;
+
+    /* Fail the start of the second burst */
+    fake_op_fail_idx = 3;
+    fake_op_fail_status = FWK_E_DEVICE;
+
+    status = stream_image(fake_destination, fake_source, FAKE_IMAGE_SIZE);
+    TEST_ASSERT_EQUAL(FWK_E_DEVICE, status);
+    fake_op_check(3, FAKE_OP_COPY_START, FAKE_BURST_SIZE, FAKE_BURST_SIZE);
+
+    /* Nothing is verified or copied after the failure */
+    TEST_ASSERT_EQUAL(4, fake_op_count);
+}
+
+void test_load_image_streamed(void)
+{
+    int status = FWK_SUCCESS;
+
+    if (setjmp(boot_env) == 0) {
+        status = load_image();
+    }
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(boot_called);
+
+    /* The image is already in place, the boot routine copies nothing */
+    TEST_ASSERT_EQUAL(0, boot_size);
+    TEST_ASSERT_EQUAL_MEMORY(fake_source, fake_destination, FAKE_IMAGE_SIZE);
+}
+
+void test_load_image_verify_error(void)
+{
+    int status = FWK_SUCCESS;
+
+    /*
+     * Fail the verification of the whole image, which follows the start of
+     * the verification and the copy, wait and update of every burst.
+     */
+    fake_op_fail_idx = (3 * FAKE_BURST_COUNT) + 1;
+    fake_op_fail_status = FWK_E_DATA;
+
+    if (setjmp(boot_env) == 0) {
+        status = load_image();
+    }
+
+    TEST_ASSERT_EQUAL(FWK_E_DATA, status);
+    TEST_ASSERT_FALSE(boot_called);
+    fake_op_check(fake_op_fail_idx, FAKE_OP_VERIFY_FINISH, 0, 0);
+}
+
+void test_load_image_not_streamed(void)
+{
+    int status = FWK_SUCCESS;
+
+    test_config.burst_size = 0;
+
+    if (setjmp(boot_env) == 0) {
+        status = load_image();
+    }
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(boot_called);
+
+    /* The boot routine copies the whole image */
+    TEST_ASSERT_EQUAL(FAKE_IMAGE_SIZE, boot_size);
+    TEST_ASSERT_EQUAL(0, fake_op_count);
+}
+
+int bootloader_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bootloader_init_unaligned_burst);
+    RUN_TEST(test_bootloader_bind_copy_and_verify);
+    RUN_TEST(test_bootloader_bind_no_burst);
+    RUN_TEST(test_stream_image_processor_copy);
+    RUN_TEST(test_stream_image_overlaps_copy_and_verify);
+    RUN_TEST(test_stream_image_copy_error);
+    RUN_TEST(test_load_image_streamed);
+    RUN_TEST(test_load_image_verify_error);
+    RUN_TEST(test_load_image_not_streamed);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return bootloader_test_main();
+}
+#endif
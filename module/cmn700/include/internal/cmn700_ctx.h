@@ -18,6 +18,18 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+struct cmn700_topology_cache;
+struct ccg_link_state;
+
+/* Non-hashed region programmed in the RN-SAMs */
+struct cmn700_io_region {
+    /* Base address of the region */
+    uint64_t base;
+
+    /* Identifier of the target node */
+    unsigned int node_id;
+};
+
 struct cmn700_device_ctx {
     const struct mod_cmn700_config *config;
 
@@ -74,6 +86,9 @@ struct cmn700_device_ctx {
      */
     struct ccla_reg_tuple *ccla_reg_table;
 
+    /* State of the CCG links, used to bring them up in parallel */
+    struct ccg_link_state *ccg_link_table;
+
     /*
      * remote_rnf_ldid_value keeps track of the ldid of the remote RNF agents
      * which are to be programmed on the HNF's RN_PHYS_ID registers.
@@ -88,11 +103,26 @@ struct cmn700_device_ctx {
     /* Count of IO regions programmed in SAM table */
     unsigned int region_io_count;
 
+    /*
+     * IO regions programmed in SAM table, indexed by region index. Used to
+     * look up mapped regions without reading back the RN-SAM registers.
+     */
+    struct cmn700_io_region *io_region_table;
+
     /* Count of system cache regions programmed in SAM table */
     unsigned int region_sys_count;
 
     /* Flags to indicate SCG region init status. */
     unsigned int scg_regions_enabled[MAX_SCG_COUNT];
+
+    /* Topology cache in retained memory, NULL if not used */
+    struct cmn700_topology_cache *topology_cache;
+
+    /* Whether the topology cache describes the mesh */
+    bool topology_valid;
+
+    /* Whether the topology did not fit in the topology cache */
+    bool topology_overflow;
 };
 
 #endif /* INTERNAL_CMN700_CTX_H */
@@ -377,6 +377,23 @@ struct mod_cmn700_config {
     /*! Hierarchical hashing configuration */
     struct mod_cmn700_hierarchical_hashing hierarchical_hashing_config;
 
+    /*!
+     * \brief Optimize the layout of the system cache groups.
+     *
+     * \details When set, the HN-Fs of each system cache group are ordered
+     *      using the positions found during the discovery so that the
+     *      hierarchical hashing clusters are compact in the mesh. The
+     *      membership of the groups is still given by the memory region map.
+     *      The average and worst-case hop distance from the RN-SAMs to their
+     *      closest cluster are logged for the configured and optimized
+     *      layouts.
+     *
+     * \note Not supported with a multiple SN-F mode in
+     *      ::mod_cmn700_hierarchical_hashing::sn_mode, as the SN-Fs of a
+     *      cluster are selected from the HN-F logical identifiers.
+     */
+    bool hnf_scg_layout_optimize;
+
     /*! Table of region memory map entries */
     const struct mod_cmn700_mem_region_map *mmap_table;
 
@@ -405,6 +422,26 @@ struct mod_cmn700_config {
      * a CAL port, node id of HN-F will be a odd number).
      */
     bool hnf_cal_mode;
+
+    /*!
+     * \brief Base address of the topology cache.
+     *
+     * \details Retained memory in which the topology found by the discovery
+     *      at cold boot is stored. On warm boot and resume, the topology is
+     *      restored from this memory if it matches the root configuration
+     *      registers of the mesh, skipping the discovery. Zero to always run
+     *      the discovery.
+     */
+    uintptr_t topology_cache_base;
+
+    /*!
+     * \brief Size of the topology cache in bytes.
+     *
+     * \details Each node of interest of the mesh (RN-SAM, HN-F and CCG nodes)
+     *      takes 16 bytes, in addition to a 28-byte header. If the topology
+     *      does not fit, it is not cached.
+     */
+    size_t topology_cache_size;
 };
 
 /*!
@@ -245,74 +245,13 @@ bool is_region_aligned(
     return ((mmap->base & ~lsb_addr_mask) & (mmap->size & ~lsb_addr_mask)) == 0;
 }
 
-bool is_non_hash_region_mapped(
+static void get_region_regs(
     struct cmn700_rnsam_reg *rnsam,
-    uint32_t region_io_count,
-    struct mod_cmn700_mem_region_map *mmap,
-    uint32_t *region_index)
-{
-    int idx;
-    unsigned int programmed_node_id;
-    uint32_t group;
-    uint32_t bit_pos;
-    volatile uint64_t *reg;
-    uint64_t lsb_addr_mask;
-
-    lsb_addr_mask =
-        get_rnsam_lsb_addr_mask(rnsam, SAM_TYPE_NON_HASH_MEM_REGION);
-
-    for (idx = region_io_count - 1; idx >= 0; idx--) {
-        reg = &rnsam->NON_HASH_MEM_REGION[idx];
-        if (mmap->base == (*reg & ~lsb_addr_mask)) {
-            group = idx / CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRIES_PER_GROUP;
-            bit_pos = CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_BITS_WIDTH *
-                (idx % CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRIES_PER_GROUP);
-            programmed_node_id =
-                (rnsam->NON_HASH_TGT_NODEID[group] >> bit_pos) &
-                CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK;
-            mmap->node_id &= CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK;
-
-            if (programmed_node_id == mmap->node_id) {
-                FWK_LOG_INFO(
-                    MOD_NAME "Found region: %d mapped for Node: %u ",
-                    idx,
-                    mmap->node_id);
-                *region_index = idx;
-
-                return true;
-            } else {
-                FWK_LOG_ERR(
-                    MOD_NAME
-                    "Address: 0x%llx mapped to different node id:"
-                    " %u than expected: %u\n",
-                    mmap->base,
-                    programmed_node_id,
-                    mmap->node_id);
-                fwk_unexpected();
-            }
-        }
-    }
-
-    return false;
-}
-
-void configure_region(
-    void *rnsam_reg,
     unsigned int region_idx,
-    uint64_t base,
-    uint64_t size,
-    enum sam_node_type node_type,
-    enum sam_type sam_type)
+    enum sam_type sam_type,
+    volatile uint64_t **reg,
+    volatile uint64_t **reg_cfg2)
 {
-    bool prog_start_and_end_addr;
-    uint64_t lsb_addr_mask;
-    uint64_t value;
-    struct cmn700_rnsam_reg *rnsam = rnsam_reg;
-    volatile uint64_t *reg;
-    volatile uint64_t *reg_cfg2;
-
-    fwk_assert(rnsam_reg);
-
     if (sam_type == SAM_TYPE_NON_HASH_MEM_REGION) {
         if (region_idx >= MAX_NON_HASH_MEM_COUNT) {
             FWK_LOG_ERR(
@@ -325,15 +264,15 @@ void configure_region(
         }
 
         if (region_idx < NON_HASH_MEM_REG_COUNT) {
-            reg = &rnsam->NON_HASH_MEM_REGION[region_idx];
-            reg_cfg2 = &rnsam->NON_HASH_MEM_REGION_CFG2[region_idx];
+            *reg = &rnsam->NON_HASH_MEM_REGION[region_idx];
+            *reg_cfg2 = &rnsam->NON_HASH_MEM_REGION_CFG2[region_idx];
         } else {
-            reg = &rnsam->NON_HASH_MEM_REGION_GRP2
-                       [region_idx - NON_HASH_MEM_REG_COUNT];
-            reg_cfg2 = &rnsam->NON_HASH_MEM_REGION_CFG2_GRP2
-                            [region_idx - NON_HASH_MEM_REG_COUNT];
+            *reg = &rnsam->NON_HASH_MEM_REGION_GRP2
+                        [region_idx - NON_HASH_MEM_REG_COUNT];
+            *reg_cfg2 = &rnsam->NON_HASH_MEM_REGION_CFG2_GRP2
+                             [region_idx - NON_HASH_MEM_REG_COUNT];
         }
-    } else if (sam_type == SAM_TYPE_SYS_CACHE_GRP_REGION) {
+    } else {
         if (region_idx >= MAX_SCG_COUNT) {
             FWK_LOG_ERR(
                 MOD_NAME
@@ -342,20 +281,32 @@ void configure_region(
                 MAX_SCG_COUNT);
             fwk_unexpected();
         }
-        reg = &rnsam->SYS_CACHE_GRP_REGION[region_idx];
-        reg_cfg2 = &rnsam->HASHED_TGT_GRP_CFG2_REGION[region_idx];
-    } else {
-        FWK_LOG_ERR(MOD_NAME "Unexpected sam_type!");
-        fwk_unexpected();
-        return;
+        *reg = &rnsam->SYS_CACHE_GRP_REGION[region_idx];
+        *reg_cfg2 = &rnsam->HASHED_TGT_GRP_CFG2_REGION[region_idx];
     }
+}
+
+void encode_region(
+    void *rnsam_reg,
+    uint64_t base,
+    uint64_t size,
+    enum sam_node_type node_type,
+    enum sam_type sam_type,
+    struct cmn700_region_entry *entry)
+{
+    uint64_t lsb_addr_mask;
+    struct cmn700_rnsam_reg *rnsam = rnsam_reg;
+
+    fwk_assert(rnsam_reg);
+    fwk_assert(entry);
 
     /* Check if the start and end address has to be programmed */
-    prog_start_and_end_addr = (sam_type == SAM_TYPE_NON_HASH_MEM_REGION) ?
+    entry->prog_start_and_end_addr =
+        (sam_type == SAM_TYPE_NON_HASH_MEM_REGION) ?
         get_rnsam_nonhash_range_comp_en_mode(rnsam) :
         get_rnsam_htg_range_comp_en_mode(rnsam);
 
-    if ((!prog_start_and_end_addr) && ((base % size) != 0)) {
+    if ((!entry->prog_start_and_end_addr) && ((base % size) != 0)) {
         FWK_LOG_ERR(
             MOD_NAME "Base: 0x%" PRIx64 " should align with Size: 0x%" PRIx64,
             base,
@@ -366,21 +317,61 @@ void configure_region(
     /* Get the LSB mask from LSB bit position defining minimum region size */
     lsb_addr_mask = get_rnsam_lsb_addr_mask(rnsam, sam_type);
 
-    value = CMN700_RNSAM_REGION_ENTRY_VALID;
-    value |= node_type << CMN700_RNSAM_REGION_ENTRY_TYPE_POS;
+    entry->sam_type = sam_type;
+    entry->value = CMN700_RNSAM_REGION_ENTRY_VALID;
+    entry->value |= node_type << CMN700_RNSAM_REGION_ENTRY_TYPE_POS;
 
-    if (prog_start_and_end_addr) {
-        value |= (base & ~lsb_addr_mask);
-        *reg = value;
-        *reg_cfg2 = (base + size - 1) & ~lsb_addr_mask;
+    if (entry->prog_start_and_end_addr) {
+        entry->value |= (base & ~lsb_addr_mask);
+        entry->end = (base + size - 1) & ~lsb_addr_mask;
     } else {
-        value |= sam_encode_region_size(size)
+        entry->value |= sam_encode_region_size(size)
             << CMN700_RNSAM_REGION_ENTRY_SIZE_POS;
-        value |= (base / SAM_GRANULARITY) << CMN700_RNSAM_REGION_ENTRY_BASE_POS;
-        *reg = value;
+        entry->value |= (base / SAM_GRANULARITY)
+            << CMN700_RNSAM_REGION_ENTRY_BASE_POS;
+        entry->end = 0;
+    }
+}
+
+void write_region(
+    void *rnsam_reg,
+    unsigned int region_idx,
+    const struct cmn700_region_entry *entry)
+{
+    volatile uint64_t *reg;
+    volatile uint64_t *reg_cfg2;
+
+    fwk_assert(rnsam_reg);
+
+    get_region_regs(rnsam_reg, region_idx, entry->sam_type, &reg, &reg_cfg2);
+
+    *reg = entry->value;
+    if (entry->prog_start_and_end_addr) {
+        *reg_cfg2 = entry->end;
     }
 }
 
+void configure_region(
+    void *rnsam_reg,
+    unsigned int region_idx,
+    uint64_t base,
+    uint64_t size,
+    enum sam_node_type node_type,
+    enum sam_type sam_type)
+{
+    struct cmn700_region_entry entry;
+
+    if ((sam_type != SAM_TYPE_NON_HASH_MEM_REGION) &&
+        (sam_type != SAM_TYPE_SYS_CACHE_GRP_REGION)) {
+        FWK_LOG_ERR(MOD_NAME "Unexpected sam_type!");
+        fwk_unexpected();
+        return;
+    }
+
+    encode_region(rnsam_reg, base, size, node_type, sam_type, &entry);
+    write_region(rnsam_reg, region_idx, &entry);
+}
+
 static const char *const type_to_name[] = {
     [NODE_TYPE_INVALID]     = "<Invalid>",
     [NODE_TYPE_DVM]         = "DVM",
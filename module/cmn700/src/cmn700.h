@@ -119,6 +119,24 @@ enum sam_node_type {
     SAM_NODE_TYPE_COUNT
 };
 
+/*
+ * Encoded RN-SAM region entry. All the RN-SAMs of the mesh are programmed with
+ * the same regions, so an entry is encoded once and written to each of them.
+ */
+struct cmn700_region_entry {
+    /* Type of the region register */
+    enum sam_type sam_type;
+
+    /* Value of the region register */
+    uint64_t value;
+
+    /* Value of the region end address register */
+    uint64_t end;
+
+    /* Whether the region end address register is used */
+    bool prog_start_and_end_addr;
+};
+
 enum sam_scg_index {
     SAM_SCG0 = 0,
     SAM_SCG1,
@@ -683,23 +701,40 @@ bool is_region_aligned(
     enum sam_type sam_type);
 
 /*
- * \brief Checks if a non-hashed region is already mapped by comparing the
- * base address and node id with the values programmed in the registers
+ * Encode a NON-HASH or SYS-CACHE memory region entry
  *
- * \param rnsam rnsam node
- * \param region_io_count Number of region mapped
- * \param mmap Region memory map information
- * \param region_index Placeholder to put region index where the region is
- *                     mapped
+ * \param rnsam_reg Pointer to the RNSAM register, used to read the RN-SAM
+ *      capabilities
+ * \param base Region base address
+ * \param size Region size
+ * \param node_type Type of the target node
+ * \param sam_type Type of the region register to program (NON-HASH or
+ * SYS-CACHE)
+ * \param[out] entry Encoded region entry
  *
- * \return true if region is found
- * \return false if region is not found
+ * \return None
  */
-bool is_non_hash_region_mapped(
-    struct cmn700_rnsam_reg *rnsam,
-    uint32_t region_io_count,
-    struct mod_cmn700_mem_region_map *mmap,
-    uint32_t *region_index);
+void encode_region(
+    void *rnsam_reg,
+    uint64_t base,
+    uint64_t size,
+    enum sam_node_type node_type,
+    enum sam_type sam_type,
+    struct cmn700_region_entry *entry);
+
+/*
+ * Write an encoded memory region entry to an RN-SAM
+ *
+ * \param rnsam_reg Pointer to the RNSAM register
+ * \param region_idx Index of the memory region
+ * \param entry Encoded region entry
+ *
+ * \return None
+ */
+void write_region(
+    void *rnsam_reg,
+    unsigned int region_idx,
+    const struct cmn700_region_entry *entry);
 
 /*
  * Configure a NON-HASH or SYS-CACHE memory region
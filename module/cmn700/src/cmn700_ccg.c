@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2021-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 
 #include <fwk_assert.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_math.h>
 
 #include <inttypes.h>
@@ -51,29 +52,22 @@ static unsigned int get_ldid(
     return ldid;
 }
 
-static bool ccg_link_wait_condition(void *data)
+static bool ccg_link_check_condition(
+    const struct ccg_link_state *link,
+    enum ccg_link_up_wait_cond cond)
 {
     bool ret;
     uint8_t linkid;
     uint64_t val1;
     uint64_t val2;
-    unsigned int ccg_ldid;
-    struct ccg_wait_condition_data *wait_data;
     struct cmn700_ccg_ra_reg *ccg_ra_reg;
     struct cmn700_ccg_ha_reg *ccg_ha_reg;
-    struct cmn700_device_ctx *ctx;
-
-    fwk_assert(data != NULL);
-
-    wait_data = (struct ccg_wait_condition_data *)data;
-    ctx = wait_data->ctx;
 
-    ccg_ldid = get_ldid(ctx, cmn700_ccg_ctx.is_prog_for_port_agg);
-    ccg_ra_reg = ctx->ccg_ra_reg_table[ccg_ldid].ccg_ra_reg;
-    ccg_ha_reg = ctx->ccg_ha_reg_table[ccg_ldid].ccg_ha_reg;
-    linkid = wait_data->linkid;
+    ccg_ra_reg = link->ccg_ra_reg;
+    ccg_ha_reg = link->ccg_ha_reg;
+    linkid = link->linkid;
 
-    switch (wait_data->cond) {
+    switch (cond) {
     case CCG_LINK_CTRL_EN_BIT_SET:
         val1 = ccg_ra_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL;
         val2 = ccg_ha_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL;
@@ -137,6 +131,154 @@ static bool ccg_link_wait_condition(void *data)
     return ret;
 }
 
+static void ccg_link_enter_step(
+    struct ccg_link_state *link,
+    const struct ccg_link_step *step)
+{
+    if (step->ra_ctrl_set_mask != 0) {
+        link->ccg_ra_reg->LINK_REGS[link->linkid].CCG_CCPRTCL_LINK_CTRL |=
+            step->ra_ctrl_set_mask;
+    }
+
+    if (step->ha_ctrl_set_mask != 0) {
+        link->ccg_ha_reg->LINK_REGS[link->linkid].CCG_CCPRTCL_LINK_CTRL |=
+            step->ha_ctrl_set_mask;
+    }
+}
+
+/*
+ * Advance every link through the sequence of steps as far as its status
+ * allows. Returns true once all the links have completed the sequence.
+ */
+static bool ccg_link_wait_condition(void *data)
+{
+    bool done;
+    unsigned int idx;
+    struct ccg_link_state *link;
+    struct ccg_wait_condition_data *wait_data;
+
+    fwk_assert(data != NULL);
+
+    wait_data = (struct ccg_wait_condition_data *)data;
+    done = true;
+
+    for (idx = 0; idx < wait_data->link_count; idx++) {
+        link = &wait_data->link[idx];
+
+        while ((link->step < wait_data->step_count) &&
+               ccg_link_check_condition(
+                   link, wait_data->step[link->step].cond)) {
+            link->step++;
+
+            if (link->step < wait_data->step_count) {
+                ccg_link_enter_step(link, &wait_data->step[link->step]);
+            }
+        }
+
+        if (link->step < wait_data->step_count) {
+            done = false;
+        }
+    }
+
+    return done;
+}
+
+/*
+ * Run a sequence of steps on all the links of the link table at once.
+ */
+static int ccg_link_run_sequence(
+    struct cmn700_device_ctx *ctx,
+    unsigned int link_count,
+    const struct ccg_link_step *step,
+    unsigned int step_count,
+    uint32_t step_timeout)
+{
+    int status;
+    unsigned int idx;
+    struct ccg_link_state *link;
+    struct ccg_wait_condition_data wait_data;
+
+    wait_data.link = ctx->ccg_link_table;
+    wait_data.link_count = link_count;
+    wait_data.step = step;
+    wait_data.step_count = step_count;
+
+    for (idx = 0; idx < link_count; idx++) {
+        link = &ctx->ccg_link_table[idx];
+        link->step = 0;
+        ccg_link_enter_step(link, &step[0]);
+    }
+
+    /*
+     * The links go through the steps independently of each other, so the
+     * whole sequence is bounded by the time the slowest link takes to go
+     * through all the steps.
+     */
+    status = ctx->timer_api->wait(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
+        step_timeout * step_count,
+        ccg_link_wait_condition,
+        &wait_data);
+    if (status != FWK_SUCCESS) {
+        for (idx = 0; idx < link_count; idx++) {
+            link = &ctx->ccg_link_table[idx];
+            if (link->step < step_count) {
+                FWK_LOG_ERR(
+                    MOD_NAME "CCG %u link %u: timeout at step %u",
+                    link->ccg_ldid,
+                    (unsigned int)link->linkid,
+                    (unsigned int)link->step);
+            }
+        }
+    }
+
+    return status;
+}
+
+/*
+ * Fill the link table with link 0 of the CCG gateways used by the CCG
+ * configuration table, including the ones used for port aggregation.
+ */
+static unsigned int ccg_link_table_init(
+    struct cmn700_device_ctx *ctx,
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count)
+{
+    bool program_for_port_aggregation;
+    unsigned int link_count;
+    unsigned int ccg_ldid;
+    size_t idx;
+    struct ccg_link_state *link;
+
+    link_count = 0;
+
+    for (idx = 0; idx < ccg_table_count; idx++) {
+        config = &ccg_config_table[idx];
+        program_for_port_aggregation = false;
+
+        do {
+            ccg_ldid = get_ldid(ctx, program_for_port_aggregation);
+
+            if (link_count >= ctx->ccg_node_count) {
+                FWK_LOG_ERR(MOD_NAME "Too many CCG links");
+                fwk_trap();
+            }
+
+            link = &ctx->ccg_link_table[link_count++];
+            link->ccg_ra_reg = ctx->ccg_ra_reg_table[ccg_ldid].ccg_ra_reg;
+            link->ccg_ha_reg = ctx->ccg_ha_reg_table[ccg_ldid].ccg_ha_reg;
+            link->ccg_ldid = ccg_ldid;
+
+            /* Current support enables Link 0 only */
+            link->linkid = 0;
+
+            program_for_port_aggregation = !program_for_port_aggregation;
+        } while (config->port_aggregate && program_for_port_aggregation);
+    }
+
+    return link_count;
+}
+
 static void program_ccg_ra_rnf_ldid_to_exp_raid_reg(
     struct cmn700_device_ctx *ctx,
     uint8_t ldid_value,
@@ -547,119 +689,50 @@ static void program_ccg_ra_sam_addr_region(
     }
 }
 
-static int enable_and_start_ccg_link_up_sequence(
-    struct cmn700_device_ctx *ctx,
-    uint8_t linkid)
-{
-    int status;
-    unsigned int ccg_ldid;
-    struct ccg_wait_condition_data wait_data;
-    struct cmn700_ccg_ra_reg *ccg_ra_reg;
-    struct cmn700_ccg_ha_reg *ccg_ha_reg;
-
-    ccg_ldid = get_ldid(ctx, cmn700_ccg_ctx.is_prog_for_port_agg);
-    ccg_ra_reg = ctx->ccg_ra_reg_table[ccg_ldid].ccg_ra_reg;
-    ccg_ha_reg = ctx->ccg_ha_reg_table[ccg_ldid].ccg_ha_reg;
-
-    if (linkid > 2) {
-        return FWK_E_PARAM;
-    }
-
-    wait_data.ctx = ctx;
-    wait_data.linkid = linkid;
-
-    FWK_LOG_INFO(MOD_NAME "Enabling CCG link %d...", linkid);
-    /* Set link enable bit to enable the CCG link */
-    ccg_ra_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-        CCG_LINK_CTRL_EN_MASK;
-    ccg_ha_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-        CCG_LINK_CTRL_EN_MASK;
-
-    /* Wait until link enable bits are set */
-    wait_data.cond = CCG_LINK_CTRL_EN_BIT_SET;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Enabling CCG link %d... Failed", linkid);
-        return status;
-    }
-    FWK_LOG_INFO(MOD_NAME "Enabling CCG link %d... Done", linkid);
-
-    FWK_LOG_INFO(MOD_NAME "Verifying link down status...");
-    /* Wait till link up bits are cleared in control register */
-    wait_data.cond = CCG_LINK_CTRL_UP_BIT_CLR;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Verifying link down status... Failed");
-        return status;
-    }
-
-    /* Wait till link down bits are set in status register */
-    wait_data.cond = CCG_LINK_STATUS_DWN_BIT_SET;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Verifying link down status... Failed");
-        return status;
-    }
-
-    /* Wait till link ACK bits are cleared in status register */
-    wait_data.cond = CCG_LINK_STATUS_ACK_BIT_CLR;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Verifying link down status... Failed");
-        return status;
-    }
-    FWK_LOG_INFO(MOD_NAME "Verifying link down status... Done");
-
-    FWK_LOG_INFO(MOD_NAME "Bringing up link...");
-    /* Bring up link using link request bit */
-    ccg_ra_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-        CCG_LINK_CTRL_REQ_MASK;
-    ccg_ha_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-        CCG_LINK_CTRL_REQ_MASK;
-
-    /* Wait till link ACK bits are set in status register */
-    wait_data.cond = CCG_LINK_STATUS_ACK_BIT_SET;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Bringing up link... Failed");
-        return status;
-    }
+/*
+ * Link up sequence. The link is enabled, checked to be down and then brought
+ * up using the link request bit.
+ */
+static const struct ccg_link_step ccg_link_up_sequence[] = {
+    {
+        .ra_ctrl_set_mask = CCG_LINK_CTRL_EN_MASK,
+        .ha_ctrl_set_mask = CCG_LINK_CTRL_EN_MASK,
+        .cond = CCG_LINK_CTRL_EN_BIT_SET,
+    },
+    {
+        .cond = CCG_LINK_CTRL_UP_BIT_CLR,
+    },
+    {
+        .cond = CCG_LINK_STATUS_DWN_BIT_SET,
+    },
+    {
+        .cond = CCG_LINK_STATUS_ACK_BIT_CLR,
+    },
+    {
+        .ra_ctrl_set_mask = CCG_LINK_CTRL_REQ_MASK,
+        .ha_ctrl_set_mask = CCG_LINK_CTRL_REQ_MASK,
+        .cond = CCG_LINK_STATUS_ACK_BIT_SET,
+    },
+    {
+        .cond = CCG_LINK_STATUS_DWN_BIT_CLR,
+    },
+};
 
-    /* Wait till link down bits are cleared in status register */
-    wait_data.cond = CCG_LINK_STATUS_DWN_BIT_CLR;
-    status = ctx->timer_api->wait(
-        FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-        CCG_CCPRTCL_LINK_CTRL_TIMEOUT,
-        ccg_link_wait_condition,
-        &wait_data);
-    if (status != FWK_SUCCESS) {
-        FWK_LOG_ERR(MOD_NAME "Bringing up link... Failed");
-        return status;
-    }
-    FWK_LOG_INFO(MOD_NAME "Bringing up link... Done");
+/* Enter system coherency by setting the CCHA DVMDOMAIN request bit */
+static const struct ccg_link_step ccg_system_coherency_sequence[] = {
+    {
+        .ha_ctrl_set_mask = CCG_LINK_CTRL_DVMDOMAIN_REQ_MASK,
+        .cond = CCG_LINK_STATUS_HA_DVMDOMAIN_ACK_BIT_SET,
+    },
+};
 
-    return FWK_SUCCESS;
-}
+/* Enter DVM domain by setting the CCRA DVMDOMAIN request bit */
+static const struct ccg_link_step ccg_dvm_domain_sequence[] = {
+    {
+        .ra_ctrl_set_mask = CCG_LINK_CTRL_DVMDOMAIN_REQ_MASK,
+        .cond = CCG_LINK_STATUS_RA_DVMDOMAIN_ACK_BIT_SET,
+    },
+};
 
 int ccg_setup(
     const unsigned int chip_id,
@@ -677,6 +750,8 @@ int ccg_setup(
     unsigned int i;
     unsigned int unique_remote_rnf_ldid_value;
 
+    status = FWK_SUCCESS;
+
     FWK_LOG_INFO(MOD_NAME "Programming CCG gateway...");
 
     /* Assign the max count among the RNs as local_ra_cnt */
@@ -793,9 +868,6 @@ int ccg_setup(
                 return status;
             }
         }
-        /* Program the Link Control registers present in CCRA/CCHA/CCLA */
-        status = enable_and_start_ccg_link_up_sequence(ctx, 0);
-
         if (config->port_aggregate && !cmn700_ccg_ctx.is_prog_for_port_agg) {
             cmn700_ccg_ctx.is_prog_for_port_agg = true;
             FWK_LOG_INFO(MOD_NAME
@@ -808,6 +880,37 @@ int ccg_setup(
     return status;
 }
 
+int ccg_link_up(
+    struct cmn700_device_ctx *ctx,
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count)
+{
+    int status;
+    unsigned int link_count;
+
+    link_count = ccg_link_table_init(ctx, ccg_config_table, ccg_table_count);
+
+    /*
+     * Program the Link Control registers present in CCRA/CCHA of all the
+     * links before polling any of them, so that the links are trained in
+     * parallel.
+     */
+    FWK_LOG_INFO(MOD_NAME "Bringing up %u CCG links...", link_count);
+    status = ccg_link_run_sequence(
+        ctx,
+        link_count,
+        ccg_link_up_sequence,
+        FWK_ARRAY_SIZE(ccg_link_up_sequence),
+        CCG_CCPRTCL_LINK_CTRL_TIMEOUT);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Bringing up CCG links... Failed");
+        return status;
+    }
+    FWK_LOG_INFO(MOD_NAME "Bringing up CCG links... Done");
+
+    return FWK_SUCCESS;
+}
+
 int ccg_exchange_protocol_credit(
     struct cmn700_device_ctx *ctx,
     const struct mod_cmn700_ccg_config *ccg_config)
@@ -852,112 +955,53 @@ int ccg_exchange_protocol_credit(
 
 int ccg_enter_system_coherency(
     struct cmn700_device_ctx *ctx,
-    const struct mod_cmn700_ccg_config *ccg_config)
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count)
 {
     int status;
-    int linkid;
-    unsigned int ccg_ldid;
-    struct ccg_wait_condition_data wait_data;
-    struct cmn700_ccg_ha_reg *ccg_ha_reg;
-
-    cmn700_ccg_ctx.is_prog_for_port_agg = false;
+    unsigned int link_count;
 
-    do {
-        config = ccg_config;
-        ccg_ldid = get_ldid(ctx, cmn700_ccg_ctx.is_prog_for_port_agg);
-        ccg_ha_reg = ctx->ccg_ha_reg_table[ccg_ldid].ccg_ha_reg;
-
-        /* Current support enables Link 0 only */
-        linkid = 0;
-
-        wait_data.ctx = ctx;
-        wait_data.linkid = linkid;
-
-        FWK_LOG_INFO(
-            MOD_NAME "Entering system coherency for link %d...", linkid);
-        /* Enter system coherency by setting DVMDOMAIN request bit */
-        ccg_ha_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-            CCG_LINK_CTRL_DVMDOMAIN_REQ_MASK;
-
-        /* Wait till DVMDOMAIN ACK bit is set in status register */
-        wait_data.cond = CCG_LINK_STATUS_HA_DVMDOMAIN_ACK_BIT_SET;
-        status = ctx->timer_api->wait(
-            FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-            CCG_CCPRTCL_LINK_DVMDOMAIN_TIMEOUT,
-            ccg_link_wait_condition,
-            &wait_data);
-        if (status != FWK_SUCCESS) {
-            FWK_LOG_ERR(
-                MOD_NAME "Entering system coherency for link %d... Failed",
-                linkid);
-            return status;
-        }
-        FWK_LOG_INFO(
-            MOD_NAME "Entering system coherency for link %d... Done", linkid);
+    link_count = ccg_link_table_init(ctx, ccg_config_table, ccg_table_count);
 
-        if (config->port_aggregate && !cmn700_ccg_ctx.is_prog_for_port_agg) {
-            cmn700_ccg_ctx.is_prog_for_port_agg = true;
-            FWK_LOG_INFO(MOD_NAME
-                         "Enter system coherency for Port Aggregation...");
-        } else {
-            cmn700_ccg_ctx.is_prog_for_port_agg = false;
-        }
-    } while (config->port_aggregate && cmn700_ccg_ctx.is_prog_for_port_agg);
+    FWK_LOG_INFO(
+        MOD_NAME "Entering system coherency for %u links...", link_count);
+    status = ccg_link_run_sequence(
+        ctx,
+        link_count,
+        ccg_system_coherency_sequence,
+        FWK_ARRAY_SIZE(ccg_system_coherency_sequence),
+        CCG_CCPRTCL_LINK_DVMDOMAIN_TIMEOUT);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Entering system coherency... Failed");
+        return status;
+    }
+    FWK_LOG_INFO(MOD_NAME "Entering system coherency... Done");
 
     return FWK_SUCCESS;
 }
 
 int ccg_enter_dvm_domain(
     struct cmn700_device_ctx *ctx,
-    const struct mod_cmn700_ccg_config *ccg_config)
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count)
 {
     int status;
-    int linkid;
-    unsigned int ccg_ldid;
-    struct ccg_wait_condition_data wait_data;
-    struct cmn700_ccg_ra_reg *ccg_ra_reg;
-
-    cmn700_ccg_ctx.is_prog_for_port_agg = false;
-
-    do {
-        config = ccg_config;
-        ccg_ldid = get_ldid(ctx, cmn700_ccg_ctx.is_prog_for_port_agg);
-        ccg_ra_reg = ctx->ccg_ra_reg_table[ccg_ldid].ccg_ra_reg;
+    unsigned int link_count;
 
-        /* Current support enables Link 0 only */
-        linkid = 0;
+    link_count = ccg_link_table_init(ctx, ccg_config_table, ccg_table_count);
 
-        wait_data.ctx = ctx;
-        wait_data.linkid = linkid;
-
-        FWK_LOG_INFO(MOD_NAME "Entering DVM domain for link %d...", linkid);
-        /* DVM domain entry by setting DVMDOMAIN request bit */
-        ccg_ra_reg->LINK_REGS[linkid].CCG_CCPRTCL_LINK_CTRL |=
-            CCG_LINK_CTRL_DVMDOMAIN_REQ_MASK;
-
-        /* Wait till DVMDOMAIN ACK bit is set in status register */
-        wait_data.cond = CCG_LINK_STATUS_RA_DVMDOMAIN_ACK_BIT_SET;
-        status = ctx->timer_api->wait(
-            FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
-            CCG_CCPRTCL_LINK_DVMDOMAIN_TIMEOUT,
-            ccg_link_wait_condition,
-            &wait_data);
-        if (status != FWK_SUCCESS) {
-            FWK_LOG_ERR(
-                MOD_NAME "Entering DVM domain for link %d... Failed", linkid);
-            return status;
-        }
-        FWK_LOG_INFO(
-            MOD_NAME "Entering DVM domain for link %d... Done", linkid);
-
-        if (config->port_aggregate && !cmn700_ccg_ctx.is_prog_for_port_agg) {
-            cmn700_ccg_ctx.is_prog_for_port_agg = true;
-            FWK_LOG_INFO(MOD_NAME
-                         "Entering DVM domain for Port Aggregation...");
-        } else {
-            cmn700_ccg_ctx.is_prog_for_port_agg = false;
-        }
-    } while (config->port_aggregate && cmn700_ccg_ctx.is_prog_for_port_agg);
+    FWK_LOG_INFO(MOD_NAME "Entering DVM domain for %u links...", link_count);
+    status = ccg_link_run_sequence(
+        ctx,
+        link_count,
+        ccg_dvm_domain_sequence,
+        FWK_ARRAY_SIZE(ccg_dvm_domain_sequence),
+        CCG_CCPRTCL_LINK_DVMDOMAIN_TIMEOUT);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_ERR(MOD_NAME "Entering DVM domain... Failed");
+        return status;
+    }
+    FWK_LOG_INFO(MOD_NAME "Entering DVM domain... Done");
 
     return FWK_SUCCESS;
 }
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2021-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,22 +15,40 @@
 
 #include <mod_cmn700.h>
 
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Program the CCG gateway. The links are brought up separately, for all the
+ * CCG gateways at once, using ccg_link_up().
+ */
 int ccg_setup(
     const unsigned int chip_id,
     struct cmn700_device_ctx *ctx,
     const struct mod_cmn700_ccg_config *ccg_config);
 
+/*
+ * Start the link up sequence on all the links described by the CCG
+ * configuration table and wait for all of them to be up.
+ */
+int ccg_link_up(
+    struct cmn700_device_ctx *ctx,
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count);
+
 int ccg_exchange_protocol_credit(
     struct cmn700_device_ctx *ctx,
     const struct mod_cmn700_ccg_config *ccg_config);
 
 int ccg_enter_system_coherency(
     struct cmn700_device_ctx *ctx,
-    const struct mod_cmn700_ccg_config *ccg_config);
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count);
 
 int ccg_enter_dvm_domain(
     struct cmn700_device_ctx *ctx,
-    const struct mod_cmn700_ccg_config *ccg_config);
+    const struct mod_cmn700_ccg_config *ccg_config_table,
+    size_t ccg_table_count);
 
 /*
  * CCG Link UP stages
@@ -48,14 +66,40 @@ enum ccg_link_up_wait_cond {
 };
 
 /*
- * Structure defining data to be passed to timer API
+ * State of a CCG link going through a sequence of steps
  */
-struct ccg_wait_condition_data {
-    struct cmn700_device_ctx *ctx;
+struct ccg_link_state {
+    struct cmn700_ccg_ra_reg *ccg_ra_reg;
+    struct cmn700_ccg_ha_reg *ccg_ha_reg;
+    unsigned int ccg_ldid;
     uint8_t linkid;
+
+    /* Index of the step the link is waiting on */
+    uint8_t step;
+};
+
+/*
+ * Step of a sequence applied to the CCG links
+ */
+struct ccg_link_step {
+    /* Bits set in the CCRA and CCHA link control registers on entry */
+    uint64_t ra_ctrl_set_mask;
+    uint64_t ha_ctrl_set_mask;
+
+    /* Condition to wait for before moving to the next step */
     enum ccg_link_up_wait_cond cond;
 };
 
+/*
+ * Structure defining data to be passed to timer API
+ */
+struct ccg_wait_condition_data {
+    struct ccg_link_state *link;
+    unsigned int link_count;
+    const struct ccg_link_step *step;
+    unsigned int step_count;
+};
+
 /* CCG Home Agent (HA) defines */
 #define CCG_HA_RAID_TO_LDID_RNF_MASK (0x4000)
 
@@ -0,0 +1,171 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      CMN-700 system cache group layout.
+ *
+ *      The membership of the system cache groups is given by the
+ *      configuration, but the order of the HN-Fs in a group decides which
+ *      HN-Fs form a hierarchical hashing cluster. The HN-Fs are ordered using
+ *      the positions found during the discovery so that the clusters are
+ *      compact in the mesh. This file does not access the hardware.
+ */
+
+#include <cmn700_scg_layout.h>
+
+#include <mod_cmn700.h>
+
+#include <stdint.h>
+
+static unsigned int distance(unsigned int a, unsigned int b)
+{
+    return (a > b) ? (a - b) : (b - a);
+}
+
+static void swap(unsigned int *list, unsigned int a, unsigned int b)
+{
+    unsigned int tmp = list[a];
+
+    list[a] = list[b];
+    list[b] = tmp;
+}
+
+unsigned int cmn700_scg_hops(
+    const struct node_pos *node_a,
+    const struct node_pos *node_b)
+{
+    return distance(node_a->pos_x, node_b->pos_x) +
+        distance(node_a->pos_y, node_b->pos_y);
+}
+
+void cmn700_scg_layout_order(
+    const struct node_pos *hnf_pos,
+    unsigned int *hnf_list,
+    unsigned int hnf_count,
+    unsigned int cluster_size)
+{
+    const struct node_pos *seed;
+    const struct node_pos *node;
+    unsigned int start;
+    unsigned int end;
+    unsigned int idx;
+    unsigned int next;
+    unsigned int best;
+    unsigned int best_hops;
+    unsigned int hops;
+
+    if ((cluster_size == 0) || (cluster_size >= hnf_count)) {
+        return;
+    }
+
+    for (start = 0; start < hnf_count; start += cluster_size) {
+        /*
+         * The cluster is seeded with the remaining HN-F closest to the origin
+         * of the mesh, so that the clusters are peeled off from a corner.
+         */
+        best = start;
+        for (idx = start + 1; idx < hnf_count; idx++) {
+            node = &hnf_pos[hnf_list[idx]];
+            seed = &hnf_pos[hnf_list[best]];
+            if ((node->pos_x + node->pos_y) < (seed->pos_x + seed->pos_y)) {
+                best = idx;
+            }
+        }
+        swap(hnf_list, start, best);
+        seed = &hnf_pos[hnf_list[start]];
+
+        /* The cluster is completed with the remaining HN-Fs closest to it */
+        end = start + cluster_size;
+        if (end > hnf_count) {
+            end = hnf_count;
+        }
+
+        for (idx = start + 1; idx < end; idx++) {
+            best = idx;
+            best_hops = UINT32_MAX;
+
+            for (next = idx; next < hnf_count; next++) {
+                hops = cmn700_scg_hops(seed, &hnf_pos[hnf_list[next]]);
+                if (hops < best_hops) {
+                    best = next;
+                    best_hops = hops;
+                }
+            }
+
+            swap(hnf_list, idx, best);
+        }
+    }
+}
+
+void cmn700_scg_layout_evaluate(
+    const struct node_pos *hnf_pos,
+    const unsigned int *hnf_list,
+    unsigned int hnf_count,
+    unsigned int cluster_size,
+    const struct node_pos *rn_pos,
+    unsigned int rn_count,
+    struct cmn700_scg_layout_stats *stats)
+{
+    unsigned int rn;
+    unsigned int start;
+    unsigned int end;
+    unsigned int idx;
+    unsigned int hops;
+    unsigned int sum;
+    unsigned int max;
+    unsigned int best_avg;
+    unsigned int best_max;
+    uint64_t total;
+
+    stats->avg_hops_x100 = 0;
+    stats->max_hops = 0;
+
+    if ((hnf_count == 0) || (rn_count == 0)) {
+        return;
+    }
+
+    if ((cluster_size == 0) || (cluster_size > hnf_count)) {
+        cluster_size = hnf_count;
+    }
+
+    total = 0;
+
+    for (rn = 0; rn < rn_count; rn++) {
+        best_avg = UINT32_MAX;
+        best_max = 0;
+
+        for (start = 0; start < hnf_count; start += cluster_size) {
+            end = start + cluster_size;
+            if (end > hnf_count) {
+                end = hnf_count;
+            }
+
+            sum = 0;
+            max = 0;
+            for (idx = start; idx < end; idx++) {
+                hops = cmn700_scg_hops(&rn_pos[rn], &hnf_pos[hnf_list[idx]]);
+                sum += hops;
+                if (hops > max) {
+                    max = hops;
+                }
+            }
+
+            /* Mean hop count of the cluster, in hundredths of a hop */
+            sum = (sum * 100) / (end - start);
+            if (sum < best_avg) {
+                best_avg = sum;
+                best_max = max;
+            }
+        }
+
+        total += best_avg;
+        if (best_max > stats->max_hops) {
+            stats->max_hops = best_max;
+        }
+    }
+
+    stats->avg_hops_x100 = (unsigned int)(total / rn_count);
+}
@@ -0,0 +1,64 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      CMN-700 system cache group layout.
+ */
+
+#ifndef CMN700_SCG_LAYOUT_H
+#define CMN700_SCG_LAYOUT_H
+
+#include <mod_cmn700.h>
+
+/*
+ * Hop distance of a layout, as seen from the requesters of the mesh.
+ */
+struct cmn700_scg_layout_stats {
+    /*
+     * Average, over the requesters, of the mean number of hops to the HN-Fs
+     * of the closest cluster, in hundredths of a hop.
+     */
+    unsigned int avg_hops_x100;
+
+    /* Largest number of hops from a requester to its closest cluster */
+    unsigned int max_hops;
+};
+
+/*
+ * Number of hops between the crosspoints of two nodes.
+ */
+unsigned int cmn700_scg_hops(
+    const struct node_pos *node_a,
+    const struct node_pos *node_b);
+
+/*
+ * Order the HN-Fs of a system cache group.
+ *
+ * The hierarchical hashing clusters are made of consecutive entries of the
+ * system cache group HN-F list. The list of HN-F logical identifiers is
+ * reordered so that each group of cluster_size consecutive HN-Fs is compact
+ * in the mesh.
+ */
+void cmn700_scg_layout_order(
+    const struct node_pos *hnf_pos,
+    unsigned int *hnf_list,
+    unsigned int hnf_count,
+    unsigned int cluster_size);
+
+/*
+ * Evaluate the hop distance between the requesters and the clusters of a
+ * system cache group HN-F list.
+ */
+void cmn700_scg_layout_evaluate(
+    const struct node_pos *hnf_pos,
+    const unsigned int *hnf_list,
+    unsigned int hnf_count,
+    unsigned int cluster_size,
+    const struct node_pos *rn_pos,
+    unsigned int rn_count,
+    struct cmn700_scg_layout_stats *stats);
+
+#endif /* CMN700_SCG_LAYOUT_H */
@@ -0,0 +1,191 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      CMN-700 topology cache.
+ *
+ *      The nodes found during the discovery of the mesh are recorded in
+ *      retained memory at cold boot. On warm boot and resume, the cache is
+ *      checked against the root configuration registers and, if it matches,
+ *      used instead of walking the mesh again.
+ */
+
+#include <cmn700.h>
+#include <cmn700_topology.h>
+
+#include <internal/cmn700_ctx.h>
+
+#include <mod_cmn700.h>
+
+#include <fwk_log.h>
+#include <fwk_macros.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define MOD_NAME "[CMN700] "
+
+#define FNV1A_OFFSET_BASIS UINT32_C(2166136261)
+#define FNV1A_PRIME        UINT32_C(16777619)
+
+static uint32_t fnv1a(uint32_t hash, const void *data, size_t size)
+{
+    const uint8_t *byte = data;
+
+    while (size-- > 0) {
+        hash = (hash ^ *byte++) * FNV1A_PRIME;
+    }
+
+    return hash;
+}
+
+static uint32_t hash_root(const struct cmn700_device_ctx *ctx)
+{
+    const struct mod_cmn700_config *config = ctx->config;
+    uint64_t reg;
+    uint32_t hash = FNV1A_OFFSET_BASIS;
+    unsigned int idx;
+
+    reg = ctx->root->NODE_INFO;
+    hash = fnv1a(hash, &reg, sizeof(reg));
+
+    reg = ctx->root->CHILD_INFO;
+    hash = fnv1a(hash, &reg, sizeof(reg));
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(ctx->root->PERIPH_ID); idx++) {
+        reg = ctx->root->PERIPH_ID[idx];
+        hash = fnv1a(hash, &reg, sizeof(reg));
+    }
+
+    hash = fnv1a(hash, &config->base, sizeof(config->base));
+    hash = fnv1a(hash, &config->mesh_size_x, sizeof(config->mesh_size_x));
+    hash = fnv1a(hash, &config->mesh_size_y, sizeof(config->mesh_size_y));
+
+    return hash;
+}
+
+static uint32_t checksum(const struct cmn700_topology_cache *cache)
+{
+    const void *start = &cache->node_count;
+    size_t size = (size_t)((const uint8_t *)&cache->node[cache->node_count] -
+                           (const uint8_t *)start);
+
+    return fnv1a(FNV1A_OFFSET_BASIS, start, size);
+}
+
+static size_t capacity(const struct cmn700_device_ctx *ctx)
+{
+    size_t size = ctx->config->topology_cache_size;
+
+    if (size < sizeof(struct cmn700_topology_cache)) {
+        return 0;
+    }
+
+    return (size - sizeof(struct cmn700_topology_cache)) /
+        sizeof(struct cmn700_topology_node);
+}
+
+bool cmn700_topology_restore(struct cmn700_device_ctx *ctx)
+{
+    struct cmn700_topology_cache *cache = ctx->topology_cache;
+
+    if (cache == NULL) {
+        return false;
+    }
+
+    if ((cache->magic != CMN700_TOPOLOGY_MAGIC) ||
+        (cache->node_count > capacity(ctx)) ||
+        (cache->root_hash != hash_root(ctx)) ||
+        (cache->checksum != checksum(cache))) {
+        return false;
+    }
+
+    ctx->hnf_count = cache->hnf_count;
+    ctx->rnf_count = cache->rnf_count;
+    ctx->rnd_count = cache->rnd_count;
+    ctx->rni_count = cache->rni_count;
+    ctx->internal_rnsam_count = cache->internal_rnsam_count;
+    ctx->external_rnsam_count = cache->external_rnsam_count;
+    ctx->ccg_node_count = cache->ccg_node_count;
+
+    set_encoding_and_masking_bits(ctx->config);
+
+    ctx->topology_valid = true;
+
+    FWK_LOG_INFO(
+        MOD_NAME "Topology restored from cache: %u nodes, %u HN-F, %u RN-F",
+        (unsigned int)cache->node_count,
+        ctx->hnf_count,
+        ctx->rnf_count);
+
+    return true;
+}
+
+void cmn700_topology_begin(struct cmn700_device_ctx *ctx)
+{
+    struct cmn700_topology_cache *cache = ctx->topology_cache;
+
+    ctx->topology_valid = false;
+
+    if (cache == NULL) {
+        return;
+    }
+
+    cache->magic = 0;
+    cache->node_count = 0;
+    ctx->topology_overflow = false;
+}
+
+void cmn700_topology_record(
+    struct cmn700_device_ctx *ctx,
+    const struct cmn700_topology_node *node)
+{
+    struct cmn700_topology_cache *cache = ctx->topology_cache;
+
+    if ((cache == NULL) || ctx->topology_overflow) {
+        return;
+    }
+
+    if (cache->node_count >= capacity(ctx)) {
+        FWK_LOG_WARN(MOD_NAME "Topology cache too small, not cached");
+        ctx->topology_overflow = true;
+        return;
+    }
+
+    cache->node[cache->node_count++] = *node;
+}
+
+void cmn700_topology_commit(struct cmn700_device_ctx *ctx)
+{
+    struct cmn700_topology_cache *cache = ctx->topology_cache;
+
+    if ((cache == NULL) || ctx->topology_overflow) {
+        return;
+    }
+
+    cache->hnf_count = (uint16_t)ctx->hnf_count;
+    cache->rnf_count = (uint16_t)ctx->rnf_count;
+    cache->rnd_count = (uint16_t)ctx->rnd_count;
+    cache->rni_count = (uint16_t)ctx->rni_count;
+    cache->internal_rnsam_count = (uint16_t)ctx->internal_rnsam_count;
+    cache->external_rnsam_count = (uint16_t)ctx->external_rnsam_count;
+    cache->ccg_node_count = (uint16_t)ctx->ccg_node_count;
+    cache->root_hash = hash_root(ctx);
+    cache->checksum = checksum(cache);
+    cache->magic = CMN700_TOPOLOGY_MAGIC;
+
+    ctx->topology_valid = true;
+}
+
+const struct cmn700_topology_node *cmn700_topology_nodes(
+    struct cmn700_device_ctx *ctx,
+    unsigned int *node_count)
+{
+    *node_count = ctx->topology_cache->node_count;
+
+    return ctx->topology_cache->node;
+}
@@ -0,0 +1,110 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      CMN-700 topology cache.
+ */
+
+#ifndef CMN700_TOPOLOGY_H
+#define CMN700_TOPOLOGY_H
+
+#include <internal/cmn700_ctx.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Identifier of a valid topology cache ("CMNT") */
+#define CMN700_TOPOLOGY_MAGIC UINT32_C(0x544E4D43)
+
+/* Type of the entries describing external RN-SAM nodes */
+#define CMN700_TOPOLOGY_NODE_EXTERNAL UINT16_C(0xFFFF)
+
+/*
+ * Node of interest of the mesh, as found during the discovery.
+ */
+struct cmn700_topology_node {
+    /* Offset of the node registers from the configuration base address */
+    uint32_t offset;
+
+    /* Node type, or CMN700_TOPOLOGY_NODE_EXTERNAL */
+    uint16_t type;
+
+    /* Node identifier */
+    uint16_t node_id;
+
+    /* Logical identifier */
+    uint16_t logical_id;
+
+    /* Position of the node in the mesh and port of its crosspoint */
+    uint8_t pos_x;
+    uint8_t pos_y;
+    uint8_t port_num;
+
+    uint8_t reserved[3];
+};
+
+/*
+ * Topology cache layout, stored in retained memory.
+ */
+struct cmn700_topology_cache {
+    /* CMN700_TOPOLOGY_MAGIC if the cache is valid */
+    uint32_t magic;
+
+    /* Hash of the root configuration registers the cache was built from */
+    uint32_t root_hash;
+
+    /* Checksum of the counts and of the node table */
+    uint32_t checksum;
+
+    /* Number of nodes in the node table */
+    uint16_t node_count;
+
+    /* Node counts found during the discovery */
+    uint16_t hnf_count;
+    uint16_t rnf_count;
+    uint16_t rnd_count;
+    uint16_t rni_count;
+    uint16_t internal_rnsam_count;
+    uint16_t external_rnsam_count;
+    uint16_t ccg_node_count;
+
+    /* Node table */
+    struct cmn700_topology_node node[];
+};
+
+/*
+ * Restore the node counts from the topology cache.
+ *
+ * Returns true if the cache is valid and matches the root configuration
+ * registers of the mesh, in which case the discovery can be skipped.
+ */
+bool cmn700_topology_restore(struct cmn700_device_ctx *ctx);
+
+/*
+ * Invalidate the topology cache and start recording a new topology.
+ */
+void cmn700_topology_begin(struct cmn700_device_ctx *ctx);
+
+/*
+ * Record a node of interest in the topology cache.
+ */
+void cmn700_topology_record(
+    struct cmn700_device_ctx *ctx,
+    const struct cmn700_topology_node *node);
+
+/*
+ * Complete the recording, storing the node counts of the context.
+ */
+void cmn700_topology_commit(struct cmn700_device_ctx *ctx);
+
+/*
+ * Get the node table of a valid topology cache.
+ */
+const struct cmn700_topology_node *cmn700_topology_nodes(
+    struct cmn700_device_ctx *ctx,
+    unsigned int *node_count);
+
+#endif /* CMN700_TOPOLOGY_H */
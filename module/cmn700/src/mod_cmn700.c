@@ -7,6 +7,8 @@
 
 #include <cmn700.h>
 #include <cmn700_ccg.h>
+#include <cmn700_scg_layout.h>
+#include <cmn700_topology.h>
 
 #include <internal/cmn700_ctx.h>
 
@@ -19,6 +21,7 @@
 #include <fwk_event.h>
 #include <fwk_id.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_math.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
@@ -54,6 +57,14 @@ static bool multi_chip_mode;
 
 static struct node_pos *hnf_node_pos;
 
+/* HN-Fs of the system cache group being programmed, by logical identifier */
+static unsigned int *scg_hnf_list;
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_INFO
+/* Positions of the internal RN-SAMs, used to evaluate the SCG layout */
+static struct node_pos *rnsam_pos;
+#endif
+
 static inline size_t cmn700_hnf_cache_group_count(size_t hnf_count)
 {
     return (hnf_count + CMN700_HNF_CACHE_GROUP_ENTRIES_PER_GROUP - 1) /
@@ -426,12 +437,100 @@ static int cmn700_discovery(void)
     return FWK_SUCCESS;
 }
 
+/*
+ * Configure a node of interest found in the mesh, either by walking the mesh or
+ * from the topology cache.
+ */
+static void cmn700_configure_node(
+    const struct cmn700_topology_node *entry,
+    unsigned int *irnsam_entry,
+    unsigned int *xrnsam_entry)
+{
+    unsigned int ldid = entry->logical_id;
+    void *node = (void *)(ctx->config->base + entry->offset);
+
+    switch (entry->type) {
+    case CMN700_TOPOLOGY_NODE_EXTERNAL:
+        fwk_assert(*xrnsam_entry < ctx->external_rnsam_count);
+
+        ctx->external_rnsam_table[*xrnsam_entry].node_id = entry->node_id;
+        ctx->external_rnsam_table[*xrnsam_entry].node = node;
+
+        (*xrnsam_entry)++;
+        break;
+
+    case NODE_TYPE_RN_SAM:
+        fwk_assert(*irnsam_entry < ctx->internal_rnsam_count);
+
+        ctx->internal_rnsam_table[*irnsam_entry] = node;
+
+        (*irnsam_entry)++;
+        break;
+
+    case NODE_TYPE_CCRA:
+        fwk_assert(ldid < ctx->ccg_node_count);
+
+        /* Use ldid as index of the ccg_ra table */
+        ctx->ccg_ra_reg_table[ldid].node_id = entry->node_id;
+        ctx->ccg_ra_reg_table[ldid].ccg_ra_reg =
+            (struct cmn700_ccg_ra_reg *)node;
+        break;
+
+    case NODE_TYPE_CCHA:
+        fwk_assert(ldid < ctx->ccg_node_count);
+
+        /* Use ldid as index of the ccg_ra table */
+        ctx->ccg_ha_reg_table[ldid].node_id = entry->node_id;
+        ctx->ccg_ha_reg_table[ldid].ccg_ha_reg =
+            (struct cmn700_ccg_ha_reg *)node;
+        break;
+
+    case NODE_TYPE_CCLA:
+        /* Use ldid as index of the ccla table */
+        ctx->ccla_reg_table[ldid].node_id = entry->node_id;
+        ctx->ccla_reg_table[ldid].ccla_reg = (struct cmn700_ccla_reg *)node;
+        break;
+
+    case NODE_TYPE_HN_F:
+        fwk_assert(ldid < ctx->hnf_count);
+
+        ctx->hnf_node[ldid] = (uintptr_t)node;
+
+        hnf_node_pos[ldid].pos_x = entry->pos_x;
+        hnf_node_pos[ldid].pos_y = entry->pos_y;
+        hnf_node_pos[ldid].port_num = entry->port_num;
+
+        process_node_hnf(node);
+        break;
+
+    default:
+        /* Nothing to be done for other node types */
+        break;
+    }
+}
+
+/*
+ * Configure the nodes recorded in the topology cache, without walking the
+ * mesh.
+ */
+static void cmn700_configure_cached(void)
+{
+    unsigned int irnsam_entry = 0;
+    unsigned int xrnsam_entry = 0;
+    unsigned int node_count;
+    unsigned int idx;
+    const struct cmn700_topology_node *nodes;
+
+    nodes = cmn700_topology_nodes(ctx, &node_count);
+
+    for (idx = 0; idx < node_count; idx++) {
+        cmn700_configure_node(&nodes[idx], &irnsam_entry, &xrnsam_entry);
+    }
+}
+
 static void cmn700_configure(void)
 {
-    unsigned int logical_id;
     unsigned int node_count;
-    unsigned int ldid;
-    unsigned int node_id;
     unsigned int node_idx;
     unsigned int xp_count;
     unsigned int xp_idx;
@@ -440,6 +539,7 @@ static void cmn700_configure(void)
     unsigned int xp_port;
     void *node;
     struct cmn700_mxp_reg *xp;
+    struct cmn700_topology_node entry = { 0 };
     const struct mod_cmn700_config *config = ctx->config;
 
     fwk_assert(get_node_type(ctx->root) == NODE_TYPE_CFG);
@@ -447,6 +547,8 @@ static void cmn700_configure(void)
     irnsam_entry = 0;
     xrnsam_entry = 0;
 
+    cmn700_topology_begin(ctx);
+
     /* Traverse cross points (XP) */
     xp_count = get_node_child_count(ctx->root);
     for (xp_idx = 0; xp_idx < xp_count; xp_idx++) {
@@ -460,67 +562,47 @@ static void cmn700_configure(void)
             xp_port = get_port_number(
                 get_child_node_id(xp, node_idx),
                 get_node_device_port_count(xp));
-            if (is_child_external(xp, node_idx)) {
-                node_id = get_child_node_id(xp, node_idx);
-
-                if (!(get_device_type(xp, xp_port) == DEVICE_TYPE_CXRH) &&
-                    !(get_device_type(xp, xp_port) == DEVICE_TYPE_CXHA) &&
-                    !(get_device_type(xp, xp_port) == DEVICE_TYPE_CXRA)) {
-                    fwk_assert(xrnsam_entry < ctx->external_rnsam_count);
 
-                    ctx->external_rnsam_table[xrnsam_entry].node_id = node_id;
-                    ctx->external_rnsam_table[xrnsam_entry].node = node;
+            entry.offset = (uint32_t)((uintptr_t)node - config->base);
 
-                    xrnsam_entry++;
+            if (is_child_external(xp, node_idx)) {
+                if ((get_device_type(xp, xp_port) == DEVICE_TYPE_CXRH) ||
+                    (get_device_type(xp, xp_port) == DEVICE_TYPE_CXHA) ||
+                    (get_device_type(xp, xp_port) == DEVICE_TYPE_CXRA)) {
+                    continue;
                 }
+
+                entry.type = CMN700_TOPOLOGY_NODE_EXTERNAL;
+                entry.node_id = (uint16_t)get_child_node_id(xp, node_idx);
+                entry.logical_id = 0;
+                entry.pos_x = 0;
+                entry.pos_y = 0;
+                entry.port_num = 0;
             } else {
-                enum node_type node_type = get_node_type(node);
-                node_id = get_node_id(node);
-                if (node_type == NODE_TYPE_RN_SAM) {
-                    fwk_assert(irnsam_entry < ctx->internal_rnsam_count);
-
-                    ctx->internal_rnsam_table[irnsam_entry] = node;
-
-                    irnsam_entry++;
-                } else if (node_type == NODE_TYPE_CCRA) {
-                    ldid = get_node_logical_id(node);
-                    fwk_assert(ldid < ctx->ccg_node_count);
-
-                    /* Use ldid as index of the ccg_ra table */
-                    ctx->ccg_ra_reg_table[ldid].node_id = node_id;
-                    ctx->ccg_ra_reg_table[ldid].ccg_ra_reg =
-                        (struct cmn700_ccg_ra_reg *)node;
-                } else if (node_type == NODE_TYPE_CCHA) {
-                    ldid = get_node_logical_id(node);
-                    fwk_assert(ldid < ctx->ccg_node_count);
-
-                    /* Use ldid as index of the ccg_ra table */
-                    ctx->ccg_ha_reg_table[ldid].node_id = node_id;
-                    ctx->ccg_ha_reg_table[ldid].ccg_ha_reg =
-                        (struct cmn700_ccg_ha_reg *)node;
-                } else if (node_type == NODE_TYPE_CCLA) {
-                    ldid = get_node_logical_id(node);
-
-                    /* Use ldid as index of the ccla table */
-                    ctx->ccla_reg_table[ldid].node_id = node_id;
-                    ctx->ccla_reg_table[ldid].ccla_reg =
-                        (struct cmn700_ccla_reg *)node;
-                } else if (node_type == NODE_TYPE_HN_F) {
-                    logical_id = get_node_logical_id(node);
-                    fwk_assert(logical_id < ctx->hnf_count);
-
-                    ctx->hnf_node[logical_id] = (uintptr_t)(void *)node;
-
-                    hnf_node_pos[logical_id].pos_x = get_node_pos_x(node);
-                    hnf_node_pos[logical_id].pos_y = get_node_pos_y(node);
-                    hnf_node_pos[logical_id].port_num =
-                        get_port_number(node_id, xp_port);
-
-                    process_node_hnf(node);
+                entry.type = (uint16_t)get_node_type(node);
+
+                if ((entry.type != NODE_TYPE_RN_SAM) &&
+                    (entry.type != NODE_TYPE_CCRA) &&
+                    (entry.type != NODE_TYPE_CCHA) &&
+                    (entry.type != NODE_TYPE_CCLA) &&
+                    (entry.type != NODE_TYPE_HN_F)) {
+                    continue;
                 }
+
+                entry.node_id = (uint16_t)get_node_id(node);
+                entry.logical_id = (uint16_t)get_node_logical_id(node);
+                entry.pos_x = (uint8_t)get_node_pos_x(node);
+                entry.pos_y = (uint8_t)get_node_pos_y(node);
+                entry.port_num =
+                    (uint8_t)get_port_number(entry.node_id, xp_port);
             }
+
+            cmn700_topology_record(ctx, &entry);
+            cmn700_configure_node(&entry, &irnsam_entry, &xrnsam_entry);
         }
     }
+
+    cmn700_topology_commit(ctx);
 }
 
 /* Helper function to check if hnf is inside the SCG/HTG square/rectangle */
@@ -621,53 +703,132 @@ static int cmn700_setup_rnsam_ccg_regions(void)
 
 static void cmn700_setup_sys_cache_group_nodeid(
     struct cmn700_rnsam_reg *rnsam,
-    const struct mod_cmn700_mem_region_map *region,
+    const unsigned int *hnf_list,
+    unsigned int hnf_count_in_scg,
     uint32_t region_idx)
 {
-    uint8_t logical_id;
+    unsigned int idx;
+    unsigned int logical_id;
     uint32_t group;
     uint32_t cache_group_bit_position;
-    uint32_t hnf_count_in_scg = 0;
     uint32_t hnf_nodeid;
-    uint32_t hn_nodeid_reg_bits_idx = 0;
     const struct mod_cmn700_config *config = ctx->config;
 
-    for (logical_id = 0; logical_id < ctx->hnf_count; logical_id++) {
+    for (idx = 0; idx < hnf_count_in_scg; idx++) {
+        logical_id = hnf_list[idx];
         hnf_nodeid = get_node_id((void *)ctx->hnf_node[logical_id]);
 
-        if ((config->hnf_cal_mode) && ((hnf_nodeid % 2) == 1)) {
-            /* Ignore odd node ids if cal mode is set */
-            continue;
+        group = idx / CMN700_HNF_CACHE_GROUP_ENTRIES_PER_GROUP;
+
+        cache_group_bit_position = CMN700_HNF_CACHE_GROUP_ENTRY_BITS_WIDTH *
+            (idx % CMN700_HNF_CACHE_GROUP_ENTRIES_PER_GROUP);
+
+        rnsam->SYS_CACHE_GRP_HN_NODEID[group] += (uint64_t)hnf_nodeid
+            << cache_group_bit_position;
+        rnsam->SYS_CACHE_GRP_SN_NODEID[group] +=
+            ((uint64_t)config->snf_table[logical_id])
+            << cache_group_bit_position;
+    }
+
+    rnsam->SYS_CACHE_GRP_HN_COUNT |= ((uint64_t)hnf_count_in_scg)
+        << CMN700_RNSAM_SYS_CACHE_GRP_HN_CNT_POS(region_idx);
+}
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_INFO
+static void cmn700_log_scg_layout(
+    const char *name,
+    unsigned int hnf_count_in_scg,
+    unsigned int cluster_size)
+{
+    unsigned int idx;
+    struct cmn700_scg_layout_stats stats;
+
+    if (rnsam_pos == NULL) {
+        rnsam_pos =
+            fwk_mm_calloc(ctx->internal_rnsam_count, sizeof(*rnsam_pos));
+
+        for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
+            rnsam_pos[idx].pos_x =
+                get_node_pos_x(ctx->internal_rnsam_table[idx]);
+            rnsam_pos[idx].pos_y =
+                get_node_pos_y(ctx->internal_rnsam_table[idx]);
         }
+    }
 
-        group =
-            hn_nodeid_reg_bits_idx / CMN700_HNF_CACHE_GROUP_ENTRIES_PER_GROUP;
+    cmn700_scg_layout_evaluate(
+        hnf_node_pos,
+        scg_hnf_list,
+        hnf_count_in_scg,
+        cluster_size,
+        rnsam_pos,
+        ctx->internal_rnsam_count,
+        &stats);
 
-        cache_group_bit_position = CMN700_HNF_CACHE_GROUP_ENTRY_BITS_WIDTH *
-            ((hn_nodeid_reg_bits_idx %
-              (CMN700_HNF_CACHE_GROUP_ENTRIES_PER_GROUP)));
+    FWK_LOG_INFO(
+        MOD_NAME "  %s SCG layout: average %u.%02u hops, worst %u hops",
+        name,
+        stats.avg_hops_x100 / 100,
+        stats.avg_hops_x100 % 100,
+        stats.max_hops);
+}
+#endif
 
-        if (is_hnf_inside_rect(hnf_node_pos[logical_id], region)) {
+/*
+ * Build the list of the HN-Fs of a system cache group, in the order in which
+ * they are programmed in the RN-SAMs. Returns the number of HN-Fs in the
+ * group.
+ */
+static unsigned int cmn700_get_scg_hnf_list(
+    const struct mod_cmn700_mem_region_map *region)
+{
+    unsigned int logical_id;
+    unsigned int hnf_count_in_scg;
+    unsigned int cluster_count;
+    unsigned int cluster_size;
+    uint32_t hnf_nodeid;
+    const struct mod_cmn700_config *config = ctx->config;
+
+    hnf_count_in_scg = 0;
+
+    for (logical_id = 0; logical_id < ctx->hnf_count; logical_id++) {
+        hnf_nodeid = get_node_id((void *)ctx->hnf_node[logical_id]);
+
+        if ((config->hnf_cal_mode) && ((hnf_nodeid % 2) == 1)) {
             /*
-             * If CAL mode is set, add only even numbered hnd node
-             * to sys_cache_grp_hn_nodeid registers.
+             * If CAL mode is set, add only even numbered hnf node to
+             * sys_cache_grp_hn_nodeid registers.
              */
-            if (config->hnf_cal_mode && ((hnf_nodeid & 1) == 1)) {
-                continue;
-            }
+            continue;
+        }
 
-            rnsam->SYS_CACHE_GRP_HN_NODEID[group] += (uint64_t)hnf_nodeid
-                << cache_group_bit_position;
-            rnsam->SYS_CACHE_GRP_SN_NODEID[group] +=
-                ((uint64_t)config->snf_table[logical_id])
-                << cache_group_bit_position;
-            hnf_count_in_scg++;
-            hn_nodeid_reg_bits_idx++;
+        if (is_hnf_inside_rect(hnf_node_pos[logical_id], region)) {
+            scg_hnf_list[hnf_count_in_scg++] = logical_id;
         }
     }
 
-    rnsam->SYS_CACHE_GRP_HN_COUNT |= ((uint64_t)hnf_count_in_scg)
-        << CMN700_RNSAM_SYS_CACHE_GRP_HN_CNT_POS(region_idx);
+    if (!config->hnf_scg_layout_optimize ||
+        !config->hierarchical_hashing_enable) {
+        return hnf_count_in_scg;
+    }
+
+    cluster_count = config->hierarchical_hashing_config.hnf_cluster_count;
+    if (cluster_count == 0) {
+        return hnf_count_in_scg;
+    }
+    cluster_size = hnf_count_in_scg / cluster_count;
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_INFO
+    cmn700_log_scg_layout("Configured", hnf_count_in_scg, cluster_size);
+#endif
+
+    cmn700_scg_layout_order(
+        hnf_node_pos, scg_hnf_list, hnf_count_in_scg, cluster_size);
+
+#if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_INFO
+    cmn700_log_scg_layout("Optimized", hnf_count_in_scg, cluster_size);
+#endif
+
+    return hnf_count_in_scg;
 }
 
 static uint32_t get_region_index(enum mod_cmn700_mem_region_type region_type)
@@ -691,23 +852,32 @@ static uint32_t get_region_index(enum mod_cmn700_mem_region_type region_type)
     return region_index;
 }
 
+/*
+ * Program the target node of a non-hashed region in all the internal RN-SAMs.
+ * All the RN-SAMs are programmed identically, so the register value is
+ * computed once from the first one.
+ */
 static void configure_target_node(
     const struct mod_cmn700_mem_region_map *region,
-    struct cmn700_rnsam_reg *rnsam,
     uint32_t region_idx)
 {
+    uint8_t idx;
     uint32_t group;
     uint32_t bit_pos;
+    uint64_t value;
 
     group = region_idx / CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRIES_PER_GROUP;
     bit_pos = CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_BITS_WIDTH *
         (region_idx % CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRIES_PER_GROUP);
 
-    rnsam->NON_HASH_TGT_NODEID[group] &=
-        ~(CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK << bit_pos);
-    rnsam->NON_HASH_TGT_NODEID[group] |=
-        (region->node_id & CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK)
+    value = ctx->internal_rnsam_table[0]->NON_HASH_TGT_NODEID[group];
+    value &= ~(CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK << bit_pos);
+    value |= (region->node_id & CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK)
         << bit_pos;
+
+    for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
+        ctx->internal_rnsam_table[idx]->NON_HASH_TGT_NODEID[group] = value;
+    }
 }
 
 static int cmn700_program_rnsam(const struct mod_cmn700_mem_region_map *region)
@@ -715,16 +885,16 @@ static int cmn700_program_rnsam(const struct mod_cmn700_mem_region_map *region)
     uint8_t idx;
     uint64_t base;
     uint32_t region_idx;
-    int status;
+    unsigned int hnf_count_in_scg;
     struct cmn700_rnsam_reg *rnsam;
+    struct cmn700_region_entry entry;
 
     /* Offset the base with chip address space base on chip-id */
     base = ((uint64_t)(ctx->config->chip_addr_space * chip_id) + region->base);
 
-    status = FWK_SUCCESS;
     if (region->type == MOD_CMN700_REGION_TYPE_SYSCACHE_SUB) {
         /* System cache sub-regions are handled by HN-Fs */
-        return status;
+        return FWK_SUCCESS;
     }
 
     region_idx = get_region_index(region->type);
@@ -732,50 +902,67 @@ static int cmn700_program_rnsam(const struct mod_cmn700_mem_region_map *region)
         return FWK_E_PARAM;
     }
 
-    for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
-        rnsam = ctx->internal_rnsam_table[idx];
-        switch (region->type) {
-        case MOD_CMN700_MEM_REGION_TYPE_IO:
-            configure_region(
-                rnsam,
-                region_idx,
-                base,
-                region->size,
-                SAM_NODE_TYPE_HN_I,
-                SAM_TYPE_NON_HASH_MEM_REGION);
+    if (ctx->internal_rnsam_count == 0) {
+        return FWK_SUCCESS;
+    }
 
-            configure_target_node(region, rnsam, region_idx);
-            break;
+    /*
+     * The region entry is encoded once and then written to every internal
+     * RN-SAM.
+     */
+    switch (region->type) {
+    case MOD_CMN700_MEM_REGION_TYPE_IO:
+        encode_region(
+            ctx->internal_rnsam_table[0],
+            base,
+            region->size,
+            SAM_NODE_TYPE_HN_I,
+            SAM_TYPE_NON_HASH_MEM_REGION,
+            &entry);
 
-        case MOD_CMN700_MEM_REGION_TYPE_SYSCACHE:
-            configure_region(
-                rnsam,
-                region_idx,
-                base,
-                region->size,
-                SAM_NODE_TYPE_HN_F,
-                SAM_TYPE_SYS_CACHE_GRP_REGION);
+        for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
+            write_region(ctx->internal_rnsam_table[idx], region_idx, &entry);
+        }
+
+        configure_target_node(region, region_idx);
+
+        if (region_idx < MAX_NON_HASH_MEM_COUNT) {
+            ctx->io_region_table[region_idx].base = region->base;
+            ctx->io_region_table[region_idx].node_id =
+                region->node_id & CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK;
+        }
+        break;
 
-            /* Mark corresponding region as enabled */
-            fwk_assert(region_idx < MAX_SCG_COUNT);
-            ctx->scg_regions_enabled[region_idx] = 1;
+    case MOD_CMN700_MEM_REGION_TYPE_SYSCACHE:
+        encode_region(
+            ctx->internal_rnsam_table[0],
+            base,
+            region->size,
+            SAM_NODE_TYPE_HN_F,
+            SAM_TYPE_SYS_CACHE_GRP_REGION,
+            &entry);
 
-            cmn700_setup_sys_cache_group_nodeid(rnsam, region, region_idx);
+        /* Mark corresponding region as enabled */
+        fwk_assert(region_idx < MAX_SCG_COUNT);
+        ctx->scg_regions_enabled[region_idx] = 1;
 
-            break;
+        hnf_count_in_scg = cmn700_get_scg_hnf_list(region);
 
-        default:
-            fwk_unexpected();
-            status = FWK_E_DATA;
-            break;
-        }
+        for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
+            rnsam = ctx->internal_rnsam_table[idx];
 
-        if (status != FWK_SUCCESS) {
-            return status;
+            write_region(rnsam, region_idx, &entry);
+            cmn700_setup_sys_cache_group_nodeid(
+                rnsam, scg_hnf_list, hnf_count_in_scg, region_idx);
         }
+        break;
+
+    default:
+        fwk_unexpected();
+        return FWK_E_DATA;
     }
 
-    return status;
+    return FWK_SUCCESS;
 }
 
 static int setup_internal_rn_sam_nodes(void)
@@ -927,9 +1114,12 @@ static int cmn700_setup(void)
     int status;
 
     if (!ctx->initialized) {
-        status = cmn700_discovery();
-        if (status != FWK_SUCCESS)
-            return FWK_SUCCESS;
+        /* Skip the discovery if the topology cache matches the mesh */
+        if (!cmn700_topology_restore(ctx)) {
+            status = cmn700_discovery();
+            if (status != FWK_SUCCESS)
+                return FWK_SUCCESS;
+        }
 
         /*
          * Allocate resources based on the discovery
@@ -956,6 +1146,7 @@ static int cmn700_setup(void)
             ctx->hnf_node =
                 fwk_mm_calloc(ctx->hnf_count, sizeof(*ctx->hnf_node));
             hnf_node_pos = fwk_mm_calloc(ctx->hnf_count, sizeof(*hnf_node_pos));
+            scg_hnf_list = fwk_mm_calloc(ctx->hnf_count, sizeof(*scg_hnf_list));
             if (ctx->hnf_node == NULL)
                 return FWK_E_NOMEM;
             ctx->hnf_cache_group = fwk_mm_calloc(
@@ -963,6 +1154,10 @@ static int cmn700_setup(void)
                 sizeof(*ctx->hnf_cache_group));
         }
 
+        /* Shadow of the IO regions programmed in the RN-SAMs */
+        ctx->io_region_table = fwk_mm_calloc(
+            MAX_NON_HASH_MEM_COUNT, sizeof(*ctx->io_region_table));
+
         /* Allocate resource for the CCG nodes */
         if (ctx->ccg_node_count != 0) {
             ctx->ccg_ra_reg_table = fwk_mm_calloc(
@@ -971,10 +1166,16 @@ static int cmn700_setup(void)
                 ctx->ccg_node_count, sizeof(*ctx->ccg_ha_reg_table));
             ctx->ccla_reg_table = fwk_mm_calloc(
                 ctx->ccg_node_count, sizeof(*ctx->ccla_reg_table));
+            ctx->ccg_link_table = fwk_mm_calloc(
+                ctx->ccg_node_count, sizeof(*ctx->ccg_link_table));
         }
     }
 
-    cmn700_configure();
+    if (ctx->topology_valid) {
+        cmn700_configure_cached();
+    } else {
+        cmn700_configure();
+    }
 
     cmn700_rnsam_stall();
 
@@ -1009,27 +1210,82 @@ static void cmn700_ccg_setup(void)
     /* Remote RNF LDID value begins from local chip's last RNF LDID value + 1 */
     ctx->remote_rnf_ldid_value = ctx->rnf_count;
 
-    /* Do configuration for CCG Nodes and enable the links */
+    /* Do configuration for CCG Nodes */
     for (idx = 0; idx < config->ccg_table_count; idx++) {
         ccg_setup(chip_id, ctx, &config->ccg_config_table[idx]);
     }
 
+    /*
+     * Enable the links of all the CCG Nodes at once, so that they are trained
+     * in parallel.
+     */
+    ccg_link_up(ctx, config->ccg_config_table, config->ccg_table_count);
+
     /*
      * Exchange protocol credits and enter system coherecy and dvm domain for
      * multichip SMP mode operation.
      */
     for (idx = 0; idx < config->ccg_table_count; idx++) {
         ccg_exchange_protocol_credit(ctx, &config->ccg_config_table[idx]);
-        ccg_enter_system_coherency(ctx, &config->ccg_config_table[idx]);
-        ccg_enter_dvm_domain(ctx, &config->ccg_config_table[idx]);
     }
+
+    ccg_enter_system_coherency(
+        ctx, config->ccg_config_table, config->ccg_table_count);
+    ccg_enter_dvm_domain(
+        ctx, config->ccg_config_table, config->ccg_table_count);
+}
+
+/*
+ * Look up a non-hashed region already mapped at the base address of a region.
+ */
+static bool find_io_region(
+    struct mod_cmn700_mem_region_map *mmap,
+    uint32_t *region_index)
+{
+    int idx;
+    unsigned int count;
+    const struct cmn700_io_region *io_region;
+
+    mmap->node_id &= CMN700_RNSAM_NON_HASH_TGT_NODEID_ENTRY_MASK;
+
+    /* Only the first MAX_NON_HASH_MEM_COUNT regions are recorded */
+    count =
+        FWK_MIN(ctx->region_io_count, (unsigned int)MAX_NON_HASH_MEM_COUNT);
+
+    for (idx = (int)count - 1; idx >= 0; idx--) {
+        io_region = &ctx->io_region_table[idx];
+        if (io_region->base != mmap->base) {
+            continue;
+        }
+
+        if (io_region->node_id != mmap->node_id) {
+            FWK_LOG_ERR(
+                MOD_NAME "Address: 0x%llx mapped to different node id:"
+                         " %u than expected: %u\n",
+                mmap->base,
+                io_region->node_id,
+                mmap->node_id);
+            fwk_unexpected();
+            return false;
+        }
+
+        FWK_LOG_INFO(
+            MOD_NAME "Found region: %d mapped for Node: %u ",
+            idx,
+            mmap->node_id);
+        *region_index = (uint32_t)idx;
+
+        return true;
+    }
+
+    return false;
 }
 
 static void update_io_region(
     struct mod_cmn700_mem_region_map *mmap,
     uint32_t region_idx)
 {
-    struct cmn700_rnsam_reg *rnsam;
+    struct cmn700_region_entry entry;
     uint32_t idx;
 
     FWK_LOG_INFO(MOD_NAME "Updating region: %" PRIX32, region_idx);
@@ -1039,15 +1295,16 @@ static void update_io_region(
         mmap->base + mmap->size - 1,
         mmap_type_name[mmap->type]);
 
+    encode_region(
+        ctx->internal_rnsam_table[0],
+        mmap->base,
+        mmap->size,
+        SAM_NODE_TYPE_HN_I,
+        SAM_TYPE_NON_HASH_MEM_REGION,
+        &entry);
+
     for (idx = 0; idx < ctx->internal_rnsam_count; idx++) {
-        rnsam = ctx->internal_rnsam_table[idx];
-        configure_region(
-            rnsam,
-            region_idx,
-            mmap->base,
-            mmap->size,
-            SAM_NODE_TYPE_HN_I,
-            SAM_TYPE_NON_HASH_MEM_REGION);
+        write_region(ctx->internal_rnsam_table[idx], region_idx, &entry);
     }
 }
 
@@ -1075,8 +1332,7 @@ static int map_io_region(uint64_t base, size_t size, uint32_t node_id)
 
     cmn700_rnsam_stall();
 
-    if (is_non_hash_region_mapped(
-            rnsam, ctx->region_io_count, &mmap, &region_idx)) {
+    if (find_io_region(&mmap, &region_idx)) {
         update_io_region(&mmap, region_idx);
     } else {
         FWK_LOG_INFO(MOD_NAME "Mapping region:");
@@ -1142,8 +1398,23 @@ static int cmn700_device_init(
     if (device_ctx->config->snf_count > CMN700_HNF_CACHE_GROUP_ENTRIES_MAX)
         return FWK_E_DATA;
 
+    /*
+     * The SN-Fs of an HN-F cluster are chosen from the HN-F logical
+     * identifiers, which do not follow the optimized system cache group layout.
+     */
+    if (device_ctx->config->hnf_scg_layout_optimize &&
+        device_ctx->config->hierarchical_hashing_enable &&
+        (device_ctx->config->hierarchical_hashing_config.sn_mode !=
+         MOD_CMN700_1_SN_MODE))
+        return FWK_E_DATA;
+
     device_ctx->root = (struct cmn700_cfgm_reg *)device_ctx->config->base;
 
+    if (device_ctx->config->topology_cache_base != 0) {
+        device_ctx->topology_cache = (struct cmn700_topology_cache *)
+                                         device_ctx->config->topology_cache_base;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -0,0 +1,170 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <mod_cmn700.h>
+
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+
+/*
+ * HN-Fs of the system cache group, by logical identifier. Consecutive logical
+ * identifiers are in opposite corners of the mesh:
+ *
+ *   y
+ *   3  .  .  .  1
+ *   2  .  .  .  3
+ *   1  2  .  .  .
+ *   0  0  .  .  .
+ *      0  1  2  3  x
+ */
+static const struct node_pos fake_hnf_pos[] = {
+    { .pos_x = 0, .pos_y = 0 },
+    { .pos_x = 3, .pos_y = 3 },
+    { .pos_x = 0, .pos_y = 1 },
+    { .pos_x = 3, .pos_y = 2 },
+};
+
+#define FAKE_HNF_COUNT FWK_ARRAY_SIZE(fake_hnf_pos)
+
+#define FAKE_CLUSTER_SIZE 2
+
+/* Requesters in the corners holding the HN-Fs */
+static const struct node_pos fake_rn_pos[] = {
+    { .pos_x = 0, .pos_y = 0 },
+    { .pos_x = 3, .pos_y = 3 },
+};
+
+#define FAKE_RN_COUNT FWK_ARRAY_SIZE(fake_rn_pos)
+
+static unsigned int hnf_list[FAKE_HNF_COUNT];
+
+void setUp(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < FAKE_HNF_COUNT; idx++) {
+        hnf_list[idx] = idx;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+void test_cmn700_scg_hops(void)
+{
+    TEST_ASSERT_EQUAL(0, cmn700_scg_hops(&fake_hnf_pos[0], &fake_hnf_pos[0]));
+    TEST_ASSERT_EQUAL(6, cmn700_scg_hops(&fake_hnf_pos[0], &fake_hnf_pos[1]));
+    TEST_ASSERT_EQUAL(6, cmn700_scg_hops(&fake_hnf_pos[1], &fake_hnf_pos[0]));
+    TEST_ASSERT_EQUAL(4, cmn700_scg_hops(&fake_hnf_pos[2], &fake_hnf_pos[3]));
+}
+
+void test_cmn700_scg_layout_order_single_cluster(void)
+{
+    static const unsigned int expected[] = { 0, 1, 2, 3 };
+
+    /* A single cluster, or no cluster at all, keeps the configured order */
+    cmn700_scg_layout_order(fake_hnf_pos, hnf_list, FAKE_HNF_COUNT, 0);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(expected, hnf_list, FAKE_HNF_COUNT);
+
+    cmn700_scg_layout_order(
+        fake_hnf_pos, hnf_list, FAKE_HNF_COUNT, FAKE_HNF_COUNT);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(expected, hnf_list, FAKE_HNF_COUNT);
+}
+
+void test_cmn700_scg_layout_order_compact_clusters(void)
+{
+    /* Each cluster holds the HN-Fs of one corner, starting from the origin */
+    static const unsigned int expected[] = { 0, 2, 3, 1 };
+
+    cmn700_scg_layout_order(
+        fake_hnf_pos, hnf_list, FAKE_HNF_COUNT, FAKE_CLUSTER_SIZE);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(expected, hnf_list, FAKE_HNF_COUNT);
+}
+
+void test_cmn700_scg_layout_order_partial_cluster(void)
+{
+    static const unsigned int expected[] = { 0, 2, 1 };
+
+    /* The last cluster is smaller than the others */
+    cmn700_scg_layout_order(fake_hnf_pos, hnf_list, 3, FAKE_CLUSTER_SIZE);
+    TEST_ASSERT_EQUAL_UINT_ARRAY(expected, hnf_list, 3);
+    TEST_ASSERT_EQUAL(3, hnf_list[3]);
+}
+
+void test_cmn700_scg_layout_evaluate(void)
+{
+    struct cmn700_scg_layout_stats stats;
+
+    /* Every cluster spans the mesh in the configured order */
+    cmn700_scg_layout_evaluate(
+        fake_hnf_pos,
+        hnf_list,
+        FAKE_HNF_COUNT,
+        FAKE_CLUSTER_SIZE,
+        fake_rn_pos,
+        FAKE_RN_COUNT,
+        &stats);
+    TEST_ASSERT_EQUAL(300, stats.avg_hops_x100);
+    TEST_ASSERT_EQUAL(6, stats.max_hops);
+
+    cmn700_scg_layout_order(
+        fake_hnf_pos, hnf_list, FAKE_HNF_COUNT, FAKE_CLUSTER_SIZE);
+
+    /* Every requester has a cluster next to it in the optimized order */
+    cmn700_scg_layout_evaluate(
+        fake_hnf_pos,
+        hnf_list,
+        FAKE_HNF_COUNT,
+        FAKE_CLUSTER_SIZE,
+        fake_rn_pos,
+        FAKE_RN_COUNT,
+        &stats);
+    TEST_ASSERT_EQUAL(50, stats.avg_hops_x100);
+    TEST_ASSERT_EQUAL(1, stats.max_hops);
+}
+
+void test_cmn700_scg_layout_evaluate_no_requester(void)
+{
+    struct cmn700_scg_layout_stats stats;
+
+    cmn700_scg_layout_evaluate(
+        fake_hnf_pos,
+        hnf_list,
+        FAKE_HNF_COUNT,
+        FAKE_CLUSTER_SIZE,
+        fake_rn_pos,
+        0,
+        &stats);
+    TEST_ASSERT_EQUAL(0, stats.avg_hops_x100);
+    TEST_ASSERT_EQUAL(0, stats.max_hops);
+}
+
+int cmn700_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_cmn700_scg_hops);
+    RUN_TEST(test_cmn700_scg_layout_order_single_cluster);
+    RUN_TEST(test_cmn700_scg_layout_order_compact_clusters);
+    RUN_TEST(test_cmn700_scg_layout_order_partial_cluster);
+    RUN_TEST(test_cmn700_scg_layout_evaluate);
+    RUN_TEST(test_cmn700_scg_layout_evaluate_no_requester);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return cmn700_test_main();
+}
+#endif
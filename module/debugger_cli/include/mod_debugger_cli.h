@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -26,6 +26,16 @@ struct mod_debugger_cli_module_config {
      * Time period to set for the poll alarm delay (milliseconds)
      */
     uint32_t poll_period;
+
+    /*!
+     * \brief Optional batch of commands run when Ctrl-B is pressed.
+     *
+     * \details Commands are separated by ';' or newlines. The batch runs
+     *      without entering the interactive CLI, and its output is sent to the
+     *      UART in the background, so a running system can be inspected (e.g.
+     *      "checkpoint list") without being paused. Set to NULL to disable.
+     */
+    const char *batch;
 };
 
 #endif /* MOD_DEBUGGER_CLI_H */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,8 @@
 
 enum debugger_cli_internal_event_idx {
     DEBUGGER_CLI_INTERNAL_EVENT_IDX_ENTER_DEBUGGER,
+    DEBUGGER_CLI_INTERNAL_EVENT_IDX_RUN_BATCH,
+    DEBUGGER_CLI_INTERNAL_EVENT_IDX_FLUSH_OUTPUT,
     DEBUGGER_CLI_INTERNAL_EVENT_IDX_COUNT
 };
 
@@ -25,13 +27,40 @@ static const fwk_id_t debugger_cli_event_id_request =
     FWK_ID_EVENT_INIT(FWK_MODULE_IDX_DEBUGGER_CLI,
         DEBUGGER_CLI_INTERNAL_EVENT_IDX_ENTER_DEBUGGER);
 
+static const fwk_id_t debugger_cli_event_id_run_batch =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_DEBUGGER_CLI,
+        DEBUGGER_CLI_INTERNAL_EVENT_IDX_RUN_BATCH);
+
+static const fwk_id_t debugger_cli_event_id_flush_output =
+    FWK_ID_EVENT_INIT(FWK_MODULE_IDX_DEBUGGER_CLI,
+        DEBUGGER_CLI_INTERNAL_EVENT_IDX_FLUSH_OUTPUT);
+
 static struct mod_timer_alarm_api *alarm_api;
 
+/* Set while a flush of the CLI output is queued */
+static volatile bool flush_pending;
+
+static void put_internal_event(unsigned int module_idx, fwk_id_t event_id)
+{
+    int status;
+    struct fwk_event *event;
+
+    /* Send out an event to do the work outside of the ISR */
+    event = &((struct fwk_event){
+        .source_id = FWK_ID_MODULE(module_idx),
+        .target_id = FWK_ID_MODULE(module_idx),
+        .id = event_id
+    });
+
+    status = fwk_put_event(event);
+
+    fwk_assert(status == FWK_SUCCESS);
+}
+
 static void alarm_callback(uintptr_t module_idx)
 {
     int status;
     char ch = 0;
-    struct fwk_event *event;
 
     /* Get the pending character (if any) from the UART without blocking */
     status = fwk_io_getch(fwk_io_stdin, &ch);
@@ -39,18 +68,41 @@ static void alarm_callback(uintptr_t module_idx)
     if (status == FWK_SUCCESS) {
         /* Ctrl-E has been pressed */
         if (ch == 0x05) {
-            /* Send out an event to start the CLI not inside an ISR */
-            event = &((struct fwk_event){
-                .source_id = FWK_ID_MODULE(module_idx),
-                .target_id = FWK_ID_MODULE(module_idx),
-                .id = debugger_cli_event_id_request
-            });
-
-            status = fwk_put_event(event);
+            put_internal_event(module_idx, debugger_cli_event_id_request);
+        }
 
-            fwk_assert(status == FWK_SUCCESS);
+        /* Ctrl-B has been pressed */
+        if (ch == 0x02) {
+            put_internal_event(module_idx, debugger_cli_event_id_run_batch);
         }
     }
+
+    /* Resume sending the output of the last batch, if it stalled */
+    if (!flush_pending && cli_output_pending()) {
+        flush_pending = true;
+        put_internal_event(module_idx, debugger_cli_event_id_flush_output);
+    }
+}
+
+static int flush_output(fwk_id_t id)
+{
+    int status;
+
+    status = (int)cli_flush_nowait();
+    if (status != FWK_PENDING) {
+        flush_pending = false;
+        return status;
+    }
+
+    /*
+     * The UART is busy, carry on once the other pending events have been
+     * processed rather than waiting for the next poll of the UART.
+     */
+    flush_pending = true;
+    put_internal_event(fwk_id_get_module_idx(id),
+        debugger_cli_event_id_flush_output);
+
+    return FWK_SUCCESS;
 }
 
 static int start_alarm(fwk_id_t id)
@@ -113,6 +165,7 @@ static int debugger_cli_start(fwk_id_t id)
 static int debugger_cli_process_event(const struct fwk_event *event,
                                       struct fwk_event *resp_event)
 {
+    const struct mod_debugger_cli_module_config *module_config;
     int status;
     int start_alarm_status;
 
@@ -137,6 +190,26 @@ static int debugger_cli_process_event(const struct fwk_event *event,
 exit_cli:
         cli_print("\n[CLI_DEBUGGER_MODULE] Exiting CLI\n");
         return status;
+
+    case DEBUGGER_CLI_INTERNAL_EVENT_IDX_RUN_BATCH:
+        module_config = fwk_module_get_data(event->target_id);
+        if (module_config->batch == NULL) {
+            return FWK_E_SUPPORT;
+        }
+
+        /*
+         * The output is sent in the background by the flush event. It ends
+         * with a notice if it did not fit in the print buffer.
+         */
+        status = cli_run_batch(module_config->batch);
+        if (!flush_pending) {
+            (void)flush_output(event->target_id);
+        }
+
+        return status;
+
+    case DEBUGGER_CLI_INTERNAL_EVENT_IDX_FLUSH_OUTPUT:
+        return flush_output(event->target_id);
     default:
         return FWK_E_PARAM;
     }
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -134,6 +134,10 @@ static void i2c_isr(uintptr_t data)
         i2c_reg->IC_CLR_TX_ABRT;
     }
 
+    /*
+     * The I2C HAL may start the next transaction of the request from this
+     * call, so the controller must not be accessed after it.
+     */
     ctx->i2c_api->transaction_completed(ctx->i2c_id, i2c_status);
 }
 
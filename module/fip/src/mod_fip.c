@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -12,53 +12,82 @@
 
 #include <fwk_id.h>
 #include <fwk_log.h>
+#include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_status.h>
-#include <fwk_string.h>
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <string.h>
 
-static const struct fip_uuid_desc fip_uuid_desc_arr[3] = {
-    FIP_UUID_NULL,
-    FIP_UUID_SCP_BL2,
-    FIP_UUID_TFA_BL31,
+static const struct fip_uuid_desc
+    fip_uuid_desc_arr[MOD_FIP_TOC_ENTRY_COUNT] = {
+        FIP_UUID_NULL,
+        FIP_UUID_SCP_BL2,
+        FIP_UUID_TFA_BL31,
+    };
+
+/*
+ * Index of the FIP ToC.
+ *
+ * The ToC is walked once and the entry of every known image type is recorded,
+ * so that subsequent lookups in the same FIP do not traverse the ToC again.
+ * The index is indexed the same way as the known UUID descriptors: default
+ * descriptors first, followed by the custom descriptors of the configuration.
+ */
+struct fip_ctx {
+    /* Module configuration */
+    const struct mod_fip_module_config *config;
+
+    /* Number of known UUID descriptors */
+    size_t desc_count;
+
+    /* ToC entry of each known UUID descriptor, NULL if not in the FIP */
+    const struct fip_toc_entry **entry;
+
+    /* Base address of the indexed FIP */
+    uintptr_t base;
+
+    /* Serial number of the indexed FIP */
+    uint32_t serial_number;
+
+    /* Flags of the indexed FIP */
+    uint64_t flags;
+
+    /* Whether the index describes the FIP at base */
+    bool indexed;
 };
 
+static struct fip_ctx fip_ctx;
+
 /*
  * Static helpers
  */
-static int fip_entry_type_to_uuid(
+static const struct fip_uuid_desc *fip_get_desc(size_t index)
+{
+    if (index < MOD_FIP_TOC_ENTRY_COUNT) {
+        return &fip_uuid_desc_arr[index];
+    }
+
+    return &fip_ctx.config->custom_fip_uuid_desc_arr
+                [index - MOD_FIP_TOC_ENTRY_COUNT];
+}
+
+static int fip_entry_type_to_index(
     enum mod_fip_toc_entry_type type,
-    uint8_t *uuid)
+    size_t *index)
 {
-    const struct mod_fip_module_config *module_config;
     size_t i;
 
-    module_config = fwk_module_get_data(fwk_module_id_fip);
-    size_t desc_arr_size =
-        sizeof(fip_uuid_desc_arr) / sizeof(fip_uuid_desc_arr[0]);
-
     if (type < MOD_FIP_TOC_ENTRY_COUNT) {
-        for (i = 0; i < desc_arr_size; i++) {
-            if (fip_uuid_desc_arr[i].image_type == type) {
-                fwk_str_memcpy(
-                    uuid, fip_uuid_desc_arr[i].uuid, FIP_UUID_ENTRY_SIZE);
-                return FWK_SUCCESS;
-            }
-        }
+        *index = (size_t)type;
+        return FWK_SUCCESS;
     }
 
-    if (type >= MOD_FIP_TOC_ENTRY_COUNT &&
-        module_config->custom_fip_uuid_desc_arr != NULL) {
-        for (i = 0; i < module_config->custom_uuid_desc_count; i++) {
-            if (module_config->custom_fip_uuid_desc_arr[i].image_type == type) {
-                fwk_str_memcpy(
-                    uuid,
-                    module_config->custom_fip_uuid_desc_arr[i].uuid,
-                    FIP_UUID_ENTRY_SIZE);
-                return FWK_SUCCESS;
-            }
+    for (i = MOD_FIP_TOC_ENTRY_COUNT; i < fip_ctx.desc_count; i++) {
+        if (fip_get_desc(i)->image_type == type) {
+            *index = i;
+            return FWK_SUCCESS;
         }
     }
 
@@ -67,17 +96,7 @@ static int fip_entry_type_to_uuid(
 
 static inline bool uuid_cmp(const uint8_t *a, const uint8_t *b)
 {
-    int match = 0;
-
-    for (unsigned int i = 0; i < FIP_UUID_ENTRY_SIZE; i++) {
-        if (a[i] == b[i]) {
-            match++;
-        } else {
-            match--;
-        }
-    }
-
-    return (match == FIP_UUID_ENTRY_SIZE);
+    return memcmp(a, b, FIP_UUID_ENTRY_SIZE) == 0;
 }
 
 static bool uuid_is_null(const uint8_t *uuid)
@@ -91,6 +110,71 @@ static bool validate_fip_toc(const struct fip_toc *const toc)
     return toc->header.name == FIP_TOC_HEADER_NAME;
 }
 
+static bool fip_index_is_current(const struct fip_toc *const toc)
+{
+    return fip_ctx.indexed && (fip_ctx.base == (uintptr_t)toc) &&
+        (fip_ctx.serial_number == toc->header.serial_number) &&
+        (fip_ctx.flags == toc->header.flags);
+}
+
+/*
+ * Walk the ToC once, until the ToC End Marker, and record the first entry
+ * matching each known UUID.
+ */
+static void fip_build_index(const struct fip_toc *const toc)
+{
+    const struct fip_toc_entry *toc_entry = toc->entry;
+    size_t i;
+    bool end;
+
+    memset(fip_ctx.entry, 0, fip_ctx.desc_count * sizeof(fip_ctx.entry[0]));
+
+    do {
+        end = uuid_is_null(toc_entry->uuid);
+
+        for (i = 0; i < fip_ctx.desc_count; i++) {
+            if ((fip_ctx.entry[i] == NULL) &&
+                uuid_cmp(toc_entry->uuid, fip_get_desc(i)->uuid)) {
+                fip_ctx.entry[i] = toc_entry;
+                break;
+            }
+        }
+
+        toc_entry++;
+    } while (!end);
+
+    fip_ctx.base = (uintptr_t)toc;
+    fip_ctx.serial_number = toc->header.serial_number;
+    fip_ctx.flags = toc->header.flags;
+    fip_ctx.indexed = true;
+}
+
+static const struct fip_toc_entry *fip_lookup(
+    const struct fip_toc *const toc,
+    size_t index)
+{
+    const struct fip_toc_entry *toc_entry;
+
+    if (!fip_index_is_current(toc)) {
+        fip_build_index(toc);
+    }
+
+    toc_entry = fip_ctx.entry[index];
+
+    /*
+     * The FIP may have been rewritten in place without changing its header.
+     * Check the entry still holds the expected UUID and rebuild the index
+     * otherwise.
+     */
+    if ((toc_entry != NULL) &&
+        !uuid_cmp(toc_entry->uuid, fip_get_desc(index)->uuid)) {
+        fip_build_index(toc);
+        toc_entry = fip_ctx.entry[index];
+    }
+
+    return toc_entry;
+}
+
 /*
  * Module API functions
  */
@@ -101,8 +185,8 @@ static int fip_get_entry(
     size_t limit)
 {
     uintptr_t address;
-    uint8_t target_uuid[FIP_UUID_ENTRY_SIZE];
-    struct fip_toc_entry *toc_entry;
+    size_t index;
+    const struct fip_toc_entry *toc_entry;
     int status;
     struct fip_toc *toc = (void *)base;
 
@@ -118,22 +202,18 @@ static int fip_get_entry(
         return FWK_E_PARAM;
     }
 
-    toc_entry = toc->entry;
-
-    /* Updates target_uuid field with UUID of corresponding image_type passed */
-    status = fip_entry_type_to_uuid(image_type, target_uuid);
+    /* Find the UUID descriptor of the image_type passed */
+    status = fip_entry_type_to_index(image_type, &index);
     if (status != FWK_SUCCESS)
         return status;
 
     /*
-     * Traverse all FIP ToC entries until the desired entry is found or ToC
-     * End Marker is reached
+     * Find the desired entry in the ToC index, which is built on the first
+     * lookup in this FIP
      */
-    while (!uuid_cmp(toc_entry->uuid, target_uuid)) {
-        if (uuid_is_null(toc_entry->uuid))
-            return FWK_E_RANGE;
-        toc_entry++;
-    }
+    toc_entry = fip_lookup(toc, index);
+    if (toc_entry == NULL)
+        return FWK_E_RANGE;
 
     /* Sanity checks of the retrieved entry data */
     if (__builtin_add_overflow(
@@ -162,6 +242,16 @@ static int fip_init(
     unsigned int element_count,
     const void *data)
 {
+    fip_ctx.config = data;
+    fip_ctx.desc_count = MOD_FIP_TOC_ENTRY_COUNT;
+
+    if ((fip_ctx.config != NULL) &&
+        (fip_ctx.config->custom_fip_uuid_desc_arr != NULL)) {
+        fip_ctx.desc_count += fip_ctx.config->custom_uuid_desc_count;
+    }
+
+    fip_ctx.entry = fwk_mm_calloc(fip_ctx.desc_count, sizeof(fip_ctx.entry[0]));
+
     return FWK_SUCCESS;
 }
 
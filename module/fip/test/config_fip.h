@@ -0,0 +1,45 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_fip.h>
+
+#include <fwk_macros.h>
+
+/* Image type of the custom descriptor */
+#define FAKE_FIP_TOC_ENTRY_CUSTOM (MOD_FIP_TOC_ENTRY_COUNT + 1)
+
+/* Image type with no descriptor */
+#define FAKE_FIP_TOC_ENTRY_UNKNOWN (MOD_FIP_TOC_ENTRY_COUNT + 2)
+
+/* Offset, size and flags of the images of the fake FIP */
+#define FAKE_FIP_SCP_BL2_OFFSET 0x100
+#define FAKE_FIP_SCP_BL2_SIZE 0x40
+#define FAKE_FIP_SCP_BL2_FLAGS 0x1
+#define FAKE_FIP_TFA_BL31_OFFSET 0x140
+#define FAKE_FIP_TFA_BL31_SIZE 0x80
+#define FAKE_FIP_TFA_BL31_FLAGS 0x2
+#define FAKE_FIP_CUSTOM_OFFSET 0x1C0
+#define FAKE_FIP_CUSTOM_SIZE 0x20
+#define FAKE_FIP_CUSTOM_FLAGS 0x4
+
+/* Size of the media holding the fake FIP */
+#define FAKE_FIP_SIZE 0x200
+
+#define FAKE_FIP_SERIAL_NUMBER 0x12345678
+
+static struct fip_uuid_desc fake_custom_uuid_desc_arr[] = {
+    {
+        .image_type = (enum mod_fip_toc_entry_type)FAKE_FIP_TOC_ENTRY_CUSTOM,
+        .uuid = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10 },
+    },
+};
+
+static const struct mod_fip_module_config fake_fip_config = {
+    .custom_fip_uuid_desc_arr = fake_custom_uuid_desc_arr,
+    .custom_uuid_desc_count = FWK_ARRAY_SIZE(fake_custom_uuid_desc_arr),
+};
@@ -0,0 +1,327 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <mod_fip.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_mm.h>
+#include <fwk_module_idx.h>
+
+#include UNIT_TEST_SRC
+#include "config_fip.h"
+
+/* Media holding the fake FIP */
+static uint64_t fake_fip[FAKE_FIP_SIZE / sizeof(uint64_t)];
+
+static struct fip_toc *fake_toc = (struct fip_toc *)fake_fip;
+
+static void fake_toc_entry_set(
+    unsigned int entry_idx,
+    const struct fip_uuid_desc *desc,
+    uint64_t offset,
+    uint64_t size,
+    uint64_t flags)
+{
+    struct fip_toc_entry *entry = &fake_toc->entry[entry_idx];
+
+    memcpy(entry->uuid, desc->uuid, sizeof(entry->uuid));
+    entry->offset_address = offset;
+    entry->size = size;
+    entry->flags = flags;
+}
+
+static void fake_toc_entry_set_null(unsigned int entry_idx)
+{
+    struct fip_uuid_desc null_desc = FIP_UUID_NULL;
+
+    fake_toc_entry_set(entry_idx, &null_desc, 0, 0, 0);
+}
+
+static void get_entry_expect(
+    enum mod_fip_toc_entry_type image_type,
+    uintptr_t base,
+    uint64_t offset,
+    uint64_t size,
+    uint64_t flags)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    status = fip_get_entry(image_type, &entry_data, base, FAKE_FIP_SIZE);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL_PTR((void *)(base + offset), entry_data.base);
+    TEST_ASSERT_EQUAL(size, entry_data.size);
+    TEST_ASSERT_EQUAL(flags, entry_data.flags);
+}
+
+void setUp(void)
+{
+    struct fip_uuid_desc scp_bl2_desc = FIP_UUID_SCP_BL2;
+    struct fip_uuid_desc tfa_bl31_desc = FIP_UUID_TFA_BL31;
+    int status;
+
+    memset(fake_fip, 0, sizeof(fake_fip));
+
+    fake_toc->header.name = FIP_TOC_HEADER_NAME;
+    fake_toc->header.serial_number = FAKE_FIP_SERIAL_NUMBER;
+    fake_toc->header.flags = 0;
+
+    fake_toc_entry_set(
+        0,
+        &scp_bl2_desc,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+    fake_toc_entry_set(
+        1,
+        &tfa_bl31_desc,
+        FAKE_FIP_TFA_BL31_OFFSET,
+        FAKE_FIP_TFA_BL31_SIZE,
+        FAKE_FIP_TFA_BL31_FLAGS);
+    fake_toc_entry_set_null(2);
+
+    memset(&fip_ctx, 0, sizeof(fip_ctx));
+
+    status = fip_init(fwk_module_id_fip, 0, &fake_fip_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void tearDown(void)
+{
+    fwk_mm_free(fip_ctx.entry);
+}
+
+void test_fip_get_entry_invalid_header(void)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    fake_toc->header.name = ~FIP_TOC_HEADER_NAME;
+
+    status = fip_get_entry(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        &entry_data,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SIZE);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+    TEST_ASSERT_FALSE(fip_ctx.indexed);
+}
+
+void test_fip_get_entry_unknown_type(void)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    status = fip_get_entry(
+        (enum mod_fip_toc_entry_type)FAKE_FIP_TOC_ENTRY_UNKNOWN,
+        &entry_data,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SIZE);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_fip_get_entry_builds_index(void)
+{
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_TFA_BL31,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_TFA_BL31_OFFSET,
+        FAKE_FIP_TFA_BL31_SIZE,
+        FAKE_FIP_TFA_BL31_FLAGS);
+
+    /* The whole ToC is indexed by the first lookup */
+    TEST_ASSERT_TRUE(fip_ctx.indexed);
+    TEST_ASSERT_EQUAL_PTR((uintptr_t)fake_fip, fip_ctx.base);
+    TEST_ASSERT_EQUAL_PTR(
+        &fake_toc->entry[0], fip_ctx.entry[MOD_FIP_TOC_ENTRY_SCP_BL2]);
+    TEST_ASSERT_EQUAL_PTR(
+        &fake_toc->entry[1], fip_ctx.entry[MOD_FIP_TOC_ENTRY_TFA_BL31]);
+    TEST_ASSERT_NULL(fip_ctx.entry[MOD_FIP_TOC_ENTRY_COUNT]);
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+}
+
+void test_fip_get_entry_absent(void)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    status = fip_get_entry(
+        (enum mod_fip_toc_entry_type)FAKE_FIP_TOC_ENTRY_CUSTOM,
+        &entry_data,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SIZE);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
+void test_fip_get_entry_reuses_index(void)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+
+    /*
+     * Add the custom image behind the back of the index. The header is
+     * unchanged, so the index is not rebuilt and the image is not found.
+     */
+    fake_toc_entry_set(
+        2,
+        &fake_custom_uuid_desc_arr[0],
+        FAKE_FIP_CUSTOM_OFFSET,
+        FAKE_FIP_CUSTOM_SIZE,
+        FAKE_FIP_CUSTOM_FLAGS);
+    fake_toc_entry_set_null(3);
+
+    status = fip_get_entry(
+        (enum mod_fip_toc_entry_type)FAKE_FIP_TOC_ENTRY_CUSTOM,
+        &entry_data,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SIZE);
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+}
+
+void test_fip_get_entry_rebuilds_index_on_header_change(void)
+{
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+
+    fake_toc_entry_set(
+        2,
+        &fake_custom_uuid_desc_arr[0],
+        FAKE_FIP_CUSTOM_OFFSET,
+        FAKE_FIP_CUSTOM_SIZE,
+        FAKE_FIP_CUSTOM_FLAGS);
+    fake_toc_entry_set_null(3);
+    fake_toc->header.serial_number++;
+
+    get_entry_expect(
+        (enum mod_fip_toc_entry_type)FAKE_FIP_TOC_ENTRY_CUSTOM,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_CUSTOM_OFFSET,
+        FAKE_FIP_CUSTOM_SIZE,
+        FAKE_FIP_CUSTOM_FLAGS);
+    TEST_ASSERT_EQUAL(fake_toc->header.serial_number, fip_ctx.serial_number);
+}
+
+void test_fip_get_entry_rebuilds_index_on_base_change(void)
+{
+    static uint64_t other_fip[FAKE_FIP_SIZE / sizeof(uint64_t)];
+    struct fip_toc *other_toc = (struct fip_toc *)other_fip;
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+
+    memcpy(other_fip, fake_fip, sizeof(other_fip));
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)other_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+    TEST_ASSERT_EQUAL_PTR((uintptr_t)other_fip, fip_ctx.base);
+    TEST_ASSERT_EQUAL_PTR(
+        &other_toc->entry[0], fip_ctx.entry[MOD_FIP_TOC_ENTRY_SCP_BL2]);
+}
+
+void test_fip_get_entry_rebuilds_index_on_uuid_mismatch(void)
+{
+    struct fip_uuid_desc scp_bl2_desc = FIP_UUID_SCP_BL2;
+    struct fip_uuid_desc tfa_bl31_desc = FIP_UUID_TFA_BL31;
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+
+    /* Rewrite the FIP in place with the entries swapped, same header */
+    fake_toc_entry_set(
+        0,
+        &tfa_bl31_desc,
+        FAKE_FIP_TFA_BL31_OFFSET,
+        FAKE_FIP_TFA_BL31_SIZE,
+        FAKE_FIP_TFA_BL31_FLAGS);
+    fake_toc_entry_set(
+        1,
+        &scp_bl2_desc,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+
+    get_entry_expect(
+        MOD_FIP_TOC_ENTRY_SCP_BL2,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_SCP_BL2_OFFSET,
+        FAKE_FIP_SCP_BL2_SIZE,
+        FAKE_FIP_SCP_BL2_FLAGS);
+    TEST_ASSERT_EQUAL_PTR(
+        &fake_toc->entry[1], fip_ctx.entry[MOD_FIP_TOC_ENTRY_SCP_BL2]);
+    TEST_ASSERT_EQUAL_PTR(
+        &fake_toc->entry[0], fip_ctx.entry[MOD_FIP_TOC_ENTRY_TFA_BL31]);
+}
+
+void test_fip_get_entry_beyond_limit(void)
+{
+    int status;
+    struct mod_fip_entry_data entry_data;
+
+    status = fip_get_entry(
+        MOD_FIP_TOC_ENTRY_TFA_BL31,
+        &entry_data,
+        (uintptr_t)fake_fip,
+        FAKE_FIP_TFA_BL31_OFFSET + FAKE_FIP_TFA_BL31_SIZE - 1);
+    TEST_ASSERT_EQUAL(FWK_E_SIZE, status);
+}
+
+int fip_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fip_get_entry_invalid_header);
+    RUN_TEST(test_fip_get_entry_unknown_type);
+    RUN_TEST(test_fip_get_entry_builds_index);
+    RUN_TEST(test_fip_get_entry_absent);
+    RUN_TEST(test_fip_get_entry_reuses_index);
+    RUN_TEST(test_fip_get_entry_rebuilds_index_on_header_change);
+    RUN_TEST(test_fip_get_entry_rebuilds_index_on_base_change);
+    RUN_TEST(test_fip_get_entry_rebuilds_index_on_uuid_mismatch);
+    RUN_TEST(test_fip_get_entry_beyond_limit);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return fip_test_main();
+}
+#endif
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -33,6 +33,11 @@
  * \{
  */
 
+/*!
+ * \brief Default number of requests that can be queued on an I2C device.
+ */
+#define MOD_I2C_REQUEST_QUEUE_LENGTH_DEFAULT 8
+
 /*!
  * \brief Configuration data for an I2C device.
  */
@@ -45,6 +50,15 @@ struct mod_i2c_dev_config {
 
     /*! Identifier of the driver API. */
     fwk_id_t api_id;
+
+    /*!
+     * \brief Maximum number of requests queued on the device, including the
+     *      request being processed.
+     *
+     * \details A batch request takes a single entry of the queue. If zero,
+     *      ::MOD_I2C_REQUEST_QUEUE_LENGTH_DEFAULT is used.
+     */
+    unsigned int request_queue_length;
 };
 
 /*!
@@ -85,9 +99,6 @@ struct mod_i2c_request {
     uint8_t *receive_data;
 };
 
-static_assert(sizeof(struct mod_i2c_request) <= FWK_EVENT_PARAMETERS_SIZE,
-    "An I2C request should fit in the params field of an event\n");
-
 /*!
  * \brief I2C driver interface.
  *
@@ -158,7 +169,7 @@ struct mod_i2c_api {
      *
      * \retval ::FWK_PENDING The request was submitted.
      * \retval ::FWK_E_PARAM One or more parameters were invalid.
-     * \retval ::FWK_E_BUSY An I2C transaction is already on-going.
+     * \retval ::FWK_E_BUSY The request queue of the device is full.
      * \retval ::FWK_E_DEVICE The transmission is aborted due to a device error.
      * \return One of the standard framework status codes.
      */
@@ -184,7 +195,7 @@ struct mod_i2c_api {
      *
      * \retval ::FWK_PENDING The request was submitted.
      * \retval ::FWK_E_PARAM One or more parameters were invalid.
-     * \retval ::FWK_E_BUSY An I2C transaction is already on-going.
+     * \retval ::FWK_E_BUSY The request queue of the device is full.
      * \retval ::FWK_E_DEVICE The reception is aborted due to a device error.
      * \return One of the standard framework status codes.
      */
@@ -217,7 +228,7 @@ struct mod_i2c_api {
      *
      * \retval ::FWK_PENDING The request was submitted.
      * \retval ::FWK_E_PARAM One or more parameters were invalid.
-     * \retval ::FWK_E_BUSY An I2C transaction is already on-going.
+     * \retval ::FWK_E_BUSY The request queue of the device is full.
      * \retval ::FWK_E_DEVICE The reception is aborted due to a device error.
      * \return One of the standard framework status codes.
      */
@@ -228,6 +239,33 @@ struct mod_i2c_api {
         uint8_t *receive_data,
         uint8_t transmit_byte_count,
         uint8_t receive_byte_count);
+
+    /*!
+     * \brief Request the execution of a batch of transactions as Controller.
+     *
+     * \details The transactions of the batch, for example a list of register
+     *      reads and writes, are executed back to back and a single response
+     *      event is sent to the client when the last transaction has
+     *      completed or when one of them has failed, in which case the
+     *      remaining transactions are not executed. When the function returns
+     *      the batch is not completed, possibly not even started. The table of
+     *      requests and the data buffers must stay allocated and their content
+     *      must not be modified until the batch is completed or aborted.
+     *
+     * \param dev_id Identifier of the I2C device
+     * \param requests Table of transaction requests
+     * \param request_count Number of transaction requests in the table
+     *
+     * \retval ::FWK_PENDING The request was submitted.
+     * \retval ::FWK_E_PARAM One or more parameters were invalid.
+     * \retval ::FWK_E_BUSY The request queue of the device is full.
+     * \retval ::FWK_E_DEVICE The batch is aborted due to a device error.
+     * \return One of the standard framework status codes.
+     */
+    int (*transfer_batch_as_controller)(
+        fwk_id_t dev_id,
+        struct mod_i2c_request *requests,
+        uint8_t request_count);
 };
 
 /*!
@@ -242,6 +280,11 @@ struct mod_i2c_driver_response_api {
      * \brief Function called back after the completion or abortion of an I2C
      *      transaction request.
      *
+     * \details The function may be called from the interrupt handler of the
+     *      driver. When the transaction is part of a request that has further
+     *      transactions to execute, the I2C HAL starts the next one from
+     *      within this function through the driver interface.
+     *
      * \param dev_id Identifier of the I2C device
      * \param i2c_status I2C transaction status
      */
@@ -277,6 +320,7 @@ enum mod_i2c_event_idx {
     MOD_I2C_EVENT_IDX_REQUEST_TRANSMIT,
     MOD_I2C_EVENT_IDX_REQUEST_RECEIVE,
     MOD_I2C_EVENT_IDX_REQUEST_TRANSMIT_THEN_RECEIVE,
+    MOD_I2C_EVENT_IDX_REQUEST_BATCH,
     MOD_I2C_EVENT_IDX_COUNT,
 };
 
@@ -292,6 +336,10 @@ static const fwk_id_t mod_i2c_event_id_request_rx = FWK_ID_EVENT_INIT(
 static const fwk_id_t mod_i2c_event_id_request_tx_rx = FWK_ID_EVENT_INIT(
     FWK_MODULE_IDX_I2C, MOD_I2C_EVENT_IDX_REQUEST_TRANSMIT_THEN_RECEIVE);
 
+/*! Batch request event identifier */
+static const fwk_id_t mod_i2c_event_id_request_batch = FWK_ID_EVENT_INIT(
+    FWK_MODULE_IDX_I2C, MOD_I2C_EVENT_IDX_REQUEST_BATCH);
+
 /*!
  * \}
  */
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -27,10 +27,43 @@ enum mod_i2c_dev_state {
     MOD_I2C_DEV_PANIC,
 };
 
+/* Entry of the request queue of a device */
+struct mod_i2c_queue_entry {
+    /* Table of the transaction requests to execute */
+    struct mod_i2c_request *requests;
+
+    /* Number of transaction requests in the table */
+    uint8_t request_count;
+
+    /* Copy of the transaction request of a single request */
+    struct mod_i2c_request request;
+
+    /* Whether the entry holds a request */
+    bool in_use;
+};
+
+/* Parameters of the request events */
+struct mod_i2c_request_event_param {
+    /* Queue entry holding the request */
+    struct mod_i2c_queue_entry *entry;
+};
+
+static_assert(
+    sizeof(struct mod_i2c_request_event_param) <= FWK_EVENT_PARAMETERS_SIZE,
+    "An I2C request should fit in the params field of an event\n");
+
 struct mod_i2c_dev_ctx {
     const struct mod_i2c_dev_config *config;
     const struct mod_i2c_driver_api *driver_api;
-    struct mod_i2c_request request;
+
+    /* Request queue of the device */
+    struct mod_i2c_queue_entry *queue;
+    unsigned int queue_length;
+
+    /* Queue entry being processed and index of its current transaction */
+    struct mod_i2c_queue_entry *entry;
+    unsigned int request_idx;
+
     enum mod_i2c_dev_state state;
 };
 
@@ -60,34 +93,129 @@ static void get_ctx(fwk_id_t id, struct mod_i2c_dev_ctx **ctx)
     *ctx = ctx_table + fwk_id_get_element_idx(id);
 }
 
-static int create_i2c_request(fwk_id_t dev_id,
-                              struct mod_i2c_request *request)
+/*
+ * Start the current transaction of the request being processed. This is also
+ * called from the interrupt handler of the driver, through the driver response
+ * API, to chain the transactions of a request.
+ */
+static int process_request(struct mod_i2c_dev_ctx *ctx)
+{
+    int drv_status = FWK_SUCCESS;
+    const struct mod_i2c_driver_api *driver_api = ctx->driver_api;
+    fwk_id_t driver_id = ctx->config->driver_id;
+    struct mod_i2c_request *request = &ctx->entry->requests[ctx->request_idx];
+
+    if (request->transmit_byte_count > 0) {
+        ctx->state = (request->receive_byte_count > 0) ? MOD_I2C_DEV_TX_RX :
+                                                         MOD_I2C_DEV_TX;
+        drv_status = driver_api->transmit_as_controller(driver_id, request);
+
+        if (drv_status != FWK_SUCCESS) {
+            /* The request has failed or been acknowledged */
+            return drv_status;
+        }
+    }
+
+    if (request->receive_byte_count > 0) {
+        ctx->state = MOD_I2C_DEV_RX;
+        drv_status = driver_api->receive_as_controller(driver_id, request);
+    }
+
+    return drv_status;
+}
+
+/*
+ * Execute the transactions of the request being processed, from the current
+ * one, until one of them is pending or has failed.
+ */
+static int process_transactions(struct mod_i2c_dev_ctx *ctx)
+{
+    int drv_status;
+
+    do {
+        drv_status = process_request(ctx);
+        if (drv_status != FWK_SUCCESS) {
+            return drv_status;
+        }
+
+        ctx->request_idx++;
+    } while (ctx->request_idx < ctx->entry->request_count);
+
+    return FWK_SUCCESS;
+}
+
+static int start_request(
+    struct mod_i2c_dev_ctx *ctx,
+    struct mod_i2c_queue_entry *entry)
+{
+    ctx->entry = entry;
+    ctx->request_idx = 0;
+
+    return process_transactions(ctx);
+}
+
+static struct mod_i2c_queue_entry *alloc_queue_entry(
+    struct mod_i2c_dev_ctx *ctx)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < ctx->queue_length; idx++) {
+        if (!ctx->queue[idx].in_use) {
+            ctx->queue[idx].in_use = true;
+            return &ctx->queue[idx];
+        }
+    }
+
+    return NULL;
+}
+
+static int create_i2c_request(
+    fwk_id_t dev_id,
+    fwk_id_t event_id,
+    struct mod_i2c_request *requests,
+    uint8_t request_count)
 {
     int status;
+    unsigned int idx;
     struct fwk_event event;
-    struct mod_i2c_request *event_param =
-        (struct mod_i2c_request *)event.params;
+    struct mod_i2c_dev_ctx *ctx;
+    struct mod_i2c_queue_entry *entry;
+    struct mod_i2c_request_event_param *event_param =
+        (struct mod_i2c_request_event_param *)event.params;
 
-    /* The target address should be on 7 bits */
-    if (!fwk_expect(request->target_address < 0x80)) {
-        return FWK_E_PARAM;
+    for (idx = 0; idx < request_count; idx++) {
+        /* The target address should be on 7 bits */
+        if (!fwk_expect(requests[idx].target_address < 0x80)) {
+            return FWK_E_PARAM;
+        }
+    }
+
+    get_ctx(dev_id, &ctx);
+
+    entry = alloc_queue_entry(ctx);
+    if (entry == NULL) {
+        return FWK_E_BUSY;
     }
 
+    if (request_count == 1) {
+        /*
+         * A single request is copied to the queue so that the caller does not
+         * have to keep it allocated.
+         */
+        entry->request = *requests;
+        entry->requests = &entry->request;
+    } else {
+        entry->requests = requests;
+    }
+    entry->request_count = request_count;
+
     event = (struct fwk_event) {
         .target_id = dev_id,
+        .id = event_id,
         .response_requested = true,
     };
 
-    *event_param = *request;
-
-    if ((request->transmit_byte_count > 0) &&
-        (request->receive_byte_count > 0)) {
-        event.id = mod_i2c_event_id_request_tx_rx;
-    } else if (request->transmit_byte_count > 0) {
-        event.id = mod_i2c_event_id_request_tx;
-    } else if (request->receive_byte_count > 0) {
-        event.id = mod_i2c_event_id_request_rx;
-    }
+    event_param->entry = entry;
 
     status = fwk_put_event(&event);
     if (status == FWK_SUCCESS) {
@@ -99,6 +227,8 @@ static int create_i2c_request(fwk_id_t dev_id,
         return FWK_PENDING;
     }
 
+    entry->in_use = false;
+
     return status;
 }
 
@@ -125,7 +255,8 @@ static int transmit_as_controller(
         .transmit_byte_count = byte_count,
     };
 
-    return create_i2c_request(dev_id, &request);
+    return create_i2c_request(
+        dev_id, mod_i2c_event_id_request_tx, &request, 1);
 }
 
 static int receive_as_controller(
@@ -148,7 +279,8 @@ static int receive_as_controller(
         .receive_byte_count = byte_count,
     };
 
-    return create_i2c_request(dev_id, &request);
+    return create_i2c_request(
+        dev_id, mod_i2c_event_id_request_rx, &request, 1);
 }
 
 static int transmit_then_receive_as_controller(
@@ -175,13 +307,49 @@ static int transmit_then_receive_as_controller(
         .receive_byte_count = receive_byte_count,
     };
 
-    return create_i2c_request(dev_id, &request);
+    return create_i2c_request(
+        dev_id, mod_i2c_event_id_request_tx_rx, &request, 1);
+}
+
+static int transfer_batch_as_controller(
+    fwk_id_t dev_id,
+    struct mod_i2c_request *requests,
+    uint8_t request_count)
+{
+    unsigned int idx;
+    struct mod_i2c_request *request;
+
+    if (!fwk_expect((requests != NULL) && (request_count != 0))) {
+        return FWK_E_PARAM;
+    }
+
+    for (idx = 0; idx < request_count; idx++) {
+        request = &requests[idx];
+
+        if (!fwk_expect(
+                (request->transmit_byte_count != 0) ||
+                (request->receive_byte_count != 0))) {
+            return FWK_E_PARAM;
+        }
+
+        if (!fwk_expect(
+                ((request->transmit_byte_count == 0) ||
+                 (request->transmit_data != NULL)) &&
+                ((request->receive_byte_count == 0) ||
+                 (request->receive_data != NULL)))) {
+            return FWK_E_PARAM;
+        }
+    }
+
+    return create_i2c_request(
+        dev_id, mod_i2c_event_id_request_batch, requests, request_count);
 }
 
 static struct mod_i2c_api i2c_api = {
     .transmit_as_controller = transmit_as_controller,
     .receive_as_controller = receive_as_controller,
     .transmit_then_receive_as_controller = transmit_then_receive_as_controller,
+    .transfer_batch_as_controller = transfer_batch_as_controller,
 };
 
 /*
@@ -191,9 +359,39 @@ static void transaction_completed(fwk_id_t dev_id, int i2c_status)
 {
     int status;
     struct fwk_event event;
+    struct mod_i2c_dev_ctx *ctx;
     struct mod_i2c_event_param* param =
         (struct mod_i2c_event_param *)event.params;
 
+    get_ctx(dev_id, &ctx);
+
+    /*
+     * The next transfer of the request is started from here, so that only the
+     * completion of the whole request goes through the event queue.
+     */
+    if (i2c_status == FWK_SUCCESS) {
+        if (ctx->state == MOD_I2C_DEV_TX_RX) {
+            /* The TX request succeeded, proceed with the RX */
+            ctx->state = MOD_I2C_DEV_RX;
+
+            i2c_status = ctx->driver_api->receive_as_controller(
+                ctx->config->driver_id,
+                &ctx->entry->requests[ctx->request_idx]);
+        }
+
+        if (i2c_status == FWK_SUCCESS) {
+            ctx->request_idx++;
+
+            if (ctx->request_idx < ctx->entry->request_count) {
+                i2c_status = process_transactions(ctx);
+            }
+        }
+
+        if (i2c_status == FWK_PENDING) {
+            return;
+        }
+    }
+
     event = (struct fwk_event) {
         .target_id = dev_id,
         .source_id = dev_id,
@@ -231,6 +429,13 @@ static int mod_i2c_dev_init(fwk_id_t element_id,
     ctx = ctx_table + fwk_id_get_element_idx(element_id);
     ctx->config = (struct mod_i2c_dev_config *)data;
 
+    ctx->queue_length = ctx->config->request_queue_length;
+    if (ctx->queue_length == 0) {
+        ctx->queue_length = MOD_I2C_REQUEST_QUEUE_LENGTH_DEFAULT;
+    }
+
+    ctx->queue = fwk_mm_calloc(ctx->queue_length, sizeof(ctx->queue[0]));
+
     return FWK_SUCCESS;
 }
 
@@ -306,50 +511,13 @@ static int respond_to_caller(
         return status;
     }
 
+    ctx->entry->in_use = false;
+
     param->status = (drv_status == FWK_SUCCESS) ? FWK_SUCCESS : FWK_E_DEVICE;
 
     return fwk_put_event(&resp);
 }
 
-static int process_request(struct mod_i2c_dev_ctx *ctx, fwk_id_t event_id)
-{
-    int drv_status = FWK_E_PARAM;
-    const struct mod_i2c_driver_api *driver_api = ctx->driver_api;
-    fwk_id_t driver_id = ctx->config->driver_id;
-    enum mod_i2c_event_idx event_id_type =
-        (enum mod_i2c_event_idx)fwk_id_get_event_idx(event_id);
-
-    switch (event_id_type) {
-    case MOD_I2C_EVENT_IDX_REQUEST_TRANSMIT:
-        ctx->state = MOD_I2C_DEV_TX;
-        drv_status =
-            driver_api->transmit_as_controller(driver_id, &ctx->request);
-        break;
-
-    case MOD_I2C_EVENT_IDX_REQUEST_TRANSMIT_THEN_RECEIVE:
-        ctx->state = MOD_I2C_DEV_TX_RX;
-        drv_status =
-            driver_api->transmit_as_controller(driver_id, &ctx->request);
-
-        if (drv_status != FWK_SUCCESS) {
-            /* The request has failed or been acknowledged */
-            break;
-        }
-        /* fall through */
-
-    case MOD_I2C_EVENT_IDX_REQUEST_RECEIVE:
-        ctx->state = MOD_I2C_DEV_RX;
-        drv_status =
-            driver_api->receive_as_controller(driver_id, &ctx->request);
-        break;
-
-    default:
-        break;
-    }
-
-    return drv_status;
-}
-
 static int reload(fwk_id_t dev_id, struct mod_i2c_dev_ctx *ctx)
 {
     int status;
@@ -380,7 +548,7 @@ static int process_next_request(fwk_id_t dev_id, struct mod_i2c_dev_ctx *ctx)
     int status, drv_status;
     bool is_empty;
     struct fwk_event delayed_response;
-    struct mod_i2c_request *request;
+    struct mod_i2c_request_event_param *request_param;
     struct mod_i2c_event_param *event_param;
 
     status = fwk_is_delayed_response_list_empty(dev_id, &is_empty);
@@ -398,11 +566,13 @@ static int process_next_request(fwk_id_t dev_id, struct mod_i2c_dev_ctx *ctx)
         return status;
     }
 
-    request = (struct mod_i2c_request *)delayed_response.params;
-    ctx->request = *request;
+    request_param =
+        (struct mod_i2c_request_event_param *)delayed_response.params;
 
-    drv_status = process_request(ctx, delayed_response.id);
+    drv_status = start_request(ctx, request_param->entry);
     if (drv_status != FWK_PENDING) {
+        ctx->entry->in_use = false;
+
         event_param = (struct mod_i2c_event_param *)delayed_response.params;
         event_param->status = drv_status;
 
@@ -422,7 +592,7 @@ static int mod_i2c_process_event(const struct fwk_event *event,
     int status, drv_status;
     bool is_request;
     struct mod_i2c_dev_ctx *ctx;
-    struct mod_i2c_request *request;
+    struct mod_i2c_request_event_param *request_param;
     struct mod_i2c_event_param *event_param, *resp_param;
 
     enum mod_i2c_internal_event_idx event_id_type;
@@ -433,7 +603,11 @@ static int mod_i2c_process_event(const struct fwk_event *event,
     is_request = fwk_id_get_event_idx(event->id) < MOD_I2C_EVENT_IDX_COUNT;
 
     if (is_request) {
+        request_param = (struct mod_i2c_request_event_param *)event->params;
+
         if (ctx->state == MOD_I2C_DEV_PANIC) {
+            request_param->entry->in_use = false;
+
             event_param = (struct mod_i2c_event_param *)resp_event->params;
             event_param->status = FWK_E_PANIC;
 
@@ -444,10 +618,7 @@ static int mod_i2c_process_event(const struct fwk_event *event,
             return FWK_SUCCESS;
         }
 
-        request = (struct mod_i2c_request *)event->params;
-        ctx->request = *request;
-
-        drv_status = process_request(ctx, event->id);
+        drv_status = start_request(ctx, request_param->entry);
 
         if (drv_status == FWK_PENDING) {
             resp_event->is_delayed_response = true;
@@ -457,6 +628,7 @@ static int mod_i2c_process_event(const struct fwk_event *event,
 
             resp_param->status = (drv_status == FWK_SUCCESS) ?
                                  FWK_SUCCESS : FWK_E_DEVICE;
+            ctx->entry->in_use = false;
             ctx->state = MOD_I2C_DEV_IDLE;
         }
 
@@ -470,32 +642,12 @@ static int mod_i2c_process_event(const struct fwk_event *event,
     case MOD_I2C_EVENT_IDX_REQUEST_COMPLETED:
         event_param = (struct mod_i2c_event_param *)event->params;
 
-        if ((ctx->state == MOD_I2C_DEV_TX) || (ctx->state == MOD_I2C_DEV_RX)) {
+        if ((ctx->state == MOD_I2C_DEV_TX) || (ctx->state == MOD_I2C_DEV_RX) ||
+            (ctx->state == MOD_I2C_DEV_TX_RX)) {
             status = respond_to_caller(dev_id, ctx, event_param->status);
             if (status == FWK_SUCCESS) {
                 status = process_next_request(dev_id, ctx);
             }
-
-        } else if (ctx->state == MOD_I2C_DEV_TX_RX) {
-            drv_status = event_param->status;
-
-            if (drv_status == FWK_SUCCESS) {
-                /* The TX request succeeded, proceed with the RX */
-                ctx->state = MOD_I2C_DEV_RX;
-
-                drv_status = ctx->driver_api->receive_as_controller(
-                    ctx->config->driver_id, &ctx->request);
-
-                if (drv_status == FWK_PENDING) {
-                    status = FWK_SUCCESS;
-                    break;
-                }
-            }
-
-            status = respond_to_caller(dev_id, ctx, drv_status);
-            if (status == FWK_SUCCESS) {
-                status = process_next_request(dev_id, ctx);
-            }
         } else {
             status = FWK_E_STATE;
         }
@@ -0,0 +1,25 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_i2c.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+#define FAKE_I2C_DEV_IDX 0
+
+#define FAKE_I2C_QUEUE_LENGTH 2
+
+#define FAKE_I2C_TARGET_ADDRESS 0x42
+
+#define FAKE_I2C_DEV_ID FWK_ID_ELEMENT(FWK_MODULE_IDX_I2C, FAKE_I2C_DEV_IDX)
+
+static const struct mod_i2c_dev_config fake_i2c_dev_config = {
+    .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_I2C_DRIVER, 0),
+    .api_id = FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_I2C_DRIVER, 0),
+    .request_queue_length = FAKE_I2C_QUEUE_LENGTH,
+};
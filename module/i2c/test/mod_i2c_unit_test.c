@@ -0,0 +1,403 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_i2c.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_i2c.h"
+
+#define FAKE_DRIVER_CALL_MAX 8
+#define PUT_EVENT_MAX 4
+
+enum fake_driver_call {
+    FAKE_DRIVER_CALL_TX,
+    FAKE_DRIVER_CALL_RX,
+};
+
+/* Calls made to the fake driver, in order */
+static enum fake_driver_call fake_driver_calls[FAKE_DRIVER_CALL_MAX];
+static struct mod_i2c_request *fake_driver_requests[FAKE_DRIVER_CALL_MAX];
+static unsigned int fake_driver_call_count;
+
+/* Status returned by the fake driver functions */
+static int fake_driver_status;
+
+/* Events put by the I2C HAL */
+static struct fwk_event put_events[PUT_EVENT_MAX];
+static unsigned int put_event_count;
+
+static uint8_t transmit_data[2];
+static uint8_t receive_data[2];
+
+static int fake_driver_call(
+    enum fake_driver_call call,
+    struct mod_i2c_request *request)
+{
+    TEST_ASSERT_LESS_THAN(FAKE_DRIVER_CALL_MAX, fake_driver_call_count);
+
+    fake_driver_calls[fake_driver_call_count] = call;
+    fake_driver_requests[fake_driver_call_count] = request;
+    fake_driver_call_count++;
+
+    return fake_driver_status;
+}
+
+static int fake_transmit_as_controller(
+    fwk_id_t dev_id,
+    struct mod_i2c_request *transmit_request)
+{
+    return fake_driver_call(FAKE_DRIVER_CALL_TX, transmit_request);
+}
+
+static int fake_receive_as_controller(
+    fwk_id_t dev_id,
+    struct mod_i2c_request *receive_request)
+{
+    return fake_driver_call(FAKE_DRIVER_CALL_RX, receive_request);
+}
+
+static const struct mod_i2c_driver_api fake_driver_api = {
+    .transmit_as_controller = fake_transmit_as_controller,
+    .receive_as_controller = fake_receive_as_controller,
+};
+
+static int put_event_callback(struct fwk_event *event, int cmock_num_calls)
+{
+    TEST_ASSERT_LESS_THAN(PUT_EVENT_MAX, put_event_count);
+
+    put_events[put_event_count++] = *event;
+
+    return FWK_SUCCESS;
+}
+
+static void check_driver_call(
+    unsigned int idx,
+    enum fake_driver_call call,
+    struct mod_i2c_request *request)
+{
+    TEST_ASSERT_EQUAL(call, fake_driver_calls[idx]);
+    TEST_ASSERT_EQUAL_PTR(request, fake_driver_requests[idx]);
+}
+
+/* Process a request event put by the I2C HAL */
+static void process_request_event(
+    struct fwk_event *event,
+    struct fwk_event *resp_event)
+{
+    int status;
+
+    *resp_event = (struct fwk_event){ 0 };
+
+    status = mod_i2c_process_event(event, resp_event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+/* Check the request completed event put by the I2C HAL */
+static void check_completed_event(struct fwk_event *event, int i2c_status)
+{
+    struct mod_i2c_event_param *param =
+        (struct mod_i2c_event_param *)event->params;
+
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(event->id, mod_i2c_event_id_request_completed));
+    TEST_ASSERT_EQUAL(i2c_status, param->status);
+}
+
+void setUp(void)
+{
+    int status;
+
+    fake_driver_call_count = 0;
+    fake_driver_status = FWK_PENDING;
+    put_event_count = 0;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+    __fwk_put_event_Stub(put_event_callback);
+
+    status = mod_i2c_init(fwk_module_id_i2c, 1, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = mod_i2c_dev_init(FAKE_I2C_DEV_ID, 0, &fake_i2c_dev_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    ctx_table[FAKE_I2C_DEV_IDX].driver_api = &fake_driver_api;
+}
+
+void tearDown(void)
+{
+    fwk_mm_free(ctx_table[FAKE_I2C_DEV_IDX].queue);
+    fwk_mm_free(ctx_table);
+}
+
+void test_i2c_batch_invalid_param(void)
+{
+    int status;
+    struct mod_i2c_request requests[] = {
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .transmit_byte_count = 1,
+        },
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .receive_byte_count = 1,
+        },
+    };
+
+    status =
+        i2c_api.transfer_batch_as_controller(FAKE_I2C_DEV_ID, requests, 0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* The second request has no buffer to receive the data */
+    status = i2c_api.transfer_batch_as_controller(
+        FAKE_I2C_DEV_ID, requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    TEST_ASSERT_EQUAL(0, put_event_count);
+}
+
+void test_i2c_batch_chained_from_completion(void)
+{
+    int status;
+    struct fwk_event resp_event;
+    struct mod_i2c_request requests[] = {
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .transmit_byte_count = 2,
+        },
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .receive_data = receive_data,
+            .transmit_byte_count = 1,
+            .receive_byte_count = 2,
+        },
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .receive_data = receive_data,
+            .receive_byte_count = 2,
+        },
+    };
+
+    status = i2c_api.transfer_batch_as_controller(
+        FAKE_I2C_DEV_ID, requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_EQUAL(1, put_event_count);
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(put_events[0].id, mod_i2c_event_id_request_batch));
+
+    process_request_event(&put_events[0], &resp_event);
+    TEST_ASSERT_TRUE(resp_event.is_delayed_response);
+    TEST_ASSERT_EQUAL(1, fake_driver_call_count);
+    check_driver_call(0, FAKE_DRIVER_CALL_TX, &requests[0]);
+
+    /* Each transfer is started from the completion of the previous one */
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(2, fake_driver_call_count);
+    check_driver_call(1, FAKE_DRIVER_CALL_TX, &requests[1]);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(3, fake_driver_call_count);
+    check_driver_call(2, FAKE_DRIVER_CALL_RX, &requests[1]);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(4, fake_driver_call_count);
+    check_driver_call(3, FAKE_DRIVER_CALL_RX, &requests[2]);
+
+    /* No event is put until the whole batch has completed */
+    TEST_ASSERT_EQUAL(1, put_event_count);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(4, fake_driver_call_count);
+    TEST_ASSERT_EQUAL(2, put_event_count);
+    check_completed_event(&put_events[1], FWK_SUCCESS);
+}
+
+void test_i2c_batch_stops_on_error(void)
+{
+    int status;
+    struct fwk_event resp_event;
+    struct mod_i2c_request requests[] = {
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .transmit_byte_count = 1,
+        },
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .transmit_byte_count = 1,
+        },
+    };
+
+    status = i2c_api.transfer_batch_as_controller(
+        FAKE_I2C_DEV_ID, requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    process_request_event(&put_events[0], &resp_event);
+    TEST_ASSERT_EQUAL(1, fake_driver_call_count);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_E_DEVICE);
+    TEST_ASSERT_EQUAL(1, fake_driver_call_count);
+    TEST_ASSERT_EQUAL(2, put_event_count);
+    check_completed_event(&put_events[1], FWK_E_DEVICE);
+}
+
+void test_i2c_batch_completed_synchronously(void)
+{
+    int status;
+    struct fwk_event resp_event;
+    struct mod_i2c_event_param *resp_param =
+        (struct mod_i2c_event_param *)resp_event.params;
+    struct mod_i2c_request requests[] = {
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .transmit_data = transmit_data,
+            .transmit_byte_count = 1,
+        },
+        {
+            .target_address = FAKE_I2C_TARGET_ADDRESS,
+            .receive_data = receive_data,
+            .receive_byte_count = 1,
+        },
+    };
+
+    fake_driver_status = FWK_SUCCESS;
+
+    status = i2c_api.transfer_batch_as_controller(
+        FAKE_I2C_DEV_ID, requests, FWK_ARRAY_SIZE(requests));
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    process_request_event(&put_events[0], &resp_event);
+    TEST_ASSERT_FALSE(resp_event.is_delayed_response);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, resp_param->status);
+    TEST_ASSERT_EQUAL(2, fake_driver_call_count);
+    check_driver_call(0, FAKE_DRIVER_CALL_TX, &requests[0]);
+    check_driver_call(1, FAKE_DRIVER_CALL_RX, &requests[1]);
+    TEST_ASSERT_EQUAL(MOD_I2C_DEV_IDLE, ctx_table[FAKE_I2C_DEV_IDX].state);
+}
+
+void test_i2c_single_request_copied(void)
+{
+    int status;
+    struct fwk_event resp_event;
+
+    status = i2c_api.transmit_then_receive_as_controller(
+        FAKE_I2C_DEV_ID,
+        FAKE_I2C_TARGET_ADDRESS,
+        transmit_data,
+        receive_data,
+        1,
+        2);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(put_events[0].id, mod_i2c_event_id_request_tx_rx));
+
+    process_request_event(&put_events[0], &resp_event);
+    TEST_ASSERT_TRUE(resp_event.is_delayed_response);
+    TEST_ASSERT_EQUAL(1, fake_driver_call_count);
+    TEST_ASSERT_EQUAL(FAKE_DRIVER_CALL_TX, fake_driver_calls[0]);
+    TEST_ASSERT_EQUAL_PTR(
+        transmit_data, fake_driver_requests[0]->transmit_data);
+    TEST_ASSERT_EQUAL(2, fake_driver_requests[0]->receive_byte_count);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(2, fake_driver_call_count);
+    check_driver_call(1, FAKE_DRIVER_CALL_RX, fake_driver_requests[0]);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(2, put_event_count);
+    check_completed_event(&put_events[1], FWK_SUCCESS);
+}
+
+void test_i2c_queue_full(void)
+{
+    int status;
+    unsigned int idx;
+
+    for (idx = 0; idx < FAKE_I2C_QUEUE_LENGTH; idx++) {
+        status = i2c_api.transmit_as_controller(
+            FAKE_I2C_DEV_ID, FAKE_I2C_TARGET_ADDRESS, transmit_data, 1);
+        TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    }
+
+    status = i2c_api.receive_as_controller(
+        FAKE_I2C_DEV_ID, FAKE_I2C_TARGET_ADDRESS, receive_data, 1);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+    TEST_ASSERT_EQUAL(FAKE_I2C_QUEUE_LENGTH, put_event_count);
+}
+
+void test_i2c_queue_entry_released_on_response(void)
+{
+    int status;
+    unsigned int idx;
+    bool is_empty = true;
+    struct fwk_event resp_event;
+    struct fwk_event request_event;
+    struct fwk_event completed_event;
+
+    status = i2c_api.transmit_as_controller(
+        FAKE_I2C_DEV_ID, FAKE_I2C_TARGET_ADDRESS, transmit_data, 1);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    request_event = put_events[0];
+    process_request_event(&request_event, &resp_event);
+
+    driver_response_api.transaction_completed(FAKE_I2C_DEV_ID, FWK_SUCCESS);
+    completed_event = put_events[1];
+    put_event_count = 0;
+
+    fwk_get_first_delayed_response_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fwk_get_first_delayed_response_ReturnThruPtr_event(&request_event);
+    fwk_is_delayed_response_list_empty_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fwk_is_delayed_response_list_empty_ReturnThruPtr_is_empty(&is_empty);
+
+    status = mod_i2c_process_event(&completed_event, &resp_event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, put_event_count);
+    TEST_ASSERT_EQUAL(MOD_I2C_DEV_IDLE, ctx_table[FAKE_I2C_DEV_IDX].state);
+
+    /* The whole queue is available again */
+    for (idx = 0; idx < FAKE_I2C_QUEUE_LENGTH; idx++) {
+        status = i2c_api.transmit_as_controller(
+            FAKE_I2C_DEV_ID, FAKE_I2C_TARGET_ADDRESS, transmit_data, 1);
+        TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    }
+}
+
+int i2c_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_i2c_batch_invalid_param);
+    RUN_TEST(test_i2c_batch_chained_from_completion);
+    RUN_TEST(test_i2c_batch_stops_on_error);
+    RUN_TEST(test_i2c_batch_completed_synchronously);
+    RUN_TEST(test_i2c_single_request_copied);
+    RUN_TEST(test_i2c_queue_full);
+    RUN_TEST(test_i2c_queue_entry_released_on_response);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return i2c_test_main();
+}
+#endif
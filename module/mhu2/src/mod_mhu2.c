@@ -82,24 +82,37 @@ static struct mhu2_ctx {
 static void mhu2_isr(uintptr_t ctx_param)
 {
     struct mhu2_channel_ctx *channel_ctx = (struct mhu2_channel_ctx *)ctx_param;
-    struct mhu2_bound_channel *bound_channel;
+    struct mhu2_bound_channel *bound_channel = NULL;
+    fwk_id_t channel_ids[MHU_SLOT_COUNT_MAX];
+    unsigned int channel_count;
     unsigned int slot;
+    uint32_t pending;
 
     fwk_assert(channel_ctx != NULL);
 
-    while (channel_ctx->recv_channel->STAT != 0) {
-        slot = __builtin_ctz(channel_ctx->recv_channel->STAT);
+    while ((pending = channel_ctx->recv_channel->STAT) != 0) {
+        /* Acknowledge all the pending slots with a single write */
+        channel_ctx->recv_channel->STAT_CLEAR = pending;
+
         /*
-         * If the slot is bound to a transport channel,
-         * signal the message to the corresponding module
+         * Collect the transport channels bound to the pending slots and
+         * signal them to the transport module as one batch
          */
-        if (channel_ctx->bound_slots & (1 << slot)) {
+        pending &= channel_ctx->bound_slots;
+        channel_count = 0;
+
+        while (pending != 0) {
+            slot = __builtin_ctz(pending);
+            pending &= ~(UINT32_C(1) << slot);
+
             bound_channel = &channel_ctx->bound_channels_table[slot];
+            channel_ids[channel_count++] = bound_channel->id;
+        }
 
-            bound_channel->driver_input_api->signal_message(bound_channel->id);
+        if (channel_count != 0) {
+            bound_channel->driver_input_api->signal_messages(
+                channel_ids, channel_count);
         }
-        /* Acknowledge the interrupt */
-        channel_ctx->recv_channel->STAT_CLEAR = 1 << slot;
     }
 }
 
@@ -82,6 +82,10 @@ static void mhu3_isr(void)
     struct mhu3_mbx_reg *mbx_reg;
     struct mhu3_mbx_mdbcw_reg *mdbcw_reg;
     unsigned int pending = 0U;
+    uint32_t dbch_int_st;
+    fwk_id_t transport_ids[MHU_DOORBELL_CHANNEL_COUNT_MAX];
+    const struct mod_transport_driver_input_api *transport_api = NULL;
+    unsigned int transport_count = 0U;
 
     status = fwk_interrupt_get_current(&interrupt);
     if (status != FWK_SUCCESS) {
@@ -106,6 +110,12 @@ static void mhu3_isr(void)
     mdbcw_reg = (struct mhu3_mbx_mdbcw_reg
                      *)((uint8_t *)mbx_reg + MHU3_MBX_MDBCW_PAGE_OFFSET);
 
+    /*
+     * Sample the doorbell interrupt status once, so that all the doorbells
+     * pending at this point are handled in this pass.
+     */
+    dbch_int_st = mbx_reg->MBX_DBCH_INT_ST[0];
+
     while (pending < device_ctx->channels_count) {
         channel = &(device_ctx->config->channels[pending]);
         channel_ctx = &(device_ctx->channel_ctx_table[pending]);
@@ -125,8 +135,7 @@ static void mhu3_isr(void)
              * although MHUv3 supports upto 128 channels, it is not
              * expected hardware to be configured more than 32 channels.
              */
-            if (((1u << channel->dbch.mbx_channel) &
-                 mbx_reg->MBX_DBCH_INT_ST[0]) != 0u) {
+            if (((1u << channel->dbch.mbx_channel) & dbch_int_st) != 0u) {
                 /*
                  * Clear Doorbell flag, we should clear only the flag(bit) which
                  * is set. However, we are using only one flag(bit) of
@@ -135,8 +144,18 @@ static void mhu3_isr(void)
                 mdbcw_reg[channel->dbch.mbx_channel].MDBCW_CLR |=
                     (1UL << channel->dbch.mbx_flag_pos);
                 if (channel_ctx->transport_id_bound) {
-                    channel_ctx->transport_api->signal_message(
-                        channel_ctx->transport_id);
+                    /*
+                     * The transport channels are signalled in batches once
+                     * the doorbells are acknowledged.
+                     */
+                    if (transport_count == MHU_DOORBELL_CHANNEL_COUNT_MAX) {
+                        transport_api->signal_messages(
+                            transport_ids, transport_count);
+                        transport_count = 0U;
+                    }
+                    transport_api = channel_ctx->transport_api;
+                    transport_ids[transport_count++] =
+                        channel_ctx->transport_id;
                 }
             }
             break;
@@ -163,6 +182,10 @@ static void mhu3_isr(void)
         }
         pending++;
     }
+
+    if (transport_count != 0U) {
+        transport_api->signal_messages(transport_ids, transport_count);
+    }
 }
 
 static int mhu3_raise_interrupt(fwk_id_t ch_id)
@@ -1,7 +1,7 @@
 
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,7 @@
 
 #include <fwk_id.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -45,6 +46,27 @@ struct mod_pl011_element_cfg {
      */
     uint64_t clock_rate_hz;
 
+    /*!
+     * \brief Size of the transmit buffer in bytes.
+     *
+     * \details When set to a value other than zero, characters written to the
+     *      device are queued in a transmit buffer of this size and drained into
+     *      the transmit FIFO by the transmit interrupt, so that writers never
+     *      have to wait for the FIFO to empty. Writes only report the device
+     *      as busy once the buffer itself is full.
+     *
+     * \note If set to zero, characters are written directly to the transmit
+     *      FIFO.
+     */
+    size_t tx_buffer_size;
+
+    /*!
+     * \brief Interrupt number of the device.
+     *
+     * \note Only used if ::mod_pl011_element_cfg::tx_buffer_size is not zero.
+     */
+    unsigned int irq;
+
 #ifdef BUILD_HAS_MOD_CLOCK
     /*!
      * \brief Identifier of the clock that this device depends on.
@@ -12,15 +12,19 @@
 #include <fwk_assert.h>
 #include <fwk_attributes.h>
 #include <fwk_event.h>
+#include <fwk_interrupt.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_notification.h>
+#include <fwk_ring.h>
 #include <fwk_status.h>
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef BUILD_HAS_MOD_CLOCK
 #    include <mod_clock.h>
@@ -43,6 +47,15 @@ struct mod_pl011_element_ctx {
 
     /* Whether the device has an open file stream */
     bool open;
+
+    /* Whether transmitted characters are queued in the transmit buffer */
+    bool tx_buffered;
+
+    /* Whether the transmit interrupt is available to drain the buffer */
+    bool tx_irq_ready;
+
+    /* Transmit buffer drained by the transmit interrupt */
+    struct fwk_ring tx_ring;
 };
 
 static struct mod_pl011_ctx {
@@ -86,7 +99,14 @@ static void mod_pl011_init_ctx(void)
             fwk_id_is_equal(cfg->clock_id, FWK_ID_NONE);
 #endif
 
-        (void)cfg;
+        if (cfg->tx_buffer_size > 0) {
+            fwk_ring_init(
+                &pl011_ctx.elements[i].tx_ring,
+                fwk_mm_alloc(cfg->tx_buffer_size, sizeof(char)),
+                cfg->tx_buffer_size);
+
+            pl011_ctx.elements[i].tx_buffered = true;
+        }
     }
 
     pl011_ctx.initialized = true;
@@ -136,6 +156,110 @@ static void mod_pl011_set_baud_rate(const struct mod_pl011_element_cfg *cfg)
     reg->FBRD = divisor_fractional;
 }
 
+static size_t mod_pl011_fifo_write(
+    struct pl011_reg *reg,
+    const char *buffer,
+    size_t size)
+{
+    size_t count = 0;
+    size_t burst;
+
+    /*
+     * If the transmit FIFO is empty we can fill it up to its full depth without
+     * polling the flag register between characters.
+     */
+    if ((reg->FR & PL011_FR_TXFE) > 0) {
+        burst = FWK_MIN(size, (size_t)PL011_FIFO_DEPTH);
+
+        for (; count < burst; count++) {
+            reg->DR = (uint16_t)buffer[count];
+        }
+    }
+
+    while ((count < size) && ((reg->FR & PL011_FR_TXFF) == 0)) {
+        reg->DR = (uint16_t)buffer[count++];
+    }
+
+    return count;
+}
+
+/*
+ * Move as many queued characters as possible from the transmit buffer into the
+ * transmit FIFO, and keep the transmit interrupt unmasked for as long as there
+ * are characters left in the buffer. Must be called with interrupts disabled
+ * or from the interrupt handler.
+ */
+static void mod_pl011_tx_drain(
+    struct mod_pl011_element_ctx *ctx,
+    struct pl011_reg *reg)
+{
+    char ch;
+
+    while (!fwk_ring_is_empty(&ctx->tx_ring) &&
+           ((reg->FR & PL011_FR_TXFF) == 0)) {
+        (void)fwk_ring_pop(&ctx->tx_ring, &ch, sizeof(ch));
+
+        reg->DR = (uint16_t)ch;
+    }
+
+    if (fwk_ring_is_empty(&ctx->tx_ring) || !ctx->tx_irq_ready) {
+        reg->IMSC &= ~PL011_IMSC_TXIM;
+    } else {
+        reg->IMSC |= PL011_IMSC_TXIM;
+    }
+}
+
+static size_t mod_pl011_tx_queue(
+    struct mod_pl011_element_ctx *ctx,
+    struct pl011_reg *reg,
+    const char *buffer,
+    size_t size)
+{
+    unsigned int flags;
+    size_t count = 0;
+
+    flags = fwk_interrupt_global_disable();
+
+    mod_pl011_tx_drain(ctx, reg);
+
+    /* Bypass the buffer entirely if nothing is waiting ahead of us */
+    if (fwk_ring_is_empty(&ctx->tx_ring)) {
+        count = mod_pl011_fifo_write(reg, buffer, size);
+    }
+
+    /* Pushing past the free space would drop characters already queued */
+    count += fwk_ring_push(
+        &ctx->tx_ring,
+        buffer + count,
+        FWK_MIN(size - count, fwk_ring_get_free(&ctx->tx_ring)));
+
+    mod_pl011_tx_drain(ctx, reg);
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return count;
+}
+
+static void mod_pl011_isr(uintptr_t element_idx)
+{
+    fwk_id_t id = FWK_ID_ELEMENT(FWK_MODULE_IDX_PL011, element_idx);
+
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx = &pl011_ctx.elements[element_idx];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+
+    reg->ICR = PL011_ICR_TXIC;
+
+    if (!ctx->powered || !ctx->clocked) {
+        reg->IMSC &= ~PL011_IMSC_TXIM;
+
+        return;
+    }
+
+    mod_pl011_tx_drain(ctx, reg);
+}
+
 static void mod_pl011_enable(fwk_id_t id)
 {
     const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
@@ -144,6 +268,8 @@ static void mod_pl011_enable(fwk_id_t id)
 
     struct pl011_reg *reg = (void *)cfg->reg_base;
 
+    unsigned int flags;
+
     fwk_assert(ctx->powered); /* Must be powered to enable */
     fwk_assert(ctx->clocked); /* Must be clocked to enable */
 
@@ -152,6 +278,13 @@ static void mod_pl011_enable(fwk_id_t id)
     reg->ECR = PL011_ECR_CLR;
     reg->LCR_H = PL011_LCR_H_WLEN_8BITS | PL011_LCR_H_FEN;
     reg->CR = PL011_CR_UARTEN | PL011_CR_RXE | PL011_CR_TXE;
+
+    if (ctx->tx_buffered) {
+        /* Resume transmission of anything queued while the device was off */
+        flags = fwk_interrupt_global_disable();
+        mod_pl011_tx_drain(ctx, reg);
+        (void)fwk_interrupt_global_enable(flags);
+    }
 }
 
 static bool mod_pl011_putch(fwk_id_t id, char ch)
@@ -165,6 +298,10 @@ static bool mod_pl011_putch(fwk_id_t id, char ch)
     fwk_assert(ctx->powered);
     fwk_assert(ctx->clocked);
 
+    if (ctx->tx_buffered) {
+        return mod_pl011_tx_queue(ctx, reg, &ch, sizeof(ch)) > 0;
+    }
+
     /* Check if buffer is full. */
     if ((reg->FR & PL011_FR_TXFF) > 0) {
         return false;
@@ -195,6 +332,44 @@ static bool mod_pl011_getch(fwk_id_t id, char *ch)
     return true;
 }
 
+static size_t mod_pl011_write(fwk_id_t id, const char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    if (ctx->tx_buffered) {
+        return mod_pl011_tx_queue(ctx, reg, buffer, size);
+    }
+
+    return mod_pl011_fifo_write(reg, buffer, size);
+}
+
+static size_t mod_pl011_read(fwk_id_t id, char *buffer, size_t size)
+{
+    const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+
+    struct pl011_reg *reg = (void *)cfg->reg_base;
+
+    size_t count = 0;
+
+    fwk_assert(ctx->powered);
+    fwk_assert(ctx->clocked);
+
+    while ((count < size) && ((reg->FR & PL011_FR_RXFE) == 0)) {
+        buffer[count++] = (char)reg->DR;
+    }
+
+    return count;
+}
+
 static void mod_pl011_flush(fwk_id_t id)
 {
     const struct mod_pl011_element_cfg *cfg = fwk_module_get_data(id);
@@ -203,9 +378,19 @@ static void mod_pl011_flush(fwk_id_t id)
 
     struct pl011_reg *reg = (void *)cfg->reg_base;
 
+    unsigned int flags;
+
     fwk_assert(ctx->powered);
     fwk_assert(ctx->clocked);
 
+    if (ctx->tx_buffered) {
+        while (!fwk_ring_is_empty(&ctx->tx_ring)) {
+            flags = fwk_interrupt_global_disable();
+            mod_pl011_tx_drain(ctx, reg);
+            (void)fwk_interrupt_global_enable(flags);
+        }
+    }
+
     while (reg->FR & PL011_FR_BUSY) {
         continue;
     }
@@ -238,6 +423,8 @@ static int mod_pl011_start(fwk_id_t id)
     int status = FWK_SUCCESS;
 
     const struct mod_pl011_element_cfg *cfg;
+    struct mod_pl011_element_ctx *ctx;
+    unsigned int flags;
 
     if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
         return FWK_SUCCESS;
@@ -285,8 +472,32 @@ static int mod_pl011_start(fwk_id_t id)
     }
 #endif
 
-    (void)cfg;
-    (void)status;
+    if (cfg->tx_buffer_size > 0) {
+        /*
+         * Until now, queued characters have only been drained when new ones
+         * were written. From here on the transmit interrupt takes over.
+         */
+
+        status = fwk_interrupt_set_isr_param(
+            cfg->irq, mod_pl011_isr, (uintptr_t)fwk_id_get_element_idx(id));
+        if (!fwk_expect(status == FWK_SUCCESS)) {
+            return FWK_E_HANDLER;
+        }
+
+        ctx = &pl011_ctx.elements[fwk_id_get_element_idx(id)];
+        ctx->tx_irq_ready = true;
+
+        status = fwk_interrupt_enable(cfg->irq);
+        if (!fwk_expect(status == FWK_SUCCESS)) {
+            return FWK_E_HANDLER;
+        }
+
+        if (ctx->powered && ctx->clocked) {
+            flags = fwk_interrupt_global_disable();
+            mod_pl011_tx_drain(ctx, (void *)cfg->reg_base);
+            (void)fwk_interrupt_global_enable(flags);
+        }
+    }
 
     return FWK_SUCCESS;
 }
@@ -625,6 +836,52 @@ static int mod_pl011_io_putch(const struct fwk_io_stream *stream, char ch)
     return FWK_SUCCESS;
 }
 
+static int mod_pl011_io_read(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict read,
+    char *restrict buffer,
+    size_t size)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *read = mod_pl011_read(stream->id, buffer, size);
+    if (*read == 0) {
+        return FWK_PENDING;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int mod_pl011_io_write(
+    const struct fwk_io_stream *restrict stream,
+    size_t *restrict written,
+    const char *restrict buffer,
+    size_t size)
+{
+    const struct mod_pl011_element_ctx *ctx =
+        &pl011_ctx.elements[fwk_id_get_element_idx(stream->id)];
+
+    fwk_assert(ctx->open);
+
+    if (!ctx->powered || !ctx->clocked) {
+        return FWK_E_PWRSTATE;
+    }
+
+    *written = mod_pl011_write(stream->id, buffer, size);
+    if (*written == 0) {
+        return FWK_E_BUSY;
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int mod_pl011_close(const struct fwk_io_stream *stream)
 {
     struct mod_pl011_element_ctx *ctx;
@@ -656,6 +913,8 @@ const struct fwk_module module_pl011 = {
             .open = mod_pl011_io_open,
             .getch = mod_pl011_io_getch,
             .putch = mod_pl011_io_putch,
+            .read = mod_pl011_io_read,
+            .write = mod_pl011_io_write,
             .close = mod_pl011_close,
         },
 };
@@ -158,6 +158,9 @@ struct pl011_reg {
 #define PL011_DMACR_TXDMAE    (uint16_t)0x0002
 #define PL011_DMACR_DMAAONERR (uint16_t)0x0004
 
+/* Revisions before r1p5 only implement a 16-entry FIFO */
+#define PL011_FIFO_DEPTH 16
+
 #define PL011_UARTCLK_MIN (1420 * FWK_KHZ)
 #define PL011_UARTCLK_MAX (542720 * FWK_KHZ)
 
@@ -23,6 +23,12 @@
 struct fwk_io_stream stream;
 struct mod_pl011_element_cfg *cfg_ut;
 
+/* The flag register is read-only for the driver, set it through a cast */
+static void set_flag_register(uint16_t value)
+{
+    *(volatile uint16_t *)&mod_reg.FR = value;
+}
+
 void setUp(void)
 {
     memset(&pl011_ctx, 0, sizeof(pl011_ctx));
@@ -56,6 +62,57 @@ void test_mod_pl011_putch_true(void)
     TEST_ASSERT_EQUAL(mod_reg.DR, ch);
 }
 
+void test_mod_pl011_putch_buffered_fifo_full(void)
+{
+    bool status;
+    char ch = 64;
+    char popped = 0;
+    char storage[4];
+    fwk_id_t id;
+
+    pl011_ctx.elements[0].tx_buffered = true;
+    fwk_ring_init(&pl011_ctx.elements[0].tx_ring, storage, sizeof(storage));
+
+    set_flag_register(PL011_FR_TXFF);
+    mod_reg.DR = 0;
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    /* The character is queued rather than written to the full FIFO */
+    status = mod_pl011_putch(id, ch);
+    TEST_ASSERT_EQUAL(true, status);
+    TEST_ASSERT_EQUAL(0, mod_reg.DR);
+    TEST_ASSERT_EQUAL(1, fwk_ring_get_length(&pl011_ctx.elements[0].tx_ring));
+
+    fwk_ring_pop(&pl011_ctx.elements[0].tx_ring, &popped, sizeof(popped));
+    TEST_ASSERT_EQUAL(ch, popped);
+
+    set_flag_register(0);
+}
+
+void test_mod_pl011_putch_buffered_full(void)
+{
+    bool status;
+    char storage[1] = { 0 };
+    fwk_id_t id;
+
+    pl011_ctx.elements[0].tx_buffered = true;
+    fwk_ring_init(&pl011_ctx.elements[0].tx_ring, storage, sizeof(storage));
+    fwk_ring_push(&pl011_ctx.elements[0].tx_ring, "a", 1);
+
+    set_flag_register(PL011_FR_TXFF);
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    /* Neither the FIFO nor the transmit buffer can accept the character */
+    status = mod_pl011_putch(id, 'b');
+    TEST_ASSERT_EQUAL(false, status);
+
+    set_flag_register(0);
+}
+
 void test_mod_pl011_io_putch_success(void)
 {
     int status;
@@ -228,6 +285,73 @@ void test_mod_pl011_io_getch(void)
     TEST_ASSERT_EQUAL(ch, 64);
 }
 
+void test_mod_pl011_write_fifo_empty(void)
+{
+    size_t count;
+    char buffer[PL011_FIFO_DEPTH + 1];
+    fwk_id_t id;
+
+    memset(buffer, 'a', sizeof(buffer));
+    buffer[sizeof(buffer) - 1] = 'b';
+
+    set_flag_register(PL011_FR_TXFE);
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    count = mod_pl011_write(id, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL(sizeof(buffer), count);
+    TEST_ASSERT_EQUAL('b', mod_reg.DR);
+
+    set_flag_register(0);
+}
+
+void test_mod_pl011_io_write_busy(void)
+{
+    int status;
+    size_t written = 0;
+    char buffer[] = "abc";
+    struct fwk_io_stream stream;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    pl011_ctx.elements[0].open = true;
+
+    set_flag_register(PL011_FR_TXFF);
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = mod_pl011_io_write(&stream, &written, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+    TEST_ASSERT_EQUAL(0, written);
+
+    set_flag_register(0);
+}
+
+void test_mod_pl011_io_read_pending(void)
+{
+    int status;
+    size_t read = 0;
+    char buffer[4];
+    struct fwk_io_stream stream;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    pl011_ctx.elements[0].open = true;
+
+    set_flag_register(PL011_FR_RXFE);
+
+    fwk_module_get_data_ExpectAnyArgsAndReturn(cfg_ut);
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = mod_pl011_io_read(&stream, &read, buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+    TEST_ASSERT_EQUAL(0, read);
+
+    set_flag_register(0);
+}
+
 void test_mod_pl011_flush(void)
 {
     fwk_id_t id;
@@ -243,6 +367,8 @@ int pl011_test_main(void)
 {
     UNITY_BEGIN();
     RUN_TEST(test_mod_pl011_putch_true);
+    RUN_TEST(test_mod_pl011_putch_buffered_fifo_full);
+    RUN_TEST(test_mod_pl011_putch_buffered_full);
     RUN_TEST(test_mod_pl011_io_putch_success);
     RUN_TEST(test_mod_pl011_io_putch_fail_powered);
     RUN_TEST(test_mod_pl011_io_putch_fail_clocked);
@@ -253,6 +379,9 @@ int pl011_test_main(void)
     RUN_TEST(test_mod_pl011_io_open_support);
     RUN_TEST(test_mod_pl011_io_open_success);
     RUN_TEST(test_mod_pl011_io_getch);
+    RUN_TEST(test_mod_pl011_write_fifo_empty);
+    RUN_TEST(test_mod_pl011_io_write_busy);
+    RUN_TEST(test_mod_pl011_io_read_pending);
     RUN_TEST(test_mod_pl011_flush);
     return UNITY_END();
 }
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -658,6 +658,32 @@ struct mod_pd_driver_input_api {
      */
     int (*report_power_state_transition)(fwk_id_t pd_id, unsigned int state);
 
+    /*!
+     * \brief Report the same power state transition for a set of power
+     *      domains.
+     *
+     * \details The transitions are reported with a single event and processed
+     *      together by the power domain module. This is intended for drivers
+     *      servicing the interrupts of several power domains, for instance all
+     *      the cores of a cluster, in one pass.
+     *
+     * \param first_pd_id Identifier of the first power domain of the set.
+     * \param pd_mask Bitmap of the power domains of the set. Bit n stands for
+     *      the power domain whose element index is the element index of
+     *      first_pd_id plus n.
+     * \param state New power state of the power domains of the set.
+     *
+     * \retval ::FWK_SUCCESS Report transmitted.
+     * \retval ::FWK_E_ACCESS Invalid access, the framework has rejected the
+     *      call to the API.
+     * \retval ::FWK_E_NOMEM Failed to allocate a report event.
+     * \retval ::FWK_E_PARAM One of the power domains is unknown.
+     */
+    int (*report_power_state_transitions)(
+        fwk_id_t first_pd_id,
+        uint32_t pd_mask,
+        unsigned int state);
+
     /*!
      * \brief Get the power domain identifier of the last core online before or
      *      during system suspend.
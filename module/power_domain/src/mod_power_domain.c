@@ -228,6 +228,7 @@ struct mod_pd_mod_ctx {
 enum pd_event_idx {
     PD_EVENT_IDX_RESET = MOD_PD_PUBLIC_EVENT_IDX_COUNT,
     PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITION,
+    PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS,
     PD_EVENT_IDX_SYSTEM_SUSPEND,
     PD_EVENT_IDX_SYSTEM_SHUTDOWN,
     PD_EVENT_COUNT
@@ -261,6 +262,21 @@ struct pd_power_state_transition_report {
     uint32_t state;
 };
 
+/*
+ * PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS
+ * Parameters of the power state transitions report event
+ */
+struct pd_power_state_transitions_report {
+    /* Index of the first power domain of the set */
+    uint32_t first_pd_idx;
+
+    /* Bitmap of the power domains of the set, relative to first_pd_idx */
+    uint32_t pd_mask;
+
+    /* The new power state of the power domains */
+    uint32_t state;
+};
+
 /*
  * PD_EVENT_IDX_SYSTEM_SUSPEND
  * Parameters of the system suspend request event
@@ -1264,6 +1280,29 @@ static void process_power_state_transition_report(
     }
 }
 
+/*
+ * Process a power state transitions report for a set of power domains
+ *
+ * \param report_params Parameters of the power state transitions report
+ */
+static void process_power_state_transitions_report(
+    const struct pd_power_state_transitions_report *report_params)
+{
+    struct pd_power_state_transition_report report = {
+        .state = report_params->state,
+    };
+    uint32_t pd_mask = report_params->pd_mask;
+    unsigned int pd_idx;
+
+    while (pd_mask != 0) {
+        pd_idx = report_params->first_pd_idx + __builtin_ctz(pd_mask);
+        pd_mask &= pd_mask - 1;
+
+        process_power_state_transition_report(
+            &mod_pd_ctx.pd_ctx_table[pd_idx], &report);
+    }
+}
+
 /*
  * Process a 'system suspend' request
  *
@@ -1693,6 +1732,39 @@ static int pd_report_power_state_transition(fwk_id_t pd_id, unsigned int state)
     return report_power_state_transition(pd, state);
 }
 
+static int pd_report_power_state_transitions(
+    fwk_id_t first_pd_id,
+    uint32_t pd_mask,
+    unsigned int state)
+{
+    struct fwk_event report;
+    struct pd_power_state_transitions_report *report_params =
+        (struct pd_power_state_transitions_report *)(&report.params);
+    unsigned int first_pd_idx = fwk_id_get_element_idx(first_pd_id);
+
+    if (pd_mask == 0) {
+        return FWK_SUCCESS;
+    }
+
+    if ((first_pd_idx + (31U - (unsigned int)__builtin_clz(pd_mask))) >=
+        mod_pd_ctx.pd_count) {
+        return FWK_E_PARAM;
+    }
+
+    report = (struct fwk_event){
+        .source_id = mod_pd_ctx.pd_ctx_table[first_pd_idx].driver_id,
+        .target_id = fwk_module_id_power_domain,
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS),
+    };
+    report_params->first_pd_idx = first_pd_idx;
+    report_params->pd_mask = pd_mask;
+    report_params->state = state;
+
+    return fwk_put_event(&report);
+}
+
 static int pd_get_last_core_pd_id(fwk_id_t *last_core_pd_id)
 {
     bool system_suspend_ongoing = mod_pd_ctx.system_suspend.suspend_ongoing;
@@ -1731,6 +1803,7 @@ static const struct mod_pd_driver_input_api pd_driver_input_api = {
     .set_state = pd_set_state,
     .reset = pd_reset,
     .report_power_state_transition = pd_report_power_state_transition,
+    .report_power_state_transitions = pd_report_power_state_transitions,
     .get_last_core_pd_id = pd_get_last_core_pd_id,
 };
 
@@ -2012,6 +2085,12 @@ static int pd_process_event(
 
         return FWK_SUCCESS;
 
+    case (unsigned int)PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS:
+        process_power_state_transitions_report(
+            (struct pd_power_state_transitions_report *)event->params);
+
+        return FWK_SUCCESS;
+
     case (unsigned int)PD_EVENT_IDX_SYSTEM_SUSPEND:
         process_system_suspend_request(
             (struct pd_system_suspend_request *)event->params,
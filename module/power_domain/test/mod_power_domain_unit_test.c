@@ -0,0 +1,185 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+enum test_pd_idx {
+    TEST_PD_IDX_SYSTOP,
+    TEST_PD_IDX_CORE0,
+    TEST_PD_IDX_CORE1,
+    TEST_PD_IDX_CORE2,
+    TEST_PD_IDX_COUNT,
+};
+
+static struct pd_ctx test_pd_ctx_table[TEST_PD_IDX_COUNT];
+
+void setUp(void)
+{
+    unsigned int idx;
+
+    memset(&mod_pd_ctx, 0, sizeof(mod_pd_ctx));
+    memset(test_pd_ctx_table, 0, sizeof(test_pd_ctx_table));
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_pd_ctx_table[idx].id =
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, idx);
+        test_pd_ctx_table[idx].driver_id =
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_PPU_V1, idx);
+        test_pd_ctx_table[idx].current_state = MOD_PD_STATE_OFF;
+        test_pd_ctx_table[idx].requested_state = MOD_PD_STATE_OFF;
+        test_pd_ctx_table[idx].state_requested_to_driver = MOD_PD_STATE_OFF;
+        fwk_list_init(&test_pd_ctx_table[idx].children_list);
+
+        if (idx != TEST_PD_IDX_SYSTOP) {
+            test_pd_ctx_table[idx].parent =
+                &test_pd_ctx_table[TEST_PD_IDX_SYSTOP];
+        }
+    }
+
+    /* The cores are waking up while the system is already on */
+    test_pd_ctx_table[TEST_PD_IDX_SYSTOP].current_state = MOD_PD_STATE_ON;
+    test_pd_ctx_table[TEST_PD_IDX_SYSTOP].requested_state = MOD_PD_STATE_ON;
+    test_pd_ctx_table[TEST_PD_IDX_SYSTOP].state_requested_to_driver =
+        MOD_PD_STATE_ON;
+
+    mod_pd_ctx.pd_ctx_table = test_pd_ctx_table;
+    mod_pd_ctx.pd_count = TEST_PD_IDX_COUNT;
+}
+
+void tearDown(void)
+{
+}
+
+static int put_event_transitions_report_callback(
+    struct fwk_event *event,
+    int num_calls)
+{
+    const struct pd_power_state_transitions_report *params =
+        (const struct pd_power_state_transitions_report *)event->params;
+
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        event->id,
+        FWK_ID_EVENT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS)));
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(event->target_id, fwk_module_id_power_domain));
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        event->source_id,
+        test_pd_ctx_table[TEST_PD_IDX_CORE0].driver_id));
+    TEST_ASSERT_EQUAL(TEST_PD_IDX_CORE0, params->first_pd_idx);
+    TEST_ASSERT_EQUAL(0x5, params->pd_mask);
+    TEST_ASSERT_EQUAL(MOD_PD_STATE_ON, params->state);
+
+    return FWK_SUCCESS;
+}
+
+void test_report_power_state_transitions(void)
+{
+    int status;
+
+    __fwk_put_event_Stub(put_event_transitions_report_callback);
+
+    status = pd_report_power_state_transitions(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_PD_IDX_CORE0),
+        0x5,
+        MOD_PD_STATE_ON);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_report_power_state_transitions_empty_mask(void)
+{
+    int status;
+
+    /* Nothing to report, no event is sent */
+    status = pd_report_power_state_transitions(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_PD_IDX_CORE0),
+        0,
+        MOD_PD_STATE_ON);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_report_power_state_transitions_out_of_range(void)
+{
+    int status;
+
+    /* The third power domain of the set does not exist */
+    status = pd_report_power_state_transitions(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_PD_IDX_CORE1),
+        0x5,
+        MOD_PD_STATE_ON);
+
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void test_process_power_state_transitions_report(void)
+{
+    int status;
+    struct fwk_event resp;
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT_INIT(
+            FWK_MODULE_IDX_POWER_DOMAIN,
+            PD_EVENT_IDX_REPORT_POWER_STATE_TRANSITIONS),
+        .target_id = FWK_ID_MODULE_INIT(FWK_MODULE_IDX_POWER_DOMAIN),
+    };
+    struct pd_power_state_transitions_report *params =
+        (struct pd_power_state_transitions_report *)event.params;
+
+    params->first_pd_idx = TEST_PD_IDX_CORE0;
+    params->pd_mask = 0x5;
+    params->state = MOD_PD_STATE_ON;
+
+    status = pd_process_event(&event, &resp);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Only the power domains of the set are updated */
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, test_pd_ctx_table[TEST_PD_IDX_CORE0].current_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, test_pd_ctx_table[TEST_PD_IDX_CORE0].requested_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_OFF, test_pd_ctx_table[TEST_PD_IDX_CORE1].current_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, test_pd_ctx_table[TEST_PD_IDX_CORE2].current_state);
+    TEST_ASSERT_EQUAL(
+        MOD_PD_STATE_ON, test_pd_ctx_table[TEST_PD_IDX_CORE2].requested_state);
+}
+
+int power_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_report_power_state_transitions);
+    RUN_TEST(test_report_power_state_transitions_empty_mask);
+    RUN_TEST(test_report_power_state_transitions_out_of_range);
+    RUN_TEST(test_process_power_state_transitions_report);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return power_domain_test_main();
+}
+#endif
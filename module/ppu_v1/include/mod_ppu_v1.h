@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -192,6 +192,26 @@ struct ppu_v1_isr_api {
      * \param pd_id Identifier of the power domain
      */
     void (*ppu_interrupt_handler)(fwk_id_t pd_id);
+
+    /*!
+     * \brief Handle the PPU interrupts of a set of power domains
+     *
+     * \details The power state transitions of the core power domains of the
+     *      set are reported to the power domain module with one report per
+     *      new power state, rather than one report per core.
+     *
+     * \note There is no batched counterpart of the driver set_state()
+     *      function. The power domain module requests the state of each power
+     *      domain on its own, once the states of its parent and children allow
+     *      it, and a PPU state request is a register write that does not go
+     *      through an event. Only the reports of the transitions are batched.
+     *
+     * \param first_pd_id Identifier of the first power domain of the set
+     * \param pd_mask Bitmap of the power domains of the set. Bit n stands for
+     *      the power domain whose element index is the element index of
+     *      first_pd_id plus n.
+     */
+    void (*ppu_interrupt_handler_batch)(fwk_id_t first_pd_id, uint32_t pd_mask);
 };
 
 /*!
@@ -331,9 +331,14 @@ static int ppu_v1_core_pd_prepare_for_system_suspend(fwk_id_t core_pd_id)
 }
 #endif
 
-static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
+/*
+ * Service the interrupt of a core PPU. Returns true if a power state transition
+ * has to be reported, the new power state being returned in *state.
+ */
+static bool core_pd_ppu_interrupt(
+    struct ppu_v1_pd_ctx *pd_ctx,
+    unsigned int *state)
 {
-    int status;
     struct ppu_v1_reg *ppu;
 
     ppu = pd_ctx->ppu;
@@ -346,19 +351,15 @@ static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
                                           PPU_V1_EDGE_SENSITIVITY_MASKED);
         ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
 
-        status = pd_ctx->pd_driver_input_api->report_power_state_transition(
-            pd_ctx->bound_id, MOD_PD_STATE_ON);
-        fwk_assert(status == FWK_SUCCESS);
-        (void)status;
+        *state = MOD_PD_STATE_ON;
+
+        return true;
     /* Minimum policy reached interrupt */
     } else if (ppu_v1_is_dyn_policy_min_interrupt(ppu)) {
         ppu_v1_ack_interrupt(ppu, PPU_V1_ISR_DYN_POLICY_MIN_IRQ);
         ppu_v1_interrupt_mask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
 
-        status = pd_ctx->pd_driver_input_api->report_power_state_transition(
-            pd_ctx->bound_id, MOD_PD_STATE_SLEEP);
-        fwk_assert(status == FWK_SUCCESS);
-        (void)status;
+        *state = MOD_PD_STATE_SLEEP;
 
         /*
          * Enable the core PACTIVE ON signal rising edge interrupt then check if
@@ -377,6 +378,23 @@ static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
             ppu_v1_ack_power_active_edge_interrupt(ppu, PPU_V1_MODE_ON);
             ppu_v1_interrupt_unmask(ppu, PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
         }
+
+        return true;
+    }
+
+    return false;
+}
+
+static void core_pd_ppu_interrupt_handler(struct ppu_v1_pd_ctx *pd_ctx)
+{
+    int status;
+    unsigned int state;
+
+    if (core_pd_ppu_interrupt(pd_ctx, &state)) {
+        status = pd_ctx->pd_driver_input_api->report_power_state_transition(
+            pd_ctx->bound_id, state);
+        fwk_assert(status == FWK_SUCCESS);
+        (void)status;
     }
 }
 
@@ -639,8 +657,122 @@ static void ppu_isr_api_interrupt_handler(fwk_id_t pd_id)
     ppu_interrupt_handler((uintptr_t)pd_ctx);
 }
 
+/*
+ * Set of power domains with the same power state transition to report,
+ * relative to the power domain with the lowest element index.
+ */
+struct ppu_v1_batch_report {
+    struct mod_pd_driver_input_api *api;
+    unsigned int first_pd_idx;
+    uint32_t pd_mask;
+};
+
+static void batch_report_flush(
+    struct ppu_v1_batch_report *report,
+    unsigned int state)
+{
+#ifdef BUILD_HAS_MOD_POWER_DOMAIN
+    int status;
+
+    if (report->pd_mask == 0)
+        return;
+
+    status = report->api->report_power_state_transitions(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, report->first_pd_idx),
+        report->pd_mask,
+        state);
+    fwk_assert(status == FWK_SUCCESS);
+    (void)status;
+
+    report->pd_mask = 0;
+#endif
+}
+
+static void batch_report_add(
+    struct ppu_v1_batch_report *report,
+    struct ppu_v1_pd_ctx *pd_ctx,
+    unsigned int state)
+{
+    int status;
+#ifdef BUILD_HAS_MOD_POWER_DOMAIN
+    unsigned int pd_idx;
+
+    /* Only the power domain module supports batched reports */
+    if ((fwk_id_get_module_idx(pd_ctx->bound_id) ==
+         FWK_MODULE_IDX_POWER_DOMAIN) &&
+        (pd_ctx->pd_driver_input_api->report_power_state_transitions !=
+         NULL)) {
+        pd_idx = fwk_id_get_element_idx(pd_ctx->bound_id);
+
+        if ((report->pd_mask != 0) &&
+            ((pd_idx < report->first_pd_idx) ||
+             (pd_idx >= (report->first_pd_idx + 32)))) {
+            batch_report_flush(report, state);
+        }
+
+        if (report->pd_mask == 0) {
+            report->api = pd_ctx->pd_driver_input_api;
+            report->first_pd_idx = pd_idx;
+        }
+
+        report->pd_mask |= UINT32_C(1) << (pd_idx - report->first_pd_idx);
+
+        return;
+    }
+#endif
+
+    status = pd_ctx->pd_driver_input_api->report_power_state_transition(
+        pd_ctx->bound_id, state);
+    fwk_assert(status == FWK_SUCCESS);
+    (void)status;
+}
+
+static void ppu_isr_api_interrupt_handler_batch(
+    fwk_id_t first_pd_id,
+    uint32_t pd_mask)
+{
+    struct ppu_v1_pd_ctx *pd_ctx;
+    struct ppu_v1_batch_report on_report = { 0 };
+    struct ppu_v1_batch_report sleep_report = { 0 };
+    unsigned int first_idx;
+    unsigned int state;
+    unsigned int idx;
+
+    if (!fwk_id_is_type(first_pd_id, FWK_ID_TYPE_ELEMENT))
+        return;
+
+    first_idx = fwk_id_get_element_idx(first_pd_id);
+
+    while (pd_mask != 0) {
+        idx = first_idx + (unsigned int)__builtin_ctz(pd_mask);
+        pd_mask &= pd_mask - 1;
+
+        if (idx >= ppu_v1_ctx.pd_ctx_table_size)
+            break;
+
+        pd_ctx = ppu_v1_ctx.pd_ctx_table + idx;
+
+        if (pd_ctx->config->pd_type != MOD_PD_TYPE_CORE) {
+            cluster_pd_ppu_interrupt_handler(pd_ctx);
+            continue;
+        }
+
+        if (!core_pd_ppu_interrupt(pd_ctx, &state))
+            continue;
+
+        if (state == MOD_PD_STATE_ON)
+            batch_report_add(&on_report, pd_ctx, state);
+        else
+            batch_report_add(&sleep_report, pd_ctx, state);
+    }
+
+    batch_report_flush(&on_report, MOD_PD_STATE_ON);
+    batch_report_flush(&sleep_report, MOD_PD_STATE_SLEEP);
+}
+
 static const struct ppu_v1_isr_api isr_api = {
     .ppu_interrupt_handler = ppu_isr_api_interrupt_handler,
+    .ppu_interrupt_handler_batch = ppu_isr_api_interrupt_handler_batch,
 };
 
 static int ppu_power_mode_on(fwk_id_t pd_id)
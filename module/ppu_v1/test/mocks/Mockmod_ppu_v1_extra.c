@@ -0,0 +1,379 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmod_ppu_v1_extra.h"
+
+static const char* CMockString_first_pd_id = "first_pd_id";
+static const char* CMockString_pd_id = "pd_id";
+static const char* CMockString_pd_mask = "pd_mask";
+static const char* CMockString_pd_report_power_state_transition = "pd_report_power_state_transition";
+static const char* CMockString_pd_report_power_state_transitions = "pd_report_power_state_transitions";
+static const char* CMockString_state = "state";
+
+typedef struct _CMOCK_pd_report_power_state_transition_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_pd_id;
+  unsigned int Expected_state;
+  char IgnoreArg_pd_id;
+  char IgnoreArg_state;
+
+} CMOCK_pd_report_power_state_transition_CALL_INSTANCE;
+
+typedef struct _CMOCK_pd_report_power_state_transitions_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_first_pd_id;
+  uint32_t Expected_pd_mask;
+  unsigned int Expected_state;
+  char IgnoreArg_first_pd_id;
+  char IgnoreArg_pd_mask;
+  char IgnoreArg_state;
+
+} CMOCK_pd_report_power_state_transitions_CALL_INSTANCE;
+
+static struct Mockmod_ppu_v1_extraInstance
+{
+  char pd_report_power_state_transition_IgnoreBool;
+  int pd_report_power_state_transition_FinalReturn;
+  char pd_report_power_state_transition_CallbackBool;
+  CMOCK_pd_report_power_state_transition_CALLBACK pd_report_power_state_transition_CallbackFunctionPointer;
+  int pd_report_power_state_transition_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE pd_report_power_state_transition_CallInstance;
+  char pd_report_power_state_transitions_IgnoreBool;
+  int pd_report_power_state_transitions_FinalReturn;
+  char pd_report_power_state_transitions_CallbackBool;
+  CMOCK_pd_report_power_state_transitions_CALLBACK pd_report_power_state_transitions_CallbackFunctionPointer;
+  int pd_report_power_state_transitions_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE pd_report_power_state_transitions_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+
+void Mockmod_ppu_v1_extra_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.pd_report_power_state_transition_CallInstance;
+  if (Mock.pd_report_power_state_transition_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_pd_report_power_state_transition);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.pd_report_power_state_transition_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.pd_report_power_state_transitions_CallInstance;
+  if (Mock.pd_report_power_state_transitions_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_pd_report_power_state_transitions);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.pd_report_power_state_transitions_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmod_ppu_v1_extra_Init(void)
+{
+  Mockmod_ppu_v1_extra_Destroy();
+}
+
+void Mockmod_ppu_v1_extra_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+}
+
+int pd_report_power_state_transition(fwk_id_t pd_id, unsigned int state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_pd_report_power_state_transition);
+  cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.pd_report_power_state_transition_CallInstance);
+  Mock.pd_report_power_state_transition_CallInstance = CMock_Guts_MemNext(Mock.pd_report_power_state_transition_CallInstance);
+  if (Mock.pd_report_power_state_transition_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.pd_report_power_state_transition_FinalReturn;
+    Mock.pd_report_power_state_transition_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.pd_report_power_state_transition_CallbackBool &&
+      Mock.pd_report_power_state_transition_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.pd_report_power_state_transition_CallbackFunctionPointer(pd_id, state, Mock.pd_report_power_state_transition_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_pd_id)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_report_power_state_transition,CMockString_pd_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_pd_id), (void*)(&pd_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_state)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_report_power_state_transition,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_state, state, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.pd_report_power_state_transition_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.pd_report_power_state_transition_CallbackFunctionPointer(pd_id, state, Mock.pd_report_power_state_transition_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_pd_report_power_state_transition(CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance, fwk_id_t pd_id, unsigned int state);
+void CMockExpectParameters_pd_report_power_state_transition(CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance, fwk_id_t pd_id, unsigned int state)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_pd_id), (void*)(&pd_id),
+         sizeof(fwk_id_t[sizeof(pd_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_pd_id = 0;
+  cmock_call_instance->Expected_state = state;
+  cmock_call_instance->IgnoreArg_state = 0;
+}
+
+void pd_report_power_state_transition_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transition_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transition_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transition_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)1;
+}
+
+void pd_report_power_state_transition_CMockStopIgnore(void)
+{
+  if(Mock.pd_report_power_state_transition_IgnoreBool)
+    Mock.pd_report_power_state_transition_CallInstance = CMock_Guts_MemNext(Mock.pd_report_power_state_transition_CallInstance);
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+}
+
+void pd_report_power_state_transition_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transition_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transition_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transition_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void pd_report_power_state_transition_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t pd_id, unsigned int state, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transition_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transition_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transition_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_pd_report_power_state_transition(cmock_call_instance, pd_id, state);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void pd_report_power_state_transition_AddCallback(CMOCK_pd_report_power_state_transition_CALLBACK Callback)
+{
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+  Mock.pd_report_power_state_transition_CallbackBool = (char)1;
+  Mock.pd_report_power_state_transition_CallbackFunctionPointer = Callback;
+}
+
+void pd_report_power_state_transition_Stub(CMOCK_pd_report_power_state_transition_CALLBACK Callback)
+{
+  Mock.pd_report_power_state_transition_IgnoreBool = (char)0;
+  Mock.pd_report_power_state_transition_CallbackBool = (char)0;
+  Mock.pd_report_power_state_transition_CallbackFunctionPointer = Callback;
+}
+
+void pd_report_power_state_transition_CMockIgnoreArg_pd_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_report_power_state_transition_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pd_id = 1;
+}
+
+void pd_report_power_state_transition_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_report_power_state_transition_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transition_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_report_power_state_transition_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_state = 1;
+}
+
+int pd_report_power_state_transitions(fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_pd_report_power_state_transitions);
+  cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.pd_report_power_state_transitions_CallInstance);
+  Mock.pd_report_power_state_transitions_CallInstance = CMock_Guts_MemNext(Mock.pd_report_power_state_transitions_CallInstance);
+  if (Mock.pd_report_power_state_transitions_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.pd_report_power_state_transitions_FinalReturn;
+    Mock.pd_report_power_state_transitions_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.pd_report_power_state_transitions_CallbackBool &&
+      Mock.pd_report_power_state_transitions_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.pd_report_power_state_transitions_CallbackFunctionPointer(first_pd_id, pd_mask, state, Mock.pd_report_power_state_transitions_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_first_pd_id)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_report_power_state_transitions,CMockString_first_pd_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_first_pd_id), (void*)(&first_pd_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pd_mask)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_report_power_state_transitions,CMockString_pd_mask);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_pd_mask, pd_mask, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_state)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_report_power_state_transitions,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_state, state, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.pd_report_power_state_transitions_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.pd_report_power_state_transitions_CallbackFunctionPointer(first_pd_id, pd_mask, state, Mock.pd_report_power_state_transitions_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_pd_report_power_state_transitions(CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance, fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state);
+void CMockExpectParameters_pd_report_power_state_transitions(CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance, fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_first_pd_id), (void*)(&first_pd_id),
+         sizeof(fwk_id_t[sizeof(first_pd_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_first_pd_id = 0;
+  cmock_call_instance->Expected_pd_mask = pd_mask;
+  cmock_call_instance->IgnoreArg_pd_mask = 0;
+  cmock_call_instance->Expected_state = state;
+  cmock_call_instance->IgnoreArg_state = 0;
+}
+
+void pd_report_power_state_transitions_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transitions_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transitions_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transitions_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)1;
+}
+
+void pd_report_power_state_transitions_CMockStopIgnore(void)
+{
+  if(Mock.pd_report_power_state_transitions_IgnoreBool)
+    Mock.pd_report_power_state_transitions_CallInstance = CMock_Guts_MemNext(Mock.pd_report_power_state_transitions_CallInstance);
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+}
+
+void pd_report_power_state_transitions_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transitions_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transitions_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transitions_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void pd_report_power_state_transitions_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_report_power_state_transitions_CALL_INSTANCE));
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_report_power_state_transitions_CallInstance = CMock_Guts_MemChain(Mock.pd_report_power_state_transitions_CallInstance, cmock_guts_index);
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_pd_report_power_state_transitions(cmock_call_instance, first_pd_id, pd_mask, state);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void pd_report_power_state_transitions_AddCallback(CMOCK_pd_report_power_state_transitions_CALLBACK Callback)
+{
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+  Mock.pd_report_power_state_transitions_CallbackBool = (char)1;
+  Mock.pd_report_power_state_transitions_CallbackFunctionPointer = Callback;
+}
+
+void pd_report_power_state_transitions_Stub(CMOCK_pd_report_power_state_transitions_CALLBACK Callback)
+{
+  Mock.pd_report_power_state_transitions_IgnoreBool = (char)0;
+  Mock.pd_report_power_state_transitions_CallbackBool = (char)0;
+  Mock.pd_report_power_state_transitions_CallbackFunctionPointer = Callback;
+}
+
+void pd_report_power_state_transitions_CMockIgnoreArg_first_pd_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_report_power_state_transitions_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_first_pd_id = 1;
+}
+
+void pd_report_power_state_transitions_CMockIgnoreArg_pd_mask(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_report_power_state_transitions_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pd_mask = 1;
+}
+
+void pd_report_power_state_transitions_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_report_power_state_transitions_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_report_power_state_transitions_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_report_power_state_transitions_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_state = 1;
+}
+
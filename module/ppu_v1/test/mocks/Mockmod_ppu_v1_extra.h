@@ -0,0 +1,68 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMOD_PPU_V1_EXTRA_H
+#define _MOCKMOD_PPU_V1_EXTRA_H
+
+#include "unity.h"
+#include "mod_ppu_v1_extra.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmod_ppu_v1_extra_Init(void);
+void Mockmod_ppu_v1_extra_Destroy(void);
+void Mockmod_ppu_v1_extra_Verify(void);
+
+
+
+
+#define pd_report_power_state_transition_IgnoreAndReturn(cmock_retval) pd_report_power_state_transition_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void pd_report_power_state_transition_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_report_power_state_transition_StopIgnore() pd_report_power_state_transition_CMockStopIgnore()
+void pd_report_power_state_transition_CMockStopIgnore(void);
+#define pd_report_power_state_transition_ExpectAnyArgsAndReturn(cmock_retval) pd_report_power_state_transition_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void pd_report_power_state_transition_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_report_power_state_transition_ExpectAndReturn(pd_id, state, cmock_retval) pd_report_power_state_transition_CMockExpectAndReturn(__LINE__, pd_id, state, cmock_retval)
+void pd_report_power_state_transition_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t pd_id, unsigned int state, int cmock_to_return);
+typedef int (* CMOCK_pd_report_power_state_transition_CALLBACK)(fwk_id_t pd_id, unsigned int state, int cmock_num_calls);
+void pd_report_power_state_transition_AddCallback(CMOCK_pd_report_power_state_transition_CALLBACK Callback);
+void pd_report_power_state_transition_Stub(CMOCK_pd_report_power_state_transition_CALLBACK Callback);
+#define pd_report_power_state_transition_StubWithCallback pd_report_power_state_transition_Stub
+#define pd_report_power_state_transition_IgnoreArg_pd_id() pd_report_power_state_transition_CMockIgnoreArg_pd_id(__LINE__)
+void pd_report_power_state_transition_CMockIgnoreArg_pd_id(UNITY_LINE_TYPE cmock_line);
+#define pd_report_power_state_transition_IgnoreArg_state() pd_report_power_state_transition_CMockIgnoreArg_state(__LINE__)
+void pd_report_power_state_transition_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line);
+#define pd_report_power_state_transitions_IgnoreAndReturn(cmock_retval) pd_report_power_state_transitions_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void pd_report_power_state_transitions_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_report_power_state_transitions_StopIgnore() pd_report_power_state_transitions_CMockStopIgnore()
+void pd_report_power_state_transitions_CMockStopIgnore(void);
+#define pd_report_power_state_transitions_ExpectAnyArgsAndReturn(cmock_retval) pd_report_power_state_transitions_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void pd_report_power_state_transitions_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_report_power_state_transitions_ExpectAndReturn(first_pd_id, pd_mask, state, cmock_retval) pd_report_power_state_transitions_CMockExpectAndReturn(__LINE__, first_pd_id, pd_mask, state, cmock_retval)
+void pd_report_power_state_transitions_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state, int cmock_to_return);
+typedef int (* CMOCK_pd_report_power_state_transitions_CALLBACK)(fwk_id_t first_pd_id, uint32_t pd_mask, unsigned int state, int cmock_num_calls);
+void pd_report_power_state_transitions_AddCallback(CMOCK_pd_report_power_state_transitions_CALLBACK Callback);
+void pd_report_power_state_transitions_Stub(CMOCK_pd_report_power_state_transitions_CALLBACK Callback);
+#define pd_report_power_state_transitions_StubWithCallback pd_report_power_state_transitions_Stub
+#define pd_report_power_state_transitions_IgnoreArg_first_pd_id() pd_report_power_state_transitions_CMockIgnoreArg_first_pd_id(__LINE__)
+void pd_report_power_state_transitions_CMockIgnoreArg_first_pd_id(UNITY_LINE_TYPE cmock_line);
+#define pd_report_power_state_transitions_IgnoreArg_pd_mask() pd_report_power_state_transitions_CMockIgnoreArg_pd_mask(__LINE__)
+void pd_report_power_state_transitions_CMockIgnoreArg_pd_mask(UNITY_LINE_TYPE cmock_line);
+#define pd_report_power_state_transitions_IgnoreArg_state() pd_report_power_state_transitions_CMockIgnoreArg_state(__LINE__)
+void pd_report_power_state_transitions_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
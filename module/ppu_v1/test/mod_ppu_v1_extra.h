@@ -0,0 +1,18 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      PPU v1 unit test support.
+ */
+#include <fwk_id.h>
+
+#include <stdint.h>
+
+int pd_report_power_state_transition(fwk_id_t pd_id, unsigned int state);
+int pd_report_power_state_transitions(
+    fwk_id_t first_pd_id,
+    uint32_t pd_mask,
+    unsigned int state);
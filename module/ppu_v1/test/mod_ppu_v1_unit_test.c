@@ -0,0 +1,265 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+#include <Mockmod_ppu_v1_extra.h>
+
+#include <internal/Mockfwk_core_internal.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+enum test_pd_idx {
+    TEST_PD_IDX_CORE0,
+    TEST_PD_IDX_CORE1,
+    TEST_PD_IDX_CORE2,
+    TEST_PD_IDX_COUNT,
+};
+
+/* Element index of the power domain of the first core */
+#define TEST_FIRST_CORE_PD_IDX 4
+
+/* Edge interrupt of the ON request of a core */
+#define TEST_PPU_ISR_ON_EDGE_IRQ \
+    (UINT32_C(1) << (PPU_V1_MODE_ON + PPU_V1_ISR_ACTIVE_EDGE_POS))
+
+static struct ppu_v1_reg test_ppu[TEST_PD_IDX_COUNT];
+static struct ppu_v1_pd_ctx test_pd_ctx_table[TEST_PD_IDX_COUNT];
+
+static const struct mod_ppu_v1_pd_config test_core_config = {
+    .pd_type = MOD_PD_TYPE_CORE,
+};
+
+static struct mod_pd_driver_input_api test_pd_driver_input_api = {
+    .report_power_state_transition = pd_report_power_state_transition,
+    .report_power_state_transitions = pd_report_power_state_transitions,
+};
+
+static const fwk_id_t test_ppu_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_PPU_V1, TEST_PD_IDX_CORE0);
+
+void setUp(void)
+{
+    unsigned int idx;
+
+    memset(test_ppu, 0, sizeof(test_ppu));
+    memset(test_pd_ctx_table, 0, sizeof(test_pd_ctx_table));
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_pd_ctx_table[idx] = (struct ppu_v1_pd_ctx){
+            .config = &test_core_config,
+            .ppu = &test_ppu[idx],
+            .bound_id = FWK_ID_ELEMENT(
+                FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX + idx),
+            .pd_driver_input_api = &test_pd_driver_input_api,
+        };
+    }
+
+    ppu_v1_ctx.pd_ctx_table = test_pd_ctx_table;
+    ppu_v1_ctx.pd_ctx_table_size = TEST_PD_IDX_COUNT;
+}
+
+void tearDown(void)
+{
+}
+
+void test_interrupt_handler_batch_same_state(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_ppu[idx].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+        test_ppu[idx].IMR = PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK;
+    }
+
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x7,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+
+    /* The dynamic policy minimum interrupt is enabled again */
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        TEST_ASSERT_EQUAL(
+            0, test_ppu[idx].IMR & PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+    }
+}
+
+void test_interrupt_handler_batch_mixed_states(void)
+{
+    test_ppu[TEST_PD_IDX_CORE0].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+    test_ppu[TEST_PD_IDX_CORE1].ISR = PPU_V1_ISR_DYN_POLICY_MIN_IRQ;
+    test_ppu[TEST_PD_IDX_CORE2].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x5,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX + 1),
+        0x1,
+        MOD_PD_STATE_SLEEP,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+
+    /* The dynamic policy minimum interrupt is masked until the core wakes up */
+    TEST_ASSERT_EQUAL(
+        PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK,
+        test_ppu[TEST_PD_IDX_CORE1].IMR & PPU_V1_IMR_DYN_POLICY_MIN_IRQ_MASK);
+}
+
+void test_interrupt_handler_batch_no_transition(void)
+{
+    /* Only the second core has a pending interrupt */
+    test_ppu[TEST_PD_IDX_CORE1].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX + 1),
+        0x1,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+}
+
+void test_interrupt_handler_batch_mask_subset(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_ppu[idx].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+    }
+
+    /* The second core is not part of the set and is not serviced */
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x5,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x5);
+
+    TEST_ASSERT_EQUAL(
+        TEST_PPU_ISR_ON_EDGE_IRQ, test_ppu[TEST_PD_IDX_CORE1].ISR);
+}
+
+void test_interrupt_handler_batch_flush_out_of_range(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_ppu[idx].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+    }
+
+    /*
+     * The power domain of the last core is too far from the first one to be
+     * part of the same report, which is sent before a new one is started.
+     */
+    test_pd_ctx_table[TEST_PD_IDX_CORE2].bound_id = FWK_ID_ELEMENT(
+        FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX + 32);
+
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x3,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX + 32),
+        0x1,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+}
+
+void test_interrupt_handler_batch_flush_lower_index(void)
+{
+    unsigned int idx;
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_ppu[idx].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+    }
+
+    /* The power domains are not in the order of the PPUs */
+    test_pd_ctx_table[TEST_PD_IDX_CORE1].bound_id = FWK_ID_ELEMENT(
+        FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX - 1);
+
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x1,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX - 1),
+        0x9,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+}
+
+void test_interrupt_handler_batch_other_module(void)
+{
+    unsigned int idx;
+    fwk_id_t bound_id = FWK_ID_MODULE(FWK_MODULE_IDX_SYSTEM_POWER);
+
+    for (idx = 0; idx < TEST_PD_IDX_COUNT; idx++) {
+        test_ppu[idx].ISR = TEST_PPU_ISR_ON_EDGE_IRQ;
+    }
+
+    /* Only the power domain module receives batched reports */
+    test_pd_ctx_table[TEST_PD_IDX_CORE1].bound_id = bound_id;
+
+    pd_report_power_state_transition_ExpectAndReturn(
+        bound_id, MOD_PD_STATE_ON, FWK_SUCCESS);
+    pd_report_power_state_transitions_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, TEST_FIRST_CORE_PD_IDX),
+        0x5,
+        MOD_PD_STATE_ON,
+        FWK_SUCCESS);
+
+    ppu_isr_api_interrupt_handler_batch(test_ppu_id, 0x7);
+}
+
+int ppu_v1_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_interrupt_handler_batch_same_state);
+    RUN_TEST(test_interrupt_handler_batch_mixed_states);
+    RUN_TEST(test_interrupt_handler_batch_no_transition);
+    RUN_TEST(test_interrupt_handler_batch_mask_subset);
+    RUN_TEST(test_interrupt_handler_batch_flush_out_of_range);
+    RUN_TEST(test_interrupt_handler_batch_flush_lower_index);
+    RUN_TEST(test_interrupt_handler_batch_other_module);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return ppu_v1_test_main();
+}
+#endif
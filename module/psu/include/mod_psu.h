@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -420,6 +420,30 @@ struct mod_psu_element_cfg {
      *      ::mod_psu_driver_api.
      */
     fwk_id_t driver_api_id;
+
+    /*!
+     * \brief Cache the voltage and enable state of the device.
+     *
+     * \details When set, the last voltage and enable state read from or
+     *      successfully written to the driver are cached, and the
+     *      ::mod_psu_device_api::get_voltage and
+     *      ::mod_psu_device_api::get_enabled functions return the cached
+     *      value synchronously, even while another operation is in progress.
+     *      The cache is filled by the first read and is updated on every
+     *      successful write.
+     */
+    bool cache_enabled;
+
+    /*!
+     * \brief Number of reads served from the cache before the state is read
+     *      back from the driver again.
+     *
+     * \details When the device is idle, the read following this number of
+     *      cached reads is forwarded to the driver to re-verify the cached
+     *      state. Zero to never re-verify it. Only used if
+     *      ::mod_psu_element_cfg::cache_enabled is set.
+     */
+    unsigned int cache_verify_period;
 };
 
 /*!
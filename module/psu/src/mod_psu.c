@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -26,6 +26,26 @@ struct mod_psu_operation {
     enum mod_psu_state state;
 
     unsigned int cookie;
+
+    /* Value being written by the operation, if it is a write */
+    union {
+        bool enabled;
+        uint32_t voltage;
+    };
+};
+
+struct mod_psu_cache {
+    bool enabled_valid;
+    bool enabled;
+
+    /* Number of reads of the enable state served from the cache */
+    unsigned int enabled_hits;
+
+    bool voltage_valid;
+    uint32_t voltage;
+
+    /* Number of reads of the voltage served from the cache */
+    unsigned int voltage_hits;
 };
 
 enum mod_psu_impl_event_idx {
@@ -42,6 +62,8 @@ static struct mod_psu_mod_ctx {
         const struct mod_psu_driver_api *driver;
 
         struct mod_psu_operation op;
+
+        struct mod_psu_cache cache;
     } *elements;
 } mod_psu_ctx;
 
@@ -72,6 +94,48 @@ static int mod_psu_get_cfg_ctx(
     return FWK_SUCCESS;
 }
 
+/*
+ * Check whether a read can be served from the cache. Once the re-verification
+ * period is reached, the next read issued while the device is idle is
+ * forwarded to the driver.
+ */
+static bool mod_psu_cache_hit(
+    const struct mod_psu_element_cfg *cfg,
+    const struct mod_psu_element_ctx *ctx,
+    bool valid,
+    unsigned int *hits)
+{
+    if (!cfg->cache_enabled || !valid) {
+        return false;
+    }
+
+    if ((cfg->cache_verify_period != 0) &&
+        (*hits >= cfg->cache_verify_period) &&
+        (ctx->op.state == MOD_PSU_STATE_IDLE)) {
+        return false;
+    }
+
+    (*hits)++;
+
+    return true;
+}
+
+static void mod_psu_cache_enabled(struct mod_psu_element_ctx *ctx, bool enabled)
+{
+    ctx->cache.enabled_valid = true;
+    ctx->cache.enabled = enabled;
+    ctx->cache.enabled_hits = 0;
+}
+
+static void mod_psu_cache_voltage(
+    struct mod_psu_element_ctx *ctx,
+    uint32_t voltage)
+{
+    ctx->cache.voltage_valid = true;
+    ctx->cache.voltage = voltage;
+    ctx->cache.voltage_hits = 0;
+}
+
 static int mod_psu_get_enabled(fwk_id_t element_id, bool *enabled)
 {
     int status;
@@ -84,6 +148,13 @@ static int mod_psu_get_enabled(fwk_id_t element_id, bool *enabled)
         goto exit;
     }
 
+    if (mod_psu_cache_hit(
+            cfg, ctx, ctx->cache.enabled_valid, &ctx->cache.enabled_hits)) {
+        *enabled = ctx->cache.enabled;
+
+        goto exit;
+    }
+
     if (ctx->op.state != MOD_PSU_STATE_IDLE) {
         status = FWK_E_BUSY;
 
@@ -91,7 +162,9 @@ static int mod_psu_get_enabled(fwk_id_t element_id, bool *enabled)
     }
 
     status = ctx->driver->get_enabled(cfg->driver_id, enabled);
-    if (status == FWK_PENDING) {
+    if (status == FWK_SUCCESS) {
+        mod_psu_cache_enabled(ctx, *enabled);
+    } else if (status == FWK_PENDING) {
         struct fwk_event_light request = {
             .id = mod_psu_event_id_get_enabled,
             .target_id = element_id,
@@ -133,8 +206,12 @@ static int mod_psu_set_enabled(fwk_id_t element_id, bool enabled)
         goto exit;
     }
 
+    ctx->op.enabled = enabled;
+
     status = ctx->driver->set_enabled(cfg->driver_id, enabled);
-    if (status == FWK_PENDING) {
+    if (status == FWK_SUCCESS) {
+        mod_psu_cache_enabled(ctx, enabled);
+    } else if (status == FWK_PENDING) {
         struct fwk_event_light request = {
             .id = mod_psu_event_id_set_enabled,
             .target_id = element_id,
@@ -150,7 +227,10 @@ static int mod_psu_set_enabled(fwk_id_t element_id, bool enabled)
         } else {
             status = FWK_E_STATE;
         }
-    } else if (status != FWK_SUCCESS) {
+    } else {
+        /* The state of the device is unknown after a failed write */
+        ctx->cache.enabled_valid = false;
+
         status = FWK_E_HANDLER;
     }
 
@@ -170,6 +250,13 @@ static int mod_psu_get_voltage(fwk_id_t element_id, uint32_t *voltage)
         goto exit;
     }
 
+    if (mod_psu_cache_hit(
+            cfg, ctx, ctx->cache.voltage_valid, &ctx->cache.voltage_hits)) {
+        *voltage = ctx->cache.voltage;
+
+        goto exit;
+    }
+
     if (ctx->op.state != MOD_PSU_STATE_IDLE) {
         status = FWK_E_BUSY;
 
@@ -177,7 +264,9 @@ static int mod_psu_get_voltage(fwk_id_t element_id, uint32_t *voltage)
     }
 
     status = ctx->driver->get_voltage(cfg->driver_id, voltage);
-    if (status == FWK_PENDING) {
+    if (status == FWK_SUCCESS) {
+        mod_psu_cache_voltage(ctx, *voltage);
+    } else if (status == FWK_PENDING) {
         struct fwk_event_light request = {
             .id = mod_psu_event_id_get_voltage,
             .target_id = element_id,
@@ -219,8 +308,12 @@ static int mod_psu_set_voltage(fwk_id_t element_id, uint32_t voltage)
         goto exit;
     }
 
+    ctx->op.voltage = voltage;
+
     status = ctx->driver->set_voltage(cfg->driver_id, voltage);
-    if (status == FWK_PENDING) {
+    if (status == FWK_SUCCESS) {
+        mod_psu_cache_voltage(ctx, voltage);
+    } else if (status == FWK_PENDING) {
         struct fwk_event_light request = {
             .id = mod_psu_event_id_set_voltage,
             .target_id = element_id,
@@ -236,7 +329,10 @@ static int mod_psu_set_voltage(fwk_id_t element_id, uint32_t voltage)
         } else {
             status = FWK_E_STATE;
         }
-    } else if (status != FWK_SUCCESS) {
+    } else {
+        /* The state of the device is unknown after a failed write */
+        ctx->cache.voltage_valid = false;
+
         status = FWK_E_HANDLER;
     }
 
@@ -447,11 +543,37 @@ static int mod_psu_process_event(
         case MOD_PSU_EVENT_IDX_GET_ENABLED:
             hal_params->enabled = params->enabled;
 
+            if (params->status == FWK_SUCCESS) {
+                mod_psu_cache_enabled(ctx, params->enabled);
+            }
+
+            break;
+
+        case MOD_PSU_EVENT_IDX_SET_ENABLED:
+            if (params->status == FWK_SUCCESS) {
+                mod_psu_cache_enabled(ctx, ctx->op.enabled);
+            } else {
+                ctx->cache.enabled_valid = false;
+            }
+
             break;
 
         case MOD_PSU_EVENT_IDX_GET_VOLTAGE:
             hal_params->voltage = params->voltage;
 
+            if (params->status == FWK_SUCCESS) {
+                mod_psu_cache_voltage(ctx, params->voltage);
+            }
+
+            break;
+
+        case MOD_PSU_EVENT_IDX_SET_VOLTAGE:
+            if (params->status == FWK_SUCCESS) {
+                mod_psu_cache_voltage(ctx, ctx->op.voltage);
+            } else {
+                ctx->cache.voltage_valid = false;
+            }
+
             break;
 
         default:
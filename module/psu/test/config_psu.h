@@ -0,0 +1,52 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_psu.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+enum fake_psu_element_idx {
+    /* Device read through on every access */
+    FAKE_PSU_ELEMENT_IDX_UNCACHED,
+
+    /* Cached device, never re-verified */
+    FAKE_PSU_ELEMENT_IDX_CACHED,
+
+    /* Cached device, re-verified every FAKE_PSU_VERIFY_PERIOD reads */
+    FAKE_PSU_ELEMENT_IDX_VERIFIED,
+
+    FAKE_PSU_ELEMENT_IDX_COUNT,
+};
+
+#define FAKE_PSU_VERIFY_PERIOD 2
+
+#define FAKE_PSU_ELEMENT_ID(idx) FWK_ID_ELEMENT(FWK_MODULE_IDX_PSU, idx)
+
+#define FAKE_PSU_DRIVER_ID(idx) \
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_FAKE_PSU_DRIVER, idx)
+
+#define FAKE_PSU_DRIVER_API_ID FWK_ID_API_INIT(FWK_MODULE_IDX_FAKE_PSU_DRIVER, 0)
+
+static const struct mod_psu_element_cfg
+    fake_psu_element_cfg[FAKE_PSU_ELEMENT_IDX_COUNT] = {
+        [FAKE_PSU_ELEMENT_IDX_UNCACHED] = {
+            .driver_id = FAKE_PSU_DRIVER_ID(FAKE_PSU_ELEMENT_IDX_UNCACHED),
+            .driver_api_id = FAKE_PSU_DRIVER_API_ID,
+        },
+        [FAKE_PSU_ELEMENT_IDX_CACHED] = {
+            .driver_id = FAKE_PSU_DRIVER_ID(FAKE_PSU_ELEMENT_IDX_CACHED),
+            .driver_api_id = FAKE_PSU_DRIVER_API_ID,
+            .cache_enabled = true,
+        },
+        [FAKE_PSU_ELEMENT_IDX_VERIFIED] = {
+            .driver_id = FAKE_PSU_DRIVER_ID(FAKE_PSU_ELEMENT_IDX_VERIFIED),
+            .driver_api_id = FAKE_PSU_DRIVER_API_ID,
+            .cache_enabled = true,
+            .cache_verify_period = FAKE_PSU_VERIFY_PERIOD,
+        },
+    };
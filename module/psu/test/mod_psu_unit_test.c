@@ -0,0 +1,344 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_psu.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_psu.h"
+
+#define FAKE_VOLTAGE_MV 800
+#define FAKE_OTHER_VOLTAGE_MV 900
+
+/* State of the device behind the fake driver */
+static uint32_t fake_driver_voltage;
+static bool fake_driver_enabled;
+
+/* Status returned by the fake driver functions */
+static int fake_driver_status;
+
+/* Number of reads of the device by the fake driver */
+static unsigned int fake_driver_read_count;
+
+static int fake_driver_get_enabled(fwk_id_t id, bool *enabled)
+{
+    fake_driver_read_count++;
+    *enabled = fake_driver_enabled;
+
+    return fake_driver_status;
+}
+
+static int fake_driver_set_enabled(fwk_id_t id, bool enable)
+{
+    if (fake_driver_status == FWK_SUCCESS) {
+        fake_driver_enabled = enable;
+    }
+
+    return fake_driver_status;
+}
+
+static int fake_driver_get_voltage(fwk_id_t id, uint32_t *voltage)
+{
+    fake_driver_read_count++;
+    *voltage = fake_driver_voltage;
+
+    return fake_driver_status;
+}
+
+static int fake_driver_set_voltage(fwk_id_t id, uint32_t voltage)
+{
+    if (fake_driver_status == FWK_SUCCESS) {
+        fake_driver_voltage = voltage;
+    }
+
+    return fake_driver_status;
+}
+
+static const struct mod_psu_driver_api fake_driver_api = {
+    .get_enabled = fake_driver_get_enabled,
+    .set_enabled = fake_driver_set_enabled,
+    .get_voltage = fake_driver_get_voltage,
+    .set_voltage = fake_driver_set_voltage,
+};
+
+static const void *get_data_callback(fwk_id_t id, int cmock_num_calls)
+{
+    return &fake_psu_element_cfg[fwk_id_get_element_idx(id)];
+}
+
+static void get_voltage_expect(
+    enum fake_psu_element_idx element_idx,
+    uint32_t expected_voltage,
+    unsigned int expected_read_count)
+{
+    int status;
+    uint32_t voltage = 0;
+
+    status = mod_psu_get_voltage(FAKE_PSU_ELEMENT_ID(element_idx), &voltage);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(expected_voltage, voltage);
+    TEST_ASSERT_EQUAL(expected_read_count, fake_driver_read_count);
+}
+
+/* Complete the pending operation of an element with the given status */
+static void driver_respond(
+    enum fake_psu_element_idx element_idx,
+    fwk_id_t request_event_id,
+    int driver_status)
+{
+    int status;
+    struct fwk_event response_event;
+    struct fwk_event hal_event = {
+        .id = request_event_id,
+        .target_id = FAKE_PSU_ELEMENT_ID(element_idx),
+    };
+    struct fwk_event event = {
+        .id = mod_psu_impl_event_id_response,
+        .target_id = FAKE_PSU_ELEMENT_ID(element_idx),
+    };
+    struct mod_psu_driver_response *params =
+        (struct mod_psu_driver_response *)event.params;
+
+    params->status = driver_status;
+
+    fwk_get_delayed_response_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fwk_get_delayed_response_ReturnThruPtr_event(&hal_event);
+    __fwk_put_event_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = mod_psu_process_event(&event, &response_event);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void setUp(void)
+{
+    unsigned int idx;
+    int status;
+
+    fake_driver_voltage = FAKE_VOLTAGE_MV;
+    fake_driver_enabled = true;
+    fake_driver_status = FWK_SUCCESS;
+    fake_driver_read_count = 0;
+
+    fwk_module_get_data_Stub(get_data_callback);
+
+    status = mod_psu_init(fwk_module_id_psu, FAKE_PSU_ELEMENT_IDX_COUNT, NULL);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    for (idx = 0; idx < FAKE_PSU_ELEMENT_IDX_COUNT; idx++) {
+        status = mod_psu_element_init(
+            FAKE_PSU_ELEMENT_ID(idx), 0, &fake_psu_element_cfg[idx]);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+        mod_psu_ctx.elements[idx].driver = &fake_driver_api;
+    }
+}
+
+void tearDown(void)
+{
+    fwk_mm_free(mod_psu_ctx.elements);
+}
+
+void test_psu_get_voltage_uncached(void)
+{
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_UNCACHED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_UNCACHED, FAKE_VOLTAGE_MV, 2);
+}
+
+void test_psu_get_voltage_cache_hit(void)
+{
+    /* The first read fills the cache */
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+
+    /* A change behind the back of the HAL is not seen */
+    fake_driver_voltage = FAKE_OTHER_VOLTAGE_MV;
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+}
+
+void test_psu_get_enabled_cache_hit(void)
+{
+    int status;
+    bool enabled = false;
+
+    status = mod_psu_get_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED), &enabled);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(enabled);
+
+    fake_driver_enabled = false;
+
+    status = mod_psu_get_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED), &enabled);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(enabled);
+    TEST_ASSERT_EQUAL(1, fake_driver_read_count);
+}
+
+void test_psu_set_voltage_updates_cache(void)
+{
+    int status;
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+
+    status = mod_psu_set_voltage(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED),
+        FAKE_OTHER_VOLTAGE_MV);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The written voltage is read from the cache */
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_OTHER_VOLTAGE_MV, 1);
+}
+
+void test_psu_get_voltage_verify_period(void)
+{
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+
+    fake_driver_voltage = FAKE_OTHER_VOLTAGE_MV;
+
+    /* FAKE_PSU_VERIFY_PERIOD reads are served from the cache */
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+
+    /* The next one reads the device again and refreshes the cache */
+    get_voltage_expect(
+        FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_OTHER_VOLTAGE_MV, 2);
+    get_voltage_expect(
+        FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_OTHER_VOLTAGE_MV, 2);
+}
+
+void test_psu_get_voltage_verify_deferred_while_busy(void)
+{
+    int status;
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+
+    /* Start an asynchronous write of the enable state */
+    fake_driver_status = FWK_PENDING;
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = mod_psu_set_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_VERIFIED),
+        false);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    /* The re-verification is deferred until the device is idle */
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 1);
+
+    fake_driver_status = FWK_SUCCESS;
+    driver_respond(
+        FAKE_PSU_ELEMENT_IDX_VERIFIED, mod_psu_event_id_set_enabled, FWK_SUCCESS);
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_VERIFIED, FAKE_VOLTAGE_MV, 2);
+}
+
+void test_psu_set_voltage_error_invalidates_cache(void)
+{
+    int status;
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+
+    fake_driver_status = FWK_E_DEVICE;
+
+    status = mod_psu_set_voltage(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED),
+        FAKE_OTHER_VOLTAGE_MV);
+    TEST_ASSERT_EQUAL(FWK_E_HANDLER, status);
+    TEST_ASSERT_FALSE(
+        mod_psu_ctx.elements[FAKE_PSU_ELEMENT_IDX_CACHED].cache.voltage_valid);
+
+    /* The state of the device is read again */
+    fake_driver_status = FWK_SUCCESS;
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 2);
+}
+
+void test_psu_set_enabled_error_invalidates_cache(void)
+{
+    int status;
+    bool enabled = false;
+
+    status = mod_psu_get_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED), &enabled);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(1, fake_driver_read_count);
+
+    fake_driver_status = FWK_E_DEVICE;
+
+    status = mod_psu_set_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED), false);
+    TEST_ASSERT_EQUAL(FWK_E_HANDLER, status);
+
+    fake_driver_status = FWK_SUCCESS;
+
+    status = mod_psu_get_enabled(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED), &enabled);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_TRUE(enabled);
+    TEST_ASSERT_EQUAL(2, fake_driver_read_count);
+}
+
+void test_psu_set_voltage_async_error_invalidates_cache(void)
+{
+    int status;
+
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+
+    fake_driver_status = FWK_PENDING;
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+
+    status = mod_psu_set_voltage(
+        FAKE_PSU_ELEMENT_ID(FAKE_PSU_ELEMENT_IDX_CACHED),
+        FAKE_OTHER_VOLTAGE_MV);
+    TEST_ASSERT_EQUAL(FWK_PENDING, status);
+
+    /* The cache still holds the last known voltage until the write ends */
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 1);
+
+    driver_respond(
+        FAKE_PSU_ELEMENT_IDX_CACHED, mod_psu_event_id_set_voltage, FWK_E_DEVICE);
+    TEST_ASSERT_FALSE(
+        mod_psu_ctx.elements[FAKE_PSU_ELEMENT_IDX_CACHED].cache.voltage_valid);
+
+    fake_driver_status = FWK_SUCCESS;
+    get_voltage_expect(FAKE_PSU_ELEMENT_IDX_CACHED, FAKE_VOLTAGE_MV, 2);
+}
+
+int psu_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_psu_get_voltage_uncached);
+    RUN_TEST(test_psu_get_voltage_cache_hit);
+    RUN_TEST(test_psu_get_enabled_cache_hit);
+    RUN_TEST(test_psu_set_voltage_updates_cache);
+    RUN_TEST(test_psu_get_voltage_verify_period);
+    RUN_TEST(test_psu_get_voltage_verify_deferred_while_busy);
+    RUN_TEST(test_psu_set_voltage_error_invalidates_cache);
+    RUN_TEST(test_psu_set_enabled_error_invalidates_cache);
+    RUN_TEST(test_psu_set_voltage_async_error_invalidates_cache);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return psu_test_main();
+}
+#endif
@@ -15,6 +15,7 @@
 #include <mod_scmi_header.h>
 
 #include <fwk_id.h>
+#include <fwk_time.h>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -59,6 +60,14 @@ struct scmi_service_ctx {
 
     /* SCMI type of the message currently being processed */
     enum mod_scmi_message_type scmi_message_type;
+
+#ifdef BUILD_HAS_DEBUGGER
+    /* Number of messages received on the service */
+    uint32_t message_count;
+
+    /* Number of messages which could not be handled */
+    uint32_t error_count;
+#endif
 };
 
 struct scmi_protocol {
@@ -113,6 +122,14 @@ struct mod_scmi_ctx {
     /* Table of scmi notification subscribers */
     struct scmi_notification_subscribers *scmi_notif_subscribers;
 #endif
+
+#ifdef BUILD_HAS_DEBUGGER
+    /* Number of services */
+    unsigned int service_count;
+
+    /* Time at which the message counters were last reset */
+    fwk_timestamp_t counters_reset_time;
+#endif
 };
 
 #endif /* MOD_INTERNAL_SCMI_H */
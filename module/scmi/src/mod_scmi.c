@@ -34,7 +34,12 @@
 #    include <mod_resource_perms.h>
 #endif
 
+#ifdef BUILD_HAS_DEBUGGER
+#    include <cli.h>
+#endif
+
 #include <inttypes.h>
+#include <string.h>
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
 
@@ -713,6 +718,70 @@ static struct mod_scmi_notification_api mod_scmi_notif_api = {
 };
 #endif
 
+#ifdef BUILD_HAS_DEBUGGER
+/*
+ * Debugger CLI command printing the SCMI message counters of each agent.
+ */
+static const char scmi_perf_call[] = "scmiperf";
+static const char scmi_perf_help[] =
+    "  Prints the number and rate of SCMI messages received from each agent.\n"
+    "    Usage: scmiperf [reset]";
+static int32_t scmi_perf_f(int32_t argc, char **argv)
+{
+    struct scmi_service_ctx *ctx;
+    unsigned int agent_id, service_idx;
+    uint32_t message_count, error_count;
+    fwk_duration_ms_t elapsed_ms;
+    fwk_timestamp_t now = fwk_time_current();
+
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        for (service_idx = 0; service_idx < scmi_ctx.service_count;
+             service_idx++) {
+            scmi_ctx.service_ctx_table[service_idx].message_count = 0;
+            scmi_ctx.service_ctx_table[service_idx].error_count = 0;
+        }
+        scmi_ctx.counters_reset_time = now;
+
+        return FWK_SUCCESS;
+    }
+
+    elapsed_ms = fwk_time_duration_ms(
+        fwk_time_duration(scmi_ctx.counters_reset_time, now));
+    if (elapsed_ms == 0) {
+        elapsed_ms = 1;
+    }
+
+    cli_printf(NONE, "Over the last %u ms:\n", (unsigned int)elapsed_ms);
+
+    for (agent_id = MOD_SCMI_PLATFORM_ID + 1;
+         agent_id <= scmi_ctx.config->agent_count;
+         agent_id++) {
+        message_count = 0;
+        error_count = 0;
+
+        for (service_idx = 0; service_idx < scmi_ctx.service_count;
+             service_idx++) {
+            ctx = &scmi_ctx.service_ctx_table[service_idx];
+            if ((ctx->config != NULL) &&
+                (ctx->config->scmi_agent_id == agent_id)) {
+                message_count += ctx->message_count;
+                error_count += ctx->error_count;
+            }
+        }
+
+        cli_printf(
+            NONE,
+            "  Agent %u: %u messages (%u/s), %u errors\n",
+            agent_id,
+            (unsigned int)message_count,
+            (unsigned int)((uint64_t)message_count * 1000 / elapsed_ms),
+            (unsigned int)error_count);
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Framework handlers
  */
@@ -723,6 +792,9 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
     struct mod_scmi_config *config = (struct mod_scmi_config *)data;
     unsigned int agent_idx;
     const struct mod_scmi_agent *agent;
+#ifdef BUILD_HAS_DEBUGGER
+    int status;
+#endif
 
     if (config == NULL) {
         return FWK_E_PARAM;
@@ -760,6 +832,16 @@ static int scmi_init(fwk_id_t module_id, unsigned int service_count,
     scmi_ctx.service_ctx_table = fwk_mm_calloc(
         service_count, sizeof(scmi_ctx.service_ctx_table[0]));
 
+#ifdef BUILD_HAS_DEBUGGER
+    scmi_ctx.service_count = service_count;
+
+    status = cli_command_register((cli_command_st){
+        scmi_perf_call, scmi_perf_help, &scmi_perf_f, false });
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
 #ifdef BUILD_HAS_BASE_PROTOCOL
     scmi_ctx.protocol_table[PROTOCOL_TABLE_BASE_PROTOCOL_IDX].message_handler =
         scmi_base_message_handler;
@@ -1027,6 +1109,10 @@ static int scmi_process_event(const struct fwk_event *event,
     ctx->scmi_token = read_token(message_header);
     message_type_name = get_message_type_str(ctx);
 
+#ifdef BUILD_HAS_DEBUGGER
+    ctx->message_count++;
+#endif
+
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_DEBUG
     FWK_LOG_DEBUG(
         "[SCMI] %s: %s [%" PRIu16 " (0x%x:0x%x)] was received",
@@ -1059,6 +1145,9 @@ static int scmi_process_event(const struct fwk_event *event,
             if (status != FWK_SUCCESS) {
                 FWK_LOG_DEBUG("[SCMI] %s @%d", __func__, __LINE__);
             }
+#ifdef BUILD_HAS_DEBUGGER
+            ctx->error_count++;
+#endif
             return FWK_SUCCESS;
         }
 
@@ -1123,6 +1212,9 @@ static int scmi_process_event(const struct fwk_event *event,
         send_to_message_handler(ctx, protocol, payload, payload_size, event);
 
     if (status != FWK_SUCCESS) {
+#ifdef BUILD_HAS_DEBUGGER
+        ctx->error_count++;
+#endif
 #if FWK_LOG_LEVEL <= FWK_LOG_LEVEL_ERROR
         FWK_LOG_ERR(
             "[SCMI] %s: %s [%" PRIu16 " (0x%x:0x%x)] handler error (%s)",
@@ -0,0 +1,150 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI Batch Protocol Support
+ */
+
+#ifndef INTERNAL_SCMI_BATCH_H
+#define INTERNAL_SCMI_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Protocol Attributes
+ */
+
+#define SCMI_BATCH_PROTOCOL_ATTRIBUTES_MAX_ENTRIES_POS  0
+#define SCMI_BATCH_PROTOCOL_ATTRIBUTES_MAX_ENTRIES_MASK UINT32_C(0xFFFF)
+
+/*
+ * Protocol Message Attributes
+ */
+
+#define SCMI_BATCH_MESSAGE_ATTRIBUTES_MAX_ENTRIES_POS  0
+#define SCMI_BATCH_MESSAGE_ATTRIBUTES_MAX_ENTRIES_MASK UINT32_C(0xFFFF)
+
+/*
+ * Maximum number of entries of a batch, given the maximum payload size of the
+ * channel and the size of the largest of a request entry and a response entry
+ * of the command. Entries follow a one-word header in both directions.
+ */
+#define SCMI_BATCH_ENTRIES_MAX(PAYLOAD_SIZE, ENTRY_SIZE) \
+    (((PAYLOAD_SIZE) > sizeof(uint32_t)) ? \
+         (((PAYLOAD_SIZE) - sizeof(uint32_t)) / (ENTRY_SIZE)) : \
+         0)
+
+/*
+ * Perf Level Set
+ */
+
+struct scmi_batch_perf_level_set_entry {
+    uint32_t domain_id;
+    uint32_t performance_level;
+};
+
+struct scmi_batch_perf_level_set_a2p {
+    uint32_t entry_count;
+    struct scmi_batch_perf_level_set_entry entries[];
+};
+
+struct scmi_batch_perf_level_set_p2a {
+    int32_t status;
+    int32_t entry_status[];
+};
+
+/*
+ * Perf Level Get
+ */
+
+struct scmi_batch_perf_level_get_a2p {
+    uint32_t entry_count;
+    uint32_t domain_id[];
+};
+
+struct scmi_batch_perf_level_get_entry {
+    int32_t status;
+    uint32_t performance_level;
+};
+
+struct scmi_batch_perf_level_get_p2a {
+    int32_t status;
+    struct scmi_batch_perf_level_get_entry entries[];
+};
+
+/*
+ * Perf Hint Set
+ */
+
+struct scmi_batch_perf_hint_set_entry {
+    uint32_t domain_id;
+    uint32_t utilization;
+    uint32_t performance_level;
+};
+
+struct scmi_batch_perf_hint_set_a2p {
+    uint32_t entry_count;
+    struct scmi_batch_perf_hint_set_entry entries[];
+};
+
+struct scmi_batch_perf_hint_set_p2a {
+    int32_t status;
+    int32_t entry_status[];
+};
+
+/*
+ * Power State Set
+ */
+
+struct scmi_batch_power_state_set_entry {
+    uint32_t domain_id;
+    uint32_t power_state;
+};
+
+struct scmi_batch_power_state_set_a2p {
+    uint32_t entry_count;
+    struct scmi_batch_power_state_set_entry entries[];
+};
+
+struct scmi_batch_power_state_set_p2a {
+    int32_t status;
+    int32_t entry_status[];
+};
+
+/*
+ * Clock Rate Set
+ */
+
+#define SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_POS   2
+#define SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_POS 3
+
+#define SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_MASK \
+    (UINT32_C(0x1) << SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_POS)
+#define SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_MASK \
+    (UINT32_C(0x1) << SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_POS)
+
+#define SCMI_BATCH_CLOCK_RATE_SET_FLAGS_MASK \
+    (SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_MASK | \
+     SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_MASK)
+
+struct scmi_batch_clock_rate_set_entry {
+    uint32_t clock_id;
+    uint32_t flags;
+    uint32_t rate[2];
+};
+
+struct scmi_batch_clock_rate_set_a2p {
+    uint32_t entry_count;
+    struct scmi_batch_clock_rate_set_entry entries[];
+};
+
+struct scmi_batch_clock_rate_set_p2a {
+    int32_t status;
+    int32_t entry_status[];
+};
+
+#endif /* INTERNAL_SCMI_BATCH_H */
@@ -0,0 +1,57 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI Batch Protocol Support.
+ */
+
+#ifndef MOD_SCMI_BATCH_H
+#define MOD_SCMI_BATCH_H
+
+#include <stdint.h>
+
+/*!
+ * \ingroup GroupModules Modules
+ * \defgroup GroupSCMI_BATCH SCMI Batch Protocol
+ *
+ * \details Platform-specific SCMI protocol carrying the requests for several
+ *      domains in a single message. Each request is dispatched to the API of
+ *      the protocol owning the domain, with the same checks as the equivalent
+ *      single-domain message, and its status is returned in a status vector.
+ *      With the performance plugins handler, agents can also batch hints of
+ *      the expected load of performance domains for the plugins. Power state
+ *      and clock rate requests can be batched when the SCMI power domain and
+ *      SCMI clock modules are present.
+ *
+ * \{
+ */
+
+/*!
+ * \brief SCMI Batch protocol
+ */
+#define MOD_SCMI_PROTOCOL_ID_BATCH UINT32_C(0x92)
+
+/*!
+ * \brief SCMI Batch protocol version
+ */
+#define MOD_SCMI_PROTOCOL_VERSION_BATCH UINT32_C(0x10000)
+
+/*!
+ * \brief Identifiers of the SCMI Batch Protocol commands
+ */
+enum mod_scmi_batch_command_id {
+    MOD_SCMI_BATCH_PERF_LEVEL_SET = 0x3,
+    MOD_SCMI_BATCH_PERF_LEVEL_GET = 0x4,
+    MOD_SCMI_BATCH_PERF_HINT_SET = 0x5,
+    MOD_SCMI_BATCH_POWER_STATE_SET = 0x6,
+    MOD_SCMI_BATCH_CLOCK_RATE_SET = 0x7,
+};
+
+/*!
+ * \}
+ */
+
+#endif /* MOD_SCMI_BATCH_H */
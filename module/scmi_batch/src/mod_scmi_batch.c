@@ -0,0 +1,735 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *     SCMI Batch Protocol Support.
+ */
+
+#include <internal/scmi_batch.h>
+
+#include <mod_scmi.h>
+#include <mod_scmi_batch.h>
+#include <mod_scmi_perf.h>
+
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+#    include <mod_scmi_power_domain.h>
+#endif
+
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+#    include <mod_clock.h>
+#    include <mod_scmi_clock.h>
+#endif
+
+#include <fwk_assert.h>
+#include <fwk_id.h>
+#include <fwk_log.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
+#include <fwk_module_idx.h>
+#include <fwk_status.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct scmi_batch_ctx {
+    /* SCMI module API */
+    const struct mod_scmi_from_protocol_api *scmi_api;
+
+    /* SCMI Performance level API */
+    const struct mod_scmi_perf_level_api *perf_level_api;
+
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+    /* SCMI Power domain state API */
+    const struct mod_scmi_pd_state_api *pd_state_api;
+#endif
+
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+    /* SCMI Clock rate API */
+    const struct mod_scmi_clock_rate_api *clock_rate_api;
+#endif
+};
+
+/*
+ * Handler of an entry of a batch command returning a status vector. It
+ * returns the status of the request of the entry.
+ */
+typedef int (*scmi_batch_entry_handler_t)(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    const void *entry);
+
+static int scmi_batch_protocol_version_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+static int scmi_batch_protocol_attributes_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+static int scmi_batch_protocol_message_attributes_handler(
+    fwk_id_t service_id, const uint32_t *payload, size_t payload_size);
+static int scmi_batch_perf_level_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+static int scmi_batch_perf_level_get_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+static int scmi_batch_perf_hint_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+static int scmi_batch_power_state_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+static int scmi_batch_clock_rate_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size);
+#endif
+
+/*
+ * Internal variables.
+ */
+static struct scmi_batch_ctx scmi_batch_ctx;
+
+static int (*const handler_table[])(fwk_id_t, const uint32_t *, size_t) = {
+    [MOD_SCMI_PROTOCOL_VERSION] = scmi_batch_protocol_version_handler,
+    [MOD_SCMI_PROTOCOL_ATTRIBUTES] = scmi_batch_protocol_attributes_handler,
+    [MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        scmi_batch_protocol_message_attributes_handler,
+    [MOD_SCMI_BATCH_PERF_LEVEL_SET] = scmi_batch_perf_level_set_handler,
+    [MOD_SCMI_BATCH_PERF_LEVEL_GET] = scmi_batch_perf_level_get_handler,
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    [MOD_SCMI_BATCH_PERF_HINT_SET] = scmi_batch_perf_hint_set_handler,
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+    [MOD_SCMI_BATCH_POWER_STATE_SET] = scmi_batch_power_state_set_handler,
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+    [MOD_SCMI_BATCH_CLOCK_RATE_SET] = scmi_batch_clock_rate_set_handler,
+#endif
+};
+
+/*
+ * Size of the fixed part of the payload. The batch commands are followed by
+ * a variable number of entries, checked by their handler.
+ */
+static const unsigned int payload_size_table[] = {
+    [MOD_SCMI_PROTOCOL_VERSION] = 0,
+    [MOD_SCMI_PROTOCOL_ATTRIBUTES] = 0,
+    [MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        (unsigned int)sizeof(struct scmi_protocol_message_attributes_a2p),
+    [MOD_SCMI_BATCH_PERF_LEVEL_SET] =
+        (unsigned int)sizeof(struct scmi_batch_perf_level_set_a2p),
+    [MOD_SCMI_BATCH_PERF_LEVEL_GET] =
+        (unsigned int)sizeof(struct scmi_batch_perf_level_get_a2p),
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    [MOD_SCMI_BATCH_PERF_HINT_SET] =
+        (unsigned int)sizeof(struct scmi_batch_perf_hint_set_a2p),
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+    [MOD_SCMI_BATCH_POWER_STATE_SET] =
+        (unsigned int)sizeof(struct scmi_batch_power_state_set_a2p),
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+    [MOD_SCMI_BATCH_CLOCK_RATE_SET] =
+        (unsigned int)sizeof(struct scmi_batch_clock_rate_set_a2p),
+#endif
+};
+
+/*
+ * Size of the largest of a request entry and a response entry of the batch
+ * commands, which bounds the number of entries of a batch.
+ */
+static const size_t entry_size_table[] = {
+    [MOD_SCMI_BATCH_PERF_LEVEL_SET] =
+        sizeof(struct scmi_batch_perf_level_set_entry),
+    [MOD_SCMI_BATCH_PERF_LEVEL_GET] =
+        sizeof(struct scmi_batch_perf_level_get_entry),
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    [MOD_SCMI_BATCH_PERF_HINT_SET] =
+        sizeof(struct scmi_batch_perf_hint_set_entry),
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+    [MOD_SCMI_BATCH_POWER_STATE_SET] =
+        sizeof(struct scmi_batch_power_state_set_entry),
+#endif
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+    [MOD_SCMI_BATCH_CLOCK_RATE_SET] =
+        sizeof(struct scmi_batch_clock_rate_set_entry),
+#endif
+};
+
+/*
+ * Static, Helper Functions
+ */
+static int32_t scmi_batch_status(int status)
+{
+    switch (status) {
+    case FWK_SUCCESS:
+        return (int32_t)SCMI_SUCCESS;
+
+    case FWK_E_PARAM:
+        return (int32_t)SCMI_NOT_FOUND;
+
+    case FWK_E_DATA:
+        return (int32_t)SCMI_INVALID_PARAMETERS;
+
+    case FWK_E_ACCESS:
+        return (int32_t)SCMI_DENIED;
+
+    case FWK_E_RANGE:
+        return (int32_t)SCMI_OUT_OF_RANGE;
+
+    case FWK_E_BUSY:
+        return (int32_t)SCMI_BUSY;
+
+    case FWK_E_SUPPORT:
+        return (int32_t)SCMI_NOT_SUPPORTED;
+
+    default:
+        return (int32_t)SCMI_GENERIC_ERROR;
+    }
+}
+
+/*
+ * Number of entries of a batch command that fit in a message of the channel.
+ */
+static int scmi_batch_get_max_entries(
+    fwk_id_t service_id,
+    unsigned int message_id,
+    size_t *max_entries)
+{
+    int status;
+    size_t max_payload_size;
+
+    status = scmi_batch_ctx.scmi_api->get_max_payload_size(
+        service_id, &max_payload_size);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *max_entries =
+        SCMI_BATCH_ENTRIES_MAX(max_payload_size, entry_size_table[message_id]);
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Check the number of entries of a batch against the size of the request and
+ * against the number of entries that fit in a message of the channel.
+ */
+static int32_t scmi_batch_check_entry_count(
+    fwk_id_t service_id,
+    unsigned int message_id,
+    uint32_t entry_count,
+    size_t entry_size,
+    size_t payload_size)
+{
+    int status;
+    size_t max_entries;
+
+    status = scmi_batch_get_max_entries(service_id, message_id, &max_entries);
+    if (status != FWK_SUCCESS) {
+        return (int32_t)SCMI_GENERIC_ERROR;
+    }
+
+    if ((entry_count == 0) || (entry_count > max_entries)) {
+        return (int32_t)SCMI_INVALID_PARAMETERS;
+    }
+
+    if ((payload_size - sizeof(uint32_t)) != (entry_count * entry_size)) {
+        return (int32_t)SCMI_PROTOCOL_ERROR;
+    }
+
+    return (int32_t)SCMI_SUCCESS;
+}
+
+/*
+ * Protocol Version
+ */
+static int scmi_batch_protocol_version_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    struct scmi_protocol_version_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+        .version = MOD_SCMI_PROTOCOL_VERSION_BATCH,
+    };
+
+    return scmi_batch_ctx.scmi_api->respond(
+        service_id, &return_values, sizeof(return_values));
+}
+
+/*
+ * Protocol Attributes
+ */
+static int scmi_batch_protocol_attributes_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    int status;
+    size_t max_entries;
+    struct scmi_protocol_attributes_p2a return_values = {
+        .status = (int32_t)SCMI_GENERIC_ERROR,
+    };
+
+    status = scmi_batch_get_max_entries(
+        service_id, MOD_SCMI_BATCH_PERF_LEVEL_SET, &max_entries);
+    if (status == FWK_SUCCESS) {
+        return_values.status = (int32_t)SCMI_SUCCESS;
+        return_values.attributes =
+            (uint32_t)FWK_MIN(
+                max_entries, SCMI_BATCH_PROTOCOL_ATTRIBUTES_MAX_ENTRIES_MASK)
+            << SCMI_BATCH_PROTOCOL_ATTRIBUTES_MAX_ENTRIES_POS;
+    }
+
+    return scmi_batch_ctx.scmi_api->respond(
+        service_id,
+        &return_values,
+        (return_values.status == SCMI_SUCCESS) ? sizeof(return_values) :
+                                                 sizeof(return_values.status));
+}
+
+/*
+ * Protocol Message Attributes
+ */
+static int scmi_batch_protocol_message_attributes_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    int status;
+    size_t response_size, max_entries;
+    const struct scmi_protocol_message_attributes_a2p *parameters;
+    unsigned int message_id;
+    struct scmi_protocol_message_attributes_p2a return_values = {
+        .status = (int32_t)SCMI_SUCCESS,
+        .attributes = 0,
+    };
+
+    parameters = (const struct scmi_protocol_message_attributes_a2p *)
+        payload;
+    message_id = parameters->message_id;
+
+    if ((message_id >= FWK_ARRAY_SIZE(handler_table)) ||
+        (handler_table[message_id] == NULL)) {
+        return_values.status = (int32_t)SCMI_NOT_FOUND;
+    } else if (message_id >= (unsigned int)MOD_SCMI_BATCH_PERF_LEVEL_SET) {
+        /* The entries of the commands differ in size, so do their maximum */
+        status =
+            scmi_batch_get_max_entries(service_id, message_id, &max_entries);
+        if (status == FWK_SUCCESS) {
+            return_values.attributes =
+                (uint32_t)FWK_MIN(
+                    max_entries, SCMI_BATCH_MESSAGE_ATTRIBUTES_MAX_ENTRIES_MASK)
+                << SCMI_BATCH_MESSAGE_ATTRIBUTES_MAX_ENTRIES_POS;
+        } else {
+            return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+        }
+    }
+
+    response_size = (return_values.status == SCMI_SUCCESS) ?
+        sizeof(return_values) : sizeof(return_values.status);
+
+    return scmi_batch_ctx.scmi_api->respond(
+        service_id, &return_values, response_size);
+}
+
+/*
+ * Process the entries of a batch command returning a status vector. The
+ * requests are processed in order, and the status of each of them is written
+ * to the response as soon as it is known.
+ */
+static int scmi_batch_process_entries(
+    fwk_id_t service_id,
+    unsigned int message_id,
+    const uint32_t *payload,
+    size_t payload_size,
+    scmi_batch_entry_handler_t entry_handler)
+{
+    int status, respond_status;
+    unsigned int agent_id;
+    uint32_t idx, entry_count;
+    int32_t entry_status, return_status;
+    size_t entry_size, response_size;
+    const uint8_t *entries;
+
+    entry_count = payload[0];
+    entries = (const uint8_t *)&payload[1];
+    /* The request entries are larger than the entry status */
+    entry_size = entry_size_table[message_id];
+    response_size = sizeof(return_status);
+
+    return_status = scmi_batch_check_entry_count(
+        service_id, message_id, entry_count, entry_size, payload_size);
+    if (return_status != SCMI_SUCCESS) {
+        status = FWK_SUCCESS;
+        goto exit;
+    }
+
+    status = scmi_batch_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS) {
+        return_status = (int32_t)SCMI_GENERIC_ERROR;
+        goto exit;
+    }
+
+    for (idx = 0; idx < entry_count; idx++) {
+        entry_status = scmi_batch_status(
+            entry_handler(service_id, agent_id, &entries[idx * entry_size]));
+
+        status = scmi_batch_ctx.scmi_api->write_payload(
+            service_id, response_size, &entry_status, sizeof(entry_status));
+        if (status != FWK_SUCCESS) {
+            return_status = (int32_t)SCMI_GENERIC_ERROR;
+            goto exit;
+        }
+        response_size += sizeof(entry_status);
+    }
+
+    status = scmi_batch_ctx.scmi_api->write_payload(
+        service_id, 0, &return_status, sizeof(return_status));
+    if (status != FWK_SUCCESS) {
+        return_status = (int32_t)SCMI_GENERIC_ERROR;
+    }
+
+exit:
+    respond_status = scmi_batch_ctx.scmi_api->respond(
+        service_id,
+        (return_status == SCMI_SUCCESS) ? NULL : &return_status,
+        (return_status == SCMI_SUCCESS) ? response_size :
+                                          sizeof(return_status));
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-BATCH] %s @%d", __func__, __LINE__);
+    }
+
+    return status;
+}
+
+/*
+ * Perf Level Set
+ */
+static int scmi_batch_perf_level_set_entry(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    const void *entry_data)
+{
+    const struct scmi_batch_perf_level_set_entry *entry = entry_data;
+
+    /*
+     * Each request is fire-and-forget, as for PERFORMANCE_LEVEL_SET, so the
+     * status vector can be returned once all of them have been submitted.
+     */
+    return scmi_batch_ctx.perf_level_api->set_level(
+        agent_id, entry->domain_id, entry->performance_level);
+}
+
+static int scmi_batch_perf_level_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    return scmi_batch_process_entries(
+        service_id,
+        MOD_SCMI_BATCH_PERF_LEVEL_SET,
+        payload,
+        payload_size,
+        scmi_batch_perf_level_set_entry);
+}
+
+/*
+ * Perf Level Get
+ */
+static int scmi_batch_perf_level_get_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    int status, respond_status;
+    unsigned int agent_id;
+    uint32_t idx;
+    size_t response_size;
+    const struct scmi_batch_perf_level_get_a2p *parameters;
+    struct scmi_batch_perf_level_get_entry entry;
+    struct scmi_batch_perf_level_get_p2a return_values = {
+        .status = (int32_t)SCMI_GENERIC_ERROR
+    };
+
+    parameters = (const struct scmi_batch_perf_level_get_a2p *)payload;
+    response_size = sizeof(return_values);
+
+    return_values.status = scmi_batch_check_entry_count(
+        service_id,
+        MOD_SCMI_BATCH_PERF_LEVEL_GET,
+        parameters->entry_count,
+        sizeof(parameters->domain_id[0]),
+        payload_size);
+    if (return_values.status != SCMI_SUCCESS) {
+        status = FWK_SUCCESS;
+        goto exit;
+    }
+
+    status = scmi_batch_ctx.scmi_api->get_agent_id(service_id, &agent_id);
+    if (status != FWK_SUCCESS) {
+        return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+        goto exit;
+    }
+
+    for (idx = 0; idx < parameters->entry_count; idx++) {
+        entry.performance_level = 0;
+        entry.status = scmi_batch_status(
+            scmi_batch_ctx.perf_level_api->get_level(
+                agent_id, parameters->domain_id[idx], &entry.performance_level));
+
+        status = scmi_batch_ctx.scmi_api->write_payload(
+            service_id, response_size, &entry, sizeof(entry));
+        if (status != FWK_SUCCESS) {
+            return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+            goto exit;
+        }
+        response_size += sizeof(entry);
+    }
+
+    status = scmi_batch_ctx.scmi_api->write_payload(
+        service_id, 0, &return_values, sizeof(return_values));
+    if (status != FWK_SUCCESS) {
+        return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+    }
+
+exit:
+    respond_status = scmi_batch_ctx.scmi_api->respond(
+        service_id,
+        (return_values.status == SCMI_SUCCESS) ? NULL : &return_values.status,
+        (return_values.status == SCMI_SUCCESS) ? response_size :
+                                                 sizeof(return_values.status));
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-BATCH] %s @%d", __func__, __LINE__);
+    }
+
+    return status;
+}
+
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+/*
+ * Perf Hint Set
+ */
+static int scmi_batch_perf_hint_set_entry(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    const void *entry_data)
+{
+    const struct scmi_batch_perf_hint_set_entry *entry = entry_data;
+
+    return scmi_batch_ctx.perf_level_api->set_hint(
+        agent_id,
+        entry->domain_id,
+        entry->utilization,
+        entry->performance_level);
+}
+
+static int scmi_batch_perf_hint_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    return scmi_batch_process_entries(
+        service_id,
+        MOD_SCMI_BATCH_PERF_HINT_SET,
+        payload,
+        payload_size,
+        scmi_batch_perf_hint_set_entry);
+}
+#endif
+
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+/*
+ * Power State Set
+ */
+static int scmi_batch_power_state_set_entry(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    const void *entry_data)
+{
+    const struct scmi_batch_power_state_set_entry *entry = entry_data;
+
+    /* Each request is asynchronous, as for an async POWER_STATE_SET */
+    return scmi_batch_ctx.pd_state_api->set_state(
+        service_id, entry->domain_id, entry->power_state);
+}
+
+static int scmi_batch_power_state_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    return scmi_batch_process_entries(
+        service_id,
+        MOD_SCMI_BATCH_POWER_STATE_SET,
+        payload,
+        payload_size,
+        scmi_batch_power_state_set_entry);
+}
+#endif
+
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+/*
+ * Clock Rate Set
+ */
+static int scmi_batch_clock_rate_set_entry(
+    fwk_id_t service_id,
+    unsigned int agent_id,
+    const void *entry_data)
+{
+    const struct scmi_batch_clock_rate_set_entry *entry = entry_data;
+    enum mod_clock_round_mode round_mode;
+    uint64_t rate;
+
+    if ((entry->flags & ~SCMI_BATCH_CLOCK_RATE_SET_FLAGS_MASK) != 0) {
+        return FWK_E_DATA;
+    }
+
+    if ((entry->flags & SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_MASK) != 0) {
+        round_mode = MOD_CLOCK_ROUND_MODE_NEAREST;
+    } else if ((entry->flags & SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_MASK) != 0) {
+        round_mode = MOD_CLOCK_ROUND_MODE_UP;
+    } else {
+        round_mode = MOD_CLOCK_ROUND_MODE_DOWN;
+    }
+
+    rate = ((uint64_t)entry->rate[1] << 32) | (uint64_t)entry->rate[0];
+
+    /* The rate is set without a delayed response to the agent */
+    return scmi_batch_ctx.clock_rate_api->set_rate(
+        service_id, entry->clock_id, rate, round_mode);
+}
+
+static int scmi_batch_clock_rate_set_handler(fwk_id_t service_id,
+    const uint32_t *payload, size_t payload_size)
+{
+    return scmi_batch_process_entries(
+        service_id,
+        MOD_SCMI_BATCH_CLOCK_RATE_SET,
+        payload,
+        payload_size,
+        scmi_batch_clock_rate_set_entry);
+}
+#endif
+
+/*
+ * SCMI module -> SCMI Batch module interface
+ */
+static int scmi_batch_get_scmi_protocol_id(fwk_id_t protocol_id,
+    uint8_t *scmi_protocol_id)
+{
+    *scmi_protocol_id = (uint8_t)MOD_SCMI_PROTOCOL_ID_BATCH;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_batch_message_handler(
+    fwk_id_t protocol_id,
+    fwk_id_t service_id,
+    const uint32_t *payload,
+    size_t payload_size,
+    unsigned int message_id)
+{
+    int32_t return_value;
+
+    static_assert(FWK_ARRAY_SIZE(handler_table) ==
+        FWK_ARRAY_SIZE(payload_size_table),
+        "[SCMI] Batch protocol table sizes not consistent");
+    fwk_assert(payload != NULL);
+
+    if ((message_id >= FWK_ARRAY_SIZE(handler_table)) ||
+        (handler_table[message_id] == NULL)) {
+        return_value = (int32_t)SCMI_NOT_FOUND;
+        goto error;
+    }
+
+    if (message_id < (unsigned int)MOD_SCMI_BATCH_PERF_LEVEL_SET) {
+        if (payload_size != payload_size_table[message_id]) {
+            return_value = (int32_t)SCMI_PROTOCOL_ERROR;
+            goto error;
+        }
+    } else if (payload_size < payload_size_table[message_id]) {
+        return_value = (int32_t)SCMI_PROTOCOL_ERROR;
+        goto error;
+    }
+
+    return handler_table[message_id](service_id, payload, payload_size);
+
+error:
+    return scmi_batch_ctx.scmi_api->respond(
+        service_id, &return_value, sizeof(return_value));
+}
+
+static struct mod_scmi_to_protocol_api scmi_batch_mod_scmi_to_protocol_api = {
+    .get_scmi_protocol_id = scmi_batch_get_scmi_protocol_id,
+    .message_handler = scmi_batch_message_handler
+};
+
+/*
+ * Framework handlers
+ */
+
+static int scmi_batch_init(fwk_id_t module_id, unsigned int element_count,
+                           const void *data)
+{
+    if (element_count != 0) {
+        /* This module should not have any elements */
+        return FWK_E_SUPPORT;
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_batch_bind(fwk_id_t id, unsigned int round)
+{
+    int status;
+
+    if (round == 1) {
+        return FWK_SUCCESS;
+    }
+
+    /* Bind to the SCMI module, storing an API pointer for later use. */
+    status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_SCMI),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI, MOD_SCMI_API_IDX_PROTOCOL),
+        &scmi_batch_ctx.scmi_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_PERF),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI_PERF, MOD_SCMI_PERF_LEVEL_API),
+        &scmi_batch_ctx.perf_level_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+#ifdef BUILD_HAS_MOD_SCMI_POWER_DOMAIN
+    status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_POWER_DOMAIN),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI_POWER_DOMAIN, MOD_SCMI_PD_STATE_API),
+        &scmi_batch_ctx.pd_state_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+#ifdef BUILD_HAS_MOD_SCMI_CLOCK
+    status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_SCMI_CLOCK),
+        FWK_ID_API(FWK_MODULE_IDX_SCMI_CLOCK, MOD_SCMI_CLOCK_RATE_API),
+        &scmi_batch_ctx.clock_rate_api);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_batch_process_bind_request(fwk_id_t source_id,
+    fwk_id_t target_id, fwk_id_t api_id, const void **api)
+{
+    /* Only accept binding requests from the SCMI module. */
+    if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+        return FWK_E_ACCESS;
+    }
+
+    *api = &scmi_batch_mod_scmi_to_protocol_api;
+
+    return FWK_SUCCESS;
+}
+
+/* SCMI Batch Protocol Definition */
+const struct fwk_module module_scmi_batch = {
+    .api_count = 1,
+    .type = FWK_MODULE_TYPE_PROTOCOL,
+    .init = scmi_batch_init,
+    .bind = scmi_batch_bind,
+    .process_bind_request = scmi_batch_process_bind_request,
+};
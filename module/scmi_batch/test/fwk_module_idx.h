@@ -0,0 +1,41 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TEST_FWK_MODULE_MODULE_IDX_H
+#define TEST_FWK_MODULE_MODULE_IDX_H
+
+#include <fwk_id.h>
+
+enum fwk_module_idx {
+    FWK_MODULE_IDX_SCMI_BATCH,
+    FWK_MODULE_IDX_SCMI,
+    FWK_MODULE_IDX_SCMI_PERF,
+    FWK_MODULE_IDX_SCMI_POWER_DOMAIN,
+    FWK_MODULE_IDX_SCMI_CLOCK,
+    FWK_MODULE_IDX_CLOCK,
+    FWK_MODULE_IDX_COUNT,
+};
+
+static const fwk_id_t fwk_module_id_scmi_batch =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_BATCH);
+
+static const fwk_id_t fwk_module_id_scmi =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI);
+
+static const fwk_id_t fwk_module_id_scmi_perf =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_PERF);
+
+static const fwk_id_t fwk_module_id_scmi_power_domain =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_POWER_DOMAIN);
+
+static const fwk_id_t fwk_module_id_scmi_clock =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_SCMI_CLOCK);
+
+static const fwk_id_t fwk_module_id_clock =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_CLOCK);
+
+#endif /* TEST_FWK_MODULE_MODULE_IDX_H */
@@ -0,0 +1,1834 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmod_scmi_batch_extra.h"
+
+static const char* CMockString_agent_id = "agent_id";
+static const char* CMockString_clock_set_rate = "clock_set_rate";
+static const char* CMockString_domain_id = "domain_id";
+static const char* CMockString_domain_idx = "domain_idx";
+static const char* CMockString_level = "level";
+static const char* CMockString_offset = "offset";
+static const char* CMockString_payload = "payload";
+static const char* CMockString_pd_set_state = "pd_set_state";
+static const char* CMockString_perf_get_level = "perf_get_level";
+static const char* CMockString_perf_set_hint = "perf_set_hint";
+static const char* CMockString_perf_set_level = "perf_set_level";
+static const char* CMockString_power_state = "power_state";
+static const char* CMockString_rate = "rate";
+static const char* CMockString_round_mode = "round_mode";
+static const char* CMockString_scmi_clock_idx = "scmi_clock_idx";
+static const char* CMockString_scmi_get_agent_id = "scmi_get_agent_id";
+static const char* CMockString_scmi_get_max_payload_size = "scmi_get_max_payload_size";
+static const char* CMockString_scmi_respond = "scmi_respond";
+static const char* CMockString_scmi_write_payload = "scmi_write_payload";
+static const char* CMockString_service_id = "service_id";
+static const char* CMockString_size = "size";
+static const char* CMockString_utilization = "utilization";
+
+typedef struct _CMOCK_scmi_get_agent_id_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  unsigned int* Expected_agent_id;
+  int Expected_agent_id_Depth;
+  char ReturnThruPtr_agent_id_Used;
+  unsigned int* ReturnThruPtr_agent_id_Val;
+  size_t ReturnThruPtr_agent_id_Size;
+  char IgnoreArg_service_id;
+  char IgnoreArg_agent_id;
+
+} CMOCK_scmi_get_agent_id_CALL_INSTANCE;
+
+typedef struct _CMOCK_scmi_get_max_payload_size_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  size_t* Expected_size;
+  int Expected_size_Depth;
+  char ReturnThruPtr_size_Used;
+  size_t* ReturnThruPtr_size_Val;
+  size_t ReturnThruPtr_size_Size;
+  char IgnoreArg_service_id;
+  char IgnoreArg_size;
+
+} CMOCK_scmi_get_max_payload_size_CALL_INSTANCE;
+
+typedef struct _CMOCK_scmi_write_payload_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  size_t Expected_offset;
+  const void* Expected_payload;
+  size_t Expected_size;
+  int Expected_payload_Depth;
+  char IgnoreArg_service_id;
+  char IgnoreArg_offset;
+  char IgnoreArg_payload;
+  char IgnoreArg_size;
+
+} CMOCK_scmi_write_payload_CALL_INSTANCE;
+
+typedef struct _CMOCK_scmi_respond_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  const void* Expected_payload;
+  size_t Expected_size;
+  int Expected_payload_Depth;
+  char IgnoreArg_service_id;
+  char IgnoreArg_payload;
+  char IgnoreArg_size;
+
+} CMOCK_scmi_respond_CALL_INSTANCE;
+
+typedef struct _CMOCK_perf_set_level_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  unsigned int Expected_agent_id;
+  unsigned int Expected_domain_idx;
+  uint32_t Expected_level;
+  char IgnoreArg_agent_id;
+  char IgnoreArg_domain_idx;
+  char IgnoreArg_level;
+
+} CMOCK_perf_set_level_CALL_INSTANCE;
+
+typedef struct _CMOCK_perf_get_level_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  unsigned int Expected_agent_id;
+  unsigned int Expected_domain_idx;
+  uint32_t* Expected_level;
+  int Expected_level_Depth;
+  char ReturnThruPtr_level_Used;
+  uint32_t* ReturnThruPtr_level_Val;
+  size_t ReturnThruPtr_level_Size;
+  char IgnoreArg_agent_id;
+  char IgnoreArg_domain_idx;
+  char IgnoreArg_level;
+
+} CMOCK_perf_get_level_CALL_INSTANCE;
+
+typedef struct _CMOCK_perf_set_hint_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  unsigned int Expected_agent_id;
+  unsigned int Expected_domain_idx;
+  uint32_t Expected_utilization;
+  uint32_t Expected_level;
+  char IgnoreArg_agent_id;
+  char IgnoreArg_domain_idx;
+  char IgnoreArg_utilization;
+  char IgnoreArg_level;
+
+} CMOCK_perf_set_hint_CALL_INSTANCE;
+
+typedef struct _CMOCK_pd_set_state_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  uint32_t Expected_domain_id;
+  uint32_t Expected_power_state;
+  char IgnoreArg_service_id;
+  char IgnoreArg_domain_id;
+  char IgnoreArg_power_state;
+
+} CMOCK_pd_set_state_CALL_INSTANCE;
+
+typedef struct _CMOCK_clock_set_rate_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+  fwk_id_t Expected_service_id;
+  uint32_t Expected_scmi_clock_idx;
+  uint64_t Expected_rate;
+  enum mod_clock_round_mode Expected_round_mode;
+  char IgnoreArg_service_id;
+  char IgnoreArg_scmi_clock_idx;
+  char IgnoreArg_rate;
+  char IgnoreArg_round_mode;
+
+} CMOCK_clock_set_rate_CALL_INSTANCE;
+
+static struct Mockmod_scmi_batch_extraInstance
+{
+  char scmi_get_agent_id_IgnoreBool;
+  int scmi_get_agent_id_FinalReturn;
+  char scmi_get_agent_id_CallbackBool;
+  CMOCK_scmi_get_agent_id_CALLBACK scmi_get_agent_id_CallbackFunctionPointer;
+  int scmi_get_agent_id_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE scmi_get_agent_id_CallInstance;
+  char scmi_get_max_payload_size_IgnoreBool;
+  int scmi_get_max_payload_size_FinalReturn;
+  char scmi_get_max_payload_size_CallbackBool;
+  CMOCK_scmi_get_max_payload_size_CALLBACK scmi_get_max_payload_size_CallbackFunctionPointer;
+  int scmi_get_max_payload_size_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE scmi_get_max_payload_size_CallInstance;
+  char scmi_write_payload_IgnoreBool;
+  int scmi_write_payload_FinalReturn;
+  char scmi_write_payload_CallbackBool;
+  CMOCK_scmi_write_payload_CALLBACK scmi_write_payload_CallbackFunctionPointer;
+  int scmi_write_payload_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE scmi_write_payload_CallInstance;
+  char scmi_respond_IgnoreBool;
+  int scmi_respond_FinalReturn;
+  char scmi_respond_CallbackBool;
+  CMOCK_scmi_respond_CALLBACK scmi_respond_CallbackFunctionPointer;
+  int scmi_respond_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE scmi_respond_CallInstance;
+  char perf_set_level_IgnoreBool;
+  int perf_set_level_FinalReturn;
+  char perf_set_level_CallbackBool;
+  CMOCK_perf_set_level_CALLBACK perf_set_level_CallbackFunctionPointer;
+  int perf_set_level_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE perf_set_level_CallInstance;
+  char perf_get_level_IgnoreBool;
+  int perf_get_level_FinalReturn;
+  char perf_get_level_CallbackBool;
+  CMOCK_perf_get_level_CALLBACK perf_get_level_CallbackFunctionPointer;
+  int perf_get_level_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE perf_get_level_CallInstance;
+  char perf_set_hint_IgnoreBool;
+  int perf_set_hint_FinalReturn;
+  char perf_set_hint_CallbackBool;
+  CMOCK_perf_set_hint_CALLBACK perf_set_hint_CallbackFunctionPointer;
+  int perf_set_hint_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE perf_set_hint_CallInstance;
+  char pd_set_state_IgnoreBool;
+  int pd_set_state_FinalReturn;
+  char pd_set_state_CallbackBool;
+  CMOCK_pd_set_state_CALLBACK pd_set_state_CallbackFunctionPointer;
+  int pd_set_state_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE pd_set_state_CallInstance;
+  char clock_set_rate_IgnoreBool;
+  int clock_set_rate_FinalReturn;
+  char clock_set_rate_CallbackBool;
+  CMOCK_clock_set_rate_CALLBACK clock_set_rate_CallbackFunctionPointer;
+  int clock_set_rate_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE clock_set_rate_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+
+void Mockmod_scmi_batch_extra_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.scmi_get_agent_id_CallInstance;
+  if (Mock.scmi_get_agent_id_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_scmi_get_agent_id);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.scmi_get_agent_id_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.scmi_get_max_payload_size_CallInstance;
+  if (Mock.scmi_get_max_payload_size_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_scmi_get_max_payload_size);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.scmi_get_max_payload_size_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.scmi_write_payload_CallInstance;
+  if (Mock.scmi_write_payload_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_scmi_write_payload);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.scmi_write_payload_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.scmi_respond_CallInstance;
+  if (Mock.scmi_respond_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_scmi_respond);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.scmi_respond_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.perf_set_level_CallInstance;
+  if (Mock.perf_set_level_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_perf_set_level);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.perf_set_level_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.perf_get_level_CallInstance;
+  if (Mock.perf_get_level_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_perf_get_level);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.perf_get_level_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.perf_set_hint_CallInstance;
+  if (Mock.perf_set_hint_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_perf_set_hint);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.perf_set_hint_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.pd_set_state_CallInstance;
+  if (Mock.pd_set_state_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_pd_set_state);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.pd_set_state_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.clock_set_rate_CallInstance;
+  if (Mock.clock_set_rate_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_clock_set_rate);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.clock_set_rate_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmod_scmi_batch_extra_Init(void)
+{
+  Mockmod_scmi_batch_extra_Destroy();
+}
+
+void Mockmod_scmi_batch_extra_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+}
+
+int scmi_get_agent_id(fwk_id_t service_id, unsigned int* agent_id)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_scmi_get_agent_id);
+  cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.scmi_get_agent_id_CallInstance);
+  Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemNext(Mock.scmi_get_agent_id_CallInstance);
+  if (Mock.scmi_get_agent_id_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.scmi_get_agent_id_FinalReturn;
+    Mock.scmi_get_agent_id_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.scmi_get_agent_id_CallbackBool &&
+      Mock.scmi_get_agent_id_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.scmi_get_agent_id_CallbackFunctionPointer(service_id, agent_id, Mock.scmi_get_agent_id_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_get_agent_id,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_agent_id)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_get_agent_id,CMockString_agent_id);
+    if (cmock_call_instance->Expected_agent_id == NULL)
+      { UNITY_TEST_ASSERT_NULL(agent_id, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_agent_id, agent_id, cmock_call_instance->Expected_agent_id_Depth, cmock_line, CMockStringMismatch); }
+  }
+  }
+  if (Mock.scmi_get_agent_id_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.scmi_get_agent_id_CallbackFunctionPointer(service_id, agent_id, Mock.scmi_get_agent_id_CallbackCalls++);
+  }
+  if (cmock_call_instance->ReturnThruPtr_agent_id_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(agent_id, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)agent_id, (void*)cmock_call_instance->ReturnThruPtr_agent_id_Val,
+      cmock_call_instance->ReturnThruPtr_agent_id_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_scmi_get_agent_id(CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, unsigned int* agent_id, int agent_id_Depth);
+void CMockExpectParameters_scmi_get_agent_id(CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, unsigned int* agent_id, int agent_id_Depth)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  cmock_call_instance->Expected_agent_id = agent_id;
+  cmock_call_instance->Expected_agent_id_Depth = agent_id_Depth;
+  cmock_call_instance->IgnoreArg_agent_id = 0;
+  cmock_call_instance->ReturnThruPtr_agent_id_Used = 0;
+}
+
+void scmi_get_agent_id_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_agent_id_CALL_INSTANCE));
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_agent_id_CallInstance, cmock_guts_index);
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.scmi_get_agent_id_IgnoreBool = (char)1;
+}
+
+void scmi_get_agent_id_CMockStopIgnore(void)
+{
+  if(Mock.scmi_get_agent_id_IgnoreBool)
+    Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemNext(Mock.scmi_get_agent_id_CallInstance);
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+}
+
+void scmi_get_agent_id_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_agent_id_CALL_INSTANCE));
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_agent_id_CallInstance, cmock_guts_index);
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void scmi_get_agent_id_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, unsigned int* agent_id, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_agent_id_CALL_INSTANCE));
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_agent_id_CallInstance, cmock_guts_index);
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_get_agent_id(cmock_call_instance, service_id, agent_id, 1);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_get_agent_id_AddCallback(CMOCK_scmi_get_agent_id_CALLBACK Callback)
+{
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  Mock.scmi_get_agent_id_CallbackBool = (char)1;
+  Mock.scmi_get_agent_id_CallbackFunctionPointer = Callback;
+}
+
+void scmi_get_agent_id_Stub(CMOCK_scmi_get_agent_id_CALLBACK Callback)
+{
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  Mock.scmi_get_agent_id_CallbackBool = (char)0;
+  Mock.scmi_get_agent_id_CallbackFunctionPointer = Callback;
+}
+
+void scmi_get_agent_id_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, unsigned int* agent_id, int agent_id_Depth, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_agent_id_CALL_INSTANCE));
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_agent_id_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_agent_id_CallInstance, cmock_guts_index);
+  Mock.scmi_get_agent_id_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_get_agent_id(cmock_call_instance, service_id, agent_id, agent_id_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_get_agent_id_CMockReturnMemThruPtr_agent_id(UNITY_LINE_TYPE cmock_line, unsigned int* agent_id, size_t cmock_size)
+{
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_agent_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_agent_id_Used = 1;
+  cmock_call_instance->ReturnThruPtr_agent_id_Val = agent_id;
+  cmock_call_instance->ReturnThruPtr_agent_id_Size = cmock_size;
+}
+
+void scmi_get_agent_id_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_agent_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void scmi_get_agent_id_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_get_agent_id_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_agent_id_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_agent_id_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_agent_id = 1;
+}
+
+int scmi_get_max_payload_size(fwk_id_t service_id, size_t* size)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_scmi_get_max_payload_size);
+  cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.scmi_get_max_payload_size_CallInstance);
+  Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemNext(Mock.scmi_get_max_payload_size_CallInstance);
+  if (Mock.scmi_get_max_payload_size_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.scmi_get_max_payload_size_FinalReturn;
+    Mock.scmi_get_max_payload_size_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.scmi_get_max_payload_size_CallbackBool &&
+      Mock.scmi_get_max_payload_size_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.scmi_get_max_payload_size_CallbackFunctionPointer(service_id, size, Mock.scmi_get_max_payload_size_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_get_max_payload_size,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_size)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_get_max_payload_size,CMockString_size);
+    if (cmock_call_instance->Expected_size == NULL)
+      { UNITY_TEST_ASSERT_NULL(size, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((void*)(cmock_call_instance->Expected_size), (void*)(size), sizeof(size_t), cmock_call_instance->Expected_size_Depth, cmock_line, CMockStringMismatch); }
+  }
+  }
+  if (Mock.scmi_get_max_payload_size_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.scmi_get_max_payload_size_CallbackFunctionPointer(service_id, size, Mock.scmi_get_max_payload_size_CallbackCalls++);
+  }
+  if (cmock_call_instance->ReturnThruPtr_size_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(size, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)size, (void*)cmock_call_instance->ReturnThruPtr_size_Val,
+      cmock_call_instance->ReturnThruPtr_size_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_scmi_get_max_payload_size(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, size_t* size, int size_Depth);
+void CMockExpectParameters_scmi_get_max_payload_size(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, size_t* size, int size_Depth)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  cmock_call_instance->Expected_size = size;
+  cmock_call_instance->Expected_size_Depth = size_Depth;
+  cmock_call_instance->IgnoreArg_size = 0;
+  cmock_call_instance->ReturnThruPtr_size_Used = 0;
+}
+
+void scmi_get_max_payload_size_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE));
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_max_payload_size_CallInstance, cmock_guts_index);
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)1;
+}
+
+void scmi_get_max_payload_size_CMockStopIgnore(void)
+{
+  if(Mock.scmi_get_max_payload_size_IgnoreBool)
+    Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemNext(Mock.scmi_get_max_payload_size_CallInstance);
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+}
+
+void scmi_get_max_payload_size_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE));
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_max_payload_size_CallInstance, cmock_guts_index);
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void scmi_get_max_payload_size_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t* size, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE));
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_max_payload_size_CallInstance, cmock_guts_index);
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_get_max_payload_size(cmock_call_instance, service_id, size, 1);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_get_max_payload_size_AddCallback(CMOCK_scmi_get_max_payload_size_CALLBACK Callback)
+{
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  Mock.scmi_get_max_payload_size_CallbackBool = (char)1;
+  Mock.scmi_get_max_payload_size_CallbackFunctionPointer = Callback;
+}
+
+void scmi_get_max_payload_size_Stub(CMOCK_scmi_get_max_payload_size_CALLBACK Callback)
+{
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  Mock.scmi_get_max_payload_size_CallbackBool = (char)0;
+  Mock.scmi_get_max_payload_size_CallbackFunctionPointer = Callback;
+}
+
+void scmi_get_max_payload_size_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t* size, int size_Depth, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_get_max_payload_size_CALL_INSTANCE));
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_get_max_payload_size_CallInstance = CMock_Guts_MemChain(Mock.scmi_get_max_payload_size_CallInstance, cmock_guts_index);
+  Mock.scmi_get_max_payload_size_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_get_max_payload_size(cmock_call_instance, service_id, size, size_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_get_max_payload_size_CMockReturnMemThruPtr_size(UNITY_LINE_TYPE cmock_line, size_t* size, size_t cmock_size)
+{
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_max_payload_size_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_size_Used = 1;
+  cmock_call_instance->ReturnThruPtr_size_Val = size;
+  cmock_call_instance->ReturnThruPtr_size_Size = cmock_size;
+}
+
+void scmi_get_max_payload_size_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_max_payload_size_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void scmi_get_max_payload_size_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_get_max_payload_size_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_get_max_payload_size_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_get_max_payload_size_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_size = 1;
+}
+
+int scmi_write_payload(fwk_id_t service_id, size_t offset, const void* payload, size_t size)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_scmi_write_payload);
+  cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.scmi_write_payload_CallInstance);
+  Mock.scmi_write_payload_CallInstance = CMock_Guts_MemNext(Mock.scmi_write_payload_CallInstance);
+  if (Mock.scmi_write_payload_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.scmi_write_payload_FinalReturn;
+    Mock.scmi_write_payload_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.scmi_write_payload_CallbackBool &&
+      Mock.scmi_write_payload_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.scmi_write_payload_CallbackFunctionPointer(service_id, offset, payload, size, Mock.scmi_write_payload_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_write_payload,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_write_payload,CMockString_offset);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_offset), (void*)(&offset), sizeof(size_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_payload)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_write_payload,CMockString_payload);
+    if (cmock_call_instance->Expected_payload == NULL)
+      { UNITY_TEST_ASSERT_NULL(payload, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_payload, payload, cmock_call_instance->Expected_payload_Depth, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_size)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_write_payload,CMockString_size);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_size), (void*)(&size), sizeof(size_t), cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.scmi_write_payload_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.scmi_write_payload_CallbackFunctionPointer(service_id, offset, payload, size, Mock.scmi_write_payload_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_scmi_write_payload(CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, size_t offset, const void* payload, int payload_Depth, size_t size);
+void CMockExpectParameters_scmi_write_payload(CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, size_t offset, const void* payload, int payload_Depth, size_t size)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_offset), (void*)(&offset),
+         sizeof(size_t[sizeof(offset) == sizeof(size_t) ? 1 : -1])); /* add size_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_payload = payload;
+  cmock_call_instance->Expected_payload_Depth = payload_Depth;
+  cmock_call_instance->IgnoreArg_payload = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_size), (void*)(&size),
+         sizeof(size_t[sizeof(size) == sizeof(size_t) ? 1 : -1])); /* add size_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_size = 0;
+}
+
+void scmi_write_payload_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_write_payload_CALL_INSTANCE));
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_write_payload_CallInstance = CMock_Guts_MemChain(Mock.scmi_write_payload_CallInstance, cmock_guts_index);
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.scmi_write_payload_IgnoreBool = (char)1;
+}
+
+void scmi_write_payload_CMockStopIgnore(void)
+{
+  if(Mock.scmi_write_payload_IgnoreBool)
+    Mock.scmi_write_payload_CallInstance = CMock_Guts_MemNext(Mock.scmi_write_payload_CallInstance);
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+}
+
+void scmi_write_payload_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_write_payload_CALL_INSTANCE));
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_write_payload_CallInstance = CMock_Guts_MemChain(Mock.scmi_write_payload_CallInstance, cmock_guts_index);
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void scmi_write_payload_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t offset, const void* payload, size_t size, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_write_payload_CALL_INSTANCE));
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_write_payload_CallInstance = CMock_Guts_MemChain(Mock.scmi_write_payload_CallInstance, cmock_guts_index);
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_write_payload(cmock_call_instance, service_id, offset, payload, size, size);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_write_payload_AddCallback(CMOCK_scmi_write_payload_CALLBACK Callback)
+{
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  Mock.scmi_write_payload_CallbackBool = (char)1;
+  Mock.scmi_write_payload_CallbackFunctionPointer = Callback;
+}
+
+void scmi_write_payload_Stub(CMOCK_scmi_write_payload_CALLBACK Callback)
+{
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  Mock.scmi_write_payload_CallbackBool = (char)0;
+  Mock.scmi_write_payload_CallbackFunctionPointer = Callback;
+}
+
+void scmi_write_payload_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t offset, const void* payload, int payload_Depth, size_t size, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_write_payload_CALL_INSTANCE));
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_write_payload_CallInstance = CMock_Guts_MemChain(Mock.scmi_write_payload_CallInstance, cmock_guts_index);
+  Mock.scmi_write_payload_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_write_payload(cmock_call_instance, service_id, offset, payload, payload_Depth, size);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_write_payload_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_write_payload_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void scmi_write_payload_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_write_payload_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void scmi_write_payload_CMockIgnoreArg_payload(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_write_payload_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_payload = 1;
+}
+
+void scmi_write_payload_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_write_payload_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_write_payload_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_write_payload_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_size = 1;
+}
+
+int scmi_respond(fwk_id_t service_id, const void* payload, size_t size)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_scmi_respond);
+  cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.scmi_respond_CallInstance);
+  Mock.scmi_respond_CallInstance = CMock_Guts_MemNext(Mock.scmi_respond_CallInstance);
+  if (Mock.scmi_respond_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.scmi_respond_FinalReturn;
+    Mock.scmi_respond_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.scmi_respond_CallbackBool &&
+      Mock.scmi_respond_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.scmi_respond_CallbackFunctionPointer(service_id, payload, size, Mock.scmi_respond_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_respond,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_payload)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_respond,CMockString_payload);
+    if (cmock_call_instance->Expected_payload == NULL)
+      { UNITY_TEST_ASSERT_NULL(payload, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_payload, payload, cmock_call_instance->Expected_payload_Depth, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_size)
+  {
+    UNITY_SET_DETAILS(CMockString_scmi_respond,CMockString_size);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_size), (void*)(&size), sizeof(size_t), cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.scmi_respond_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.scmi_respond_CallbackFunctionPointer(service_id, payload, size, Mock.scmi_respond_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_scmi_respond(CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, const void* payload, int payload_Depth, size_t size);
+void CMockExpectParameters_scmi_respond(CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, const void* payload, int payload_Depth, size_t size)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  cmock_call_instance->Expected_payload = payload;
+  cmock_call_instance->Expected_payload_Depth = payload_Depth;
+  cmock_call_instance->IgnoreArg_payload = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_size), (void*)(&size),
+         sizeof(size_t[sizeof(size) == sizeof(size_t) ? 1 : -1])); /* add size_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_size = 0;
+}
+
+void scmi_respond_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_respond_CALL_INSTANCE));
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_respond_CallInstance = CMock_Guts_MemChain(Mock.scmi_respond_CallInstance, cmock_guts_index);
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.scmi_respond_IgnoreBool = (char)1;
+}
+
+void scmi_respond_CMockStopIgnore(void)
+{
+  if(Mock.scmi_respond_IgnoreBool)
+    Mock.scmi_respond_CallInstance = CMock_Guts_MemNext(Mock.scmi_respond_CallInstance);
+  Mock.scmi_respond_IgnoreBool = (char)0;
+}
+
+void scmi_respond_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_respond_CALL_INSTANCE));
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_respond_CallInstance = CMock_Guts_MemChain(Mock.scmi_respond_CallInstance, cmock_guts_index);
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void scmi_respond_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, const void* payload, size_t size, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_respond_CALL_INSTANCE));
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_respond_CallInstance = CMock_Guts_MemChain(Mock.scmi_respond_CallInstance, cmock_guts_index);
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_respond(cmock_call_instance, service_id, payload, size, size);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_respond_AddCallback(CMOCK_scmi_respond_CALLBACK Callback)
+{
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  Mock.scmi_respond_CallbackBool = (char)1;
+  Mock.scmi_respond_CallbackFunctionPointer = Callback;
+}
+
+void scmi_respond_Stub(CMOCK_scmi_respond_CALLBACK Callback)
+{
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  Mock.scmi_respond_CallbackBool = (char)0;
+  Mock.scmi_respond_CallbackFunctionPointer = Callback;
+}
+
+void scmi_respond_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, const void* payload, int payload_Depth, size_t size, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_scmi_respond_CALL_INSTANCE));
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.scmi_respond_CallInstance = CMock_Guts_MemChain(Mock.scmi_respond_CallInstance, cmock_guts_index);
+  Mock.scmi_respond_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_scmi_respond(cmock_call_instance, service_id, payload, payload_Depth, size);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void scmi_respond_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_respond_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void scmi_respond_CMockIgnoreArg_payload(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_respond_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_payload = 1;
+}
+
+void scmi_respond_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_scmi_respond_CALL_INSTANCE* cmock_call_instance = (CMOCK_scmi_respond_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.scmi_respond_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_size = 1;
+}
+
+int perf_set_level(unsigned int agent_id, unsigned int domain_idx, uint32_t level)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_perf_set_level);
+  cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.perf_set_level_CallInstance);
+  Mock.perf_set_level_CallInstance = CMock_Guts_MemNext(Mock.perf_set_level_CallInstance);
+  if (Mock.perf_set_level_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.perf_set_level_FinalReturn;
+    Mock.perf_set_level_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.perf_set_level_CallbackBool &&
+      Mock.perf_set_level_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.perf_set_level_CallbackFunctionPointer(agent_id, domain_idx, level, Mock.perf_set_level_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_agent_id)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_level,CMockString_agent_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_agent_id, agent_id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_domain_idx)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_level,CMockString_domain_idx);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_domain_idx, domain_idx, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_level)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_level,CMockString_level);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_level, level, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.perf_set_level_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.perf_set_level_CallbackFunctionPointer(agent_id, domain_idx, level, Mock.perf_set_level_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_perf_set_level(CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t level);
+void CMockExpectParameters_perf_set_level(CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t level)
+{
+  cmock_call_instance->Expected_agent_id = agent_id;
+  cmock_call_instance->IgnoreArg_agent_id = 0;
+  cmock_call_instance->Expected_domain_idx = domain_idx;
+  cmock_call_instance->IgnoreArg_domain_idx = 0;
+  cmock_call_instance->Expected_level = level;
+  cmock_call_instance->IgnoreArg_level = 0;
+}
+
+void perf_set_level_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_level_CALL_INSTANCE));
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_level_CallInstance = CMock_Guts_MemChain(Mock.perf_set_level_CallInstance, cmock_guts_index);
+  Mock.perf_set_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.perf_set_level_IgnoreBool = (char)1;
+}
+
+void perf_set_level_CMockStopIgnore(void)
+{
+  if(Mock.perf_set_level_IgnoreBool)
+    Mock.perf_set_level_CallInstance = CMock_Guts_MemNext(Mock.perf_set_level_CallInstance);
+  Mock.perf_set_level_IgnoreBool = (char)0;
+}
+
+void perf_set_level_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_level_CALL_INSTANCE));
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_level_CallInstance = CMock_Guts_MemChain(Mock.perf_set_level_CallInstance, cmock_guts_index);
+  Mock.perf_set_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void perf_set_level_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t level, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_level_CALL_INSTANCE));
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_level_CallInstance = CMock_Guts_MemChain(Mock.perf_set_level_CallInstance, cmock_guts_index);
+  Mock.perf_set_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_perf_set_level(cmock_call_instance, agent_id, domain_idx, level);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void perf_set_level_AddCallback(CMOCK_perf_set_level_CALLBACK Callback)
+{
+  Mock.perf_set_level_IgnoreBool = (char)0;
+  Mock.perf_set_level_CallbackBool = (char)1;
+  Mock.perf_set_level_CallbackFunctionPointer = Callback;
+}
+
+void perf_set_level_Stub(CMOCK_perf_set_level_CALLBACK Callback)
+{
+  Mock.perf_set_level_IgnoreBool = (char)0;
+  Mock.perf_set_level_CallbackBool = (char)0;
+  Mock.perf_set_level_CallbackFunctionPointer = Callback;
+}
+
+void perf_set_level_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_agent_id = 1;
+}
+
+void perf_set_level_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_domain_idx = 1;
+}
+
+void perf_set_level_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_level = 1;
+}
+
+int perf_get_level(unsigned int agent_id, unsigned int domain_idx, uint32_t* level)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_perf_get_level);
+  cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.perf_get_level_CallInstance);
+  Mock.perf_get_level_CallInstance = CMock_Guts_MemNext(Mock.perf_get_level_CallInstance);
+  if (Mock.perf_get_level_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.perf_get_level_FinalReturn;
+    Mock.perf_get_level_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.perf_get_level_CallbackBool &&
+      Mock.perf_get_level_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.perf_get_level_CallbackFunctionPointer(agent_id, domain_idx, level, Mock.perf_get_level_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_agent_id)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_get_level,CMockString_agent_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_agent_id, agent_id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_domain_idx)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_get_level,CMockString_domain_idx);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_domain_idx, domain_idx, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_level)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_get_level,CMockString_level);
+    if (cmock_call_instance->Expected_level == NULL)
+      { UNITY_TEST_ASSERT_NULL(level, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_level, level, cmock_call_instance->Expected_level_Depth, cmock_line, CMockStringMismatch); }
+  }
+  }
+  if (Mock.perf_get_level_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.perf_get_level_CallbackFunctionPointer(agent_id, domain_idx, level, Mock.perf_get_level_CallbackCalls++);
+  }
+  if (cmock_call_instance->ReturnThruPtr_level_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(level, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)level, (void*)cmock_call_instance->ReturnThruPtr_level_Val,
+      cmock_call_instance->ReturnThruPtr_level_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_perf_get_level(CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int level_Depth);
+void CMockExpectParameters_perf_get_level(CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int level_Depth)
+{
+  cmock_call_instance->Expected_agent_id = agent_id;
+  cmock_call_instance->IgnoreArg_agent_id = 0;
+  cmock_call_instance->Expected_domain_idx = domain_idx;
+  cmock_call_instance->IgnoreArg_domain_idx = 0;
+  cmock_call_instance->Expected_level = level;
+  cmock_call_instance->Expected_level_Depth = level_Depth;
+  cmock_call_instance->IgnoreArg_level = 0;
+  cmock_call_instance->ReturnThruPtr_level_Used = 0;
+}
+
+void perf_get_level_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_get_level_CALL_INSTANCE));
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_get_level_CallInstance = CMock_Guts_MemChain(Mock.perf_get_level_CallInstance, cmock_guts_index);
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.perf_get_level_IgnoreBool = (char)1;
+}
+
+void perf_get_level_CMockStopIgnore(void)
+{
+  if(Mock.perf_get_level_IgnoreBool)
+    Mock.perf_get_level_CallInstance = CMock_Guts_MemNext(Mock.perf_get_level_CallInstance);
+  Mock.perf_get_level_IgnoreBool = (char)0;
+}
+
+void perf_get_level_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_get_level_CALL_INSTANCE));
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_get_level_CallInstance = CMock_Guts_MemChain(Mock.perf_get_level_CallInstance, cmock_guts_index);
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void perf_get_level_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_get_level_CALL_INSTANCE));
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_get_level_CallInstance = CMock_Guts_MemChain(Mock.perf_get_level_CallInstance, cmock_guts_index);
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_perf_get_level(cmock_call_instance, agent_id, domain_idx, level, 1);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void perf_get_level_AddCallback(CMOCK_perf_get_level_CALLBACK Callback)
+{
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  Mock.perf_get_level_CallbackBool = (char)1;
+  Mock.perf_get_level_CallbackFunctionPointer = Callback;
+}
+
+void perf_get_level_Stub(CMOCK_perf_get_level_CALLBACK Callback)
+{
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  Mock.perf_get_level_CallbackBool = (char)0;
+  Mock.perf_get_level_CallbackFunctionPointer = Callback;
+}
+
+void perf_get_level_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int level_Depth, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_get_level_CALL_INSTANCE));
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_get_level_CallInstance = CMock_Guts_MemChain(Mock.perf_get_level_CallInstance, cmock_guts_index);
+  Mock.perf_get_level_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_perf_get_level(cmock_call_instance, agent_id, domain_idx, level, level_Depth);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void perf_get_level_CMockReturnMemThruPtr_level(UNITY_LINE_TYPE cmock_line, uint32_t* level, size_t cmock_size)
+{
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_get_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_level_Used = 1;
+  cmock_call_instance->ReturnThruPtr_level_Val = level;
+  cmock_call_instance->ReturnThruPtr_level_Size = cmock_size;
+}
+
+void perf_get_level_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_get_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_agent_id = 1;
+}
+
+void perf_get_level_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_get_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_domain_idx = 1;
+}
+
+void perf_get_level_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_get_level_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_get_level_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_get_level_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_level = 1;
+}
+
+int perf_set_hint(unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_perf_set_hint);
+  cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.perf_set_hint_CallInstance);
+  Mock.perf_set_hint_CallInstance = CMock_Guts_MemNext(Mock.perf_set_hint_CallInstance);
+  if (Mock.perf_set_hint_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.perf_set_hint_FinalReturn;
+    Mock.perf_set_hint_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.perf_set_hint_CallbackBool &&
+      Mock.perf_set_hint_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.perf_set_hint_CallbackFunctionPointer(agent_id, domain_idx, utilization, level, Mock.perf_set_hint_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_agent_id)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_hint,CMockString_agent_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_agent_id, agent_id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_domain_idx)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_hint,CMockString_domain_idx);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_domain_idx, domain_idx, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_utilization)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_hint,CMockString_utilization);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_utilization, utilization, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_level)
+  {
+    UNITY_SET_DETAILS(CMockString_perf_set_hint,CMockString_level);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_level, level, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.perf_set_hint_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.perf_set_hint_CallbackFunctionPointer(agent_id, domain_idx, utilization, level, Mock.perf_set_hint_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_perf_set_hint(CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level);
+void CMockExpectParameters_perf_set_hint(CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance, unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level)
+{
+  cmock_call_instance->Expected_agent_id = agent_id;
+  cmock_call_instance->IgnoreArg_agent_id = 0;
+  cmock_call_instance->Expected_domain_idx = domain_idx;
+  cmock_call_instance->IgnoreArg_domain_idx = 0;
+  cmock_call_instance->Expected_utilization = utilization;
+  cmock_call_instance->IgnoreArg_utilization = 0;
+  cmock_call_instance->Expected_level = level;
+  cmock_call_instance->IgnoreArg_level = 0;
+}
+
+void perf_set_hint_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_hint_CALL_INSTANCE));
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_hint_CallInstance = CMock_Guts_MemChain(Mock.perf_set_hint_CallInstance, cmock_guts_index);
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.perf_set_hint_IgnoreBool = (char)1;
+}
+
+void perf_set_hint_CMockStopIgnore(void)
+{
+  if(Mock.perf_set_hint_IgnoreBool)
+    Mock.perf_set_hint_CallInstance = CMock_Guts_MemNext(Mock.perf_set_hint_CallInstance);
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+}
+
+void perf_set_hint_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_hint_CALL_INSTANCE));
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_hint_CallInstance = CMock_Guts_MemChain(Mock.perf_set_hint_CallInstance, cmock_guts_index);
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void perf_set_hint_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_perf_set_hint_CALL_INSTANCE));
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.perf_set_hint_CallInstance = CMock_Guts_MemChain(Mock.perf_set_hint_CallInstance, cmock_guts_index);
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_perf_set_hint(cmock_call_instance, agent_id, domain_idx, utilization, level);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void perf_set_hint_AddCallback(CMOCK_perf_set_hint_CALLBACK Callback)
+{
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+  Mock.perf_set_hint_CallbackBool = (char)1;
+  Mock.perf_set_hint_CallbackFunctionPointer = Callback;
+}
+
+void perf_set_hint_Stub(CMOCK_perf_set_hint_CALLBACK Callback)
+{
+  Mock.perf_set_hint_IgnoreBool = (char)0;
+  Mock.perf_set_hint_CallbackBool = (char)0;
+  Mock.perf_set_hint_CallbackFunctionPointer = Callback;
+}
+
+void perf_set_hint_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_hint_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_agent_id = 1;
+}
+
+void perf_set_hint_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_hint_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_domain_idx = 1;
+}
+
+void perf_set_hint_CMockIgnoreArg_utilization(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_hint_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_utilization = 1;
+}
+
+void perf_set_hint_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_perf_set_hint_CALL_INSTANCE* cmock_call_instance = (CMOCK_perf_set_hint_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.perf_set_hint_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_level = 1;
+}
+
+int pd_set_state(fwk_id_t service_id, uint32_t domain_id, uint32_t power_state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_pd_set_state);
+  cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.pd_set_state_CallInstance);
+  Mock.pd_set_state_CallInstance = CMock_Guts_MemNext(Mock.pd_set_state_CallInstance);
+  if (Mock.pd_set_state_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.pd_set_state_FinalReturn;
+    Mock.pd_set_state_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.pd_set_state_CallbackBool &&
+      Mock.pd_set_state_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.pd_set_state_CallbackFunctionPointer(service_id, domain_id, power_state, Mock.pd_set_state_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_set_state,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_domain_id)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_set_state,CMockString_domain_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_domain_id, domain_id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_power_state)
+  {
+    UNITY_SET_DETAILS(CMockString_pd_set_state,CMockString_power_state);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_power_state, power_state, cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.pd_set_state_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.pd_set_state_CallbackFunctionPointer(service_id, domain_id, power_state, Mock.pd_set_state_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_pd_set_state(CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, uint32_t domain_id, uint32_t power_state);
+void CMockExpectParameters_pd_set_state(CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, uint32_t domain_id, uint32_t power_state)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  cmock_call_instance->Expected_domain_id = domain_id;
+  cmock_call_instance->IgnoreArg_domain_id = 0;
+  cmock_call_instance->Expected_power_state = power_state;
+  cmock_call_instance->IgnoreArg_power_state = 0;
+}
+
+void pd_set_state_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_set_state_CALL_INSTANCE));
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_set_state_CallInstance = CMock_Guts_MemChain(Mock.pd_set_state_CallInstance, cmock_guts_index);
+  Mock.pd_set_state_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.pd_set_state_IgnoreBool = (char)1;
+}
+
+void pd_set_state_CMockStopIgnore(void)
+{
+  if(Mock.pd_set_state_IgnoreBool)
+    Mock.pd_set_state_CallInstance = CMock_Guts_MemNext(Mock.pd_set_state_CallInstance);
+  Mock.pd_set_state_IgnoreBool = (char)0;
+}
+
+void pd_set_state_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_set_state_CALL_INSTANCE));
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_set_state_CallInstance = CMock_Guts_MemChain(Mock.pd_set_state_CallInstance, cmock_guts_index);
+  Mock.pd_set_state_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void pd_set_state_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, uint32_t domain_id, uint32_t power_state, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_pd_set_state_CALL_INSTANCE));
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.pd_set_state_CallInstance = CMock_Guts_MemChain(Mock.pd_set_state_CallInstance, cmock_guts_index);
+  Mock.pd_set_state_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_pd_set_state(cmock_call_instance, service_id, domain_id, power_state);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void pd_set_state_AddCallback(CMOCK_pd_set_state_CALLBACK Callback)
+{
+  Mock.pd_set_state_IgnoreBool = (char)0;
+  Mock.pd_set_state_CallbackBool = (char)1;
+  Mock.pd_set_state_CallbackFunctionPointer = Callback;
+}
+
+void pd_set_state_Stub(CMOCK_pd_set_state_CALLBACK Callback)
+{
+  Mock.pd_set_state_IgnoreBool = (char)0;
+  Mock.pd_set_state_CallbackBool = (char)0;
+  Mock.pd_set_state_CallbackFunctionPointer = Callback;
+}
+
+void pd_set_state_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_set_state_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void pd_set_state_CMockIgnoreArg_domain_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_set_state_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_domain_id = 1;
+}
+
+void pd_set_state_CMockIgnoreArg_power_state(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_pd_set_state_CALL_INSTANCE* cmock_call_instance = (CMOCK_pd_set_state_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.pd_set_state_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_power_state = 1;
+}
+
+int clock_set_rate(fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_clock_set_rate);
+  cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.clock_set_rate_CallInstance);
+  Mock.clock_set_rate_CallInstance = CMock_Guts_MemNext(Mock.clock_set_rate_CallInstance);
+  if (Mock.clock_set_rate_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.clock_set_rate_FinalReturn;
+    Mock.clock_set_rate_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.clock_set_rate_CallbackBool &&
+      Mock.clock_set_rate_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.clock_set_rate_CallbackFunctionPointer(service_id, scmi_clock_idx, rate, round_mode, Mock.clock_set_rate_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (!cmock_call_instance->ExpectAnyArgsBool)
+  {
+  if (!cmock_call_instance->IgnoreArg_service_id)
+  {
+    UNITY_SET_DETAILS(CMockString_clock_set_rate,CMockString_service_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id), sizeof(fwk_id_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_scmi_clock_idx)
+  {
+    UNITY_SET_DETAILS(CMockString_clock_set_rate,CMockString_scmi_clock_idx);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_scmi_clock_idx, scmi_clock_idx, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_rate)
+  {
+    UNITY_SET_DETAILS(CMockString_clock_set_rate,CMockString_rate);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_rate), (void*)(&rate), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_round_mode)
+  {
+    UNITY_SET_DETAILS(CMockString_clock_set_rate,CMockString_round_mode);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_round_mode), (void*)(&round_mode), sizeof(enum mod_clock_round_mode), cmock_line, CMockStringMismatch);
+  }
+  }
+  if (Mock.clock_set_rate_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.clock_set_rate_CallbackFunctionPointer(service_id, scmi_clock_idx, rate, round_mode, Mock.clock_set_rate_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_clock_set_rate(CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode);
+void CMockExpectParameters_clock_set_rate(CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance, fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_service_id), (void*)(&service_id),
+         sizeof(fwk_id_t[sizeof(service_id) == sizeof(fwk_id_t) ? 1 : -1])); /* add fwk_id_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_service_id = 0;
+  cmock_call_instance->Expected_scmi_clock_idx = scmi_clock_idx;
+  cmock_call_instance->IgnoreArg_scmi_clock_idx = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_rate), (void*)(&rate),
+         sizeof(uint64_t[sizeof(rate) == sizeof(uint64_t) ? 1 : -1])); /* add uint64_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_rate = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_round_mode), (void*)(&round_mode),
+         sizeof(enum mod_clock_round_mode[sizeof(round_mode) == sizeof(enum mod_clock_round_mode) ? 1 : -1])); /* add enum mod_clock_round_mode to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_round_mode = 0;
+}
+
+void clock_set_rate_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_clock_set_rate_CALL_INSTANCE));
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.clock_set_rate_CallInstance = CMock_Guts_MemChain(Mock.clock_set_rate_CallInstance, cmock_guts_index);
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.clock_set_rate_IgnoreBool = (char)1;
+}
+
+void clock_set_rate_CMockStopIgnore(void)
+{
+  if(Mock.clock_set_rate_IgnoreBool)
+    Mock.clock_set_rate_CallInstance = CMock_Guts_MemNext(Mock.clock_set_rate_CallInstance);
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+}
+
+void clock_set_rate_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_clock_set_rate_CALL_INSTANCE));
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.clock_set_rate_CallInstance = CMock_Guts_MemChain(Mock.clock_set_rate_CallInstance, cmock_guts_index);
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  cmock_call_instance->ExpectAnyArgsBool = (char)1;
+}
+
+void clock_set_rate_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_clock_set_rate_CALL_INSTANCE));
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.clock_set_rate_CallInstance = CMock_Guts_MemChain(Mock.clock_set_rate_CallInstance, cmock_guts_index);
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  CMockExpectParameters_clock_set_rate(cmock_call_instance, service_id, scmi_clock_idx, rate, round_mode);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void clock_set_rate_AddCallback(CMOCK_clock_set_rate_CALLBACK Callback)
+{
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+  Mock.clock_set_rate_CallbackBool = (char)1;
+  Mock.clock_set_rate_CallbackFunctionPointer = Callback;
+}
+
+void clock_set_rate_Stub(CMOCK_clock_set_rate_CALLBACK Callback)
+{
+  Mock.clock_set_rate_IgnoreBool = (char)0;
+  Mock.clock_set_rate_CallbackBool = (char)0;
+  Mock.clock_set_rate_CallbackFunctionPointer = Callback;
+}
+
+void clock_set_rate_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.clock_set_rate_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_service_id = 1;
+}
+
+void clock_set_rate_CMockIgnoreArg_scmi_clock_idx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.clock_set_rate_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_scmi_clock_idx = 1;
+}
+
+void clock_set_rate_CMockIgnoreArg_rate(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.clock_set_rate_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rate = 1;
+}
+
+void clock_set_rate_CMockIgnoreArg_round_mode(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_clock_set_rate_CALL_INSTANCE* cmock_call_instance = (CMOCK_clock_set_rate_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.clock_set_rate_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_round_mode = 1;
+}
+
@@ -0,0 +1,220 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMOD_SCMI_BATCH_EXTRA_H
+#define _MOCKMOD_SCMI_BATCH_EXTRA_H
+
+#include "unity.h"
+#include "mod_scmi_batch_extra.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmod_scmi_batch_extra_Init(void);
+void Mockmod_scmi_batch_extra_Destroy(void);
+void Mockmod_scmi_batch_extra_Verify(void);
+
+
+
+
+#define scmi_get_agent_id_IgnoreAndReturn(cmock_retval) scmi_get_agent_id_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void scmi_get_agent_id_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_get_agent_id_StopIgnore() scmi_get_agent_id_CMockStopIgnore()
+void scmi_get_agent_id_CMockStopIgnore(void);
+#define scmi_get_agent_id_ExpectAnyArgsAndReturn(cmock_retval) scmi_get_agent_id_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void scmi_get_agent_id_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_get_agent_id_ExpectAndReturn(service_id, agent_id, cmock_retval) scmi_get_agent_id_CMockExpectAndReturn(__LINE__, service_id, agent_id, cmock_retval)
+void scmi_get_agent_id_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, unsigned int* agent_id, int cmock_to_return);
+typedef int (* CMOCK_scmi_get_agent_id_CALLBACK)(fwk_id_t service_id, unsigned int* agent_id, int cmock_num_calls);
+void scmi_get_agent_id_AddCallback(CMOCK_scmi_get_agent_id_CALLBACK Callback);
+void scmi_get_agent_id_Stub(CMOCK_scmi_get_agent_id_CALLBACK Callback);
+#define scmi_get_agent_id_StubWithCallback scmi_get_agent_id_Stub
+#define scmi_get_agent_id_ExpectWithArrayAndReturn(service_id, agent_id, agent_id_Depth, cmock_retval) scmi_get_agent_id_CMockExpectWithArrayAndReturn(__LINE__, service_id, agent_id, agent_id_Depth, cmock_retval)
+void scmi_get_agent_id_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, unsigned int* agent_id, int agent_id_Depth, int cmock_to_return);
+#define scmi_get_agent_id_ReturnThruPtr_agent_id(agent_id) scmi_get_agent_id_CMockReturnMemThruPtr_agent_id(__LINE__, agent_id, sizeof(unsigned int))
+#define scmi_get_agent_id_ReturnArrayThruPtr_agent_id(agent_id, cmock_len) scmi_get_agent_id_CMockReturnMemThruPtr_agent_id(__LINE__, agent_id, cmock_len * sizeof(*agent_id))
+#define scmi_get_agent_id_ReturnMemThruPtr_agent_id(agent_id, cmock_size) scmi_get_agent_id_CMockReturnMemThruPtr_agent_id(__LINE__, agent_id, cmock_size)
+void scmi_get_agent_id_CMockReturnMemThruPtr_agent_id(UNITY_LINE_TYPE cmock_line, unsigned int* agent_id, size_t cmock_size);
+#define scmi_get_agent_id_IgnoreArg_service_id() scmi_get_agent_id_CMockIgnoreArg_service_id(__LINE__)
+void scmi_get_agent_id_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define scmi_get_agent_id_IgnoreArg_agent_id() scmi_get_agent_id_CMockIgnoreArg_agent_id(__LINE__)
+void scmi_get_agent_id_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line);
+#define scmi_get_max_payload_size_IgnoreAndReturn(cmock_retval) scmi_get_max_payload_size_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void scmi_get_max_payload_size_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_get_max_payload_size_StopIgnore() scmi_get_max_payload_size_CMockStopIgnore()
+void scmi_get_max_payload_size_CMockStopIgnore(void);
+#define scmi_get_max_payload_size_ExpectAnyArgsAndReturn(cmock_retval) scmi_get_max_payload_size_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void scmi_get_max_payload_size_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_get_max_payload_size_ExpectAndReturn(service_id, size, cmock_retval) scmi_get_max_payload_size_CMockExpectAndReturn(__LINE__, service_id, size, cmock_retval)
+void scmi_get_max_payload_size_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t* size, int cmock_to_return);
+typedef int (* CMOCK_scmi_get_max_payload_size_CALLBACK)(fwk_id_t service_id, size_t* size, int cmock_num_calls);
+void scmi_get_max_payload_size_AddCallback(CMOCK_scmi_get_max_payload_size_CALLBACK Callback);
+void scmi_get_max_payload_size_Stub(CMOCK_scmi_get_max_payload_size_CALLBACK Callback);
+#define scmi_get_max_payload_size_StubWithCallback scmi_get_max_payload_size_Stub
+#define scmi_get_max_payload_size_ExpectWithArrayAndReturn(service_id, size, size_Depth, cmock_retval) scmi_get_max_payload_size_CMockExpectWithArrayAndReturn(__LINE__, service_id, size, size_Depth, cmock_retval)
+void scmi_get_max_payload_size_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t* size, int size_Depth, int cmock_to_return);
+#define scmi_get_max_payload_size_ReturnThruPtr_size(size) scmi_get_max_payload_size_CMockReturnMemThruPtr_size(__LINE__, size, sizeof(size_t))
+#define scmi_get_max_payload_size_ReturnArrayThruPtr_size(size, cmock_len) scmi_get_max_payload_size_CMockReturnMemThruPtr_size(__LINE__, size, cmock_len * sizeof(*size))
+#define scmi_get_max_payload_size_ReturnMemThruPtr_size(size, cmock_size) scmi_get_max_payload_size_CMockReturnMemThruPtr_size(__LINE__, size, cmock_size)
+void scmi_get_max_payload_size_CMockReturnMemThruPtr_size(UNITY_LINE_TYPE cmock_line, size_t* size, size_t cmock_size);
+#define scmi_get_max_payload_size_IgnoreArg_service_id() scmi_get_max_payload_size_CMockIgnoreArg_service_id(__LINE__)
+void scmi_get_max_payload_size_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define scmi_get_max_payload_size_IgnoreArg_size() scmi_get_max_payload_size_CMockIgnoreArg_size(__LINE__)
+void scmi_get_max_payload_size_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line);
+#define scmi_write_payload_IgnoreAndReturn(cmock_retval) scmi_write_payload_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void scmi_write_payload_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_write_payload_StopIgnore() scmi_write_payload_CMockStopIgnore()
+void scmi_write_payload_CMockStopIgnore(void);
+#define scmi_write_payload_ExpectAnyArgsAndReturn(cmock_retval) scmi_write_payload_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void scmi_write_payload_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_write_payload_ExpectAndReturn(service_id, offset, payload, size, cmock_retval) scmi_write_payload_CMockExpectAndReturn(__LINE__, service_id, offset, payload, size, cmock_retval)
+void scmi_write_payload_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t offset, const void* payload, size_t size, int cmock_to_return);
+typedef int (* CMOCK_scmi_write_payload_CALLBACK)(fwk_id_t service_id, size_t offset, const void* payload, size_t size, int cmock_num_calls);
+void scmi_write_payload_AddCallback(CMOCK_scmi_write_payload_CALLBACK Callback);
+void scmi_write_payload_Stub(CMOCK_scmi_write_payload_CALLBACK Callback);
+#define scmi_write_payload_StubWithCallback scmi_write_payload_Stub
+#define scmi_write_payload_ExpectWithArrayAndReturn(service_id, offset, payload, payload_Depth, size, cmock_retval) scmi_write_payload_CMockExpectWithArrayAndReturn(__LINE__, service_id, offset, payload, payload_Depth, size, cmock_retval)
+void scmi_write_payload_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, size_t offset, const void* payload, int payload_Depth, size_t size, int cmock_to_return);
+#define scmi_write_payload_IgnoreArg_service_id() scmi_write_payload_CMockIgnoreArg_service_id(__LINE__)
+void scmi_write_payload_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define scmi_write_payload_IgnoreArg_offset() scmi_write_payload_CMockIgnoreArg_offset(__LINE__)
+void scmi_write_payload_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define scmi_write_payload_IgnoreArg_payload() scmi_write_payload_CMockIgnoreArg_payload(__LINE__)
+void scmi_write_payload_CMockIgnoreArg_payload(UNITY_LINE_TYPE cmock_line);
+#define scmi_write_payload_IgnoreArg_size() scmi_write_payload_CMockIgnoreArg_size(__LINE__)
+void scmi_write_payload_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line);
+#define scmi_respond_IgnoreAndReturn(cmock_retval) scmi_respond_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void scmi_respond_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_respond_StopIgnore() scmi_respond_CMockStopIgnore()
+void scmi_respond_CMockStopIgnore(void);
+#define scmi_respond_ExpectAnyArgsAndReturn(cmock_retval) scmi_respond_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void scmi_respond_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define scmi_respond_ExpectAndReturn(service_id, payload, size, cmock_retval) scmi_respond_CMockExpectAndReturn(__LINE__, service_id, payload, size, cmock_retval)
+void scmi_respond_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, const void* payload, size_t size, int cmock_to_return);
+typedef int (* CMOCK_scmi_respond_CALLBACK)(fwk_id_t service_id, const void* payload, size_t size, int cmock_num_calls);
+void scmi_respond_AddCallback(CMOCK_scmi_respond_CALLBACK Callback);
+void scmi_respond_Stub(CMOCK_scmi_respond_CALLBACK Callback);
+#define scmi_respond_StubWithCallback scmi_respond_Stub
+#define scmi_respond_ExpectWithArrayAndReturn(service_id, payload, payload_Depth, size, cmock_retval) scmi_respond_CMockExpectWithArrayAndReturn(__LINE__, service_id, payload, payload_Depth, size, cmock_retval)
+void scmi_respond_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, const void* payload, int payload_Depth, size_t size, int cmock_to_return);
+#define scmi_respond_IgnoreArg_service_id() scmi_respond_CMockIgnoreArg_service_id(__LINE__)
+void scmi_respond_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define scmi_respond_IgnoreArg_payload() scmi_respond_CMockIgnoreArg_payload(__LINE__)
+void scmi_respond_CMockIgnoreArg_payload(UNITY_LINE_TYPE cmock_line);
+#define scmi_respond_IgnoreArg_size() scmi_respond_CMockIgnoreArg_size(__LINE__)
+void scmi_respond_CMockIgnoreArg_size(UNITY_LINE_TYPE cmock_line);
+#define perf_set_level_IgnoreAndReturn(cmock_retval) perf_set_level_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void perf_set_level_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_set_level_StopIgnore() perf_set_level_CMockStopIgnore()
+void perf_set_level_CMockStopIgnore(void);
+#define perf_set_level_ExpectAnyArgsAndReturn(cmock_retval) perf_set_level_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void perf_set_level_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_set_level_ExpectAndReturn(agent_id, domain_idx, level, cmock_retval) perf_set_level_CMockExpectAndReturn(__LINE__, agent_id, domain_idx, level, cmock_retval)
+void perf_set_level_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t level, int cmock_to_return);
+typedef int (* CMOCK_perf_set_level_CALLBACK)(unsigned int agent_id, unsigned int domain_idx, uint32_t level, int cmock_num_calls);
+void perf_set_level_AddCallback(CMOCK_perf_set_level_CALLBACK Callback);
+void perf_set_level_Stub(CMOCK_perf_set_level_CALLBACK Callback);
+#define perf_set_level_StubWithCallback perf_set_level_Stub
+#define perf_set_level_IgnoreArg_agent_id() perf_set_level_CMockIgnoreArg_agent_id(__LINE__)
+void perf_set_level_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line);
+#define perf_set_level_IgnoreArg_domain_idx() perf_set_level_CMockIgnoreArg_domain_idx(__LINE__)
+void perf_set_level_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line);
+#define perf_set_level_IgnoreArg_level() perf_set_level_CMockIgnoreArg_level(__LINE__)
+void perf_set_level_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line);
+#define perf_get_level_IgnoreAndReturn(cmock_retval) perf_get_level_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void perf_get_level_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_get_level_StopIgnore() perf_get_level_CMockStopIgnore()
+void perf_get_level_CMockStopIgnore(void);
+#define perf_get_level_ExpectAnyArgsAndReturn(cmock_retval) perf_get_level_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void perf_get_level_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_get_level_ExpectAndReturn(agent_id, domain_idx, level, cmock_retval) perf_get_level_CMockExpectAndReturn(__LINE__, agent_id, domain_idx, level, cmock_retval)
+void perf_get_level_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int cmock_to_return);
+typedef int (* CMOCK_perf_get_level_CALLBACK)(unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int cmock_num_calls);
+void perf_get_level_AddCallback(CMOCK_perf_get_level_CALLBACK Callback);
+void perf_get_level_Stub(CMOCK_perf_get_level_CALLBACK Callback);
+#define perf_get_level_StubWithCallback perf_get_level_Stub
+#define perf_get_level_ExpectWithArrayAndReturn(agent_id, domain_idx, level, level_Depth, cmock_retval) perf_get_level_CMockExpectWithArrayAndReturn(__LINE__, agent_id, domain_idx, level, level_Depth, cmock_retval)
+void perf_get_level_CMockExpectWithArrayAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t* level, int level_Depth, int cmock_to_return);
+#define perf_get_level_ReturnThruPtr_level(level) perf_get_level_CMockReturnMemThruPtr_level(__LINE__, level, sizeof(uint32_t))
+#define perf_get_level_ReturnArrayThruPtr_level(level, cmock_len) perf_get_level_CMockReturnMemThruPtr_level(__LINE__, level, cmock_len * sizeof(*level))
+#define perf_get_level_ReturnMemThruPtr_level(level, cmock_size) perf_get_level_CMockReturnMemThruPtr_level(__LINE__, level, cmock_size)
+void perf_get_level_CMockReturnMemThruPtr_level(UNITY_LINE_TYPE cmock_line, uint32_t* level, size_t cmock_size);
+#define perf_get_level_IgnoreArg_agent_id() perf_get_level_CMockIgnoreArg_agent_id(__LINE__)
+void perf_get_level_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line);
+#define perf_get_level_IgnoreArg_domain_idx() perf_get_level_CMockIgnoreArg_domain_idx(__LINE__)
+void perf_get_level_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line);
+#define perf_get_level_IgnoreArg_level() perf_get_level_CMockIgnoreArg_level(__LINE__)
+void perf_get_level_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line);
+#define perf_set_hint_IgnoreAndReturn(cmock_retval) perf_set_hint_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void perf_set_hint_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_set_hint_StopIgnore() perf_set_hint_CMockStopIgnore()
+void perf_set_hint_CMockStopIgnore(void);
+#define perf_set_hint_ExpectAnyArgsAndReturn(cmock_retval) perf_set_hint_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void perf_set_hint_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define perf_set_hint_ExpectAndReturn(agent_id, domain_idx, utilization, level, cmock_retval) perf_set_hint_CMockExpectAndReturn(__LINE__, agent_id, domain_idx, utilization, level, cmock_retval)
+void perf_set_hint_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level, int cmock_to_return);
+typedef int (* CMOCK_perf_set_hint_CALLBACK)(unsigned int agent_id, unsigned int domain_idx, uint32_t utilization, uint32_t level, int cmock_num_calls);
+void perf_set_hint_AddCallback(CMOCK_perf_set_hint_CALLBACK Callback);
+void perf_set_hint_Stub(CMOCK_perf_set_hint_CALLBACK Callback);
+#define perf_set_hint_StubWithCallback perf_set_hint_Stub
+#define perf_set_hint_IgnoreArg_agent_id() perf_set_hint_CMockIgnoreArg_agent_id(__LINE__)
+void perf_set_hint_CMockIgnoreArg_agent_id(UNITY_LINE_TYPE cmock_line);
+#define perf_set_hint_IgnoreArg_domain_idx() perf_set_hint_CMockIgnoreArg_domain_idx(__LINE__)
+void perf_set_hint_CMockIgnoreArg_domain_idx(UNITY_LINE_TYPE cmock_line);
+#define perf_set_hint_IgnoreArg_utilization() perf_set_hint_CMockIgnoreArg_utilization(__LINE__)
+void perf_set_hint_CMockIgnoreArg_utilization(UNITY_LINE_TYPE cmock_line);
+#define perf_set_hint_IgnoreArg_level() perf_set_hint_CMockIgnoreArg_level(__LINE__)
+void perf_set_hint_CMockIgnoreArg_level(UNITY_LINE_TYPE cmock_line);
+#define pd_set_state_IgnoreAndReturn(cmock_retval) pd_set_state_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void pd_set_state_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_set_state_StopIgnore() pd_set_state_CMockStopIgnore()
+void pd_set_state_CMockStopIgnore(void);
+#define pd_set_state_ExpectAnyArgsAndReturn(cmock_retval) pd_set_state_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void pd_set_state_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define pd_set_state_ExpectAndReturn(service_id, domain_id, power_state, cmock_retval) pd_set_state_CMockExpectAndReturn(__LINE__, service_id, domain_id, power_state, cmock_retval)
+void pd_set_state_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, uint32_t domain_id, uint32_t power_state, int cmock_to_return);
+typedef int (* CMOCK_pd_set_state_CALLBACK)(fwk_id_t service_id, uint32_t domain_id, uint32_t power_state, int cmock_num_calls);
+void pd_set_state_AddCallback(CMOCK_pd_set_state_CALLBACK Callback);
+void pd_set_state_Stub(CMOCK_pd_set_state_CALLBACK Callback);
+#define pd_set_state_StubWithCallback pd_set_state_Stub
+#define pd_set_state_IgnoreArg_service_id() pd_set_state_CMockIgnoreArg_service_id(__LINE__)
+void pd_set_state_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define pd_set_state_IgnoreArg_domain_id() pd_set_state_CMockIgnoreArg_domain_id(__LINE__)
+void pd_set_state_CMockIgnoreArg_domain_id(UNITY_LINE_TYPE cmock_line);
+#define pd_set_state_IgnoreArg_power_state() pd_set_state_CMockIgnoreArg_power_state(__LINE__)
+void pd_set_state_CMockIgnoreArg_power_state(UNITY_LINE_TYPE cmock_line);
+#define clock_set_rate_IgnoreAndReturn(cmock_retval) clock_set_rate_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void clock_set_rate_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define clock_set_rate_StopIgnore() clock_set_rate_CMockStopIgnore()
+void clock_set_rate_CMockStopIgnore(void);
+#define clock_set_rate_ExpectAnyArgsAndReturn(cmock_retval) clock_set_rate_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
+void clock_set_rate_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+#define clock_set_rate_ExpectAndReturn(service_id, scmi_clock_idx, rate, round_mode, cmock_retval) clock_set_rate_CMockExpectAndReturn(__LINE__, service_id, scmi_clock_idx, rate, round_mode, cmock_retval)
+void clock_set_rate_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode, int cmock_to_return);
+typedef int (* CMOCK_clock_set_rate_CALLBACK)(fwk_id_t service_id, uint32_t scmi_clock_idx, uint64_t rate, enum mod_clock_round_mode round_mode, int cmock_num_calls);
+void clock_set_rate_AddCallback(CMOCK_clock_set_rate_CALLBACK Callback);
+void clock_set_rate_Stub(CMOCK_clock_set_rate_CALLBACK Callback);
+#define clock_set_rate_StubWithCallback clock_set_rate_Stub
+#define clock_set_rate_IgnoreArg_service_id() clock_set_rate_CMockIgnoreArg_service_id(__LINE__)
+void clock_set_rate_CMockIgnoreArg_service_id(UNITY_LINE_TYPE cmock_line);
+#define clock_set_rate_IgnoreArg_scmi_clock_idx() clock_set_rate_CMockIgnoreArg_scmi_clock_idx(__LINE__)
+void clock_set_rate_CMockIgnoreArg_scmi_clock_idx(UNITY_LINE_TYPE cmock_line);
+#define clock_set_rate_IgnoreArg_rate() clock_set_rate_CMockIgnoreArg_rate(__LINE__)
+void clock_set_rate_CMockIgnoreArg_rate(UNITY_LINE_TYPE cmock_line);
+#define clock_set_rate_IgnoreArg_round_mode() clock_set_rate_CMockIgnoreArg_round_mode(__LINE__)
+void clock_set_rate_CMockIgnoreArg_round_mode(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Description:
+ *      SCMI Batch unit test support.
+ */
+#include <mod_clock.h>
+#include <mod_scmi.h>
+
+#include <fwk_id.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+int scmi_get_agent_id(fwk_id_t service_id, unsigned int *agent_id);
+int scmi_get_max_payload_size(fwk_id_t service_id, size_t *size);
+int scmi_write_payload(
+    fwk_id_t service_id,
+    size_t offset,
+    const void *payload,
+    size_t size);
+int scmi_respond(fwk_id_t service_id, const void *payload, size_t size);
+
+int perf_set_level(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t level);
+int perf_get_level(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t *level);
+int perf_set_hint(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t utilization,
+    uint32_t level);
+
+int pd_set_state(fwk_id_t service_id, uint32_t domain_id, uint32_t power_state);
+
+int clock_set_rate(
+    fwk_id_t service_id,
+    uint32_t scmi_clock_idx,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode);
@@ -0,0 +1,442 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_id.h>
+#include <Mockfwk_mm.h>
+#include <Mockfwk_module.h>
+#include <Mockmod_scmi_batch_extra.h>
+
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_scmi.h>
+
+#include <fwk_macros.h>
+
+#include <string.h>
+
+#include UNIT_TEST_SRC
+
+/* 15 words of entries follow the one-word header of a message */
+#define TEST_MAX_PAYLOAD_SIZE 64
+
+#define TEST_AGENT_ID 1
+
+static const fwk_id_t test_service_id =
+    FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_SCMI, 0);
+
+/* Response built through the write_payload() and respond() stubs */
+static uint32_t response[TEST_MAX_PAYLOAD_SIZE / sizeof(uint32_t)];
+static size_t response_size;
+
+const struct mod_scmi_from_protocol_api mock_scmi_api = {
+    .get_agent_id = scmi_get_agent_id,
+    .get_max_payload_size = scmi_get_max_payload_size,
+    .write_payload = scmi_write_payload,
+    .respond = scmi_respond,
+};
+
+const struct mod_scmi_perf_level_api mock_perf_level_api = {
+    .set_level = perf_set_level,
+    .get_level = perf_get_level,
+    .set_hint = perf_set_hint,
+};
+
+const struct mod_scmi_pd_state_api mock_pd_state_api = {
+    .set_state = pd_set_state,
+};
+
+const struct mod_scmi_clock_rate_api mock_clock_rate_api = {
+    .set_rate = clock_set_rate,
+};
+
+static int get_agent_id_callback(
+    fwk_id_t service_id,
+    unsigned int *agent_id,
+    int cmock_num_calls)
+{
+    *agent_id = TEST_AGENT_ID;
+
+    return FWK_SUCCESS;
+}
+
+static int get_max_payload_size_callback(
+    fwk_id_t service_id,
+    size_t *size,
+    int cmock_num_calls)
+{
+    *size = TEST_MAX_PAYLOAD_SIZE;
+
+    return FWK_SUCCESS;
+}
+
+static int write_payload_callback(
+    fwk_id_t service_id,
+    size_t offset,
+    const void *payload,
+    size_t size,
+    int cmock_num_calls)
+{
+    TEST_ASSERT_TRUE((offset + size) <= sizeof(response));
+    memcpy((uint8_t *)response + offset, payload, size);
+
+    return FWK_SUCCESS;
+}
+
+static int respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int cmock_num_calls)
+{
+    TEST_ASSERT_TRUE(size <= sizeof(response));
+    if (payload != NULL) {
+        memcpy(response, payload, size);
+    }
+    response_size = size;
+
+    return FWK_SUCCESS;
+}
+
+void setUp(void)
+{
+    memset(&scmi_batch_ctx, 0, sizeof(scmi_batch_ctx));
+    memset(response, 0xFF, sizeof(response));
+    response_size = 0;
+
+    scmi_batch_ctx.scmi_api = &mock_scmi_api;
+    scmi_batch_ctx.perf_level_api = &mock_perf_level_api;
+    scmi_batch_ctx.pd_state_api = &mock_pd_state_api;
+    scmi_batch_ctx.clock_rate_api = &mock_clock_rate_api;
+
+    scmi_get_agent_id_Stub(get_agent_id_callback);
+    scmi_get_max_payload_size_Stub(get_max_payload_size_callback);
+    scmi_write_payload_Stub(write_payload_callback);
+    scmi_respond_Stub(respond_callback);
+}
+
+void tearDown(void)
+{
+}
+
+static int test_message(
+    unsigned int message_id,
+    const uint32_t *payload,
+    size_t payload_size)
+{
+    return scmi_batch_message_handler(
+        fwk_module_id_scmi_batch,
+        test_service_id,
+        payload,
+        payload_size,
+        message_id);
+}
+
+void test_message_handler_unknown_message(void)
+{
+    int status;
+    uint32_t payload[1] = { 0 };
+
+    status = test_message(0x10, payload, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, (int32_t)response[0]);
+}
+
+void test_message_handler_fixed_size_mismatch(void)
+{
+    int status;
+    uint32_t payload[1] = { 0 };
+
+    status =
+        test_message(MOD_SCMI_PROTOCOL_VERSION, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_PROTOCOL_ERROR, (int32_t)response[0]);
+}
+
+void test_message_handler_missing_entry_count(void)
+{
+    int status;
+    uint32_t payload[1] = { 0 };
+
+    status = test_message(MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_PROTOCOL_ERROR, (int32_t)response[0]);
+}
+
+void test_perf_level_set_no_entry(void)
+{
+    int status;
+    uint32_t payload[1] = { 0 };
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, (int32_t)response[0]);
+}
+
+void test_perf_level_set_too_many_entries(void)
+{
+    int status;
+    /* 8 entries of 8 bytes do not fit in a 64-byte message */
+    uint32_t payload[1 + (8 * 2)] = { 8 };
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, (int32_t)response[0]);
+}
+
+void test_perf_level_set_payload_size_mismatch(void)
+{
+    int status;
+    /* Two entries announced, one and a half provided */
+    uint32_t payload[] = { 2, 0, 100, 1 };
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_PROTOCOL_ERROR, (int32_t)response[0]);
+}
+
+void test_perf_level_set_status_vector(void)
+{
+    int status;
+    uint32_t payload[] = { 3, 0, 100, 1, 200, 2, 300 };
+
+    perf_set_level_ExpectAndReturn(TEST_AGENT_ID, 0, 100, FWK_SUCCESS);
+    perf_set_level_ExpectAndReturn(TEST_AGENT_ID, 1, 200, FWK_E_PARAM);
+    perf_set_level_ExpectAndReturn(TEST_AGENT_ID, 2, 300, FWK_E_ACCESS);
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(4 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[1]);
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, (int32_t)response[2]);
+    TEST_ASSERT_EQUAL(SCMI_DENIED, (int32_t)response[3]);
+}
+
+void test_perf_level_set_max_entries(void)
+{
+    int status;
+    uint32_t idx;
+    /* 7 entries of 8 bytes fit in a 64-byte message */
+    uint32_t payload[1 + (7 * 2)] = { 7 };
+
+    for (idx = 0; idx < 7; idx++) {
+        payload[1 + (idx * 2)] = idx;
+        payload[2 + (idx * 2)] = 100 * idx;
+        perf_set_level_ExpectAndReturn(
+            TEST_AGENT_ID, idx, 100 * idx, FWK_SUCCESS);
+    }
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(8 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+}
+
+void test_perf_level_get_entries(void)
+{
+    int status;
+    uint32_t payload[] = { 2, 0, 1 };
+    uint32_t level = 500;
+
+    perf_get_level_ExpectAndReturn(TEST_AGENT_ID, 0, NULL, FWK_SUCCESS);
+    perf_get_level_IgnoreArg_level();
+    perf_get_level_ReturnThruPtr_level(&level);
+    perf_get_level_ExpectAndReturn(TEST_AGENT_ID, 1, NULL, FWK_E_BUSY);
+    perf_get_level_IgnoreArg_level();
+
+    status = test_message(
+        MOD_SCMI_BATCH_PERF_LEVEL_GET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(5 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[1]);
+    TEST_ASSERT_EQUAL(500, response[2]);
+    TEST_ASSERT_EQUAL(SCMI_BUSY, (int32_t)response[3]);
+}
+
+void test_power_state_set_status_vector(void)
+{
+    int status;
+    uint32_t payload[] = { 3, 0, 0x0, 1, 0x40000000, 5, 0x0 };
+
+    pd_set_state_ExpectAndReturn(test_service_id, 0, 0x0, FWK_SUCCESS);
+    pd_set_state_ExpectAndReturn(
+        test_service_id, 1, 0x40000000, FWK_E_DATA);
+    pd_set_state_ExpectAndReturn(test_service_id, 5, 0x0, FWK_E_SUPPORT);
+
+    status = test_message(
+        MOD_SCMI_BATCH_POWER_STATE_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(4 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[1]);
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, (int32_t)response[2]);
+    TEST_ASSERT_EQUAL(SCMI_NOT_SUPPORTED, (int32_t)response[3]);
+}
+
+void test_clock_rate_set_status_vector(void)
+{
+    int status;
+    uint32_t payload[] = {
+        3,
+        /* Round down */
+        0, 0, 1000, 0,
+        /* Round automatically, rate above 4GHz */
+        1, SCMI_BATCH_CLOCK_RATE_SET_ROUND_AUTO_MASK, 0, 1,
+        /* Reserved flag */
+        2, 0x1, 1000, 0,
+    };
+
+    clock_set_rate_ExpectAndReturn(
+        test_service_id, 0, 1000, MOD_CLOCK_ROUND_MODE_DOWN, FWK_SUCCESS);
+    clock_set_rate_ExpectAndReturn(
+        test_service_id,
+        1,
+        UINT64_C(0x100000000),
+        MOD_CLOCK_ROUND_MODE_NEAREST,
+        FWK_E_BUSY);
+
+    status = test_message(
+        MOD_SCMI_BATCH_CLOCK_RATE_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(4 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[1]);
+    TEST_ASSERT_EQUAL(SCMI_BUSY, (int32_t)response[2]);
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, (int32_t)response[3]);
+}
+
+void test_clock_rate_set_round_up(void)
+{
+    int status;
+    uint32_t payload[] = {
+        1, 3, SCMI_BATCH_CLOCK_RATE_SET_ROUND_UP_MASK, 2000, 0,
+    };
+
+    clock_set_rate_ExpectAndReturn(
+        test_service_id, 3, 2000, MOD_CLOCK_ROUND_MODE_UP, FWK_SUCCESS);
+
+    status = test_message(
+        MOD_SCMI_BATCH_CLOCK_RATE_SET, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2 * sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[1]);
+}
+
+void test_protocol_attributes(void)
+{
+    int status;
+    uint32_t payload[1] = { 0 };
+
+    status = test_message(MOD_SCMI_PROTOCOL_ATTRIBUTES, payload, 0);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(
+        sizeof(struct scmi_protocol_attributes_p2a), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(7, response[1]);
+}
+
+void test_protocol_message_attributes_batch_commands(void)
+{
+    int status;
+    unsigned int idx;
+    static const struct {
+        uint32_t message_id;
+        uint32_t max_entries;
+    } expected[] = {
+        { MOD_SCMI_BATCH_PERF_LEVEL_SET, 7 },
+        { MOD_SCMI_BATCH_PERF_LEVEL_GET, 7 },
+        { MOD_SCMI_BATCH_PERF_HINT_SET, 5 },
+        { MOD_SCMI_BATCH_POWER_STATE_SET, 7 },
+        { MOD_SCMI_BATCH_CLOCK_RATE_SET, 3 },
+    };
+
+    for (idx = 0; idx < FWK_ARRAY_SIZE(expected); idx++) {
+        status = test_message(
+            MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES,
+            &expected[idx].message_id,
+            sizeof(expected[idx].message_id));
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        TEST_ASSERT_EQUAL(
+            sizeof(struct scmi_protocol_message_attributes_p2a),
+            response_size);
+        TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+        TEST_ASSERT_EQUAL(expected[idx].max_entries, response[1]);
+    }
+}
+
+void test_protocol_message_attributes_base_command(void)
+{
+    int status;
+    uint32_t payload[] = { MOD_SCMI_PROTOCOL_VERSION };
+
+    status = test_message(
+        MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(
+        sizeof(struct scmi_protocol_message_attributes_p2a), response_size);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, (int32_t)response[0]);
+    TEST_ASSERT_EQUAL(0, response[1]);
+}
+
+void test_protocol_message_attributes_unknown_command(void)
+{
+    int status;
+    uint32_t payload[] = { 0x10 };
+
+    status = test_message(
+        MOD_SCMI_PROTOCOL_MESSAGE_ATTRIBUTES, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(sizeof(int32_t), response_size);
+    TEST_ASSERT_EQUAL(SCMI_NOT_FOUND, (int32_t)response[0]);
+}
+
+int scmi_batch_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_message_handler_unknown_message);
+    RUN_TEST(test_message_handler_fixed_size_mismatch);
+    RUN_TEST(test_message_handler_missing_entry_count);
+    RUN_TEST(test_perf_level_set_no_entry);
+    RUN_TEST(test_perf_level_set_too_many_entries);
+    RUN_TEST(test_perf_level_set_payload_size_mismatch);
+    RUN_TEST(test_perf_level_set_status_vector);
+    RUN_TEST(test_perf_level_set_max_entries);
+    RUN_TEST(test_perf_level_get_entries);
+    RUN_TEST(test_power_state_set_status_vector);
+    RUN_TEST(test_clock_rate_set_status_vector);
+    RUN_TEST(test_clock_rate_set_round_up);
+    RUN_TEST(test_protocol_attributes);
+    RUN_TEST(test_protocol_message_attributes_batch_commands);
+    RUN_TEST(test_protocol_message_attributes_base_command);
+    RUN_TEST(test_protocol_message_attributes_unknown_command);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_batch_test_main();
+}
+#endif
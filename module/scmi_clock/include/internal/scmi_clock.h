@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -23,6 +23,7 @@ enum scmi_clock_request_type {
     SCMI_CLOCK_REQUEST_GET_RATE,
     SCMI_CLOCK_REQUEST_SET_RATE,
     SCMI_CLOCK_REQUEST_SET_STATE,
+    SCMI_CLOCK_REQUEST_SET_RATE_NO_RESPONSE,
     SCMI_CLOCK_REQUEST_COUNT,
 };
 
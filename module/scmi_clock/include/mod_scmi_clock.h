@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2015-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,6 +15,11 @@
 
 #include <mod_clock.h>
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+#endif
+
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -98,6 +103,25 @@ struct mod_scmi_clock_agent {
     uint8_t device_count;
 };
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+/*!
+ * \brief Clock device statistics configuration.
+ *
+ * \details The level statistics of a clock device track its state, with the
+ *      level identifiers given by ::mod_clock_state.
+ */
+struct mod_scmi_clock_stats_config {
+    /*! Flag indicating that statistics are collected for this clock device */
+    bool stats_collected;
+
+    /*! Histogram of the rates set, in Hz */
+    struct mod_stats_histogram_config rate_histogram;
+
+    /*! Histogram of the time taken by rate changes, in microseconds */
+    struct mod_stats_histogram_config latency_histogram;
+};
+#endif
+
 /*!
  * \brief Module configuration.
  */
@@ -113,6 +137,64 @@ struct mod_scmi_clock_config {
 
     /*! Number of agents in ::mod_scmi_clock_config::agent_table */
     size_t agent_count;
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /*!
+     * \brief Pointer to the table of clock statistics configurations.
+     *
+     * \details The table is indexed by clock device and has one entry for each
+     *      element of the \c clock module. Statistics are not collected if
+     *      this is \c NULL.
+     */
+    const struct mod_scmi_clock_stats_config *stats_table;
+#endif
+};
+
+/*!
+ * \brief SCMI Clock APIs.
+ */
+enum mod_scmi_clock_api_idx {
+    /*! Index of the SCMI protocol API */
+    MOD_SCMI_CLOCK_PROTOCOL_API,
+
+    /*! Index of the clock rate API */
+    MOD_SCMI_CLOCK_RATE_API,
+
+    /*! Number of APIs */
+    MOD_SCMI_CLOCK_API_COUNT,
+};
+
+/*!
+ * \brief SCMI Clock rate API.
+ *
+ * \details API used by vendor protocols to set the rate of a clock on behalf
+ *      of an agent. The requests go through the same permission checks and
+ *      policy handler as the CLOCK_RATE_SET message.
+ */
+struct mod_scmi_clock_rate_api {
+    /*!
+     * \brief Set the rate of a clock.
+     *
+     * \details The function returns once the request has been submitted to
+     *      the clock driver, and no response is sent to the agent when the
+     *      request completes.
+     *
+     * \param service_id Identifier of the service of the agent.
+     * \param scmi_clock_idx SCMI clock identifier, in the view of the agent.
+     * \param rate Requested rate in hertz.
+     * \param round_mode Rounding operation to perform to achieve the rate.
+     *
+     * \retval ::FWK_SUCCESS The request was submitted.
+     * \retval ::FWK_E_PARAM The clock does not exist.
+     * \retval ::FWK_E_ACCESS The agent is not allowed to set the rate.
+     * \retval ::FWK_E_BUSY Another request is in progress on the clock.
+     * \return One of the standard framework error codes.
+     */
+    int (*set_rate)(
+        fwk_id_t service_id,
+        uint32_t scmi_clock_idx,
+        uint64_t rate,
+        enum mod_clock_round_mode round_mode);
 };
 
 /*!
@@ -33,6 +33,12 @@
 #    include <mod_resource_perms.h>
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+
+#    include <fwk_time.h>
+#endif
+
 struct clock_operations {
     /*
      * Service identifier currently requesting operation from this clock.
@@ -54,6 +60,35 @@ struct clock_operations {
      * Request type for this operation.
      */
     enum scmi_clock_request_type request;
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /*
+     * The rate to be set in this operation.
+     */
+    uint64_t rate;
+
+    /*
+     * Time stamp taken when the rate change was requested from the clock.
+     */
+    fwk_timestamp_t rate_request_ts;
+#endif
+};
+
+/*
+ * Rates of a clock device, in the format of the CLOCK_DESCRIBE_RATES response.
+ */
+struct scmi_clock_rate_table {
+    /* Status of the clock driver queries used to build the table */
+    int status;
+
+    /* Format of the rates, SCMI_CLOCK_RATE_FORMAT_LIST or _RANGE */
+    uint32_t format;
+
+    /* Number of entries in the rates table */
+    unsigned int rate_count;
+
+    /* Discrete rates, or minimum, maximum and step of a linear range */
+    struct scmi_clock_rate *rates;
 };
 
 struct mod_scmi_clock_ctx {
@@ -87,10 +122,18 @@ struct mod_scmi_clock_ctx {
     /* Pointer to a table of agent:clock_states */
     uint8_t *agent_clock_state_table;
 
+    /* Pointer to a table of clock rates, built at start */
+    struct scmi_clock_rate_table *rate_tables;
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
 #endif
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /* Statistics module API */
+    const struct mod_stats_api *stats_api;
+#endif
 };
 
 static const fwk_id_t mod_scmi_clock_event_id_get_state =
@@ -469,6 +512,70 @@ static void clock_ops_update_state(unsigned int clock_dev_idx, int status)
     }
 }
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+static void clock_stats_record_histogram(
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t value)
+{
+    int status;
+
+    status = scmi_clock_ctx.stats_api->record_histogram(
+        fwk_module_id_scmi_clock, domain_id, type, value);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-CLK] %s @%d", __func__, __LINE__);
+    }
+}
+
+static void clock_ops_update_stats(unsigned int clock_dev_idx, int status)
+{
+    int stats_status;
+    const struct mod_scmi_clock_stats_config *stats_config;
+    struct clock_operations *clock_ops =
+        &scmi_clock_ctx.clock_ops[clock_dev_idx];
+    fwk_id_t domain_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_CLOCK, clock_dev_idx);
+
+    if ((status != FWK_SUCCESS) ||
+        (scmi_clock_ctx.config->stats_table == NULL)) {
+        return;
+    }
+
+    stats_config = &scmi_clock_ctx.config->stats_table[clock_dev_idx];
+    if (!stats_config->stats_collected) {
+        return;
+    }
+
+    switch (clock_ops->request) {
+    case SCMI_CLOCK_REQUEST_SET_STATE:
+        stats_status = scmi_clock_ctx.stats_api->update_domain(
+            fwk_module_id_scmi_clock, domain_id, (uint32_t)clock_ops->state);
+        if (stats_status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-CLK] %s @%d", __func__, __LINE__);
+        }
+        break;
+
+    case SCMI_CLOCK_REQUEST_SET_RATE:
+    case SCMI_CLOCK_REQUEST_SET_RATE_NO_RESPONSE:
+        if (stats_config->latency_histogram.bucket_count != 0) {
+            clock_stats_record_histogram(
+                domain_id,
+                MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+                fwk_time_duration_us(
+                    fwk_time_stamp_duration(clock_ops->rate_request_ts)));
+        }
+        if (stats_config->rate_histogram.bucket_count != 0) {
+            clock_stats_record_histogram(
+                domain_id, MOD_STATS_HISTOGRAM_VALUE, clock_ops->rate);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+#endif
+
 static inline void clock_ops_set_available(unsigned int clock_dev_idx)
 {
     scmi_clock_ctx.clock_ops[clock_dev_idx].service_id = FWK_ID_NONE;
@@ -485,6 +592,15 @@ static inline bool clock_ops_is_available(unsigned int clock_dev_idx)
                            FWK_ID_NONE);
 }
 
+/*
+ * Requests submitted through the clock rate API are not responded to
+ */
+static inline bool clock_ops_needs_response(unsigned int clock_dev_idx)
+{
+    return scmi_clock_ctx.clock_ops[clock_dev_idx].request !=
+        SCMI_CLOCK_REQUEST_SET_RATE_NO_RESPONSE;
+}
+
 /*
  * Helper for the 'get_state' response
  */
@@ -732,6 +848,7 @@ static int create_event_request(
         break;
 
     case SCMI_CLOCK_REQUEST_SET_RATE:
+    case SCMI_CLOCK_REQUEST_SET_RATE_NO_RESPONSE:
         {
         struct event_set_rate_request_data *rate_data =
             (struct event_set_rate_request_data *)data;
@@ -1205,16 +1322,12 @@ static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
 {
     int status, respond_status;
     const struct mod_scmi_clock_device *clock_device;
-    unsigned int i;
     size_t max_payload_size;
     uint32_t payload_size;
     uint32_t index;
     unsigned int rate_count;
     unsigned int remaining_rates;
-    uint64_t rate;
-    struct scmi_clock_rate scmi_rate;
-    struct scmi_clock_rate clock_range[3];
-    struct mod_clock_info info;
+    const struct scmi_clock_rate_table *rate_table;
     const struct scmi_clock_describe_rates_a2p *parameters;
     struct scmi_clock_describe_rates_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR
@@ -1252,16 +1365,17 @@ static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
         goto exit;
     }
 
-    status = scmi_clock_ctx.clock_api->get_info(clock_device->element_id,
-                                                &info);
-    if (status != FWK_SUCCESS) {
+    rate_table = &scmi_clock_ctx.rate_tables[fwk_id_get_element_idx(
+        clock_device->element_id)];
+    if (rate_table->status != FWK_SUCCESS) {
+        status = rate_table->status;
         goto exit;
     }
 
-    if (info.range.rate_type == MOD_CLOCK_RATE_TYPE_DISCRETE) {
+    if (rate_table->format == SCMI_CLOCK_RATE_FORMAT_LIST) {
         /* The clock has a discrete list of frequencies */
 
-        if (index >= info.range.rate_count) {
+        if (index >= rate_table->rate_count) {
             return_values.status = (int32_t)SCMI_OUT_OF_RANGE;
             goto exit;
         }
@@ -1280,7 +1394,7 @@ static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
          */
         rate_count = (unsigned int)FWK_MIN(
             SCMI_CLOCK_RATES_MAX(max_payload_size),
-            info.range.rate_count - index);
+            rate_table->rate_count - index);
 
         /*
          * Because the agent gives a starting index into the clock's rate list
@@ -1288,68 +1402,38 @@ static int scmi_clock_describe_rates_handler(fwk_id_t service_id,
          * the clock supports minus the index, with the number of rates being
          * returned in this payload subtracted.
          */
-        remaining_rates =
-            (unsigned int)(info.range.rate_count - index) - rate_count;
-
-        /* Give the number of rates sent in the message payload */
-        return_values.num_rates_flags =
-            SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS(
-                rate_count,
-                SCMI_CLOCK_RATE_FORMAT_LIST,
-                remaining_rates
-            );
-
-        /* Set each rate entry in the payload to the associated frequency */
-        for (i = 0; i < rate_count;
-             i++, payload_size += (uint32_t)sizeof(struct scmi_clock_rate)) {
-            status = scmi_clock_ctx.clock_api->get_rate_from_index(
-                clock_device->element_id,
-                index + i,
-                &rate);
-            if (status != FWK_SUCCESS) {
-                goto exit;
-            }
-
-            scmi_rate.low = (uint32_t)rate;
-            scmi_rate.high = (uint32_t)(rate >> 32);
-
-            status = scmi_clock_ctx.scmi_api->write_payload(service_id,
-                payload_size, &scmi_rate, sizeof(scmi_rate));
-            if (status != FWK_SUCCESS) {
-                goto exit;
-            }
-        }
+        remaining_rates = (rate_table->rate_count - index) - rate_count;
     } else {
         /* The clock has a linear stepping */
 
         /* Is the payload area large enough to return the complete triplet? */
-        if (SCMI_CLOCK_RATES_MAX(max_payload_size) < 3) {
+        if (SCMI_CLOCK_RATES_MAX(max_payload_size) <
+            SCMI_CLOCK_NUM_OF_RATES_RANGE) {
             status = FWK_E_SIZE;
             goto exit;
         }
 
-        return_values.num_rates_flags =
-            SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS(
-                SCMI_CLOCK_NUM_OF_RATES_RANGE,
-                SCMI_CLOCK_RATE_FORMAT_RANGE,
-                /* No further rates are available */
-                0U);
-
-        /* Store the range data in the range entry in the payload */
-        clock_range[0].low = (uint32_t)info.range.min;
-        clock_range[0].high = (uint32_t)(info.range.min >> 32);
-        clock_range[1].low = (uint32_t)info.range.max;
-        clock_range[1].high = (uint32_t)(info.range.max >> 32);
-        clock_range[2].low = (uint32_t)info.range.step;
-        clock_range[2].high = (uint32_t)(info.range.step >> 32);
-
-        status = scmi_clock_ctx.scmi_api->write_payload(service_id,
-            payload_size, &clock_range, sizeof(clock_range));
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-        payload_size += (uint32_t)sizeof(clock_range);
+        index = 0;
+        rate_count = SCMI_CLOCK_NUM_OF_RATES_RANGE;
+
+        /* No further rates are available */
+        remaining_rates = 0;
+    }
+
+    /* Give the number of rates sent in the message payload */
+    return_values.num_rates_flags = SCMI_CLOCK_DESCRIBE_RATES_NUM_RATES_FLAGS(
+        rate_count, rate_table->format, remaining_rates);
+
+    /* Copy the requested window of the rate table in a single write */
+    status = scmi_clock_ctx.scmi_api->write_payload(
+        service_id,
+        payload_size,
+        &rate_table->rates[index],
+        rate_count * sizeof(struct scmi_clock_rate));
+    if (status != FWK_SUCCESS) {
+        goto exit;
     }
+    payload_size += (uint32_t)(rate_count * sizeof(struct scmi_clock_rate));
 
     return_values.status = (int32_t)SCMI_SUCCESS;
     status = scmi_clock_ctx.scmi_api->write_payload(service_id, 0,
@@ -1411,6 +1495,67 @@ static struct mod_scmi_to_protocol_api scmi_clock_mod_scmi_to_protocol_api = {
     .message_handler = scmi_clock_message_handler
 };
 
+/*
+ * Clock rate API
+ */
+static int scmi_clock_rate_api_set_rate(
+    fwk_id_t service_id,
+    uint32_t scmi_clock_idx,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode)
+{
+    int status;
+    const struct mod_scmi_clock_device *clock_device;
+    enum mod_scmi_clock_policy_status policy_status;
+    struct event_set_rate_request_data data;
+
+    status = scmi_clock_get_clock_device_entry(
+        service_id, scmi_clock_idx, &clock_device);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_PARAM;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    status = scmi_clock_permissions_handler(
+        scmi_clock_idx, service_id, (unsigned int)MOD_SCMI_CLOCK_RATE_SET);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_ACCESS;
+    }
+#endif
+
+    /*
+     * Note that rate and round_mode may be modified by the policy handler.
+     */
+    status = mod_scmi_clock_rate_set_policy(
+        &policy_status,
+        &round_mode,
+        &rate,
+        MOD_SCMI_CLOCK_PRE_MESSAGE_HANDLER,
+        service_id,
+        scmi_clock_idx);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+    if (policy_status == MOD_SCMI_CLOCK_SKIP_MESSAGE_HANDLER) {
+        return FWK_SUCCESS;
+    }
+
+    data.rate[0] = (uint32_t)rate;
+    data.rate[1] = (uint32_t)(rate >> 32);
+    data.round_mode = round_mode;
+
+    return create_event_request(
+        clock_device->element_id,
+        service_id,
+        SCMI_CLOCK_REQUEST_SET_RATE_NO_RESPONSE,
+        &data,
+        scmi_clock_idx);
+}
+
+static const struct mod_scmi_clock_rate_api scmi_clock_rate_api = {
+    .set_rate = scmi_clock_rate_api_set_rate,
+};
+
 /*
  * Framework handlers
  */
@@ -1479,6 +1624,18 @@ static int scmi_clock_bind(fwk_id_t id, unsigned int round)
     }
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    if (scmi_clock_ctx.config->stats_table != NULL) {
+        status = fwk_module_bind(
+            FWK_ID_MODULE(FWK_MODULE_IDX_STATISTICS),
+            mod_stats_api_id_stats,
+            &scmi_clock_ctx.stats_api);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+#endif
+
     return fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_CLOCK),
         FWK_ID_API(FWK_MODULE_IDX_CLOCK, 0), &scmi_clock_ctx.clock_api);
 }
@@ -1486,13 +1643,203 @@ static int scmi_clock_bind(fwk_id_t id, unsigned int round)
 static int scmi_clock_process_bind_request(fwk_id_t source_id,
     fwk_id_t target_id, fwk_id_t api_id, const void **api)
 {
-    if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+    enum mod_scmi_clock_api_idx api_id_type =
+        (enum mod_scmi_clock_api_idx)fwk_id_get_api_idx(api_id);
+
+    switch (api_id_type) {
+    case MOD_SCMI_CLOCK_PROTOCOL_API:
+        if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+            return FWK_E_ACCESS;
+        }
+
+        *api = &scmi_clock_mod_scmi_to_protocol_api;
+        break;
+
+    case MOD_SCMI_CLOCK_RATE_API:
+        *api = &scmi_clock_rate_api;
+        break;
+
+    default:
         return FWK_E_ACCESS;
     }
 
-    *api = &scmi_clock_mod_scmi_to_protocol_api;
+    return FWK_SUCCESS;
+}
 
+static void scmi_clock_build_rate_table(unsigned int clock_dev_idx)
+{
+    int status;
+    unsigned int i;
+    uint64_t rate;
+    struct mod_clock_info info = { 0 };
+    struct scmi_clock_rate *rates;
+    struct scmi_clock_rate_table *rate_table;
+    fwk_id_t clock_dev_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, clock_dev_idx);
+
+    rate_table = &scmi_clock_ctx.rate_tables[clock_dev_idx];
+
+    rate_table->status =
+        scmi_clock_ctx.clock_api->get_info(clock_dev_id, &info);
+    if (rate_table->status != FWK_SUCCESS) {
+        return;
+    }
+
+    if (info.range.rate_type == MOD_CLOCK_RATE_TYPE_DISCRETE) {
+        rates = fwk_mm_calloc(
+            (unsigned int)info.range.rate_count, sizeof(struct scmi_clock_rate));
+
+        for (i = 0; i < (unsigned int)info.range.rate_count; i++) {
+            status = scmi_clock_ctx.clock_api->get_rate_from_index(
+                clock_dev_id, i, &rate);
+            if (status != FWK_SUCCESS) {
+                fwk_mm_free(rates);
+                rate_table->status = status;
+                return;
+            }
+
+            rates[i].low = (uint32_t)rate;
+            rates[i].high = (uint32_t)(rate >> 32);
+        }
+
+        rate_table->format = SCMI_CLOCK_RATE_FORMAT_LIST;
+        rate_table->rate_count = (unsigned int)info.range.rate_count;
+    } else {
+        rates = fwk_mm_calloc(
+            SCMI_CLOCK_NUM_OF_RATES_RANGE, sizeof(struct scmi_clock_rate));
+
+        rates[0].low = (uint32_t)info.range.min;
+        rates[0].high = (uint32_t)(info.range.min >> 32);
+        rates[1].low = (uint32_t)info.range.max;
+        rates[1].high = (uint32_t)(info.range.max >> 32);
+        rates[2].low = (uint32_t)info.range.step;
+        rates[2].high = (uint32_t)(info.range.step >> 32);
+
+        rate_table->format = SCMI_CLOCK_RATE_FORMAT_RANGE;
+        rate_table->rate_count = SCMI_CLOCK_NUM_OF_RATES_RANGE;
+    }
+
+    rate_table->rates = rates;
+}
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+static int scmi_clock_stats_add_histogram(
+    fwk_id_t domain_id,
+    const struct mod_stats_histogram_config *histogram,
+    enum mod_stats_histogram_type type)
+{
+    if (histogram->bucket_count == 0) {
+        return FWK_SUCCESS;
+    }
+
+    return scmi_clock_ctx.stats_api->add_histogram(
+        fwk_module_id_scmi_clock,
+        domain_id,
+        type,
+        histogram->min_value,
+        histogram->bucket_width,
+        histogram->bucket_count);
+}
+
+static int scmi_clock_stats_start(void)
+{
+    const struct mod_scmi_clock_stats_config *stats_config;
+    int status;
+    int stats_domains = 0;
+    unsigned int i;
+    fwk_id_t domain_id;
+
+    if (scmi_clock_ctx.config->stats_table == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    /* Count how many clock devices have statistics */
+    for (i = 0; i < (unsigned int)scmi_clock_ctx.clock_devices; i++) {
+        if (scmi_clock_ctx.config->stats_table[i].stats_collected) {
+            stats_domains++;
+        }
+    }
+
+    status = scmi_clock_ctx.stats_api->init_stats(
+        fwk_module_id_scmi_clock,
+        MOD_STATS_SIGNATURE_CLCK,
+        scmi_clock_ctx.clock_devices,
+        stats_domains);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    for (i = 0; i < (unsigned int)scmi_clock_ctx.clock_devices; i++) {
+        stats_config = &scmi_clock_ctx.config->stats_table[i];
+        if (!stats_config->stats_collected) {
+            continue;
+        }
+
+        /* One level for each clock state */
+        domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_CLOCK, i);
+        status = scmi_clock_ctx.stats_api->add_domain(
+            fwk_module_id_scmi_clock, domain_id, (int)MOD_CLOCK_STATE_COUNT);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        status = scmi_clock_stats_add_histogram(
+            domain_id,
+            &stats_config->rate_histogram,
+            MOD_STATS_HISTOGRAM_VALUE);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        status = scmi_clock_stats_add_histogram(
+            domain_id,
+            &stats_config->latency_histogram,
+            MOD_STATS_HISTOGRAM_TRANSITION_LATENCY);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    status = scmi_clock_ctx.stats_api->start_stats(fwk_module_id_scmi_clock);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* Clock devices enabled at startup start in the running level */
+    for (i = 0; i < (unsigned int)scmi_clock_ctx.clock_devices; i++) {
+        if (scmi_clock_ctx.config->stats_table[i].stats_collected &&
+            (scmi_clock_ctx.dev_clock_ref_count_table[i] != 0)) {
+            status = scmi_clock_ctx.stats_api->update_domain(
+                fwk_module_id_scmi_clock,
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_CLOCK, i),
+                (uint32_t)MOD_CLOCK_STATE_RUNNING);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
+static int scmi_clock_start(fwk_id_t id)
+{
+    unsigned int i;
+
+    /* Tables for CLOCK_DESCRIBE_RATES */
+    scmi_clock_ctx.rate_tables = fwk_mm_calloc(
+        (unsigned int)scmi_clock_ctx.clock_devices,
+        sizeof(struct scmi_clock_rate_table));
+
+    for (i = 0; i < (unsigned int)scmi_clock_ctx.clock_devices; i++) {
+        scmi_clock_build_rate_table(i);
+    }
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    return scmi_clock_stats_start();
+#else
     return FWK_SUCCESS;
+#endif
 }
 
 static int process_request_event(const struct fwk_event *event)
@@ -1546,13 +1893,24 @@ static int process_request_event(const struct fwk_event *event)
         rate = (uint64_t)set_rate_data.rate[0] +
                (((uint64_t)set_rate_data.rate[1]) << 32);
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+        scmi_clock_ctx.clock_ops[clock_dev_idx].rate = rate;
+        scmi_clock_ctx.clock_ops[clock_dev_idx].rate_request_ts =
+            fwk_time_current();
+#endif
+
         status =
             scmi_clock_ctx.clock_api->set_rate(params->clock_dev_id,
                                                rate,
                                                set_rate_data.round_mode);
         if (status != FWK_PENDING) {
             /* Request completed */
-            set_request_respond(service_id, status);
+            if (clock_ops_needs_response(clock_dev_idx)) {
+                set_request_respond(service_id, status);
+            }
+#ifdef BUILD_HAS_MOD_STATISTICS
+            clock_ops_update_stats(clock_dev_idx, status);
+#endif
             status = FWK_SUCCESS;
         }
         break;
@@ -1566,6 +1924,9 @@ static int process_request_event(const struct fwk_event *event)
             /* Request completed */
             set_request_respond(service_id, status);
             clock_ops_update_state(clock_dev_idx, status);
+#ifdef BUILD_HAS_MOD_STATISTICS
+            clock_ops_update_stats(clock_dev_idx, status);
+#endif
             status = FWK_SUCCESS;
         }
         break;
@@ -1598,7 +1959,9 @@ static int process_response_event(const struct fwk_event *event)
     clock_dev_idx = fwk_id_get_element_idx(event->source_id);
     service_id = clock_ops_get_service(clock_dev_idx);
 
-    if (params->status != FWK_SUCCESS) {
+    if (!clock_ops_needs_response(clock_dev_idx)) {
+        /* The request was submitted through the clock rate API */
+    } else if (params->status != FWK_SUCCESS) {
         request_response(params->status, service_id);
     } else {
         event_id_type =
@@ -1635,6 +1998,11 @@ static int process_response_event(const struct fwk_event *event)
             return FWK_E_PARAM;
         }
     }
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    clock_ops_update_stats(clock_dev_idx, params->status);
+#endif
+
     clock_ops_set_available(clock_dev_idx);
 
     return FWK_SUCCESS;
@@ -1660,11 +2028,12 @@ static int scmi_clock_process_event(const struct fwk_event *event,
 
 /* SCMI Clock Management Protocol Definition */
 const struct fwk_module module_scmi_clock = {
-    .api_count = 1,
+    .api_count = (unsigned int)MOD_SCMI_CLOCK_API_COUNT,
     .event_count = (unsigned int)SCMI_CLOCK_EVENT_IDX_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_clock_init,
     .bind = scmi_clock_bind,
+    .start = scmi_clock_start,
     .process_bind_request = scmi_clock_process_bind_request,
     .process_event = scmi_clock_process_event,
 };
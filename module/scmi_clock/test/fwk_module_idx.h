@@ -15,6 +15,7 @@ enum fwk_module_idx {
     FWK_MODULE_IDX_SCMI,
     FWK_MODULE_IDX_CLOCK,
     FWK_MODULE_IDX_RESOURCE_PERMS,
+    FWK_MODULE_IDX_STATISTICS,
     FWK_MODULE_IDX_COUNT,
 };
 
@@ -30,4 +31,7 @@ static const fwk_id_t fwk_module_id_clock =
 static const fwk_id_t fwk_module_id_resource_perms =
     FWK_ID_MODULE_INIT(FWK_MODULE_IDX_RESOURCE_PERMS);
 
+static const fwk_id_t fwk_module_id_statistics =
+    FWK_ID_MODULE_INIT(FWK_MODULE_IDX_STATISTICS);
+
 #endif /* TEST_FWK_MODULE_IDX_H */
@@ -0,0 +1,538 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+#include <Mockfwk_time.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_clock.h>
+#include <mod_scmi.h>
+#include <mod_stats.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include <config_scmi_clock.h>
+
+/* Highest number of calls to the statistics API recorded by a test */
+#define MAX_RECORD_COUNT 16
+
+/* Time taken by the rate changes of the tests */
+#define FAKE_REQUEST_TS      1000
+#define FAKE_LATENCY_NS      250000
+#define FAKE_LATENCY_US      250
+
+#define FAKE_RATE UINT64_C(0x100000001)
+
+struct stats_record {
+    /* Index of the domain */
+    unsigned int domain_idx;
+
+    /* Level set, or histogram the sample is recorded in */
+    uint32_t level_or_type;
+
+    /* Number of levels, or value of the sample */
+    uint64_t value;
+};
+
+/* Calls made to the statistics API */
+static struct stats_record added_domains[MAX_RECORD_COUNT];
+static unsigned int added_domain_count;
+static struct stats_record added_histograms[MAX_RECORD_COUNT];
+static unsigned int added_histogram_count;
+static struct stats_record updated_domains[MAX_RECORD_COUNT];
+static unsigned int updated_domain_count;
+static struct stats_record recorded_samples[MAX_RECORD_COUNT];
+static unsigned int recorded_sample_count;
+static uint32_t init_signature;
+static int init_domain_count;
+static int init_used_domains;
+static bool stats_started;
+
+/* Responses sent to the agents */
+static int32_t respond_statuses[MAX_RECORD_COUNT];
+static unsigned int respond_count;
+
+/* Status returned by the fake clock driver */
+static int clock_status;
+
+static const struct mod_scmi_clock_stats_config stats_table[
+    CLOCK_DEV_IDX_COUNT] = {
+    [CLOCK_DEV_IDX_FAKE0] = {
+        .stats_collected = true,
+        .rate_histogram = {
+            .min_value = 0,
+            .bucket_width = UINT64_C(100000000),
+            .bucket_count = 32,
+        },
+        .latency_histogram = {
+            .min_value = 0,
+            .bucket_width = 100,
+            .bucket_count = 16,
+        },
+    },
+    [CLOCK_DEV_IDX_FAKE2] = {
+        .stats_collected = true,
+    },
+};
+
+static const struct mod_scmi_clock_config stats_config = {
+    .agent_table = agent_table,
+    .agent_count = FWK_ARRAY_SIZE(agent_table),
+    .stats_table = stats_table,
+};
+
+static int fake_init_stats(
+    fwk_id_t module_id,
+    uint32_t signature,
+    int domain_count,
+    int used_domains)
+{
+    TEST_ASSERT_TRUE(fwk_id_is_equal(module_id, fwk_module_id_scmi_clock));
+
+    init_signature = signature;
+    init_domain_count = domain_count;
+    init_used_domains = used_domains;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_start_stats(fwk_id_t module_id)
+{
+    TEST_ASSERT_TRUE(fwk_id_is_equal(module_id, fwk_module_id_scmi_clock));
+
+    stats_started = true;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    int level_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_domain_count);
+
+    added_domains[added_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .value = (uint64_t)level_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_update_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    uint32_t level_id)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, updated_domain_count);
+
+    updated_domains[updated_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = level_id,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t min_value,
+    uint64_t bucket_width,
+    unsigned int bucket_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_histogram_count);
+
+    added_histograms[added_histogram_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = bucket_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_record_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t value)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, recorded_sample_count);
+
+    recorded_samples[recorded_sample_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = value,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_stats_api fake_stats_api = {
+    .init_stats = fake_init_stats,
+    .start_stats = fake_start_stats,
+    .add_domain = fake_add_domain,
+    .update_domain = fake_update_domain,
+    .add_histogram = fake_add_histogram,
+    .record_histogram = fake_record_histogram,
+};
+
+static int fake_get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    *agent_id = FAKE_SCMI_AGENT_IDX_OSPM0;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, respond_count);
+
+    respond_statuses[respond_count++] = *(const int32_t *)payload;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api fake_scmi_api = {
+    .get_agent_id = fake_get_agent_id,
+    .respond = fake_respond,
+};
+
+static int fake_clock_set_rate(
+    fwk_id_t clock_id,
+    uint64_t rate,
+    enum mod_clock_round_mode round_mode)
+{
+    return clock_status;
+}
+
+static int fake_clock_set_state(fwk_id_t clock_id, enum mod_clock_state state)
+{
+    return clock_status;
+}
+
+static const struct mod_clock_api fake_clock_api = {
+    .set_rate = fake_clock_set_rate,
+    .set_state = fake_clock_set_state,
+};
+
+void setUp(void)
+{
+    memset(&scmi_clock_ctx, 0, sizeof(scmi_clock_ctx));
+
+    scmi_clock_ctx.config = &stats_config;
+    scmi_clock_ctx.agent_table = stats_config.agent_table;
+    scmi_clock_ctx.clock_devices = CLOCK_DEV_IDX_COUNT;
+    scmi_clock_ctx.clock_ops = clock_ops_table;
+    scmi_clock_ctx.dev_clock_ref_count_table = dev_clock_ref_count_table;
+    scmi_clock_ctx.agent_clock_state_table = agent_clock_state_table;
+    scmi_clock_ctx.scmi_api = &fake_scmi_api;
+    scmi_clock_ctx.clock_api = &fake_clock_api;
+    scmi_clock_ctx.stats_api = &fake_stats_api;
+
+    memset(clock_ops_table, 0, sizeof(clock_ops_table));
+    for (unsigned int i = 0; i < CLOCK_DEV_IDX_COUNT; i++) {
+        clock_ops_table[i].service_id = FWK_ID_NONE;
+    }
+
+    memcpy(
+        dev_clock_ref_count_table,
+        dev_clock_ref_count_table_default,
+        sizeof(dev_clock_ref_count_table));
+    memcpy(
+        agent_clock_state_table,
+        agent_clock_state_table_default,
+        sizeof(agent_clock_state_table));
+    memcpy(
+        dev_clock_ref_count_table_expected,
+        dev_clock_ref_count_table_default,
+        sizeof(dev_clock_ref_count_table_expected));
+    memcpy(
+        agent_clock_state_table_expected,
+        agent_clock_state_table_default,
+        sizeof(agent_clock_state_table_expected));
+
+    added_domain_count = 0;
+    added_histogram_count = 0;
+    updated_domain_count = 0;
+    recorded_sample_count = 0;
+    init_signature = 0;
+    init_domain_count = 0;
+    init_used_domains = 0;
+    stats_started = false;
+    respond_count = 0;
+    clock_status = FWK_SUCCESS;
+}
+
+void tearDown(void)
+{
+    Mockfwk_time_Verify();
+}
+
+static void start_stats(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_clock_stats_start());
+
+    updated_domain_count = 0;
+}
+
+static fwk_id_t fake_service_id(void)
+{
+    return FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, FAKE_SCMI_AGENT_IDX_OSPM0);
+}
+
+/* Process a CLOCK_RATE_SET request on a clock device */
+static int process_set_rate(enum clock_dev_idx clock_dev_idx)
+{
+    struct fwk_event event = {
+        .id = mod_scmi_clock_event_id_set_rate,
+        .source_id = fwk_module_id_scmi,
+    };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+
+    params->clock_dev_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, clock_dev_idx);
+    params->request_data.set_rate_data.rate[0] = (uint32_t)FAKE_RATE;
+    params->request_data.set_rate_data.rate[1] = (uint32_t)(FAKE_RATE >> 32);
+
+    clock_ops_set_busy(
+        clock_dev_idx,
+        fake_service_id(),
+        clock_dev_idx,
+        MOD_CLOCK_STATE_RUNNING,
+        SCMI_CLOCK_REQUEST_SET_RATE);
+
+    return process_request_event(&event);
+}
+
+/* Complete the rate change in progress on a clock device */
+static int complete_set_rate(enum clock_dev_idx clock_dev_idx, int status)
+{
+    struct fwk_event event = {
+        .id = FWK_ID_EVENT(
+            FWK_MODULE_IDX_CLOCK, MOD_CLOCK_EVENT_IDX_SET_RATE_REQUEST),
+        .source_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, clock_dev_idx),
+    };
+    struct mod_clock_resp_params *params =
+        (struct mod_clock_resp_params *)event.params;
+
+    params->status = status;
+
+    return process_response_event(&event);
+}
+
+static void expect_latency(void)
+{
+    fwk_time_current_ExpectAndReturn(FAKE_REQUEST_TS);
+    fwk_time_stamp_duration_ExpectAndReturn(FAKE_REQUEST_TS, FAKE_LATENCY_NS);
+    fwk_time_duration_us_ExpectAndReturn(FAKE_LATENCY_NS, FAKE_LATENCY_US);
+}
+
+void test_scmi_clock_stats_start(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_clock_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(MOD_STATS_SIGNATURE_CLCK, init_signature);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_COUNT, init_domain_count);
+    TEST_ASSERT_EQUAL(2, init_used_domains);
+    TEST_ASSERT_TRUE(stats_started);
+
+    /* One level for each clock state */
+    TEST_ASSERT_EQUAL(2, added_domain_count);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, added_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(MOD_CLOCK_STATE_COUNT, added_domains[0].value);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE2, added_domains[1].domain_idx);
+    TEST_ASSERT_EQUAL(MOD_CLOCK_STATE_COUNT, added_domains[1].value);
+
+    /* Only the configured histograms are added */
+    TEST_ASSERT_EQUAL(2, added_histogram_count);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, added_histograms[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, added_histograms[0].level_or_type);
+    TEST_ASSERT_EQUAL(32, added_histograms[0].value);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, added_histograms[1].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+        added_histograms[1].level_or_type);
+    TEST_ASSERT_EQUAL(16, added_histograms[1].value);
+
+    /* Both clock devices are enabled at startup */
+    TEST_ASSERT_EQUAL(2, updated_domain_count);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_CLOCK_STATE_RUNNING, updated_domains[0].level_or_type);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE2, updated_domains[1].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_CLOCK_STATE_RUNNING, updated_domains[1].level_or_type);
+}
+
+void test_scmi_clock_stats_start_disabled(void)
+{
+    struct mod_scmi_clock_config config = stats_config;
+
+    config.stats_table = NULL;
+    scmi_clock_ctx.config = &config;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_clock_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(0, init_signature);
+    TEST_ASSERT_FALSE(stats_started);
+}
+
+void test_scmi_clock_stats_set_rate(void)
+{
+    start_stats();
+    expect_latency();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_set_rate(CLOCK_DEV_IDX_FAKE0));
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_statuses[0]);
+
+    TEST_ASSERT_EQUAL(2, recorded_sample_count);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, recorded_samples[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+        recorded_samples[0].level_or_type);
+    TEST_ASSERT_EQUAL(FAKE_LATENCY_US, recorded_samples[0].value);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, recorded_samples[1].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, recorded_samples[1].level_or_type);
+    TEST_ASSERT_EQUAL_UINT64(FAKE_RATE, recorded_samples[1].value);
+}
+
+void test_scmi_clock_stats_set_rate_async(void)
+{
+    start_stats();
+    fwk_time_current_ExpectAndReturn(FAKE_REQUEST_TS);
+
+    clock_status = FWK_PENDING;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_set_rate(CLOCK_DEV_IDX_FAKE0));
+
+    /* Nothing is recorded until the rate change completes */
+    TEST_ASSERT_EQUAL(0, respond_count);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+
+    fwk_time_stamp_duration_ExpectAndReturn(FAKE_REQUEST_TS, FAKE_LATENCY_NS);
+    fwk_time_duration_us_ExpectAndReturn(FAKE_LATENCY_NS, FAKE_LATENCY_US);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS, complete_set_rate(CLOCK_DEV_IDX_FAKE0, FWK_SUCCESS));
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_statuses[0]);
+    TEST_ASSERT_EQUAL(2, recorded_sample_count);
+    TEST_ASSERT_EQUAL(FAKE_LATENCY_US, recorded_samples[0].value);
+    TEST_ASSERT_EQUAL_UINT64(FAKE_RATE, recorded_samples[1].value);
+}
+
+void test_scmi_clock_stats_set_rate_failed(void)
+{
+    start_stats();
+    fwk_time_current_ExpectAndReturn(FAKE_REQUEST_TS);
+
+    clock_status = FWK_E_DEVICE;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_set_rate(CLOCK_DEV_IDX_FAKE0));
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_GENERIC_ERROR, respond_statuses[0]);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+}
+
+void test_scmi_clock_stats_set_rate_no_histogram(void)
+{
+    start_stats();
+    fwk_time_current_ExpectAndReturn(FAKE_REQUEST_TS);
+
+    /* FAKE2 has statistics without histograms, FAKE1 has none */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_set_rate(CLOCK_DEV_IDX_FAKE2));
+    fwk_time_current_ExpectAndReturn(FAKE_REQUEST_TS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_set_rate(CLOCK_DEV_IDX_FAKE1));
+
+    TEST_ASSERT_EQUAL(2, respond_count);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+    TEST_ASSERT_EQUAL(0, updated_domain_count);
+}
+
+void test_scmi_clock_stats_set_state(void)
+{
+    struct fwk_event event = {
+        .id = mod_scmi_clock_event_id_set_state,
+        .source_id = fwk_module_id_scmi,
+    };
+    struct scmi_clock_event_request_params *params =
+        (struct scmi_clock_event_request_params *)event.params;
+
+    start_stats();
+
+    params->clock_dev_id =
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, CLOCK_DEV_IDX_FAKE0);
+    params->request_data.set_state_data.state = MOD_CLOCK_STATE_STOPPED;
+
+    clock_ops_set_busy(
+        CLOCK_DEV_IDX_FAKE0,
+        fake_service_id(),
+        SCMI_CLOCK_OSPM0_IDX0,
+        MOD_CLOCK_STATE_STOPPED,
+        SCMI_CLOCK_REQUEST_SET_STATE);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, process_request_event(&event));
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_statuses[0]);
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(CLOCK_DEV_IDX_FAKE0, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_CLOCK_STATE_STOPPED, updated_domains[0].level_or_type);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+
+    /* The statistics do not get in the way of the reference counting */
+    dev_clock_ref_count_table_expected[CLOCK_DEV_IDX_FAKE0] = 0;
+    agent_clock_state_table_expected
+        [FAKE_SCMI_AGENT_IDX_OSPM0 * CLOCK_DEV_IDX_COUNT +
+         SCMI_CLOCK_OSPM0_IDX0] = MOD_CLOCK_STATE_STOPPED;
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(
+        dev_clock_ref_count_table_expected,
+        dev_clock_ref_count_table,
+        CLOCK_DEV_IDX_COUNT);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(
+        agent_clock_state_table_expected,
+        agent_clock_state_table,
+        FAKE_SCMI_AGENT_IDX_COUNT * CLOCK_DEV_IDX_COUNT);
+}
+
+int scmi_clock_stats_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scmi_clock_stats_start);
+    RUN_TEST(test_scmi_clock_stats_start_disabled);
+    RUN_TEST(test_scmi_clock_stats_set_rate);
+    RUN_TEST(test_scmi_clock_stats_set_rate_async);
+    RUN_TEST(test_scmi_clock_stats_set_rate_failed);
+    RUN_TEST(test_scmi_clock_stats_set_rate_no_histogram);
+    RUN_TEST(test_scmi_clock_stats_set_state);
+
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return scmi_clock_stats_test_main();
+}
@@ -63,6 +63,11 @@ struct perf_opp_table {
 
     /* The DVFS identifier for this OPP table */
     fwk_id_t dvfs_id;
+
+#ifdef BUILD_HAS_SCMI_PERF_PROTOCOL_OPS
+    /* Levels in PERFORMANCE_DESCRIBE_LEVELS format, built at start */
+    struct scmi_perf_level *levels;
+#endif
 };
 
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
@@ -87,6 +92,9 @@ struct scmi_perf_domain_ctx {
     /* Current level */
     uint32_t curr_level;
 
+    /* True once curr_level holds a level reported by DVFS */
+    bool level_valid;
+
     /* Tables of OPPs */
     struct perf_opp_table *opp_table;
 
@@ -95,6 +103,23 @@ struct scmi_perf_domain_ctx {
     /* Table of fast channel context */
     struct fast_channel_ctx fch_ctx[MOD_SCMI_PERF_FAST_CHANNEL_COUNT];
 
+    /* True if a set fast channel of the domain is polled */
+    bool fch_polled;
+
+    /* True if a doorbell signalled a write to a set fast channel */
+    volatile bool fch_pending;
+
+    /* True if the fast channels are processed in the current pass */
+    bool fch_process;
+
+#endif
+
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    /* Utilization hinted by the agent, in percent */
+    uint32_t hint_utilization;
+
+    /* Level expected by the agent in the near future, 0 if none */
+    uint32_t hint_level;
 #endif
 };
 
@@ -417,6 +442,11 @@ struct mod_scmi_perf_private_api_perf_stub {
 
 void perf_fch_set_fch_get_level(uint32_t domain_idx, uint32_t level);
 
+void perf_fch_set_hint(
+    uint32_t domain_idx,
+    uint32_t utilization,
+    uint32_t level);
+
 bool perf_fch_prot_msg_attributes_has_fastchannels(
     const struct scmi_protocol_message_attributes_a2p *parameters);
 
@@ -459,6 +489,12 @@ void perf_prot_ops_process_bind_request(
     fwk_id_t api_id,
     const void **api);
 
+void perf_prot_ops_process_level_api_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **api);
+
 int perf_prot_ops_process_events(
     const struct fwk_event *event,
     struct fwk_event *resp_event);
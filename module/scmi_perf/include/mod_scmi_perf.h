@@ -247,8 +247,11 @@ enum scmi_perf_api_idx {
     /*! Index of the Performance Plugin Handler API */
     MOD_SCMI_PERF_PLUGINS_API = 2,
 
+    /*! Index of the performance level API */
+    MOD_SCMI_PERF_LEVEL_API = 3,
+
     /*! Number of APIs */
-    MOD_SCMI_PERF_API_COUNT = 3
+    MOD_SCMI_PERF_API_COUNT = 4
 };
 
 /*!
@@ -296,6 +299,96 @@ struct mod_scmi_perf_updated_api {
         uint32_t level);
 };
 
+/*!
+ * \brief Highest utilization that an agent can hint, in percent.
+ */
+#define MOD_SCMI_PERF_HINT_UTILIZATION_MAX UINT32_C(100)
+
+/*!
+ * \brief SCMI Perf level API.
+ *
+ * \details API used by vendor protocols to get and set the level of a
+ *      performance domain on behalf of an agent. The requests go through the
+ *      same permission checks, policy handlers and limits as the
+ *      PERFORMANCE_LEVEL_SET and PERFORMANCE_LEVEL_GET messages. Agents can
+ *      also publish hints on their near-future demand for the performance
+ *      plugins.
+ *
+ * \note Only available when the SCMI performance protocol operations are
+ *      built.
+ */
+struct mod_scmi_perf_level_api {
+    /*!
+     * \brief Set the level of a performance domain.
+     *
+     * \details The request is fire-and-forget, the function returns once the
+     *      request has been submitted to DVFS.
+     *
+     * \param agent_id Identifier of the agent requesting the level.
+     * \param domain_idx SCMI performance domain identifier.
+     * \param level Requested performance level.
+     *
+     * \retval ::FWK_SUCCESS The request was submitted.
+     * \retval ::FWK_E_PARAM The domain does not exist.
+     * \retval ::FWK_E_ACCESS The agent is not allowed to set the level.
+     * \retval ::FWK_E_RANGE The level is not valid or is out of the limits.
+     * \return One of the standard framework error codes.
+     */
+    int (*set_level)(
+        unsigned int agent_id,
+        unsigned int domain_idx,
+        uint32_t level);
+
+    /*!
+     * \brief Get the current level of a performance domain.
+     *
+     * \param agent_id Identifier of the agent requesting the level.
+     * \param domain_idx SCMI performance domain identifier.
+     * \param [out] level Current performance level.
+     *
+     * \retval ::FWK_SUCCESS The level was returned.
+     * \retval ::FWK_E_PARAM The domain does not exist.
+     * \retval ::FWK_E_ACCESS The agent is not allowed to get the level.
+     * \retval ::FWK_E_BUSY The level of the domain is not known yet.
+     */
+    int (*get_level)(
+        unsigned int agent_id,
+        unsigned int domain_idx,
+        uint32_t *level);
+
+    /*!
+     * \brief Publish the utilization and the expected level of a domain.
+     *
+     * \details The hints replace the previous hints of the domain and are
+     *      provided to the performance plugins with the next update of the
+     *      domain. The hinted level is then applied as a minimum limit of
+     *      the domain, after any adjustment of the limits by the plugins, and
+     *      capped by the maximum limit of the domain.
+     *
+     * \note The hints do not expire. They stay in place until the agent
+     *      replaces them, and publishing 0 for both clears them.
+     *
+     * \param agent_id Identifier of the agent publishing the hints.
+     * \param domain_idx SCMI performance domain identifier.
+     * \param utilization Utilization of the domain, in percent.
+     * \param level Level expected to be requested in the near future, or 0.
+     *
+     * \retval ::FWK_SUCCESS The hints were recorded.
+     * \retval ::FWK_E_PARAM The domain does not exist.
+     * \retval ::FWK_E_ACCESS The agent is not allowed to set the level.
+     * \retval ::FWK_E_RANGE The utilization is above
+     *      ::MOD_SCMI_PERF_HINT_UTILIZATION_MAX or the level is outside of the
+     *      levels of the domain.
+     * \retval ::FWK_E_SUPPORT The domain is not managed by the performance
+     *      plugins.
+     */
+    int (*set_hint)(
+        unsigned int agent_id,
+        unsigned int domain_idx,
+        uint32_t utilization,
+        uint32_t level);
+};
+
 /*!
  * \defgroup GroupScmiPerformancePolicyHandlers Policy Handlers
  *
@@ -430,6 +523,26 @@ struct perf_plugins_perf_update {
      *      affect the performance limit for targeted domains.
      */
     uint32_t *adj_min_limit;
+
+    /*!
+     * \brief Expected performance level(s) hinted by the agents.
+     *
+     * \details This is an input for the plugin. It is the level that the
+     *      agent expects to request in the near future, e.g. ahead of a load
+     *      spike, and can be used to raise the performance or the voltage
+     *      before the request is made. 0 means that no level is expected.
+     *      The hints stay in place until the agents clear them.
+     *      See ::mod_scmi_perf_level_api::set_hint.
+     */
+    uint32_t *hint_level;
+
+    /*!
+     * \brief Utilization(s) hinted by the agents, in percent.
+     *
+     * \details This is an input for the plugin. 0 when no utilization has
+     *      been hinted. See ::mod_scmi_perf_level_api::set_hint.
+     */
+    uint32_t *hint_utilization;
 };
 
 /*!
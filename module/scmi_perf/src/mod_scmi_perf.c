@@ -349,6 +349,7 @@ static void scmi_perf_notify_level_updated(
 
     domain_ctx = get_ctx(domain_id);
     domain_ctx->curr_level = level;
+    domain_ctx->level_valid = true;
 }
 
 static struct mod_scmi_perf_updated_api perf_update_api = {
@@ -476,6 +477,11 @@ static int scmi_perf_process_bind_request(fwk_id_t source_id,
     case MOD_SCMI_PERF_PROTOCOL_API:
         perf_prot_ops_process_bind_request(source_id, target_id, api_id, api);
         break;
+
+    case MOD_SCMI_PERF_LEVEL_API:
+        perf_prot_ops_process_level_api_bind_request(
+            source_id, target_id, api_id, api);
+        break;
 #endif
 
     case MOD_SCMI_PERF_DVFS_UPDATE_API:
@@ -23,6 +23,7 @@
 #include <fwk_assert.h>
 #include <fwk_id.h>
 #include <fwk_log.h>
+#include <fwk_macros.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
@@ -242,6 +243,52 @@ static void plugins_policy_sync_level_limits(
     }
 }
 
+/*
+ * Without plugins, the level hinted by the agents is applied as a minimum limit
+ * of the physical domain, so that the domain reaches that level ahead of the
+ * demand. The hinted level is capped by the maximum limit of the domain.
+ */
+static void plugins_policy_apply_hint(struct perf_plugins_dev_ctx *dev_ctx)
+{
+    unsigned int phy_dom;
+    uint32_t hint_level;
+
+    phy_dom = dev_ctx->log_dom_count;
+
+    hint_level = FWK_MIN(
+        dev_ctx->perf_table.hint_level[phy_dom],
+        dev_ctx->perf_table.max_limit[phy_dom]);
+
+    if (hint_level > dev_ctx->perf_table.adj_min_limit[phy_dom]) {
+        dev_ctx->perf_table.adj_min_limit[phy_dom] = hint_level;
+    }
+}
+
+/*
+ * With plugins, the level hinted by the agents is applied as a minimum limit
+ * once the plugins have adjusted the limits of the domain, so that the plugins
+ * cannot take the domain below it. The hinted level is capped by the adjusted
+ * maximum limit.
+ */
+static void plugins_policy_apply_hint_adjusted(
+    struct perf_plugins_dev_ctx *dev_ctx)
+{
+    unsigned int phy_dom, phy_dom_idx;
+    uint32_t hint_level;
+
+    phy_dom = dev_ctx->log_dom_count;
+
+    hint_level =
+        FWK_MIN(dev_ctx->perf_table.hint_level[phy_dom], dev_ctx->lmax);
+
+    if (hint_level > dev_ctx->lmin) {
+        dev_ctx->lmin = hint_level;
+
+        phy_dom_idx = fwk_id_get_element_idx(dev_ctx->perf_table.domain_id);
+        write_back_adj_values(dev_ctx, (size_t)phy_dom_idx);
+    }
+}
+
 static void plugins_policy_update(struct fc_perf_update *fc_update)
 {
     struct perf_plugins_dev_ctx *dev_ctx;
@@ -261,19 +308,19 @@ static void plugins_policy_update_no_plugins(struct fc_perf_update *fc_update)
     unsigned int phy_dom;
 
     dev_ctx = perf_ph_get_ctx(fc_update->domain_id);
+    phy_dom = dev_ctx->log_dom_count;
 
     if (dev_ctx->log_dom_count == 1) {
         /* No plugins, no logical domains */
         fc_update->adj_max_limit = fc_update->max_limit;
-        fc_update->adj_min_limit = fc_update->min_limit;
     } else {
         /* No plugins, with logical domains */
-        phy_dom = dev_ctx->log_dom_count;
-
         fc_update->level = dev_ctx->perf_table.level[phy_dom];
         fc_update->adj_max_limit = dev_ctx->perf_table.adj_max_limit[phy_dom];
-        fc_update->adj_min_limit = dev_ctx->perf_table.adj_min_limit[phy_dom];
     }
+
+    /* The minimum limit may have been raised by the hinted level */
+    fc_update->adj_min_limit = dev_ctx->perf_table.adj_min_limit[phy_dom];
 }
 
 static inline void get_perf_table(
@@ -286,6 +333,8 @@ static inline void get_perf_table(
     dom->adj_max_limit = &ctx->perf_table.adj_max_limit[dom_ix];
     dom->min_limit = &ctx->perf_table.min_limit[dom_ix];
     dom->adj_min_limit = &ctx->perf_table.adj_min_limit[dom_ix];
+    dom->hint_level = &ctx->perf_table.hint_level[dom_ix];
+    dom->hint_utilization = &ctx->perf_table.hint_utilization[dom_ix];
 }
 
 static void assign_data_for_plugins(
@@ -310,6 +359,10 @@ static void assign_data_for_plugins(
         snapshot->adj_min_limit =
             &perf_plugins_ctx.full_perf_table.adj_min_limit[0];
 
+        snapshot->hint_level = &perf_plugins_ctx.full_perf_table.hint_level[0];
+        snapshot->hint_utilization =
+            &perf_plugins_ctx.full_perf_table.hint_utilization[0];
+
         return;
     } else if (dom_type == PERF_PLUGIN_DOM_TYPE_LOGICAL) {
         /* Provide the beginning of the table */
@@ -339,6 +392,7 @@ static inline void domain_aggregate(
      * - pick the max for the level
      * - pick the max for the min limit
      * - pick the min for the max limit
+     * - pick the max for the hinted level and utilization
      */
     if (this_dom->level[0] > phy_dom->level[0]) {
         phy_dom->level[0] = this_dom->level[0];
@@ -351,6 +405,14 @@ static inline void domain_aggregate(
     if (this_dom->min_limit[0] > phy_dom->min_limit[0]) {
         phy_dom->min_limit[0] = this_dom->min_limit[0];
     }
+
+    if (this_dom->hint_level[0] > phy_dom->hint_level[0]) {
+        phy_dom->hint_level[0] = this_dom->hint_level[0];
+    }
+
+    if (this_dom->hint_utilization[0] > phy_dom->hint_utilization[0]) {
+        phy_dom->hint_utilization[0] = this_dom->hint_utilization[0];
+    }
 }
 
 static void store_and_aggregate(struct fc_perf_update *fc_update)
@@ -374,12 +436,16 @@ static void store_and_aggregate(struct fc_perf_update *fc_update)
     this_dom.min_limit[0] = fc_update->min_limit;
     this_dom.adj_max_limit[0] = fc_update->max_limit;
     this_dom.adj_min_limit[0] = fc_update->min_limit;
+    this_dom.hint_level[0] = fc_update->hint_level;
+    this_dom.hint_utilization[0] = fc_update->hint_utilization;
 
     if (this_dom_idx == 0) {
         /* Init max/min for physical domain at the 1st iteration */
         phy_dom.level[0] = 0;
         phy_dom.max_limit[0] = UINT32_MAX;
         phy_dom.min_limit[0] = 0;
+        phy_dom.hint_level[0] = 0;
+        phy_dom.hint_utilization[0] = 0;
 
         /* as well as ctx */
         dev_ctx->lmin = 0;
@@ -406,6 +472,11 @@ static void store_and_aggregate(struct fc_perf_update *fc_update)
             phy_dom.adj_max_limit[0];
         perf_plugins_ctx.full_perf_table.adj_min_limit[phy_ix] =
             phy_dom.adj_min_limit[0];
+
+        perf_plugins_ctx.full_perf_table.hint_level[phy_ix] =
+            phy_dom.hint_level[0];
+        perf_plugins_ctx.full_perf_table.hint_utilization[phy_ix] =
+            phy_dom.hint_utilization[0];
     }
 }
 
@@ -437,6 +508,7 @@ void perf_plugins_handler_update(
     if (this_dom_idx == last_logical_dom_idx) {
         if (config->plugins_count == 0) {
             /* coordination-only */
+            plugins_policy_apply_hint(dev_ctx);
             plugins_policy_sync_level_limits(
                 dev_ctx, PERF_PLUGIN_DOM_TYPE_LOGICAL);
             return;
@@ -468,6 +540,8 @@ void perf_plugins_handler_update(
 
             plugins_policy_sync_level_limits(dev_ctx, dom_type);
         }
+
+        plugins_policy_apply_hint_adjusted(dev_ctx);
     }
 }
 
@@ -540,6 +614,8 @@ static void perf_plugins_alloc_tables(
     table->adj_max_limit = fwk_mm_calloc(count, sizeof(uint32_t));
     table->min_limit = fwk_mm_calloc(count, sizeof(uint32_t));
     table->adj_min_limit = fwk_mm_calloc(count, sizeof(uint32_t));
+    table->hint_level = fwk_mm_calloc(count, sizeof(uint32_t));
+    table->hint_utilization = fwk_mm_calloc(count, sizeof(uint32_t));
 }
 
 int perf_plugins_handler_init(const struct mod_scmi_perf_config *config)
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2021-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -38,6 +38,7 @@ int perf_plugins_handler_process_bind_request(
  *      - limits that SCMI-Perf provides to the plugins handler for its logic.
  *      - adjusted limits that the plugins handler returns to SCMI-Perf ready
  *          for the DVFS module.
+ *      - hints that the agent published on its near-future demand.
  *      These values come from the FastChannels and the plugins handler executes
  *      its logic in order to aggregate them before they can be forwarded to the
  *      DVFS module.
@@ -58,6 +59,11 @@ struct fc_perf_update {
     uint32_t adj_max_limit;
     /*! Adjusted (by the plugins hanlder) performance limit min */
     uint32_t adj_min_limit;
+
+    /*! Utilization hinted by the agent, in percent */
+    uint32_t hint_utilization;
+    /*! Performance level expected by the agent, 0 if none */
+    uint32_t hint_level;
 };
 
 /*!
@@ -52,6 +52,9 @@ struct mod_scmi_perf_fc_ctx {
 
     /* True if this domain supports fast channel */
     bool supports_fast_channel;
+
+    /* True if the polling period of the polled fast channels has elapsed */
+    volatile bool poll_pending;
 #endif
 };
 
@@ -68,6 +71,10 @@ static struct mod_scmi_perf_fc_ctx perf_fch_ctx;
 
 static void fast_channel_callback(uintptr_t param);
 
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+static void fast_channel_doorbell_callback(uintptr_t param);
+#endif
+
 /*
  * Static Helpers
  */
@@ -139,29 +146,56 @@ static struct fast_channel_ctx *get_fch_ctx(
                 .fch_ctx[fch_idx];
 }
 
-static void fch_context_init(
-    const struct scmi_perf_fch_config *fch_config,
-    struct fast_channel_ctx *fch_ctx)
+static inline bool is_set_fch(unsigned int fch_idx)
 {
+    return (fch_idx == MOD_SCMI_PERF_FAST_CHANNEL_LEVEL_SET) ||
+        (fch_idx == MOD_SCMI_PERF_FAST_CHANNEL_LIMIT_SET);
+}
+
+static void fch_context_init(unsigned int domain_idx, unsigned int fch_idx)
+{
+    const struct scmi_perf_fch_config *fch_config;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    struct fast_channel_ctx *fch_ctx;
     enum mod_transport_fch_interrupt_type interrupt_type;
+
+    fch_config = get_fch_config(domain_idx, fch_idx);
+    domain_ctx = &perf_fch_ctx.perf_ctx->domain_ctx_table[domain_idx];
+    fch_ctx = &domain_ctx->fch_ctx[fch_idx];
+
     fch_ctx->transport_fch_api->transport_get_fch_address(
         fch_config->transport_id, &fch_ctx->fch_address);
 
     fch_ctx->transport_fch_api->transport_get_fch_interrupt_type(
         fch_config->transport_id, &interrupt_type);
 
-    if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_TIMER &&
-        !perf_fch_ctx.callback_registered) {
+    if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_TIMER) {
+        if (is_set_fch(fch_idx)) {
+            domain_ctx->fch_polled = true;
+        }
+
+        if (!perf_fch_ctx.callback_registered) {
+            /*
+             * For polled fast channels, we need to register one single
+             * call back for all channels so register this only once.
+             */
+            fch_ctx->transport_fch_api->transport_fch_register_callback(
+                fch_config->transport_id,
+                (uintptr_t)NULL,
+                fast_channel_callback);
+            perf_fch_ctx.callback_registered = true;
+        }
+    } else if (
+        (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_HW) &&
+        is_set_fch(fch_idx)) {
         /*
-         * For polled fast channels, we need to register one single
-         * call back for all channels so register this only once.
+         * The doorbell of a set fast channel only signals a write to this
+         * domain, so only this domain is processed when it rings.
          */
         fch_ctx->transport_fch_api->transport_fch_register_callback(
-            fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
-        perf_fch_ctx.callback_registered = true;
-    } else if (interrupt_type == MOD_TRANSPORT_FCH_INTERRUPT_TYPE_HW) {
-        fch_ctx->transport_fch_api->transport_fch_register_callback(
-            fch_config->transport_id, (uintptr_t)NULL, fast_channel_callback);
+            fch_config->transport_id,
+            (uintptr_t)domain_ctx,
+            fast_channel_doorbell_callback);
     }
 }
 
@@ -491,7 +525,7 @@ static void perf_eval_performance(
 /*
  * Fast Channel Polling
  */
-static void fast_channel_callback(uintptr_t param)
+static void put_fast_channels_process_event(void)
 {
     int status;
 
@@ -512,6 +546,110 @@ static void fast_channel_callback(uintptr_t param)
     log_and_increment_pending_req_count();
 }
 
+static void fast_channel_callback(uintptr_t param)
+{
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    perf_fch_ctx.poll_pending = true;
+#endif
+
+    put_fast_channels_process_event();
+}
+
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+static void fast_channel_doorbell_callback(uintptr_t param)
+{
+    struct scmi_perf_domain_ctx *domain_ctx =
+        (struct scmi_perf_domain_ctx *)param;
+
+    domain_ctx->fch_pending = true;
+
+    put_fast_channels_process_event();
+}
+#endif
+
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+/*
+ * Record the hints of an agent for a domain. They are provided to the plugins
+ * in the next pass, which is requested now rather than at the next doorbell or
+ * polling period so that the plugins can act ahead of the demand.
+ */
+void perf_fch_set_hint(
+    uint32_t domain_idx,
+    uint32_t utilization,
+    uint32_t level)
+{
+    struct scmi_perf_domain_ctx *domain_ctx =
+        &perf_fch_ctx.perf_ctx->domain_ctx_table[domain_idx];
+
+    domain_ctx->hint_utilization = utilization;
+    domain_ctx->hint_level = level;
+
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    domain_ctx->fch_pending = true;
+#endif
+
+    if (perf_fch_ctx.pending_req_count == 0) {
+        put_fast_channels_process_event();
+    }
+}
+#endif
+
+/*
+ * Select the domains whose fast channels are processed in this pass: the
+ * domains signalled by a doorbell and, when the polling period has elapsed,
+ * the domains with polled fast channels.
+ */
+static void perf_fch_select_domains(void)
+{
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    struct scmi_perf_domain_ctx *domain_ctx;
+    unsigned int i;
+    bool poll;
+
+    poll = perf_fch_ctx.poll_pending;
+    if (poll) {
+        perf_fch_ctx.poll_pending = false;
+    }
+
+    for (i = 0; i < perf_fch_ctx.perf_ctx->domain_count; i++) {
+        domain_ctx = &perf_fch_ctx.perf_ctx->domain_ctx_table[i];
+
+        /*
+         * Clear the flag before the fast channels are read, so that a
+         * doorbell ringing during the pass is processed in the next pass.
+         */
+        domain_ctx->fch_process = domain_ctx->fch_pending;
+        if (domain_ctx->fch_process) {
+            domain_ctx->fch_pending = false;
+        }
+
+        if (poll && domain_ctx->fch_polled) {
+            domain_ctx->fch_process = true;
+        }
+    }
+#endif
+}
+
+/*
+ * The plugins handler aggregates the logical domains of a physical domain, and
+ * runs the plugins for the whole system, as it goes through all the domains in
+ * order. Every domain with fast channels is therefore processed in each pass
+ * when the plugins handler is built, whichever domains were signalled.
+ */
+static bool perf_fch_domain_is_selected(unsigned int domain_idx)
+{
+    if (!perf_fch_domain_has_fastchannels(domain_idx)) {
+        return false;
+    }
+
+#if defined(BUILD_HAS_MOD_TRANSPORT_FC) && \
+    !defined(BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER)
+    return perf_fch_ctx.perf_ctx->domain_ctx_table[domain_idx].fch_process;
+#else
+    return true;
+#endif
+}
+
 static inline void load_tlimits(
     struct mod_scmi_perf_fast_channel_limit *set_limit,
     uint32_t *tmax,
@@ -548,8 +686,10 @@ static void perf_fch_process_plugins_handler(void)
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
     struct fc_perf_update update;
 
+    perf_fch_select_domains();
+
     for (i = 0; i < perf_ctx->domain_count; i++) {
-        if (perf_fch_domain_has_fastchannels(i)) {
+        if (perf_fch_domain_is_selected(i)) {
             set_limit = get_fc_set_limit_addr(i);
             set_level = get_fc_set_level_addr(i);
 
@@ -563,6 +703,8 @@ static void perf_fch_process_plugins_handler(void)
                 .level = tlevel,
                 .max_limit = tmax,
                 .min_limit = tmin,
+                .hint_utilization = domain_ctx->hint_utilization,
+                .hint_level = domain_ctx->hint_level,
             };
 
             perf_plugins_handler_update(i, &update);
@@ -570,7 +712,7 @@ static void perf_fch_process_plugins_handler(void)
     }
 
     for (i = 0; i < perf_ctx->domain_count; i++) {
-        if (perf_fch_domain_has_fastchannels(i)) {
+        if (perf_fch_domain_is_selected(i)) {
             set_limit = get_fc_set_limit_addr(i);
             set_level = get_fc_set_level_addr(i);
 
@@ -625,8 +767,10 @@ static void perf_fch_process(void)
 
     struct mod_scmi_perf_ctx *perf_ctx = perf_fch_ctx.perf_ctx;
 
+    perf_fch_select_domains();
+
     for (i = 0; i < perf_ctx->domain_count; i++) {
-        if (perf_fch_domain_has_fastchannels(i)) {
+        if (perf_fch_domain_is_selected(i)) {
             set_limit = get_fc_set_limit_addr(i);
             set_level = get_fc_set_level_addr(i);
 
@@ -740,13 +884,11 @@ static void *get_fch_local_address(
     unsigned int fch_idx)
 {
 #ifdef BUILD_HAS_MOD_TRANSPORT_FC
-    const struct scmi_perf_fch_config *fch_config;
     struct fast_channel_ctx *fch_ctx;
 
-    fch_config = get_fch_config(domain_idx, fch_idx);
-    fch_ctx = get_fch_ctx(domain_idx, fch_idx);
+    fch_context_init(domain_idx, fch_idx);
 
-    fch_context_init(fch_config, fch_ctx);
+    fch_ctx = get_fch_ctx(domain_idx, fch_idx);
 
     return (void *)fch_ctx->fch_address.local_view_address;
 #else
@@ -435,13 +435,10 @@ static int scmi_perf_describe_levels_handler(
     int status, respond_status;
     size_t max_payload_size;
     const struct scmi_perf_describe_levels_a2p *parameters;
-    fwk_id_t domain_id;
-    struct scmi_perf_level perf_level;
+    const struct perf_opp_table *opp_table;
     unsigned int num_levels, level_index, level_index_max;
     size_t payload_size;
     size_t opp_count;
-    struct mod_dvfs_opp opp;
-    uint16_t latency;
     struct scmi_perf_describe_levels_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR,
     };
@@ -470,12 +467,9 @@ static int scmi_perf_describe_levels_handler(
         goto exit;
     }
 
-    /* Get the number of operating points for the domain */
-    domain_id = get_dependency_id(parameters->domain_id);
-    status = scmi_perf_ctx->dvfs_api->get_opp_count(domain_id, &opp_count);
-    if (status != FWK_SUCCESS) {
-        goto exit;
-    }
+    /* Get the levels of the domain */
+    opp_table = scmi_perf_ctx->domain_ctx_table[parameters->domain_id].opp_table;
+    opp_count = opp_table->opp_count;
 
     /* Validate level index */
     level_index = parameters->level_index;
@@ -494,34 +488,17 @@ static int scmi_perf_describe_levels_handler(
 
     level_index_max = (level_index + num_levels - 1);
 
-    status = scmi_perf_ctx->dvfs_api->get_latency(domain_id, &latency);
+    /* Copy the page of levels in one go */
+    status = scmi_perf_ctx->scmi_api->write_payload(
+        service_id,
+        payload_size,
+        &opp_table->levels[level_index],
+        num_levels * sizeof(opp_table->levels[0]));
     if (status != FWK_SUCCESS) {
         goto exit;
     }
 
-    /* Copy DVFS data into returned data structure */
-    for (; level_index <= level_index_max;
-         level_index++, payload_size += sizeof(perf_level)) {
-        status =
-            scmi_perf_ctx->dvfs_api->get_nth_opp(domain_id, level_index, &opp);
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-
-        if (opp.power != 0) {
-            perf_level.power_cost = opp.power;
-        } else {
-            perf_level.power_cost = opp.voltage;
-        }
-        perf_level.performance_level = opp.level;
-        perf_level.attributes = latency;
-
-        status = scmi_perf_ctx->scmi_api->write_payload(
-            service_id, payload_size, &perf_level, sizeof(perf_level));
-        if (status != FWK_SUCCESS) {
-            goto exit;
-        }
-    }
+    payload_size += num_levels * sizeof(opp_table->levels[0]);
 
     return_values = (struct scmi_perf_describe_levels_p2a){
         .status = SCMI_SUCCESS,
@@ -734,6 +711,9 @@ static int scmi_perf_level_get_handler(
     const struct scmi_perf_level_get_a2p *parameters;
     struct scmi_perf_event_parameters *evt_params;
     struct scmi_perf_level_get_p2a return_values;
+    struct scmi_perf_domain_ctx *domain_ctx;
+    fwk_id_t domain_id;
+    unsigned int domain_idx;
     struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
 
     parameters = (const struct scmi_perf_level_get_a2p *)payload;
@@ -744,12 +724,25 @@ static int scmi_perf_level_get_handler(
         goto exit;
     }
 
+    domain_id = get_dependency_id(parameters->domain_id);
+    domain_idx = fwk_id_get_element_idx(domain_id);
+    domain_ctx = &scmi_perf_ctx->domain_ctx_table[domain_idx];
+
+    /*
+     * The level is kept up to date on each DVFS completion, so it can be
+     * returned right away, even while a request is pending for the domain.
+     */
+    if (domain_ctx->level_valid) {
+        status = FWK_SUCCESS;
+        return_values.status = (int32_t)SCMI_SUCCESS;
+        return_values.performance_level = domain_ctx->curr_level;
+
+        goto exit;
+    }
+
     /* Check if there is already a request pending for this domain */
     if (!fwk_id_is_equal(
-            perf_prot_ctx
-                .perf_ops_table[fwk_id_get_element_idx(
-                    get_dependency_id(parameters->domain_id))]
-                .service_id,
+            perf_prot_ctx.perf_ops_table[domain_idx].service_id,
             FWK_ID_NONE)) {
         return_values.status = (int32_t)SCMI_BUSY;
         status = FWK_SUCCESS;
@@ -764,7 +757,7 @@ static int scmi_perf_level_get_handler(
     };
 
     evt_params = (struct scmi_perf_event_parameters *)event.params;
-    evt_params->domain_id = get_dependency_id(parameters->domain_id);
+    evt_params->domain_id = domain_id;
 
     status = fwk_put_event(&event);
     if (status != FWK_SUCCESS) {
@@ -774,8 +767,7 @@ static int scmi_perf_level_get_handler(
     }
 
     /* Store service identifier to indicate there is a pending request */
-    perf_prot_ctx.perf_ops_table[fwk_id_get_element_idx(evt_params->domain_id)]
-        .service_id = service_id;
+    perf_prot_ctx.perf_ops_table[domain_idx].service_id = service_id;
 
     return FWK_SUCCESS;
 
@@ -1186,7 +1178,10 @@ static int scmi_perf_stats_start(void)
     }
 
     status = perf_prot_ctx.stats_api->init_stats(
-        fwk_module_id_scmi_perf, scmi_perf_ctx->domain_count, stats_domains);
+        fwk_module_id_scmi_perf,
+        MOD_STATS_SIGNATURE_PERF,
+        scmi_perf_ctx->domain_count,
+        stats_domains);
 
     if (status != FWK_SUCCESS) {
         return status;
@@ -1285,9 +1280,63 @@ int perf_prot_ops_bind(fwk_id_t id, unsigned int round)
     return status;
 }
 
+/*
+ * Build the PERFORMANCE_DESCRIBE_LEVELS tables of the DVFS domains, so the
+ * pages of levels can be copied as they are.
+ */
+static int build_level_tables(void)
+{
+    struct mod_scmi_perf_ctx *scmi_perf_ctx = perf_prot_ctx.scmi_perf_ctx;
+    struct perf_opp_table *opp_table;
+    struct scmi_perf_level *perf_level;
+    struct mod_dvfs_opp opp;
+    uint16_t latency;
+    unsigned int i;
+    size_t level_index;
+    int status;
+
+    for (i = 0; i < scmi_perf_ctx->dvfs_doms_count; i++) {
+        opp_table = &scmi_perf_ctx->opp_table[i];
+
+        status = scmi_perf_ctx->dvfs_api->get_latency(
+            opp_table->dvfs_id, &latency);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        opp_table->levels =
+            fwk_mm_calloc(opp_table->opp_count, sizeof(struct scmi_perf_level));
+
+        for (level_index = 0; level_index < opp_table->opp_count;
+             level_index++) {
+            status = scmi_perf_ctx->dvfs_api->get_nth_opp(
+                opp_table->dvfs_id, level_index, &opp);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+
+            perf_level = &opp_table->levels[level_index];
+            if (opp.power != 0) {
+                perf_level->power_cost = opp.power;
+            } else {
+                perf_level->power_cost = opp.voltage;
+            }
+            perf_level->performance_level = opp.level;
+            perf_level->attributes = latency;
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
 int perf_prot_ops_start(fwk_id_t id)
 {
-    int status = FWK_SUCCESS;
+    int status;
+
+    status = build_level_tables();
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     status =
@@ -1316,6 +1365,168 @@ void perf_prot_ops_process_bind_request(
     *prot_bind_request_api = &scmi_perf_mod_scmi_to_protocol_api;
 }
 
+/*
+ * Cache a level read from DVFS for the subsequent PERFORMANCE_LEVEL_GET
+ * requests.
+ */
+static void cache_level(fwk_id_t domain_id, uint32_t level)
+{
+    struct scmi_perf_domain_ctx *domain_ctx;
+
+    domain_ctx = &perf_prot_ctx.scmi_perf_ctx
+                      ->domain_ctx_table[fwk_id_get_element_idx(domain_id)];
+    domain_ctx->curr_level = level;
+    domain_ctx->level_valid = true;
+}
+
+/*
+ * SCMI Performance level API
+ */
+static int scmi_perf_level_api_check(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    enum scmi_perf_command_id message_id)
+{
+    if (domain_idx >= perf_prot_ctx.scmi_perf_ctx->domain_count) {
+        return FWK_E_PARAM;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    if (perf_prot_ctx.res_perms_api->agent_has_resource_permission(
+            agent_id,
+            MOD_SCMI_PROTOCOL_ID_PERF,
+            (unsigned int)message_id,
+            domain_idx) != MOD_RES_PERMS_ACCESS_ALLOWED) {
+        return FWK_E_ACCESS;
+    }
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_perf_level_api_set_level(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t level)
+{
+    int status;
+    fwk_id_t domain_id;
+    enum mod_scmi_perf_policy_status policy_status;
+
+    status = scmi_perf_level_api_check(
+        agent_id, domain_idx, MOD_SCMI_PERF_LEVEL_SET);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /*
+     * Note that the policy handler may change the performance level
+     */
+    domain_id = get_dependency_id(domain_idx);
+
+    status = scmi_perf_level_set_policy(
+        &policy_status, &level, agent_id, domain_id);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+    if (policy_status == MOD_SCMI_PERF_SKIP_MESSAGE_HANDLER) {
+        return FWK_SUCCESS;
+    }
+
+    status = perf_prot_ctx.api_stub->perf_set_level(domain_id, agent_id, level);
+
+    /* The request is fire-and-forget, as for PERFORMANCE_LEVEL_SET */
+    return (status == FWK_PENDING) ? FWK_SUCCESS : status;
+}
+
+static int scmi_perf_level_api_get_level(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t *level)
+{
+    int status;
+    const struct scmi_perf_domain_ctx *domain_ctx;
+
+    status = scmi_perf_level_api_check(
+        agent_id, domain_idx, MOD_SCMI_PERF_LEVEL_GET);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    domain_ctx = &perf_prot_ctx.scmi_perf_ctx->domain_ctx_table
+                      [fwk_id_get_element_idx(get_dependency_id(domain_idx))];
+
+    /*
+     * Only the cached level can be returned synchronously. Until DVFS has
+     * reported a level for the domain, PERFORMANCE_LEVEL_GET must be used.
+     */
+    if (!domain_ctx->level_valid) {
+        return FWK_E_BUSY;
+    }
+
+    *level = domain_ctx->curr_level;
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_perf_level_api_set_hint(
+    unsigned int agent_id,
+    unsigned int domain_idx,
+    uint32_t utilization,
+    uint32_t level)
+{
+#ifdef BUILD_HAS_SCMI_PERF_PLUGIN_HANDLER
+    int status;
+    const struct perf_opp_table *opp_table;
+
+    status = scmi_perf_level_api_check(
+        agent_id, domain_idx, MOD_SCMI_PERF_LEVEL_SET);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* The hints are consumed by the plugins, on the fast channels updates */
+    if (!perf_fch_domain_has_fastchannels(domain_idx)) {
+        return FWK_E_SUPPORT;
+    }
+
+    if (utilization > MOD_SCMI_PERF_HINT_UTILIZATION_MAX) {
+        return FWK_E_RANGE;
+    }
+
+    if (level != 0) {
+        opp_table = perf_prot_ctx.scmi_perf_ctx->domain_ctx_table[domain_idx]
+                        .opp_table;
+
+        if ((level < opp_table->opps[0].level) ||
+            (level > opp_table->opps[opp_table->opp_count - 1].level)) {
+            return FWK_E_RANGE;
+        }
+    }
+
+    perf_fch_set_hint(domain_idx, utilization, level);
+
+    return FWK_SUCCESS;
+#else
+    return FWK_E_SUPPORT;
+#endif
+}
+
+static const struct mod_scmi_perf_level_api scmi_perf_level_api = {
+    .set_level = scmi_perf_level_api_set_level,
+    .get_level = scmi_perf_level_api_get_level,
+    .set_hint = scmi_perf_level_api_set_hint,
+};
+
+void perf_prot_ops_process_level_api_bind_request(
+    fwk_id_t source_id,
+    fwk_id_t target_id,
+    fwk_id_t api_id,
+    const void **level_api)
+{
+    *level_api = &scmi_perf_level_api;
+}
+
 /*
  * Handle a request for get_level/limits.
  */
@@ -1334,6 +1545,8 @@ static int process_request_event(const struct fwk_event *event)
             params->domain_id, &opp);
         if (status == FWK_SUCCESS) {
             /* DVFS value is ready */
+            cache_level(params->domain_id, opp.level);
+
             return_values_level = (struct scmi_perf_level_get_p2a){
                 .status = SCMI_SUCCESS,
                 .performance_level = opp.level,
@@ -1376,6 +1589,10 @@ static int process_response_event(const struct fwk_event *event)
 
     if (fwk_id_is_equal(event->id, mod_dvfs_event_id_get_opp)) {
         params_level = (struct mod_dvfs_params_response *)event->params;
+        if (params_level->status == SCMI_SUCCESS) {
+            cache_level(event->source_id, params_level->performance_level);
+        }
+
         return_values_level = (struct scmi_perf_level_get_p2a){
             .status = params_level->status,
             .performance_level = params_level->performance_level,
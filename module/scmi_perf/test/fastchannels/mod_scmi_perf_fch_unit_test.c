@@ -538,6 +538,47 @@ void utest_perf_fch_init_success(void)
         SCMI_PERF_FC_MIN_RATE_LIMIT, perf_fch_ctx.fast_channels_rate_limit);
 }
 
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+/*
+ * Test that a fast channel doorbell selects only the domain it belongs to,
+ * and that the polled domains are selected once the polling period elapses.
+ */
+void utest_perf_fch_doorbell_selects_domain(void)
+{
+    struct scmi_perf_domain_ctx domain_ctx_table[SCMI_PERF_ELEMENT_IDX_COUNT];
+    unsigned int i;
+
+    fwk_str_memset(domain_ctx_table, 0, sizeof(domain_ctx_table));
+    scmi_perf_ctx.domain_ctx_table = domain_ctx_table;
+    perf_fch_ctx.poll_pending = false;
+    perf_fch_ctx.pending_req_count = 0;
+
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_doorbell_callback((uintptr_t)&domain_ctx_table[0]);
+    TEST_ASSERT_TRUE(domain_ctx_table[0].fch_pending);
+
+    perf_fch_select_domains();
+    TEST_ASSERT_TRUE(perf_fch_domain_is_selected(0));
+    TEST_ASSERT_FALSE(domain_ctx_table[0].fch_pending);
+    for (i = 1; i < SCMI_PERF_ELEMENT_IDX_COUNT; i++) {
+        TEST_ASSERT_FALSE(perf_fch_domain_is_selected(i));
+    }
+
+    domain_ctx_table[SCMI_PERF_ELEMENT_IDX_COUNT - 1].fch_polled = true;
+
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_callback((uintptr_t)NULL);
+
+    perf_fch_select_domains();
+    TEST_ASSERT_FALSE(perf_fch_ctx.poll_pending);
+    TEST_ASSERT_TRUE(
+        perf_fch_domain_is_selected(SCMI_PERF_ELEMENT_IDX_COUNT - 1));
+    if (SCMI_PERF_ELEMENT_IDX_COUNT > 1) {
+        TEST_ASSERT_FALSE(perf_fch_domain_is_selected(0));
+    }
+}
+#endif
+
 int scmi_perf_fch_test_main(void)
 {
     UNITY_BEGIN();
@@ -554,6 +595,10 @@ int scmi_perf_fch_test_main(void)
 
     RUN_TEST(utest_perf_fch_init_success);
 
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    RUN_TEST(utest_perf_fch_doorbell_selects_domain);
+#endif
+
     return UNITY_END();
 }
 
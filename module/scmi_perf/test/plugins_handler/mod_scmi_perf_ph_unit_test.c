@@ -43,6 +43,9 @@ static int plugin_api_num_calls;
 static int plugin_update_num_calls;
 static struct perf_plugins_dev_ctx test_dev_ctx[DVFS_ELEMENT_IDX_COUNT];
 
+/* Plugins API table, which the tests must not leave pointing to their stack */
+static struct perf_plugins_api *test_plugins_api_table[PERF_PLUGIN_IDX_COUNT];
+
 /*
  * Helper to allocate plugins-handler's own memory
  */
@@ -55,6 +58,8 @@ static void malloc_perf_plugins_alloc_tables(
     table->adj_max_limit = malloc(count * sizeof(uint32_t));
     table->min_limit = malloc(count * sizeof(uint32_t));
     table->adj_min_limit = malloc(count * sizeof(uint32_t));
+    table->hint_level = malloc(count * sizeof(uint32_t));
+    table->hint_utilization = malloc(count * sizeof(uint32_t));
 
     fwk_mm_calloc_ExpectAndReturn(count, sizeof(uint32_t), table->level);
 
@@ -65,6 +70,10 @@ static void malloc_perf_plugins_alloc_tables(
     fwk_mm_calloc_ExpectAndReturn(count, sizeof(uint32_t), table->min_limit);
     fwk_mm_calloc_ExpectAndReturn(
         count, sizeof(uint32_t), table->adj_min_limit);
+
+    fwk_mm_calloc_ExpectAndReturn(count, sizeof(uint32_t), table->hint_level);
+    fwk_mm_calloc_ExpectAndReturn(
+        count, sizeof(uint32_t), table->hint_utilization);
 }
 
 /*
@@ -78,6 +87,8 @@ static void dealloc_perf_plugins_alloc_tables(
     free(table->adj_max_limit);
     free(table->min_limit);
     free(table->adj_min_limit);
+    free(table->hint_level);
+    free(table->hint_utilization);
 }
 
 /*
@@ -92,6 +103,8 @@ static void malloc_dev_ctx_tables(
     table->adj_max_limit = malloc(count * sizeof(uint32_t));
     table->min_limit = malloc(count * sizeof(uint32_t));
     table->adj_min_limit = malloc(count * sizeof(uint32_t));
+    table->hint_level = calloc(count, sizeof(uint32_t));
+    table->hint_utilization = calloc(count, sizeof(uint32_t));
 }
 
 static void free_dev_ctx_tables(struct perf_plugins_perf_update *table)
@@ -101,6 +114,8 @@ static void free_dev_ctx_tables(struct perf_plugins_perf_update *table)
     free(table->adj_max_limit);
     free(table->min_limit);
     free(table->adj_min_limit);
+    free(table->hint_level);
+    free(table->hint_utilization);
 }
 
 static void domain_aggregate_malloc(
@@ -112,19 +127,21 @@ static void domain_aggregate_malloc(
     this_dom->level = &test_dev_ctx[0].perf_table.level[0];
     this_dom->max_limit = &test_dev_ctx[0].perf_table.max_limit[0];
     this_dom->min_limit = &test_dev_ctx[0].perf_table.min_limit[0];
+    this_dom->hint_level = &test_dev_ctx[0].perf_table.hint_level[0];
+    this_dom->hint_utilization =
+        &test_dev_ctx[0].perf_table.hint_utilization[0];
 
     phy_dom->level = &test_dev_ctx[0].perf_table.level[1];
     phy_dom->max_limit = &test_dev_ctx[0].perf_table.max_limit[1];
     phy_dom->min_limit = &test_dev_ctx[0].perf_table.min_limit[1];
+    phy_dom->hint_level = &test_dev_ctx[0].perf_table.hint_level[1];
+    phy_dom->hint_utilization =
+        &test_dev_ctx[0].perf_table.hint_utilization[1];
 }
 
 static void domain_aggregate_free(void)
 {
-    free(test_dev_ctx[0].perf_table.level);
-    free(test_dev_ctx[0].perf_table.max_limit);
-    free(test_dev_ctx[0].perf_table.adj_max_limit);
-    free(test_dev_ctx[0].perf_table.min_limit);
-    free(test_dev_ctx[0].perf_table.adj_min_limit);
+    free_dev_ctx_tables(&test_dev_ctx[0].perf_table);
 }
 
 void setUp(void)
@@ -138,6 +155,8 @@ void setUp(void)
     perf_config.plugins_count = FWK_ARRAY_SIZE(plugins_table);
 
     perf_fch_ctx.api_fch_stub = &api_perf_stub;
+
+    perf_plugins_ctx.plugins_api_table = &test_plugins_api_table[0];
 }
 
 void tearDown(void)
@@ -442,13 +461,12 @@ void utest_perf_plugins_handler_bind_success_no_plugins(void)
 
 void utest_perf_plugins_handler_bind_success(void)
 {
-    struct perf_plugins_api plugins_api_table[PERF_PLUGIN_IDX_COUNT];
     int status;
 
     fwk_mm_calloc_ExpectAndReturn(
         perf_config.plugins_count,
         sizeof(struct perf_plugins_api *),
-        &plugins_api_table);
+        &test_plugins_api_table);
 
     fwk_id_get_module_idx_ExpectAndReturn(
         plugins_table[0].id, FWK_MODULE_IDX_PERF_PLUGIN);
@@ -461,13 +479,12 @@ void utest_perf_plugins_handler_bind_success(void)
 
 void utest_perf_plugins_handler_bind_fail(void)
 {
-    struct perf_plugins_api plugins_api_table[PERF_PLUGIN_IDX_COUNT];
     int status;
 
     fwk_mm_calloc_ExpectAndReturn(
         perf_config.plugins_count,
         sizeof(struct perf_plugins_api *),
-        &plugins_api_table);
+        &test_plugins_api_table);
 
     fwk_id_get_module_idx_ExpectAndReturn(
         plugins_table[0].id, FWK_MODULE_IDX_PERF_PLUGIN);
@@ -733,6 +750,37 @@ void utest_domain_aggregate_test_policy_min_limit_down(void)
     domain_aggregate_free();
 }
 
+/*
+ * The aggregation policy for the hints is: MAX(logical-domains), for both the
+ * expected level and the utilization.
+ */
+void utest_domain_aggregate_test_policy_hints(void)
+{
+    struct perf_plugins_perf_update this_dom;
+    struct perf_plugins_perf_update phy_dom;
+
+    domain_aggregate_malloc(&this_dom, &phy_dom);
+
+    this_dom.level[0] = 5;
+    this_dom.max_limit[0] = 10;
+    this_dom.min_limit[0] = 1;
+    this_dom.hint_level[0] = 8;
+    this_dom.hint_utilization[0] = 40;
+
+    phy_dom.level[0] = 5;
+    phy_dom.max_limit[0] = 10;
+    phy_dom.min_limit[0] = 1;
+    phy_dom.hint_level[0] = 6;
+    phy_dom.hint_utilization[0] = 70;
+
+    domain_aggregate(&this_dom, &phy_dom);
+
+    TEST_ASSERT_EQUAL(phy_dom.hint_level[0], 8);
+    TEST_ASSERT_EQUAL(phy_dom.hint_utilization[0], 70);
+
+    domain_aggregate_free();
+}
+
 /*
  * When there are no plugins, only the domain aggregation takes place.
  * For the first logical domain, the storage-and-aggregation will populate the
@@ -889,6 +937,82 @@ void utest_perf_plugins_handler_update_no_plugins_last_log_dom(void)
     perf_config.plugins_count = PERF_PLUGIN_IDX_COUNT;
 }
 
+/*
+ * When there are no plugins, the level hinted by the agents raises the minimum
+ * limit of the domain, without going above its maximum limit.
+ */
+void utest_perf_plugins_handler_update_no_plugins_hint(void)
+{
+    struct perf_plugins_dev_ctx dev_ctx[DVFS_ELEMENT_IDX_COUNT];
+    struct fc_perf_update fc_update;
+    fwk_id_t dep_dom_id;
+    static const struct {
+        uint32_t hint_level;
+        uint32_t adj_min_limit;
+    } hints[] = {
+        /* No hinted level */
+        { 0, 2 },
+        /* Hinted level within the limits */
+        { 8, 8 },
+        /* Hinted level above the maximum limit */
+        { 20, 10 },
+    };
+
+    memset(&dev_ctx[0], 0, sizeof(dev_ctx[0]) * DVFS_ELEMENT_IDX_COUNT);
+    perf_plugins_ctx.dev_ctx = &dev_ctx[0];
+
+    malloc_dev_ctx_tables(2, &dev_ctx[DVFS_ELEMENT_IDX_0].perf_table);
+    malloc_dev_ctx_tables(
+        DVFS_ELEMENT_IDX_COUNT, &perf_plugins_ctx.full_perf_table);
+
+    perf_config.plugins_count = 0;
+
+    dev_ctx[DVFS_ELEMENT_IDX_0].log_dom_count = 1;
+
+    dep_dom_id = FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_DVFS, DVFS_ELEMENT_IDX_0, 0);
+    dev_ctx[DVFS_ELEMENT_IDX_0].perf_table.domain_id = dep_dom_id;
+
+    for (size_t i = 0; i < FWK_ARRAY_SIZE(hints); i++) {
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+
+        fc_update = (struct fc_perf_update){
+            .domain_id = dep_dom_id,
+            .level = 5,
+            .max_limit = 10,
+            .min_limit = 2,
+            .hint_utilization = 50,
+            .hint_level = hints[i].hint_level,
+        };
+
+        perf_plugins_handler_update(SCMI_PERF_ELEMENT_IDX_0, &fc_update);
+
+        TEST_ASSERT_EQUAL(
+            dev_ctx[DVFS_ELEMENT_IDX_0].lmin, hints[i].adj_min_limit);
+
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+
+        perf_plugins_handler_get(SCMI_PERF_ELEMENT_IDX_0, &fc_update);
+
+        TEST_ASSERT_EQUAL(fc_update.level, 5);
+        TEST_ASSERT_EQUAL(fc_update.adj_max_limit, 10);
+        TEST_ASSERT_EQUAL(fc_update.adj_min_limit, hints[i].adj_min_limit);
+    }
+
+    free_dev_ctx_tables(&dev_ctx[DVFS_ELEMENT_IDX_0].perf_table);
+    free_dev_ctx_tables(&perf_plugins_ctx.full_perf_table);
+
+    perf_config.plugins_count = PERF_PLUGIN_IDX_COUNT;
+}
+
 /*
  * Where there are plugins, there can be logical domains.
  * In this case, the plugins-handler will wait until the last logical domain has
@@ -1036,6 +1160,198 @@ void utest_perf_plugins_handler_update_phy_domain_success(void)
     free_dev_ctx_tables(&perf_plugins_ctx.full_perf_table);
 }
 
+static int perf_plugin_update_hints_cback(
+    struct perf_plugins_perf_update *data,
+    int cmock_num_calls)
+{
+    TEST_ASSERT_EQUAL(data->hint_level[0], 800);
+    TEST_ASSERT_EQUAL(data->hint_utilization[0], 90);
+
+    /* Test that the tables are correclty assigned */
+    TEST_ASSERT_EQUAL(
+        data->hint_level, &test_dev_ctx[0].perf_table.hint_level[1]);
+    TEST_ASSERT_EQUAL(
+        data->hint_utilization,
+        &test_dev_ctx[0].perf_table.hint_utilization[1]);
+
+    /* Pretend to pre-boost the domain to the expected level */
+    data->adj_min_limit[0] = data->hint_level[0];
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Here we test that the hints of an agent are provided to the plugin for one
+ * single physical domain, and that the plugin can act upon them.
+ */
+void utest_perf_plugins_handler_update_phy_domain_hints(void)
+{
+    struct fc_perf_update fc_update;
+    fwk_id_t dep_dom_id;
+    fwk_id_t dep_id_table[DVFS_ELEMENT_IDX_COUNT];
+
+    memset(
+        &test_dev_ctx[0], 0, sizeof(test_dev_ctx[0]) * DVFS_ELEMENT_IDX_COUNT);
+    perf_plugins_ctx.dev_ctx = &test_dev_ctx[0];
+    test_dev_ctx[0].log_dom_count = 1;
+    perf_plugins_ctx.dep_id_table = &dep_id_table[0];
+
+    for (size_t i = 0; i < DVFS_ELEMENT_IDX_COUNT; i++) {
+        malloc_dev_ctx_tables(2, &test_dev_ctx[i].perf_table);
+
+        test_dev_ctx[i].perf_table.domain_id =
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, i);
+    }
+    malloc_dev_ctx_tables(2, &perf_plugins_ctx.full_perf_table);
+
+    perf_config.plugins_count = PERF_PLUGIN_IDX_COUNT;
+    dep_dom_id = FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_DVFS, DVFS_ELEMENT_IDX_0, 0);
+    perf_plugins_ctx.dep_id_table[0] = dep_dom_id;
+
+    fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+    fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+    fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+    fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+
+    fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+    fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+    fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+
+    fwk_id_get_element_idx_ExpectAndReturn(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, 0), 0);
+
+    fc_update = (struct fc_perf_update){
+        .domain_id = dep_dom_id,
+        .level = 500,
+        .max_limit = 1000,
+        .min_limit = 100,
+        .hint_utilization = 90,
+        .hint_level = 800,
+    };
+
+    perf_plugins_ctx.plugins_api_table[0] = &test_perf_plugins_api;
+    plugin_update_Stub(perf_plugin_update_hints_cback);
+
+    perf_plugins_handler_update(0, &fc_update);
+
+    /* Test that the full table holds the hints of the physical domain */
+    TEST_ASSERT_EQUAL(perf_plugins_ctx.full_perf_table.hint_level[0], 800);
+    TEST_ASSERT_EQUAL(
+        perf_plugins_ctx.full_perf_table.hint_utilization[0], 90);
+
+    /* Test that the pre-boost has been reflected in the internal storage */
+    TEST_ASSERT_EQUAL(test_dev_ctx[0].lmin, 800);
+
+    plugin_update_Stub(NULL);
+
+    for (size_t i = 0; i < DVFS_ELEMENT_IDX_COUNT; i++) {
+        free_dev_ctx_tables(&test_dev_ctx[i].perf_table);
+    }
+    free_dev_ctx_tables(&perf_plugins_ctx.full_perf_table);
+}
+
+static int perf_plugin_update_cap_cback(
+    struct perf_plugins_perf_update *data,
+    int cmock_num_calls)
+{
+    /* Cap the domain without acting upon the hints */
+    data->adj_max_limit[0] = 600;
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * When there are plugins, the level hinted by the agents raises the minimum
+ * limit of the domain once the plugins have adjusted the limits, without going
+ * above the adjusted maximum limit.
+ */
+void utest_perf_plugins_handler_update_phy_domain_hint_floor(void)
+{
+    struct fc_perf_update fc_update;
+    fwk_id_t dep_dom_id;
+    fwk_id_t dep_id_table[DVFS_ELEMENT_IDX_COUNT];
+    static const struct {
+        uint32_t hint_level;
+        uint32_t adj_min_limit;
+    } hints[] = {
+        /* No hinted level */
+        { 0, 100 },
+        /* Hinted level within the adjusted limits */
+        { 400, 400 },
+        /* Hinted level above the adjusted maximum limit */
+        { 800, 600 },
+    };
+
+    memset(
+        &test_dev_ctx[0], 0, sizeof(test_dev_ctx[0]) * DVFS_ELEMENT_IDX_COUNT);
+    perf_plugins_ctx.dev_ctx = &test_dev_ctx[0];
+    test_dev_ctx[0].log_dom_count = 1;
+    perf_plugins_ctx.dep_id_table = &dep_id_table[0];
+
+    for (size_t i = 0; i < DVFS_ELEMENT_IDX_COUNT; i++) {
+        malloc_dev_ctx_tables(2, &test_dev_ctx[i].perf_table);
+
+        test_dev_ctx[i].perf_table.domain_id =
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, i);
+    }
+    malloc_dev_ctx_tables(2, &perf_plugins_ctx.full_perf_table);
+
+    perf_config.plugins_count = PERF_PLUGIN_IDX_COUNT;
+    dep_dom_id = FWK_ID_SUB_ELEMENT(FWK_MODULE_IDX_DVFS, DVFS_ELEMENT_IDX_0, 0);
+    perf_plugins_ctx.dep_id_table[0] = dep_dom_id;
+
+    perf_plugins_ctx.plugins_api_table[0] = &test_perf_plugins_api;
+    plugin_update_Stub(perf_plugin_update_cap_cback);
+
+    for (size_t i = 0; i < FWK_ARRAY_SIZE(hints); i++) {
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_element_idx_ExpectAndReturn(dep_dom_id, DVFS_ELEMENT_IDX_0);
+        fwk_id_get_sub_element_idx_ExpectAndReturn(dep_dom_id, 0);
+
+        fwk_id_get_element_idx_ExpectAndReturn(
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, 0), 0);
+
+        if (hints[i].hint_level != 0) {
+            /* The raised minimum limit is written back */
+            fwk_id_get_element_idx_ExpectAndReturn(
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_DVFS, 0), 0);
+        }
+
+        fc_update = (struct fc_perf_update){
+            .domain_id = dep_dom_id,
+            .level = 500,
+            .max_limit = 1000,
+            .min_limit = 100,
+            .hint_utilization = 50,
+            .hint_level = hints[i].hint_level,
+        };
+
+        perf_plugins_handler_update(0, &fc_update);
+
+        TEST_ASSERT_EQUAL(test_dev_ctx[0].lmax, 600);
+        TEST_ASSERT_EQUAL(test_dev_ctx[0].lmin, hints[i].adj_min_limit);
+        TEST_ASSERT_EQUAL(
+            perf_plugins_ctx.full_perf_table.adj_min_limit[0],
+            hints[i].adj_min_limit);
+    }
+
+    plugin_update_Stub(NULL);
+
+    for (size_t i = 0; i < DVFS_ELEMENT_IDX_COUNT; i++) {
+        free_dev_ctx_tables(&test_dev_ctx[i].perf_table);
+    }
+    free_dev_ctx_tables(&perf_plugins_ctx.full_perf_table);
+}
+
 /*
  * Below we test the `update` function for the first logical domain.
  * No plugins are called, but internal data is set to initial predefined values.
@@ -1188,6 +1504,8 @@ void utest_perf_plugins_handler_update_log_domains_last_log_dom(void)
     fc_update.level = 6;
     fc_update.max_limit = 9;
     fc_update.min_limit = 4;
+    fc_update.hint_utilization = 0;
+    fc_update.hint_level = 0;
     fc_update.domain_id = dep_dom_id;
 
     plugins_table[PERF_PLUGIN_IDX_0].dom_type = PERF_PLUGIN_DOM_TYPE_LOGICAL;
@@ -1543,6 +1861,37 @@ void utest_plugin_set_limits_valid_limits(void)
     TEST_ASSERT_EQUAL(status, FWK_SUCCESS);
 }
 
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+/*
+ * Test that a doorbell on the first logical domain of a physical domain
+ * selects every domain, as the plugins handler expects all the logical domains
+ * and the last domain to be processed in each pass.
+ */
+void utest_perf_fch_doorbell_selects_all_domains(void)
+{
+    struct scmi_perf_domain_ctx domain_ctx_table[SCMI_PERF_ELEMENT_IDX_COUNT];
+    unsigned int i;
+
+    memset(domain_ctx_table, 0, sizeof(domain_ctx_table));
+    scmi_perf_ctx.domain_ctx_table = domain_ctx_table;
+    perf_fch_ctx.supports_fast_channel = true;
+    perf_fch_ctx.poll_pending = false;
+    perf_fch_ctx.pending_req_count = 0;
+
+    /* Only the first of the logical domains of DVFS_ELEMENT_IDX_1 rings */
+    __fwk_put_event_light_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    fast_channel_doorbell_callback(
+        (uintptr_t)&domain_ctx_table[SCMI_PERF_ELEMENT_IDX_1]);
+
+    perf_fch_select_domains();
+
+    TEST_ASSERT_FALSE(domain_ctx_table[SCMI_PERF_ELEMENT_IDX_1].fch_pending);
+    for (i = 0; i < SCMI_PERF_ELEMENT_IDX_COUNT; i++) {
+        TEST_ASSERT_TRUE(perf_fch_domain_is_selected(i));
+    }
+}
+#endif
+
 int scmi_perf_ph_test_main(void)
 {
     UNITY_BEGIN();
@@ -1566,12 +1915,16 @@ int scmi_perf_ph_test_main(void)
     RUN_TEST(utest_domain_aggregate_test_policy_max_limit_down);
     RUN_TEST(utest_domain_aggregate_test_policy_min_limit_up);
     RUN_TEST(utest_domain_aggregate_test_policy_min_limit_down);
+    RUN_TEST(utest_domain_aggregate_test_policy_hints);
 
     RUN_TEST(utest_perf_plugins_handler_update_no_plugins_first_log_dom);
     RUN_TEST(utest_perf_plugins_handler_update_no_plugins_last_log_dom);
+    RUN_TEST(utest_perf_plugins_handler_update_no_plugins_hint);
     RUN_TEST(utest_perf_plugins_handler_update_no_last_log_domain);
 
     RUN_TEST(utest_perf_plugins_handler_update_phy_domain_success);
+    RUN_TEST(utest_perf_plugins_handler_update_phy_domain_hints);
+    RUN_TEST(utest_perf_plugins_handler_update_phy_domain_hint_floor);
     RUN_TEST(utest_perf_plugins_handler_update_log_domains_first_log_dom);
     RUN_TEST(utest_perf_plugins_handler_update_log_domains_last_log_dom);
     RUN_TEST(utest_perf_plugins_handler_update_type_full_domains);
@@ -1592,6 +1945,10 @@ int scmi_perf_ph_test_main(void)
     RUN_TEST(utest_perf_eval_performance_new_limits_level_up);
     RUN_TEST(utest_perf_eval_performance_new_limits_level_down);
 
+#ifdef BUILD_HAS_MOD_TRANSPORT_FC
+    RUN_TEST(utest_perf_fch_doorbell_selects_all_domains);
+#endif
+
     return UNITY_END();
 }
 
@@ -432,9 +432,44 @@ int get_nth_opp_callback(
     return FWK_SUCCESS;
 }
 
+static struct scmi_perf_level test_levels[TEST_OPP_COUNT];
+
+static struct perf_opp_table test_opp_table = {
+    .opp_count = TEST_OPP_COUNT,
+};
+
+static struct scmi_perf_domain_ctx test_domain_ctx = {
+    .opp_table = &test_opp_table,
+};
+
+/*
+ * Build the level table of the test domain from the DVFS configuration, as
+ * done at start.
+ */
+static void describe_levels_build_level_tables(void)
+{
+    int status;
+    uint16_t latency = test_dvfs_config.latency;
+
+    scmi_perf_ctx.opp_table = &test_opp_table;
+    scmi_perf_ctx.dvfs_doms_count = 1;
+    scmi_perf_ctx.domain_ctx_table = &test_domain_ctx;
+
+    mod_dvfs_domain_api_get_latency_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+    mod_dvfs_domain_api_get_latency_ReturnThruPtr_latency(&latency);
+
+    fwk_mm_calloc_ExpectAndReturn(
+        TEST_OPP_COUNT, sizeof(struct scmi_perf_level), test_levels);
+
+    mod_dvfs_domain_api_get_nth_opp_Stub(get_nth_opp_callback);
+
+    status = build_level_tables();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
 /*
- * Check that each of the returned levels is correct. Also, check that the
- * final returned status and number of levels is correct.
+ * Check that the returned levels are correct and copied at once. Also,
+ * check that the final returned status and number of levels is correct.
  */
 int describe_levels_handler_valid_param_write_payload_callback(
     fwk_id_t service_id,
@@ -443,20 +478,27 @@ int describe_levels_handler_valid_param_write_payload_callback(
     size_t size,
     int NumCalls)
 {
-    if (NumCalls < TEST_OPP_COUNT) {
-        struct scmi_perf_level *returned_perf_level =
-            (struct scmi_perf_level *)payload;
+    if (NumCalls == 0) {
+        const struct scmi_perf_level *returned_perf_level =
+            (const struct scmi_perf_level *)payload;
 
         TEST_ASSERT_EQUAL(
-            test_dvfs_config.opps[NumCalls].voltage,
-            returned_perf_level->power_cost);
-        TEST_ASSERT_EQUAL(
-            test_dvfs_config.opps[NumCalls].level,
-            returned_perf_level->performance_level);
+            sizeof(struct scmi_perf_describe_levels_p2a), offset);
         TEST_ASSERT_EQUAL(
-            test_dvfs_config.latency, returned_perf_level->attributes);
-
-    } else if (NumCalls == TEST_OPP_COUNT) {
+            TEST_OPP_COUNT * sizeof(struct scmi_perf_level), size);
+
+        for (unsigned int i = 0; i < TEST_OPP_COUNT; i++) {
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.opps[i].voltage,
+                returned_perf_level[i].power_cost);
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.opps[i].level,
+                returned_perf_level[i].performance_level);
+            TEST_ASSERT_EQUAL(
+                test_dvfs_config.latency, returned_perf_level[i].attributes);
+        }
+
+    } else if (NumCalls == 1) {
         struct scmi_perf_describe_levels_p2a *return_values =
             (struct scmi_perf_describe_levels_p2a *)payload;
         TEST_ASSERT_EQUAL(SCMI_SUCCESS, return_values->status);
@@ -482,8 +524,8 @@ void utest_scmi_perf_describe_levels_handler_valid_param(void)
     };
 
     size_t size = UINT16_MAX;
-    size_t opp_count = TEST_OPP_COUNT;
-    uint16_t latency = test_dvfs_config.latency;
+
+    describe_levels_build_level_tables();
 
     /*
      * Return an arbitrarily large max_payload_size as we are just testing
@@ -493,14 +535,6 @@ void utest_scmi_perf_describe_levels_handler_valid_param(void)
         FWK_SUCCESS);
     mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
 
-    mod_dvfs_domain_api_get_opp_count_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_opp_count_ReturnThruPtr_opp_count(&opp_count);
-
-    mod_dvfs_domain_api_get_latency_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_latency_ReturnThruPtr_latency(&latency);
-
-    mod_dvfs_domain_api_get_nth_opp_Stub(get_nth_opp_callback);
-
     mod_scmi_from_protocol_api_write_payload_Stub(
         describe_levels_handler_valid_param_write_payload_callback);
 
@@ -588,15 +622,13 @@ void utest_scmi_perf_describe_levels_handler_invalid_level_index(void)
     };
 
     size_t size = UINT16_MAX;
-    size_t opp_count = TEST_OPP_COUNT;
+
+    scmi_perf_ctx.domain_ctx_table = &test_domain_ctx;
 
     mod_scmi_from_protocol_api_get_max_payload_size_ExpectAnyArgsAndReturn(
         FWK_SUCCESS);
     mod_scmi_from_protocol_api_get_max_payload_size_ReturnThruPtr_size(&size);
 
-    mod_dvfs_domain_api_get_opp_count_ExpectAnyArgsAndReturn(FWK_SUCCESS);
-    mod_dvfs_domain_api_get_opp_count_ReturnThruPtr_opp_count(&opp_count);
-
     mod_scmi_from_protocol_api_respond_Stub(
         describe_levels_handler_invalid_level_index_respond_callback);
 
@@ -775,6 +807,116 @@ void utest_scmi_perf_describe_fast_channels_invalid_message_id(void)
  * Test the find_opp_for_level function with a valid level, without
  * use_nearest.
  */
+int level_get_handler_cached_level_respond_callback(
+    fwk_id_t service_id,
+    const void *payload,
+    size_t size,
+    int NumCalls)
+{
+    struct scmi_perf_level_get_p2a *return_values;
+    return_values = (struct scmi_perf_level_get_p2a *)payload;
+
+    TEST_ASSERT_EQUAL(sizeof(*return_values), size);
+    TEST_ASSERT_EQUAL((int32_t)SCMI_SUCCESS, return_values->status);
+    TEST_ASSERT_EQUAL(
+        scmi_perf_ctx.domain_ctx_table[0].curr_level,
+        return_values->performance_level);
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Test that PERFORMANCE_LEVEL_GET is answered from the cached level without
+ * requesting it from DVFS.
+ */
+void utest_scmi_perf_level_get_handler_cached_level(void)
+{
+    int status;
+    struct scmi_perf_domain_ctx domain0_ctx = {
+        .curr_level = 2000,
+        .level_valid = true,
+    };
+    fwk_id_t service_id =
+        FWK_ID_ELEMENT_INIT(TEST_MODULE_IDX, TEST_SCMI_AGENT_IDX_0);
+    struct scmi_perf_level_get_a2p payload = {
+        .domain_id = 0,
+    };
+
+    scmi_perf_ctx.domain_ctx_table = &domain0_ctx;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+    mod_scmi_from_protocol_api_respond_Stub(
+        level_get_handler_cached_level_respond_callback);
+
+    status = to_protocol_api->message_handler(
+        (fwk_id_t)MOD_SCMI_PROTOCOL_ID_PERF,
+        service_id,
+        (const uint32_t *)&payload,
+        payload_size_table[MOD_SCMI_PERF_LEVEL_GET],
+        MOD_SCMI_PERF_LEVEL_GET);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void utest_scmi_perf_level_api_get_level_cached(void)
+{
+    int status;
+    uint32_t level = 0;
+    struct scmi_perf_domain_ctx domain0_ctx = {
+        .curr_level = 2000,
+        .level_valid = true,
+    };
+
+    scmi_perf_ctx.domain_ctx_table = &domain0_ctx;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = scmi_perf_level_api.get_level(TEST_SCMI_AGENT_IDX_0, 0, &level);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(2000, level);
+}
+
+void utest_scmi_perf_level_api_get_level_unknown(void)
+{
+    int status;
+    uint32_t level = 0;
+    struct scmi_perf_domain_ctx domain0_ctx = {
+        .level_valid = false,
+    };
+
+    scmi_perf_ctx.domain_ctx_table = &domain0_ctx;
+
+    fwk_id_get_element_idx_ExpectAnyArgsAndReturn(0);
+
+    status = scmi_perf_level_api.get_level(TEST_SCMI_AGENT_IDX_0, 0, &level);
+
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+}
+
+void utest_scmi_perf_level_api_invalid_domain(void)
+{
+    int status;
+    uint32_t level;
+
+    status = scmi_perf_level_api.get_level(
+        TEST_SCMI_AGENT_IDX_0, scmi_perf_ctx.domain_count, &level);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = scmi_perf_level_api.set_level(
+        TEST_SCMI_AGENT_IDX_0, scmi_perf_ctx.domain_count, 0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+void utest_scmi_perf_level_api_set_hint_no_plugins_handler(void)
+{
+    int status;
+
+    /* The hints are only consumed by the performance plugins */
+    status = scmi_perf_level_api.set_hint(TEST_SCMI_AGENT_IDX_0, 0, 50, 0);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+}
+
 void utest_find_opp_for_level_valid_level(void)
 {
     int status;
@@ -1022,6 +1164,12 @@ int scmi_perf_protocol_ops_test_main(void)
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_domain_id);
     RUN_TEST(utest_scmi_perf_describe_levels_handler_invalid_level_index);
 
+    RUN_TEST(utest_scmi_perf_level_get_handler_cached_level);
+    RUN_TEST(utest_scmi_perf_level_api_get_level_cached);
+    RUN_TEST(utest_scmi_perf_level_api_get_level_unknown);
+    RUN_TEST(utest_scmi_perf_level_api_invalid_domain);
+    RUN_TEST(utest_scmi_perf_level_api_set_hint_no_plugins_handler);
+
 #ifdef BUILD_HAS_SCMI_PERF_FAST_CHANNELS
     RUN_TEST(utest_scmi_perf_describe_fast_channels_valid_params);
     RUN_TEST(utest_scmi_perf_describe_fast_channels_invalid_domain_id);
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -45,6 +45,56 @@ struct mod_scmi_pd_config {
 };
 #endif
 
+/*!
+ * \brief SCMI Power Domain APIs.
+ */
+enum mod_scmi_pd_api_idx {
+    /*! Index of the SCMI protocol API */
+    MOD_SCMI_PD_PROTOCOL_API,
+
+    /*! Index of the power state API */
+    MOD_SCMI_PD_STATE_API,
+
+    /*! Number of APIs */
+    MOD_SCMI_PD_API_COUNT,
+};
+
+/*!
+ * \brief SCMI Power Domain state API.
+ *
+ * \details API used by vendor protocols to set the power state of a domain on
+ *      behalf of an agent. The requests go through the same permission checks
+ *      and policy handler as the POWER_STATE_SET message.
+ */
+struct mod_scmi_pd_state_api {
+    /*!
+     * \brief Set the power state of a power domain.
+     *
+     * \details The request is asynchronous, the function returns once the
+     *      request has been submitted to the power domain module. Only the
+     *      domains that accept asynchronous POWER_STATE_SET messages are
+     *      supported, cluster and debug device domains are rejected.
+     *
+     * \param service_id Identifier of the service of the agent.
+     * \param domain_id SCMI power domain identifier.
+     * \param power_state Requested power state, in the format of the
+     *      POWER_STATE_SET message.
+     *
+     * \retval ::FWK_SUCCESS The request was submitted.
+     * \retval ::FWK_E_PARAM The domain does not exist.
+     * \retval ::FWK_E_DATA The power state is not valid.
+     * \retval ::FWK_E_ACCESS The agent is not allowed to set the state.
+     * \retval ::FWK_E_SUPPORT The domain is a cluster or a debug device, which
+     *      only accept synchronous requests, or the agent is not allowed to
+     *      manage this type of domain.
+     * \return One of the standard framework error codes.
+     */
+    int (*set_state)(
+        fwk_id_t service_id,
+        uint32_t domain_id,
+        uint32_t power_state);
+};
+
 /*!
  * \defgroup GroupScmiPowerPolicyHandlers Policy Handlers
  *
@@ -38,8 +38,36 @@
 #    include <mod_debug.h>
 #endif
 
+#ifdef BUILD_HAS_DEBUGGER
+#    include <cli.h>
+
+#    include <string.h>
+#endif
+
 #define MOD_SCMI_PD_NOTIFICATION_COUNT 2
 
+/*
+ * Maximum number of synchronous POWER_STATE_SET requests waiting for the
+ * operation in progress on a power domain to complete. Requests received when
+ * this limit is reached are rejected with BUSY.
+ */
+#define MOD_SCMI_PD_PENDING_REQUEST_COUNT 3
+
+/* Synchronous request waiting for a power domain to become idle */
+struct scmi_pd_pending_request {
+    /* Service identifier of the requesting agent */
+    fwk_id_t service_id;
+
+    /* Identifier of the requesting agent */
+    unsigned int agent_id;
+
+    /* Identifier of the event handling the request */
+    fwk_id_t event_id;
+
+    /* Requested power state */
+    uint32_t power_state;
+};
+
 struct scmi_pd_operations {
     /*
      * Service identifier currently requesting operation.
@@ -49,6 +77,29 @@ struct scmi_pd_operations {
 
     /* Track agent requesting the pd operation */
     unsigned int agent_id;
+
+    /* Requests to issue once the operation in progress has completed */
+    struct scmi_pd_pending_request pending[MOD_SCMI_PD_PENDING_REQUEST_COUNT];
+
+    /* Index of the oldest request in the pending table */
+    unsigned int pending_head;
+
+    /* Number of requests in the pending table */
+    unsigned int pending_count;
+
+#ifdef BUILD_HAS_DEBUGGER
+    /* Number of synchronous POWER_STATE_SET requests received */
+    uint32_t set_count;
+
+    /* Number of requests which had to wait for the domain to become idle */
+    uint32_t queued_count;
+
+    /* Number of requests rejected with BUSY */
+    uint32_t busy_count;
+
+    /* Highest number of requests in the pending table */
+    unsigned int pending_high_water;
+#endif
 };
 
 struct mod_scmi_pd_ctx {
@@ -249,6 +300,95 @@ static void ops_set_idle(fwk_id_t pd_id)
     scmi_pd_ctx.ops[pd_idx].service_id = FWK_ID_NONE;
 }
 
+static bool ops_enqueue(
+    fwk_id_t pd_id,
+    const struct scmi_pd_pending_request *request)
+{
+    struct scmi_pd_operations *ops =
+        &scmi_pd_ctx.ops[fwk_id_get_element_idx(pd_id)];
+    unsigned int slot;
+
+    if (ops->pending_count == MOD_SCMI_PD_PENDING_REQUEST_COUNT) {
+        return false;
+    }
+
+    slot = (ops->pending_head + ops->pending_count) %
+        MOD_SCMI_PD_PENDING_REQUEST_COUNT;
+    ops->pending[slot] = *request;
+    ops->pending_count++;
+
+#ifdef BUILD_HAS_DEBUGGER
+    ops->queued_count++;
+    if (ops->pending_count > ops->pending_high_water) {
+        ops->pending_high_water = ops->pending_count;
+    }
+#endif
+
+    return true;
+}
+
+/*
+ * Start a synchronous request on an idle power domain. The request is handled
+ * in the scmi_pd context and the agent is answered once it has completed.
+ */
+static int ops_issue(
+    fwk_id_t pd_id,
+    const struct scmi_pd_pending_request *request)
+{
+    int status;
+    struct event_request_params *event_params;
+    struct fwk_event event = {
+        .target_id = fwk_module_id_scmi_power_domain,
+        .id = request->event_id,
+    };
+
+    event_params = (struct event_request_params *)event.params;
+    event_params->pd_id = pd_id;
+    event_params->pd_power_state = request->power_state;
+
+    status = fwk_put_event(&event);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    ops_set_busy(pd_id, request->service_id);
+    ops_set_agent_id(pd_id, request->agent_id);
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Start the oldest request waiting for a power domain which has just become
+ * idle. Requests which cannot be started are answered with an error.
+ */
+static void ops_issue_pending(fwk_id_t pd_id)
+{
+    struct scmi_pd_operations *ops =
+        &scmi_pd_ctx.ops[fwk_id_get_element_idx(pd_id)];
+    struct scmi_pd_pending_request request;
+    struct scmi_pd_power_state_set_p2a return_values = {
+        .status = (int32_t)SCMI_GENERIC_ERROR,
+    };
+    int respond_status;
+
+    while (ops->pending_count > 0) {
+        request = ops->pending[ops->pending_head];
+        ops->pending_head =
+            (ops->pending_head + 1) % MOD_SCMI_PD_PENDING_REQUEST_COUNT;
+        ops->pending_count--;
+
+        if (ops_issue(pd_id, &request) == FWK_SUCCESS) {
+            return;
+        }
+
+        respond_status = scmi_pd_ctx.scmi_api->respond(
+            request.service_id, &return_values, sizeof(return_values.status));
+        if (respond_status != FWK_SUCCESS) {
+            FWK_LOG_DEBUG("[SCMI-power] %s @%d", __func__, __LINE__);
+        }
+    }
+}
+
 /*
  * Power domain management protocol implementation
  */
@@ -528,6 +668,7 @@ static int scmi_pd_power_state_set_handler(
     int32_t scmi_return;
     uint32_t power_state;
     enum mod_scmi_pd_policy_status policy_status;
+    struct scmi_pd_pending_request request;
     bool is_sync;
 
     scmi_params = (const struct scmi_pd_power_state_set_a2p *)payload;
@@ -604,37 +745,48 @@ static int scmi_pd_power_state_set_handler(
     }
 
     /* Sync request handling */
-    if (ops_is_busy(pd_id)) {
-        return_values.status = (int32_t)SCMI_BUSY;
-        int respond_status = scmi_pd_ctx.scmi_api->respond(
-            service_id, &return_values, sizeof(return_values.status));
-
-        if (respond_status != FWK_SUCCESS) {
-            FWK_LOG_DEBUG("[SCMI-power] %s @%d", __func__, __LINE__);
-        }
-        return FWK_E_BUSY;
-    }
-    ops_set_busy(pd_id, service_id);
-    ops_set_agent_id(pd_id, agent_idx);
-
-    /* Send the event to handle the request in the scmi_pd context */
-    struct fwk_event event = {
-        .target_id = fwk_module_id_scmi_power_domain,
-        .id = mod_scmi_pd_event_id_set_request,
+    request = (struct scmi_pd_pending_request){
+        .service_id = service_id,
+        .agent_id = agent_idx,
+        .event_id = mod_scmi_pd_event_id_set_request,
+        .power_state = power_state,
     };
 
 #ifdef BUILD_HAS_MOD_DEBUG
     if (pd_type == MOD_PD_TYPE_DEVICE_DEBUG) {
-        event.id = mod_scmi_pd_event_id_dbg_enable_set;
+        request.event_id = mod_scmi_pd_event_id_dbg_enable_set;
     }
 #endif
 
-    struct event_request_params *event_params;
+#ifdef BUILD_HAS_DEBUGGER
+    scmi_pd_ctx.ops[fwk_id_get_element_idx(pd_id)].set_count++;
+#endif
 
-    event_params = (struct event_request_params *)event.params;
-    event_params->pd_id = pd_id;
-    event_params->pd_power_state = power_state;
-    return fwk_put_event(&event);
+    if (!ops_is_busy(pd_id)) {
+        return ops_issue(pd_id, &request);
+    }
+
+    /*
+     * Another request is in progress on this domain. Requests to other domains
+     * are not held up by it. Wait for it to complete, unless too many requests
+     * are already waiting.
+     */
+    if (ops_enqueue(pd_id, &request)) {
+        return FWK_SUCCESS;
+    }
+
+#ifdef BUILD_HAS_DEBUGGER
+    scmi_pd_ctx.ops[fwk_id_get_element_idx(pd_id)].busy_count++;
+#endif
+
+    return_values.status = (int32_t)SCMI_BUSY;
+    status = scmi_pd_ctx.scmi_api->respond(
+        service_id, &return_values, sizeof(return_values.status));
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-power] %s @%d", __func__, __LINE__);
+    }
+
+    return FWK_E_BUSY;
 }
 
 static int scmi_pd_power_state_get_handler(fwk_id_t service_id,
@@ -978,6 +1130,82 @@ static int scmi_pd_permissions_handler(
 
 #endif
 
+/*
+ * Power state API
+ */
+static int scmi_pd_state_api_set_state(
+    fwk_id_t service_id,
+    uint32_t domain_id,
+    uint32_t power_state)
+{
+    struct scmi_pd_power_state_set_a2p scmi_params = {
+        .flags = SCMI_PD_POWER_STATE_SET_ASYNC_FLAG_MASK,
+        .domain_id = domain_id,
+        .power_state = power_state,
+    };
+    enum mod_scmi_pd_policy_status policy_status;
+    enum mod_pd_type pd_type;
+    unsigned int agent_idx;
+    fwk_id_t pd_id;
+    int32_t scmi_return;
+    int status;
+
+    scmi_return =
+        scmi_pd_power_state_set_parameters_check(&scmi_params, &pd_id);
+    if (scmi_return == (int32_t)SCMI_NOT_FOUND) {
+        return FWK_E_PARAM;
+    } else if (scmi_return != (int32_t)SCMI_SUCCESS) {
+        return FWK_E_DATA;
+    }
+
+#ifdef BUILD_HAS_MOD_RESOURCE_PERMS
+    status = scmi_pd_permissions_handler(
+        service_id,
+        (const uint32_t *)&scmi_params,
+        sizeof(scmi_params),
+        (unsigned int)MOD_SCMI_PD_POWER_STATE_SET,
+        &scmi_return);
+    if (status != FWK_SUCCESS) {
+        return (scmi_return == (int32_t)SCMI_DENIED) ? FWK_E_ACCESS :
+                                                       FWK_E_DEVICE;
+    }
+#endif
+
+    scmi_return = scmi_pd_power_state_set_type_check(
+        service_id, pd_id, &agent_idx, &pd_type);
+    if (scmi_return == (int32_t)SCMI_NOT_SUPPORTED) {
+        return FWK_E_SUPPORT;
+    } else if (scmi_return != (int32_t)SCMI_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+
+    /*
+     * Cluster and Device_debug pd types supports sync requests only. The
+     * caller is not told when a request completes, so they are rejected.
+     */
+    if ((pd_type == MOD_PD_TYPE_CLUSTER) ||
+        (pd_type == MOD_PD_TYPE_DEVICE_DEBUG)) {
+        return FWK_E_SUPPORT;
+    }
+
+    status = scmi_pd_power_state_set_policy(
+        &policy_status, &power_state, agent_idx, pd_id);
+    if (status != FWK_SUCCESS) {
+        return FWK_E_DEVICE;
+    }
+    if (policy_status == MOD_SCMI_PD_SKIP_MESSAGE_HANDLER) {
+        return FWK_SUCCESS;
+    }
+
+    status = scmi_pd_ctx.pd_api->set_state(pd_id, false, power_state);
+
+    return (status == FWK_SUCCESS) ? FWK_SUCCESS : FWK_E_DEVICE;
+}
+
+static const struct mod_scmi_pd_state_api scmi_pd_state_api = {
+    .set_state = scmi_pd_state_api_set_state,
+};
+
 /*
  * SCMI module -> SCMI power module interface
  */
@@ -1032,6 +1260,49 @@ static struct mod_scmi_to_protocol_api scmi_pd_mod_scmi_to_protocol_api = {
     .message_handler = scmi_pd_message_handler
 };
 
+#ifdef BUILD_HAS_DEBUGGER
+/*
+ * Debugger CLI command printing the POWER_STATE_SET counters of each domain.
+ */
+static const char scmi_pd_perf_call[] = "scmipdperf";
+static const char scmi_pd_perf_help[] =
+    "  Prints, for each power domain, the number of synchronous\n"
+    "  POWER_STATE_SET requests, how many had to wait for another request\n"
+    "  and how many were rejected with BUSY.\n"
+    "    Usage: scmipdperf [reset]";
+static int32_t scmi_pd_perf_f(int32_t argc, char **argv)
+{
+    struct scmi_pd_operations *ops;
+    unsigned int pd_idx;
+    bool reset = (argc > 1) && (strcmp(argv[1], "reset") == 0);
+
+    for (pd_idx = 0; pd_idx < scmi_pd_ctx.domain_count; pd_idx++) {
+        ops = &scmi_pd_ctx.ops[pd_idx];
+
+        if (reset) {
+            ops->set_count = 0;
+            ops->queued_count = 0;
+            ops->busy_count = 0;
+            ops->pending_high_water = ops->pending_count;
+        } else if (ops->set_count != 0) {
+            cli_printf(
+                NONE,
+                "Domain %u: %u requests, %u queued (high-water %u), "
+                "%u busy (%u%%)\n",
+                pd_idx,
+                (unsigned int)ops->set_count,
+                (unsigned int)ops->queued_count,
+                ops->pending_high_water,
+                (unsigned int)ops->busy_count,
+                (unsigned int)(
+                    (uint64_t)ops->busy_count * 100 / ops->set_count));
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Framework handlers
  */
@@ -1087,7 +1358,12 @@ static int scmi_pd_init(fwk_id_t module_id, unsigned int element_count,
         scmi_pd_ctx.ops[i].service_id = FWK_ID_NONE;
     }
 
+#ifdef BUILD_HAS_DEBUGGER
+    return cli_command_register((cli_command_st){
+        scmi_pd_perf_call, scmi_pd_perf_help, &scmi_pd_perf_f, false });
+#else
     return FWK_SUCCESS;
+#endif
 }
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
@@ -1166,15 +1442,60 @@ static int scmi_pd_bind(fwk_id_t id, unsigned int round)
 static int scmi_pd_process_bind_request(fwk_id_t source_id, fwk_id_t target_id,
                                         fwk_id_t api_id, const void **api)
 {
-    if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+    enum mod_scmi_pd_api_idx api_id_type =
+        (enum mod_scmi_pd_api_idx)fwk_id_get_api_idx(api_id);
+
+    switch (api_id_type) {
+    case MOD_SCMI_PD_PROTOCOL_API:
+        if (!fwk_id_is_equal(source_id, FWK_ID_MODULE(FWK_MODULE_IDX_SCMI))) {
+            return FWK_E_ACCESS;
+        }
+
+        *api = &scmi_pd_mod_scmi_to_protocol_api;
+        break;
+
+    case MOD_SCMI_PD_STATE_API:
+        *api = &scmi_pd_state_api;
+        break;
+
+    default:
         return FWK_E_ACCESS;
     }
 
-    *api = &scmi_pd_mod_scmi_to_protocol_api;
-
     return FWK_SUCCESS;
 }
 
+static int process_set_state_request(
+    fwk_id_t pd_id,
+    const struct event_request_params *params)
+{
+    int status, respond_status;
+    struct scmi_pd_power_state_set_p2a retval_set = {
+        .status = (int32_t)SCMI_GENERIC_ERROR
+    };
+
+    status = scmi_pd_ctx.pd_api->set_state(pd_id, true, params->pd_power_state);
+    if (status == FWK_SUCCESS) {
+        /* The agent is answered when the power domain response arrives */
+        return FWK_SUCCESS;
+    }
+
+    /*
+     * No response will come from the power domain module. Answer the agent
+     * now and release the domain for the requests waiting for it.
+     */
+    respond_status = scmi_pd_ctx.scmi_api->respond(
+        ops_get_service(pd_id), &retval_set, sizeof(retval_set.status));
+    if (respond_status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-power] %s @%d", __func__, __LINE__);
+    }
+
+    ops_set_idle(pd_id);
+    ops_issue_pending(pd_id);
+
+    return status;
+}
+
 static int process_request_event(const struct fwk_event *event)
 {
     fwk_id_t pd_id;
@@ -1228,8 +1549,7 @@ static int process_request_event(const struct fwk_event *event)
         break;
 #endif
     case SCMI_PD_EVENT_IDX_SET_STATE:
-        return scmi_pd_ctx.pd_api->set_state(
-            pd_id, true, params->pd_power_state);
+        return process_set_state_request(pd_id, params);
 
     default:
         return FWK_E_PARAM;
@@ -1249,6 +1569,7 @@ static int process_request_event(const struct fwk_event *event)
         }
 
         ops_set_idle(pd_id);
+        ops_issue_pending(pd_id);
     }
 
     return status;
@@ -1288,6 +1609,7 @@ static int process_response_event(const struct fwk_event *event)
         }
 
         ops_set_idle(event->source_id);
+        ops_issue_pending(event->source_id);
         return FWK_SUCCESS;
 
 #ifdef BUILD_HAS_MOD_DEBUG
@@ -1324,6 +1646,7 @@ static int process_response_event(const struct fwk_event *event)
             }
         }
         ops_set_idle(scmi_pd_ctx.debug_pd_id);
+        ops_issue_pending(scmi_pd_ctx.debug_pd_id);
         return FWK_SUCCESS;
 #endif
 
@@ -1385,7 +1708,7 @@ static int scmi_pd_start(fwk_id_t id)
 
 /* SCMI Power Domain Management Protocol Definition */
 const struct fwk_module module_scmi_power_domain = {
-    .api_count = 1,
+    .api_count = (unsigned int)MOD_SCMI_PD_API_COUNT,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_pd_init,
     .bind = scmi_pd_bind,
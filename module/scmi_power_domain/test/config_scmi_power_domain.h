@@ -0,0 +1,35 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CONFIG_SCMI_POWER_DOMAIN_H
+#define CONFIG_SCMI_POWER_DOMAIN_H
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+/* Power domains exposed to the agents */
+enum fake_pd_idx {
+    FAKE_PD_IDX_CLUSTER0,
+    FAKE_PD_IDX_CLUSTER1,
+    FAKE_PD_IDX_COUNT,
+};
+
+/* SCMI services, one per agent */
+enum fake_service_idx {
+    FAKE_SERVICE_IDX_0,
+    FAKE_SERVICE_IDX_1,
+    FAKE_SERVICE_IDX_2,
+    FAKE_SERVICE_IDX_3,
+    FAKE_SERVICE_IDX_4,
+    FAKE_SERVICE_IDX_COUNT,
+};
+
+#define FAKE_PD_ID(idx) FWK_ID_ELEMENT(FWK_MODULE_IDX_POWER_DOMAIN, idx)
+
+#define FAKE_SERVICE_ID(idx) FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, idx)
+
+#endif /* CONFIG_SCMI_POWER_DOMAIN_H */
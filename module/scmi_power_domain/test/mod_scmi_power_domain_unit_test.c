@@ -0,0 +1,396 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_core.h>
+#include <Mockfwk_module.h>
+#include <internal/Mockfwk_core_internal.h>
+
+#include <mod_power_domain.h>
+#include <mod_scmi.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_scmi_power_domain.h"
+
+/* Highest number of requests and responses recorded by a test */
+#define MAX_RECORD_COUNT 16
+
+static struct scmi_pd_operations fake_ops[FAKE_PD_IDX_COUNT];
+
+/* Events sent by the module to itself */
+static struct fwk_event put_events[MAX_RECORD_COUNT];
+static unsigned int put_event_count;
+
+/* Responses sent to the agents */
+static fwk_id_t respond_service_ids[MAX_RECORD_COUNT];
+static int32_t respond_statuses[MAX_RECORD_COUNT];
+static unsigned int respond_count;
+
+/* Power states requested to the power domain module */
+static uint32_t set_states[MAX_RECORD_COUNT];
+static unsigned int set_state_count;
+
+/* Status returned by the fake power domain set_state() */
+static int set_state_status;
+
+static int fake_get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    *agent_id = fwk_id_get_element_idx(service_id);
+
+    return FWK_SUCCESS;
+}
+
+static int fake_get_agent_type(
+    uint32_t agent_id,
+    enum scmi_agent_type *agent_type)
+{
+    *agent_type = SCMI_AGENT_TYPE_PSCI;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, respond_count);
+
+    respond_service_ids[respond_count] = service_id;
+    respond_statuses[respond_count] = *(const int32_t *)payload;
+    respond_count++;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api fake_scmi_api = {
+    .get_agent_id = fake_get_agent_id,
+    .get_agent_type = fake_get_agent_type,
+    .respond = fake_respond,
+};
+
+static int fake_get_domain_type(fwk_id_t pd_id, enum mod_pd_type *type)
+{
+    *type = MOD_PD_TYPE_CLUSTER;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_set_state(fwk_id_t pd_id, bool resp_requested, uint32_t state)
+{
+    TEST_ASSERT_TRUE(resp_requested);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, set_state_count);
+
+    set_states[set_state_count++] = state;
+
+    return set_state_status;
+}
+
+static const struct mod_pd_restricted_api fake_pd_api = {
+    .get_domain_type = fake_get_domain_type,
+    .set_state = fake_set_state,
+};
+
+static int put_event_callback(struct fwk_event *event, int cmock_num_calls)
+{
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, put_event_count);
+
+    put_events[put_event_count++] = *event;
+
+    return FWK_SUCCESS;
+}
+
+/* Send a synchronous POWER_STATE_SET request from an agent */
+static int power_state_set(
+    enum fake_service_idx service_idx,
+    enum fake_pd_idx pd_idx,
+    uint32_t power_state)
+{
+    struct scmi_pd_power_state_set_a2p payload = {
+        .flags = 0,
+        .domain_id = pd_idx,
+        .power_state = power_state,
+    };
+
+    return scmi_pd_power_state_set_handler(
+        FAKE_SERVICE_ID(service_idx), (const uint32_t *)&payload);
+}
+
+/* Process the oldest event sent by the module to itself */
+static int process_put_event(unsigned int event_idx)
+{
+    struct fwk_event resp_event;
+
+    TEST_ASSERT_LESS_THAN(put_event_count, event_idx);
+
+    return scmi_pd_process_event(&put_events[event_idx], &resp_event);
+}
+
+/* Complete the operation in progress on a power domain */
+static int power_domain_respond(enum fake_pd_idx pd_idx, int pd_status)
+{
+    struct fwk_event resp_event;
+    struct fwk_event event = {
+        .source_id = FAKE_PD_ID(pd_idx),
+        .target_id = fwk_module_id_scmi_power_domain,
+        .id = mod_pd_public_event_id_set_state,
+        .is_response = true,
+    };
+    struct pd_set_state_response *params =
+        (struct pd_set_state_response *)event.params;
+
+    params->status = pd_status;
+
+    return scmi_pd_process_event(&event, &resp_event);
+}
+
+static uint32_t put_event_power_state(unsigned int event_idx)
+{
+    return ((struct event_request_params *)put_events[event_idx].params)
+        ->pd_power_state;
+}
+
+void setUp(void)
+{
+    unsigned int idx;
+
+    memset(fake_ops, 0, sizeof(fake_ops));
+    for (idx = 0; idx < FAKE_PD_IDX_COUNT; idx++) {
+        fake_ops[idx].service_id = FWK_ID_NONE;
+    }
+
+    scmi_pd_ctx = (struct mod_scmi_pd_ctx){
+        .domain_count = FAKE_PD_IDX_COUNT,
+        .scmi_api = &fake_scmi_api,
+        .pd_api = &fake_pd_api,
+        .ops = fake_ops,
+    };
+
+    put_event_count = 0;
+    respond_count = 0;
+    set_state_count = 0;
+    set_state_status = FWK_SUCCESS;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+    __fwk_put_event_Stub(put_event_callback);
+}
+
+void tearDown(void)
+{
+}
+
+void test_power_state_set_idle_domain_issued(void)
+{
+    int status;
+
+    status = power_state_set(FAKE_SERVICE_IDX_0, FAKE_PD_IDX_CLUSTER0, 10);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(1, put_event_count);
+    TEST_ASSERT_EQUAL(10, put_event_power_state(0));
+    TEST_ASSERT_EQUAL(0, respond_count);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        FAKE_SERVICE_ID(FAKE_SERVICE_IDX_0),
+        ops_get_service(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0))));
+}
+
+void test_power_state_set_queued_issued_in_order(void)
+{
+    int status;
+    unsigned int idx;
+
+    for (idx = FAKE_SERVICE_IDX_0; idx <= FAKE_SERVICE_IDX_3; idx++) {
+        status = power_state_set(idx, FAKE_PD_IDX_CLUSTER0, 10 + idx);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    /* Only the first request is started while the domain is busy */
+    TEST_ASSERT_EQUAL(1, put_event_count);
+    TEST_ASSERT_EQUAL(0, respond_count);
+    TEST_ASSERT_EQUAL(
+        MOD_SCMI_PD_PENDING_REQUEST_COUNT,
+        fake_ops[FAKE_PD_IDX_CLUSTER0].pending_count);
+
+    for (idx = FAKE_SERVICE_IDX_0; idx <= FAKE_SERVICE_IDX_3; idx++) {
+        status = process_put_event(idx);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+        TEST_ASSERT_EQUAL(10 + idx, set_states[idx]);
+
+        status = power_domain_respond(FAKE_PD_IDX_CLUSTER0, FWK_SUCCESS);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+        /* The agent is answered and the next request is started */
+        TEST_ASSERT_EQUAL(idx + 1, respond_count);
+        TEST_ASSERT_TRUE(
+            fwk_id_is_equal(FAKE_SERVICE_ID(idx), respond_service_ids[idx]));
+        TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_statuses[idx]);
+    }
+
+    TEST_ASSERT_EQUAL(4, put_event_count);
+    for (idx = 0; idx < put_event_count; idx++) {
+        TEST_ASSERT_EQUAL(10 + idx, put_event_power_state(idx));
+    }
+}
+
+void test_power_state_set_queue_full_busy(void)
+{
+    int status;
+    unsigned int idx;
+
+    for (idx = FAKE_SERVICE_IDX_0; idx <= FAKE_SERVICE_IDX_3; idx++) {
+        status = power_state_set(idx, FAKE_PD_IDX_CLUSTER0, 10 + idx);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    status = power_state_set(FAKE_SERVICE_IDX_4, FAKE_PD_IDX_CLUSTER0, 14);
+    TEST_ASSERT_EQUAL(FWK_E_BUSY, status);
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        FAKE_SERVICE_ID(FAKE_SERVICE_IDX_4), respond_service_ids[0]));
+    TEST_ASSERT_EQUAL(SCMI_BUSY, respond_statuses[0]);
+    TEST_ASSERT_EQUAL(
+        MOD_SCMI_PD_PENDING_REQUEST_COUNT,
+        fake_ops[FAKE_PD_IDX_CLUSTER0].pending_count);
+}
+
+void test_power_state_set_other_domain_not_held(void)
+{
+    int status;
+
+    status = power_state_set(FAKE_SERVICE_IDX_0, FAKE_PD_IDX_CLUSTER0, 10);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_state_set(FAKE_SERVICE_IDX_1, FAKE_PD_IDX_CLUSTER1, 11);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(2, put_event_count);
+    TEST_ASSERT_EQUAL(0, fake_ops[FAKE_PD_IDX_CLUSTER0].pending_count);
+    TEST_ASSERT_EQUAL(0, fake_ops[FAKE_PD_IDX_CLUSTER1].pending_count);
+}
+
+void test_power_state_set_queue_drained_on_completion(void)
+{
+    int status;
+    unsigned int idx;
+
+    for (idx = FAKE_SERVICE_IDX_0; idx <= FAKE_SERVICE_IDX_2; idx++) {
+        status = power_state_set(idx, FAKE_PD_IDX_CLUSTER0, 10 + idx);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    for (idx = FAKE_SERVICE_IDX_0; idx <= FAKE_SERVICE_IDX_2; idx++) {
+        status = power_domain_respond(FAKE_PD_IDX_CLUSTER0, FWK_SUCCESS);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    TEST_ASSERT_EQUAL(3, respond_count);
+    TEST_ASSERT_EQUAL(3, put_event_count);
+    TEST_ASSERT_EQUAL(0, fake_ops[FAKE_PD_IDX_CLUSTER0].pending_count);
+    TEST_ASSERT_FALSE(ops_is_busy(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0)));
+
+    /* The domain accepts requests again once the queue has been drained */
+    status = power_state_set(FAKE_SERVICE_IDX_3, FAKE_PD_IDX_CLUSTER0, 13);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(4, put_event_count);
+    TEST_ASSERT_EQUAL(13, put_event_power_state(3));
+}
+
+void test_power_state_set_error_issues_pending(void)
+{
+    int status;
+
+    status = power_state_set(FAKE_SERVICE_IDX_0, FAKE_PD_IDX_CLUSTER0, 10);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_state_set(FAKE_SERVICE_IDX_1, FAKE_PD_IDX_CLUSTER0, 11);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    set_state_status = FWK_E_PARAM;
+    status = process_put_event(0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* The failed request is answered and the pending one is started */
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        FAKE_SERVICE_ID(FAKE_SERVICE_IDX_0), respond_service_ids[0]));
+    TEST_ASSERT_EQUAL(SCMI_GENERIC_ERROR, respond_statuses[0]);
+
+    TEST_ASSERT_EQUAL(2, put_event_count);
+    TEST_ASSERT_EQUAL(11, put_event_power_state(1));
+    TEST_ASSERT_EQUAL(0, fake_ops[FAKE_PD_IDX_CLUSTER0].pending_count);
+    TEST_ASSERT_TRUE(fwk_id_is_equal(
+        FAKE_SERVICE_ID(FAKE_SERVICE_IDX_1),
+        ops_get_service(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0))));
+
+    set_state_status = FWK_SUCCESS;
+    status = process_put_event(1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = power_domain_respond(FAKE_PD_IDX_CLUSTER0, FWK_SUCCESS);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(2, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_statuses[1]);
+    TEST_ASSERT_FALSE(ops_is_busy(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0)));
+}
+
+void test_power_state_set_error_idle_domain(void)
+{
+    int status;
+
+    status = power_state_set(FAKE_SERVICE_IDX_0, FAKE_PD_IDX_CLUSTER0, 10);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    set_state_status = FWK_E_PARAM;
+    status = process_put_event(0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    TEST_ASSERT_EQUAL(1, respond_count);
+    TEST_ASSERT_EQUAL(SCMI_GENERIC_ERROR, respond_statuses[0]);
+    TEST_ASSERT_FALSE(ops_is_busy(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0)));
+}
+
+void test_state_api_set_state_cluster_not_supported(void)
+{
+    int status;
+
+    /* Clusters only accept synchronous requests */
+    status = scmi_pd_state_api_set_state(
+        FAKE_SERVICE_ID(FAKE_SERVICE_IDX_0), FAKE_PD_IDX_CLUSTER0, 10);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+
+    TEST_ASSERT_EQUAL(0, set_state_count);
+    TEST_ASSERT_EQUAL(0, put_event_count);
+    TEST_ASSERT_EQUAL(0, respond_count);
+    TEST_ASSERT_FALSE(ops_is_busy(FAKE_PD_ID(FAKE_PD_IDX_CLUSTER0)));
+}
+
+int scmi_power_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_power_state_set_idle_domain_issued);
+    RUN_TEST(test_power_state_set_queued_issued_in_order);
+    RUN_TEST(test_power_state_set_queue_full_busy);
+    RUN_TEST(test_power_state_set_other_domain_not_held);
+    RUN_TEST(test_power_state_set_queue_drained_on_completion);
+    RUN_TEST(test_power_state_set_error_issues_pending);
+    RUN_TEST(test_power_state_set_error_idle_domain);
+    RUN_TEST(test_state_api_set_state_cluster_not_supported);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return scmi_power_domain_test_main();
+}
+#endif
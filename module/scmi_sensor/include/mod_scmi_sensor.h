@@ -14,6 +14,11 @@
 #include <fwk_id.h>
 #include <fwk_macros.h>
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+#endif
+
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -63,6 +68,43 @@ enum scmi_sensor_api_idx {
     SCMI_SENSOR_API_IDX_COUNT,
 };
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+/*!
+ * \brief Sensor statistics configuration.
+ *
+ * \details The level statistics of a sensor have a single level, whose usage
+ *      count is the number of successful readings.
+ */
+struct mod_scmi_sensor_stats_config {
+    /*! Flag indicating that statistics are collected for this sensor */
+    bool stats_collected;
+
+    /*!
+     * \brief Histogram of the values read.
+     *
+     * \details Only the readings of single-axis sensors are recorded.
+     *      Negative values are counted in the first bucket.
+     */
+    struct mod_stats_histogram_config value_histogram;
+};
+
+/*!
+ * \brief Module configuration.
+ *
+ * \details The configuration is optional. Statistics are not collected when
+ *      there is none.
+ */
+struct mod_scmi_sensor_config {
+    /*!
+     * \brief Pointer to the table of sensor statistics configurations.
+     *
+     * \details The table is indexed by sensor and has one entry for each
+     *      element of the \c sensor module.
+     */
+    const struct mod_scmi_sensor_stats_config *stats_table;
+};
+#endif
+
 /*!
  * \}
  */
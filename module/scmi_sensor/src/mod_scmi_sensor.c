@@ -15,6 +15,7 @@
 #include <mod_sensor.h>
 
 #include <fwk_assert.h>
+#include <fwk_attributes.h>
 #include <fwk_core.h>
 #include <fwk_event.h>
 #include <fwk_id.h>
@@ -35,6 +36,10 @@
 #    include <mod_resource_perms.h>
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+#endif
+
 struct sensor_operations {
     /*
      * Service identifier currently requesting operation from this sensor.
@@ -43,6 +48,23 @@ struct sensor_operations {
     fwk_id_t service_id;
 };
 
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+/*
+ * Axis descriptions of a sensor, in the format of the
+ * SENSOR_AXIS_DESCRIPTION_GET response.
+ */
+struct scmi_sensor_axis_table {
+    /* SCMI status returned for the sensor, SCMI_SUCCESS if descs is valid */
+    int32_t status;
+
+    /* Number of axes of the sensor */
+    unsigned int axis_count;
+
+    /* Axis descriptions */
+    struct scmi_sensor_axis_desc *descs;
+};
+#endif
+
 struct mod_scmi_sensor_ctx {
     /* Number of sensors */
     unsigned int sensor_count;
@@ -59,6 +81,17 @@ struct mod_scmi_sensor_ctx {
     /* Array of sensor values */
     struct mod_sensor_data *sensor_values;
 
+    /* Table of sensor descriptions, built at start */
+    struct scmi_sensor_desc *desc_table;
+
+    /* Status of each sensor description, FWK_SUCCESS if it is valid */
+    int *desc_status;
+
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+    /* Table of sensor axis descriptions, built at start */
+    struct scmi_sensor_axis_table *axis_tables;
+#endif
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
@@ -71,6 +104,14 @@ struct mod_scmi_sensor_ctx {
     /* SCMI notification API */
     const struct mod_scmi_notification_api *scmi_notification_api;
 #endif
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /* Table of sensor statistics configurations, NULL if there are none */
+    const struct mod_scmi_sensor_stats_config *stats_table;
+
+    /* Statistics module API */
+    const struct mod_stats_api *stats_api;
+#endif
 };
 
 static int scmi_sensor_protocol_version_handler(fwk_id_t service_id,
@@ -149,6 +190,56 @@ static unsigned int payload_size_table[MOD_SCMI_SENSOR_COMMAND_COUNT] = {
         (unsigned int)sizeof(struct scmi_sensor_protocol_reading_get_a2p),
 };
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+static void scmi_sensor_update_stats(
+    unsigned int sensor_idx,
+    const struct mod_sensor_data *sensor_data)
+{
+    const struct mod_scmi_sensor_stats_config *stats_config;
+    fwk_id_t domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_SENSOR, sensor_idx);
+    uint64_t value;
+    int status;
+
+    if (scmi_sensor_ctx.stats_table == NULL) {
+        return;
+    }
+
+    stats_config = &scmi_sensor_ctx.stats_table[sensor_idx];
+    if (!stats_config->stats_collected) {
+        return;
+    }
+
+    /* Sensors have a single level, used once for each reading */
+    status = scmi_sensor_ctx.stats_api->update_domain(
+        fwk_module_id_scmi_sensor, domain_id, 0);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-SENS] %s @%d", __func__, __LINE__);
+    }
+
+    if (stats_config->value_histogram.bucket_count == 0) {
+        return;
+    }
+
+#    ifdef BUILD_HAS_SENSOR_MULTI_AXIS
+    if (sensor_data->axis_count > 1) {
+        return;
+    }
+#    endif
+
+#    ifdef BUILD_HAS_SENSOR_SIGNED_VALUE
+    value = (sensor_data->value < 0) ? 0 : (uint64_t)sensor_data->value;
+#    else
+    value = (uint64_t)sensor_data->value;
+#    endif
+
+    status = scmi_sensor_ctx.stats_api->record_histogram(
+        fwk_module_id_scmi_sensor, domain_id, MOD_STATS_HISTOGRAM_VALUE, value);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-SENS] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
 /*
  * Static helper for responding to SCMI a reading get request.
  */
@@ -180,6 +271,10 @@ static int scmi_sensor_reading_respond(
         goto exit_error;
     }
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    scmi_sensor_update_stats(sensor_idx, sensor_data);
+#endif
+
 #ifdef BUILD_HAS_SCMI_SENSOR_V2
     payload_size = sizeof(return_values);
     status = scmi_sensor_ctx.scmi_api->get_max_payload_size(
@@ -332,13 +427,10 @@ static int scmi_sensor_protocol_desc_get_handler(fwk_id_t service_id,
     size_t max_payload_size;
     const struct scmi_sensor_protocol_description_get_a2p *parameters =
                (const struct scmi_sensor_protocol_description_get_a2p *)payload;
-    struct scmi_sensor_desc desc = { 0 };
-    unsigned int num_descs, desc_index, desc_index_max;
-    struct mod_sensor_complete_info sensor_info;
+    unsigned int i, num_descs, desc_index;
     struct scmi_sensor_protocol_description_get_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR,
     };
-    fwk_id_t sensor_id;
 
     payload_size = sizeof(return_values);
 
@@ -366,103 +458,31 @@ static int scmi_sensor_protocol_desc_get_handler(fwk_id_t service_id,
     num_descs = (unsigned int)FWK_MIN(
         SCMI_SENSOR_DESCS_MAX(max_payload_size),
         (scmi_sensor_ctx.sensor_count - desc_index));
-    desc_index_max = (desc_index + num_descs - 1);
-
-    for (; desc_index <= desc_index_max; ++desc_index,
-         payload_size += sizeof(desc)) {
-
-        desc = (struct scmi_sensor_desc) {
-            .sensor_id = desc_index,
-            .sensor_attributes_low = 0, /* None supported */
-        };
-
-        sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, desc_index);
-        if (!fwk_module_is_valid_element_id(sensor_id)) {
-            /* domain_idx did not map to a sensor device */
-            return_values.status = (int32_t)SCMI_NOT_FOUND;
-            goto exit_unexpected;
-        }
 
-        status = scmi_sensor_ctx.sensor_api->get_info(sensor_id, &sensor_info);
+    for (i = desc_index; i < (desc_index + num_descs); i++) {
+        status = scmi_sensor_ctx.desc_status[i];
         if (status != FWK_SUCCESS) {
-            /* Unable to get sensor info */
-            goto exit_unexpected;
-        }
-
-        if (sensor_info.hal_info.type >= MOD_SENSOR_TYPE_COUNT) {
-            /* Invalid sensor type */
-            goto exit_unexpected;
-        }
-
-        if ((sensor_info.hal_info.unit_multiplier <
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MIN) ||
-            (sensor_info.hal_info.unit_multiplier >
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MAX)) {
-            /* Sensor unit multiplier out of range */
-            goto exit_unexpected;
-        }
-
-        if ((sensor_info.hal_info.update_interval_multiplier <
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_MULTIPLIER_MIN) ||
-            (sensor_info.hal_info.update_interval_multiplier >
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_MULTIPLIER_MAX)) {
-            /* Sensor update interval multiplier is out of range */
-            goto exit_unexpected;
-        }
-
-        if (sensor_info.hal_info.update_interval >=
-            SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_INTERVAL_MASK) {
-            /* Update interval is too big to fit in its mask */
-            goto exit_unexpected;
-        }
-        if (sensor_info.trip_point.count >=
-            SCMI_SENSOR_DESC_ATTRS_LOW_SENSOR_NUM_TRIP_POINTS_MASK) {
-            /* Number of trip points is too big to fit in its mask */
+            /* The sensor could not be described when the module started */
             goto exit_unexpected;
         }
+    }
 
-#ifdef BUILD_HAS_SCMI_SENSOR_V2
-        desc.sensor_attributes_low = SCMI_SENSOR_DESC_ATTRIBUTES_LOW(
-            0U, /* Asyncronous reading not-supported */
-            sensor_info.hal_info.ext_attributes,
-            (uint32_t)sensor_info.trip_point.count);
-#else
-        desc.sensor_attributes_low = SCMI_SENSOR_DESC_ATTRIBUTES_LOW(
-            0U, /* Asyncronous reading not-supported */
-            (uint32_t)sensor_info.trip_point.count);
-#endif
-
-        desc.sensor_attributes_high = SCMI_SENSOR_DESC_ATTRIBUTES_HIGH(
-            sensor_info.hal_info.type,
-            sensor_info.hal_info.unit_multiplier,
-            (uint32_t)sensor_info.hal_info.update_interval_multiplier,
-            (uint32_t)sensor_info.hal_info.update_interval);
-
-#ifdef BUILD_HAS_SCMI_SENSOR_V2
-        scmi_sensor_prop_set(&sensor_info, &desc);
-#endif
-
-        /*
-         * Copy sensor name into description struct. Copy n-1 chars to ensure a
-         * NULL terminator at the end. (struct has been zeroed out)
-         */
-        fwk_str_strncpy(
-            desc.sensor_name,
-            fwk_module_get_element_name(sensor_id),
-            sizeof(desc.sensor_name) - 1);
-
-        status = scmi_sensor_ctx.scmi_api->write_payload(service_id,
-            payload_size, &desc, sizeof(struct scmi_sensor_desc));
-        if (status != FWK_SUCCESS) {
-            /* Failed to write sensor description into message payload */
-            goto exit_unexpected;
-        }
+    /* Copy the requested window of the description table in a single write */
+    status = scmi_sensor_ctx.scmi_api->write_payload(
+        service_id,
+        payload_size,
+        &scmi_sensor_ctx.desc_table[desc_index],
+        num_descs * sizeof(struct scmi_sensor_desc));
+    if (status != FWK_SUCCESS) {
+        /* Failed to write sensor descriptions into message payload */
+        goto exit_unexpected;
     }
+    payload_size += num_descs * sizeof(struct scmi_sensor_desc);
 
     return_values = (struct scmi_sensor_protocol_description_get_p2a) {
         .status = SCMI_SUCCESS,
         .num_sensor_flags = SCMI_SENSOR_NUM_SENSOR_FLAGS(num_descs,
-            (scmi_sensor_ctx.sensor_count - desc_index_max - 1))
+            (scmi_sensor_ctx.sensor_count - desc_index - num_descs))
     };
 
     status = scmi_sensor_ctx.scmi_api->write_payload(service_id, 0,
@@ -629,14 +649,11 @@ static int scmi_sensor_axis_desc_get_handler(
     size_t max_payload_size;
     const struct scmi_sensor_axis_description_get_a2p *parameters =
         (const struct scmi_sensor_axis_description_get_a2p *)payload;
-    struct scmi_sensor_axis_desc desc = { 0 };
-    unsigned int num_descs, desc_index, desc_index_max;
-    struct mod_sensor_axis_info axis_info;
-    struct mod_sensor_complete_info sensor_info;
+    unsigned int num_descs, desc_index;
+    const struct scmi_sensor_axis_table *axis_table;
     struct scmi_sensor_axis_description_get_p2a return_values = {
         .status = (int32_t)SCMI_GENERIC_ERROR,
     };
-    fwk_id_t sensor_id;
 
     payload_size = sizeof(return_values);
 
@@ -655,96 +672,46 @@ static int scmi_sensor_axis_desc_get_handler(
 
     parameters = (const struct scmi_sensor_axis_description_get_a2p *)payload;
 
-    sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, parameters->sensor_idx);
-    if (!fwk_module_is_valid_element_id(sensor_id)) {
+    if (parameters->sensor_idx >= scmi_sensor_ctx.sensor_count) {
         /* domain_idx did not map to a sensor device */
         return_values.status = (int32_t)SCMI_NOT_FOUND;
         goto exit;
     }
 
-    status = scmi_sensor_ctx.sensor_api->get_info(sensor_id, &sensor_info);
-    if (status != FWK_SUCCESS) {
-        /* Unable to get sensor info */
-        return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+    axis_table = &scmi_sensor_ctx.axis_tables[parameters->sensor_idx];
+    if (axis_table->status != SCMI_SUCCESS) {
+        return_values.status = axis_table->status;
         goto exit;
     }
 
     desc_index = parameters->axis_desc_index;
 
-    if (!sensor_info.multi_axis.support) {
-        return_values.status = (int32_t)SCMI_NOT_SUPPORTED;
-        goto exit;
-    }
-
-    if (desc_index >= sensor_info.multi_axis.axis_count) {
+    if (desc_index >= axis_table->axis_count) {
         return_values.status = (int32_t)SCMI_INVALID_PARAMETERS;
         goto exit;
     }
 
     num_descs = (unsigned int)FWK_MIN(
         SCMI_SENSOR_AXIS_DESCS_MAX(max_payload_size),
-        (sensor_info.multi_axis.axis_count - desc_index));
-    desc_index_max = (desc_index + num_descs - 1);
-
-    for (; desc_index <= desc_index_max;
-         ++desc_index, payload_size += sizeof(desc)) {
-        status = scmi_sensor_ctx.sensor_api->get_axis_info(
-            sensor_id, desc_index, &axis_info);
-        if (status != FWK_SUCCESS) {
-            /* Unable to get sensor info */
-            return_values.status = (int32_t)SCMI_GENERIC_ERROR;
-            goto exit;
-        }
-
-        desc = (struct scmi_sensor_axis_desc){
-            .axis_idx = desc_index,
-            .axis_attributes_low =
-                SCMI_SENSOR_AXIS_DESC_ATTRIBUTES_LOW(axis_info.extended_attribs)
-        };
-
-        if (axis_info.type >= MOD_SENSOR_TYPE_COUNT) {
-            /* Invalid sensor type */
-            return_values.status = (int32_t)SCMI_NOT_SUPPORTED;
-            goto exit;
-        }
-
-        if ((axis_info.unit_multiplier <
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MIN) ||
-            (axis_info.unit_multiplier >
-             SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MAX)) {
-            /* Sensor unit multiplier out of range */
-            return_values.status = (int32_t)SCMI_INVALID_PARAMETERS;
-            goto exit;
-        }
+        (axis_table->axis_count - desc_index));
 
-        desc.axis_attributes_high = SCMI_SENSOR_AXIS_DESC_ATTRIBUTES_HIGH(
-            axis_info.type, axis_info.unit_multiplier);
-
-        scmi_sensor_axis_prop_set(&axis_info, &desc);
-
-        /*
-         * Copy sensor name into description struct. Copy n-1 chars to ensure a
-         * NULL terminator at the end. (struct has been zeroed out)
-         */
-        fwk_str_strncpy(
-            desc.axis_name, axis_info.name, SCMI_SENSOR_AXIS_NAME_LEN - 1);
-
-        status = scmi_sensor_ctx.scmi_api->write_payload(
-            service_id,
-            payload_size,
-            &desc,
-            sizeof(struct scmi_sensor_axis_desc));
-        if (status != FWK_SUCCESS) {
-            /* Failed to write sensor description into message payload */
-            return_values.status = (int32_t)SCMI_GENERIC_ERROR;
-            goto exit;
-        }
+    /* Copy the requested window of the axis table in a single write */
+    status = scmi_sensor_ctx.scmi_api->write_payload(
+        service_id,
+        payload_size,
+        &axis_table->descs[desc_index],
+        num_descs * sizeof(struct scmi_sensor_axis_desc));
+    if (status != FWK_SUCCESS) {
+        /* Failed to write sensor descriptions into message payload */
+        return_values.status = (int32_t)SCMI_GENERIC_ERROR;
+        goto exit;
     }
+    payload_size += num_descs * sizeof(struct scmi_sensor_axis_desc);
 
     return_values = (struct scmi_sensor_axis_description_get_p2a){
         .status = SCMI_SUCCESS,
         .num_axis_flags = SCMI_SENSOR_NUM_SENSOR_FLAGS(
-            num_descs, (sensor_info.multi_axis.axis_count - desc_index_max - 1))
+            num_descs, (axis_table->axis_count - desc_index - num_descs))
     };
 
     status = scmi_sensor_ctx.scmi_api->write_payload(
@@ -1010,7 +977,7 @@ static struct mod_sensor_trip_point_api sensor_trip_point_api = {
  */
 static int scmi_sensor_init(fwk_id_t module_id,
                             unsigned int element_count,
-                            const void *unused)
+                            const void *data)
 {
     if (element_count != 0) {
         /* This module should not have any elements */
@@ -1043,6 +1010,13 @@ static int scmi_sensor_init(fwk_id_t module_id,
         scmi_sensor_ctx.sensor_ops_table[i].service_id = FWK_ID_NONE;
     }
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    if (data != NULL) {
+        scmi_sensor_ctx.stats_table =
+            ((const struct mod_scmi_sensor_config *)data)->stats_table;
+    }
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -1116,12 +1090,272 @@ static int scmi_sensor_bind(fwk_id_t id, unsigned int round)
     }
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    if (scmi_sensor_ctx.stats_table != NULL) {
+        status = fwk_module_bind(
+            FWK_ID_MODULE(FWK_MODULE_IDX_STATISTICS),
+            mod_stats_api_id_stats,
+            &scmi_sensor_ctx.stats_api);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+#endif
+
+    return FWK_SUCCESS;
+}
+
+static int scmi_sensor_build_desc(
+    unsigned int sensor_idx,
+    struct scmi_sensor_desc *desc)
+{
+    int status;
+    struct mod_sensor_complete_info sensor_info = { 0 };
+    fwk_id_t sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, sensor_idx);
+
+    status = scmi_sensor_ctx.sensor_api->get_info(sensor_id, &sensor_info);
+    if (status != FWK_SUCCESS) {
+        /* Unable to get sensor info */
+        return status;
+    }
+
+    if (sensor_info.hal_info.type >= MOD_SENSOR_TYPE_COUNT) {
+        /* Invalid sensor type */
+        return FWK_E_DATA;
+    }
+
+    if ((sensor_info.hal_info.unit_multiplier <
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MIN) ||
+        (sensor_info.hal_info.unit_multiplier >
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MAX)) {
+        /* Sensor unit multiplier out of range */
+        return FWK_E_DATA;
+    }
+
+    if ((sensor_info.hal_info.update_interval_multiplier <
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_MULTIPLIER_MIN) ||
+        (sensor_info.hal_info.update_interval_multiplier >
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_MULTIPLIER_MAX)) {
+        /* Sensor update interval multiplier is out of range */
+        return FWK_E_DATA;
+    }
+
+    if (sensor_info.hal_info.update_interval >=
+        SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UPDATE_INTERVAL_MASK) {
+        /* Update interval is too big to fit in its mask */
+        return FWK_E_DATA;
+    }
+    if (sensor_info.trip_point.count >=
+        SCMI_SENSOR_DESC_ATTRS_LOW_SENSOR_NUM_TRIP_POINTS_MASK) {
+        /* Number of trip points is too big to fit in its mask */
+        return FWK_E_DATA;
+    }
+
+    desc->sensor_id = sensor_idx;
+
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+    desc->sensor_attributes_low = SCMI_SENSOR_DESC_ATTRIBUTES_LOW(
+        0U, /* Asyncronous reading not-supported */
+        sensor_info.hal_info.ext_attributes,
+        (uint32_t)sensor_info.trip_point.count);
+#else
+    desc->sensor_attributes_low = SCMI_SENSOR_DESC_ATTRIBUTES_LOW(
+        0U, /* Asyncronous reading not-supported */
+        (uint32_t)sensor_info.trip_point.count);
+#endif
+
+    desc->sensor_attributes_high = SCMI_SENSOR_DESC_ATTRIBUTES_HIGH(
+        sensor_info.hal_info.type,
+        sensor_info.hal_info.unit_multiplier,
+        (uint32_t)sensor_info.hal_info.update_interval_multiplier,
+        (uint32_t)sensor_info.hal_info.update_interval);
+
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+    scmi_sensor_prop_set(&sensor_info, desc);
+#endif
+
+    /*
+     * Copy sensor name into description struct. Copy n-1 chars to ensure a
+     * NULL terminator at the end. (struct has been zeroed out)
+     */
+    fwk_str_strncpy(
+        desc->sensor_name,
+        fwk_module_get_element_name(sensor_id),
+        sizeof(desc->sensor_name) - 1);
+
     return FWK_SUCCESS;
 }
 
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+static int32_t scmi_sensor_build_axis_desc(
+    fwk_id_t sensor_id,
+    unsigned int axis_idx,
+    struct scmi_sensor_axis_desc *desc)
+{
+    int status;
+    struct mod_sensor_axis_info axis_info = { 0 };
+
+    status = scmi_sensor_ctx.sensor_api->get_axis_info(
+        sensor_id, axis_idx, &axis_info);
+    if (status != FWK_SUCCESS) {
+        /* Unable to get sensor info */
+        return (int32_t)SCMI_GENERIC_ERROR;
+    }
+
+    if (axis_info.type >= MOD_SENSOR_TYPE_COUNT) {
+        /* Invalid sensor type */
+        return (int32_t)SCMI_NOT_SUPPORTED;
+    }
+
+    if ((axis_info.unit_multiplier <
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MIN) ||
+        (axis_info.unit_multiplier >
+         SCMI_SENSOR_DESC_ATTRS_HIGH_SENSOR_UNIT_MULTIPLIER_MAX)) {
+        /* Sensor unit multiplier out of range */
+        return (int32_t)SCMI_INVALID_PARAMETERS;
+    }
+
+    desc->axis_idx = axis_idx;
+    desc->axis_attributes_low =
+        SCMI_SENSOR_AXIS_DESC_ATTRIBUTES_LOW(axis_info.extended_attribs);
+    desc->axis_attributes_high = SCMI_SENSOR_AXIS_DESC_ATTRIBUTES_HIGH(
+        axis_info.type, axis_info.unit_multiplier);
+
+    scmi_sensor_axis_prop_set(&axis_info, desc);
+
+    /*
+     * Copy sensor name into description struct. Copy n-1 chars to ensure a
+     * NULL terminator at the end. (struct has been zeroed out)
+     */
+    fwk_str_strncpy(
+        desc->axis_name, axis_info.name, SCMI_SENSOR_AXIS_NAME_LEN - 1);
+
+    return (int32_t)SCMI_SUCCESS;
+}
+
+static void scmi_sensor_build_axis_table(unsigned int sensor_idx)
+{
+    int status;
+    unsigned int axis_idx;
+    struct mod_sensor_complete_info sensor_info = { 0 };
+    struct scmi_sensor_axis_table *axis_table;
+    fwk_id_t sensor_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, sensor_idx);
+
+    axis_table = &scmi_sensor_ctx.axis_tables[sensor_idx];
+
+    status = scmi_sensor_ctx.sensor_api->get_info(sensor_id, &sensor_info);
+    if (status != FWK_SUCCESS) {
+        /* Unable to get sensor info */
+        axis_table->status = (int32_t)SCMI_GENERIC_ERROR;
+        return;
+    }
+
+    if (!sensor_info.multi_axis.support) {
+        axis_table->status = (int32_t)SCMI_NOT_SUPPORTED;
+        return;
+    }
+
+    axis_table->descs = fwk_mm_calloc(
+        sensor_info.multi_axis.axis_count,
+        sizeof(struct scmi_sensor_axis_desc));
+
+    for (axis_idx = 0; axis_idx < sensor_info.multi_axis.axis_count;
+         axis_idx++) {
+        axis_table->status = scmi_sensor_build_axis_desc(
+            sensor_id, axis_idx, &axis_table->descs[axis_idx]);
+        if (axis_table->status != SCMI_SUCCESS) {
+            return;
+        }
+    }
+
+    axis_table->axis_count = sensor_info.multi_axis.axis_count;
+}
+#endif
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+static int scmi_sensor_stats_start(void)
+{
+    const struct mod_scmi_sensor_stats_config *stats_config;
+    int status;
+    int stats_domains = 0;
+    unsigned int i;
+    fwk_id_t domain_id;
+
+    if (scmi_sensor_ctx.stats_table == NULL) {
+        return FWK_SUCCESS;
+    }
+
+    /* Count how many sensors have statistics */
+    for (i = 0; i < scmi_sensor_ctx.sensor_count; i++) {
+        if (scmi_sensor_ctx.stats_table[i].stats_collected) {
+            stats_domains++;
+        }
+    }
+
+    status = scmi_sensor_ctx.stats_api->init_stats(
+        fwk_module_id_scmi_sensor,
+        MOD_STATS_SIGNATURE_SENS,
+        (int)scmi_sensor_ctx.sensor_count,
+        stats_domains);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    for (i = 0; i < scmi_sensor_ctx.sensor_count; i++) {
+        stats_config = &scmi_sensor_ctx.stats_table[i];
+        if (!stats_config->stats_collected) {
+            continue;
+        }
+
+        domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_SENSOR, i);
+        status = scmi_sensor_ctx.stats_api->add_domain(
+            fwk_module_id_scmi_sensor, domain_id, 1);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        if (stats_config->value_histogram.bucket_count != 0) {
+            status = scmi_sensor_ctx.stats_api->add_histogram(
+                fwk_module_id_scmi_sensor,
+                domain_id,
+                MOD_STATS_HISTOGRAM_VALUE,
+                stats_config->value_histogram.min_value,
+                stats_config->value_histogram.bucket_width,
+                stats_config->value_histogram.bucket_count);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+    }
+
+    return scmi_sensor_ctx.stats_api->start_stats(fwk_module_id_scmi_sensor);
+}
+#endif
+
 static int scmi_sensor_start(fwk_id_t id)
 {
     int status = FWK_SUCCESS;
+    unsigned int i;
+
+    /* Tables for SENSOR_DESCRIPTION_GET and SENSOR_AXIS_DESCRIPTION_GET */
+    scmi_sensor_ctx.desc_table = fwk_mm_calloc(
+        scmi_sensor_ctx.sensor_count, sizeof(struct scmi_sensor_desc));
+    scmi_sensor_ctx.desc_status =
+        fwk_mm_calloc(scmi_sensor_ctx.sensor_count, sizeof(int));
+
+    for (i = 0; i < scmi_sensor_ctx.sensor_count; i++) {
+        scmi_sensor_ctx.desc_status[i] =
+            scmi_sensor_build_desc(i, &scmi_sensor_ctx.desc_table[i]);
+    }
+
+#ifdef BUILD_HAS_SCMI_SENSOR_V2
+    scmi_sensor_ctx.axis_tables = fwk_mm_calloc(
+        scmi_sensor_ctx.sensor_count, sizeof(struct scmi_sensor_axis_table));
+
+    for (i = 0; i < scmi_sensor_ctx.sensor_count; i++) {
+        scmi_sensor_build_axis_table(i);
+    }
+#endif
 
 #ifdef BUILD_HAS_SCMI_NOTIFICATIONS
     status = scmi_init_notifications((int)scmi_sensor_ctx.sensor_count);
@@ -1130,6 +1364,10 @@ static int scmi_sensor_start(fwk_id_t id)
     }
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    status = scmi_sensor_stats_start();
+#endif
+
     return status;
 }
 
@@ -1209,5 +1447,8 @@ const struct fwk_module module_scmi_sensor = {
     .process_event = scmi_sensor_process_event,
 };
 
-/* No elements, no module configuration data */
-struct fwk_module_config config_scmi_sensor = { 0 };
+/*
+ * No elements. The module configuration data is optional, products providing
+ * it override this default.
+ */
+FWK_WEAK struct fwk_module_config config_scmi_sensor = { 0 };
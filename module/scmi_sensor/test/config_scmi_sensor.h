@@ -0,0 +1,38 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_scmi_sensor.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+enum fake_sensor_idx {
+    FAKE_SENSOR_IDX_TEMP,
+    FAKE_SENSOR_IDX_POWER,
+    FAKE_SENSOR_IDX_VOLTAGE,
+    FAKE_SENSOR_IDX_COUNT,
+};
+
+#define FAKE_SENSOR_ID(IDX) FWK_ID_ELEMENT(FWK_MODULE_IDX_SENSOR, IDX)
+
+#define FAKE_SERVICE_ID FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, 0)
+
+/* Statistics of the temperature sensor, with a histogram, and power sensor */
+static const struct mod_scmi_sensor_stats_config fake_stats_table
+    [FAKE_SENSOR_IDX_COUNT] = {
+    [FAKE_SENSOR_IDX_TEMP] = {
+        .stats_collected = true,
+        .value_histogram = {
+            .min_value = 20000,
+            .bucket_width = 5000,
+            .bucket_count = 16,
+        },
+    },
+    [FAKE_SENSOR_IDX_POWER] = {
+        .stats_collected = true,
+    },
+};
@@ -0,0 +1,362 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <mod_scmi.h>
+#include <mod_sensor.h>
+#include <mod_stats.h>
+
+#include <fwk_event.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_scmi_sensor.h"
+
+/* Highest number of calls to the statistics API recorded by a test */
+#define MAX_RECORD_COUNT 16
+
+struct stats_record {
+    /* Index of the domain */
+    unsigned int domain_idx;
+
+    /* Level set, or histogram the sample is recorded in */
+    uint32_t level_or_type;
+
+    /* Number of levels, or value of the sample */
+    uint64_t value;
+};
+
+/* Calls made to the statistics API */
+static struct stats_record added_domains[MAX_RECORD_COUNT];
+static unsigned int added_domain_count;
+static struct stats_record added_histograms[MAX_RECORD_COUNT];
+static unsigned int added_histogram_count;
+static struct stats_record updated_domains[MAX_RECORD_COUNT];
+static unsigned int updated_domain_count;
+static struct stats_record recorded_samples[MAX_RECORD_COUNT];
+static unsigned int recorded_sample_count;
+static uint32_t init_signature;
+static int init_domain_count;
+static int init_used_domains;
+static bool stats_started;
+
+/* Last response sent to the agent */
+static int32_t respond_status;
+
+/* Reading returned by the fake sensor module */
+static int sensor_status;
+static mod_sensor_value_t sensor_value;
+
+static struct sensor_operations fake_sensor_ops_table[FAKE_SENSOR_IDX_COUNT];
+static struct mod_sensor_data fake_sensor_values[FAKE_SENSOR_IDX_COUNT];
+
+static int fake_init_stats(
+    fwk_id_t module_id,
+    uint32_t signature,
+    int domain_count,
+    int used_domains)
+{
+    TEST_ASSERT_TRUE(fwk_id_is_equal(module_id, fwk_module_id_scmi_sensor));
+
+    init_signature = signature;
+    init_domain_count = domain_count;
+    init_used_domains = used_domains;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_start_stats(fwk_id_t module_id)
+{
+    stats_started = true;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    int level_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_domain_count);
+
+    added_domains[added_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .value = (uint64_t)level_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_update_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    uint32_t level_id)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, updated_domain_count);
+
+    updated_domains[updated_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = level_id,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t min_value,
+    uint64_t bucket_width,
+    unsigned int bucket_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_histogram_count);
+
+    added_histograms[added_histogram_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = bucket_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_record_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t value)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, recorded_sample_count);
+
+    recorded_samples[recorded_sample_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = value,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_stats_api fake_stats_api = {
+    .init_stats = fake_init_stats,
+    .start_stats = fake_start_stats,
+    .add_domain = fake_add_domain,
+    .update_domain = fake_update_domain,
+    .add_histogram = fake_add_histogram,
+    .record_histogram = fake_record_histogram,
+};
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    respond_status = *(const int32_t *)payload;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api fake_scmi_api = {
+    .respond = fake_respond,
+};
+
+static int fake_sensor_get_data(fwk_id_t id, struct mod_sensor_data *data)
+{
+    if (sensor_status != FWK_PENDING) {
+        data->status = sensor_status;
+        data->value = sensor_value;
+    }
+
+    return sensor_status;
+}
+
+static const struct mod_sensor_api fake_sensor_api = {
+    .get_data = fake_sensor_get_data,
+};
+
+void setUp(void)
+{
+    unsigned int i;
+
+    memset(&scmi_sensor_ctx, 0, sizeof(scmi_sensor_ctx));
+    memset(fake_sensor_values, 0, sizeof(fake_sensor_values));
+
+    for (i = 0; i < FAKE_SENSOR_IDX_COUNT; i++) {
+        fake_sensor_ops_table[i].service_id = FWK_ID_NONE;
+    }
+
+    scmi_sensor_ctx.sensor_count = FAKE_SENSOR_IDX_COUNT;
+    scmi_sensor_ctx.scmi_api = &fake_scmi_api;
+    scmi_sensor_ctx.sensor_api = &fake_sensor_api;
+    scmi_sensor_ctx.sensor_ops_table = fake_sensor_ops_table;
+    scmi_sensor_ctx.sensor_values = fake_sensor_values;
+    scmi_sensor_ctx.stats_table = fake_stats_table;
+    scmi_sensor_ctx.stats_api = &fake_stats_api;
+
+    added_domain_count = 0;
+    added_histogram_count = 0;
+    updated_domain_count = 0;
+    recorded_sample_count = 0;
+    init_signature = 0;
+    init_domain_count = 0;
+    init_used_domains = 0;
+    stats_started = false;
+    respond_status = SCMI_GENERIC_ERROR;
+    sensor_status = FWK_SUCCESS;
+    sensor_value = 0;
+}
+
+void tearDown(void)
+{
+}
+
+/* Request a reading from the sensor as the SCMI_SENSOR_READING_GET handler */
+static int reading_get(enum fake_sensor_idx sensor_idx)
+{
+    struct fwk_event event = {
+        .id = mod_scmi_sensor_event_id_get_request,
+        .target_id = fwk_module_id_scmi_sensor,
+    };
+    struct scmi_sensor_event_parameters *params =
+        (struct scmi_sensor_event_parameters *)event.params;
+
+    params->sensor_id = FAKE_SENSOR_ID(sensor_idx);
+    scmi_sensor_ctx.sensor_ops_table[sensor_idx].service_id = FAKE_SERVICE_ID;
+
+    return scmi_sensor_process_event(&event, NULL);
+}
+
+void test_scmi_sensor_stats_start(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(MOD_STATS_SIGNATURE_SENS, init_signature);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_COUNT, init_domain_count);
+    TEST_ASSERT_EQUAL(2, init_used_domains);
+    TEST_ASSERT_TRUE(stats_started);
+
+    TEST_ASSERT_EQUAL(2, added_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_TEMP, added_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(1, added_domains[0].value);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_POWER, added_domains[1].domain_idx);
+    TEST_ASSERT_EQUAL(1, added_domains[1].value);
+
+    TEST_ASSERT_EQUAL(1, added_histogram_count);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_TEMP, added_histograms[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, added_histograms[0].level_or_type);
+    TEST_ASSERT_EQUAL(16, added_histograms[0].value);
+}
+
+void test_scmi_sensor_stats_start_disabled(void)
+{
+    scmi_sensor_ctx.stats_table = NULL;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(0, init_signature);
+    TEST_ASSERT_FALSE(stats_started);
+}
+
+void test_scmi_sensor_stats_reading(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    sensor_value = 45000;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, reading_get(FAKE_SENSOR_IDX_TEMP));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_status);
+
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_TEMP, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(0, updated_domains[0].level_or_type);
+
+    TEST_ASSERT_EQUAL(1, recorded_sample_count);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_TEMP, recorded_samples[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, recorded_samples[0].level_or_type);
+    TEST_ASSERT_EQUAL(45000, recorded_samples[0].value);
+}
+
+void test_scmi_sensor_stats_reading_async(void)
+{
+    struct fwk_event event = {
+        .id = mod_sensor_event_id_read_request,
+        .source_id = FAKE_SENSOR_ID(FAKE_SENSOR_IDX_TEMP),
+        .target_id = fwk_module_id_scmi_sensor,
+    };
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    sensor_status = FWK_PENDING;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, reading_get(FAKE_SENSOR_IDX_TEMP));
+    TEST_ASSERT_EQUAL(0, updated_domain_count);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+
+    /* The sensor module provides the reading once it is available */
+    fake_sensor_values[FAKE_SENSOR_IDX_TEMP].status = FWK_SUCCESS;
+    fake_sensor_values[FAKE_SENSOR_IDX_TEMP].value = 30000;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_process_event(&event, NULL));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_status);
+
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(1, recorded_sample_count);
+    TEST_ASSERT_EQUAL(30000, recorded_samples[0].value);
+}
+
+void test_scmi_sensor_stats_reading_failed(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    sensor_status = FWK_E_DEVICE;
+    TEST_ASSERT_EQUAL(FWK_E_PANIC, reading_get(FAKE_SENSOR_IDX_TEMP));
+    TEST_ASSERT_EQUAL(SCMI_HARDWARE_ERROR, respond_status);
+
+    TEST_ASSERT_EQUAL(0, updated_domain_count);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+}
+
+void test_scmi_sensor_stats_reading_no_histogram(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_sensor_stats_start());
+
+    sensor_value = 1200;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, reading_get(FAKE_SENSOR_IDX_POWER));
+
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_SENSOR_IDX_POWER, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+
+    /* The voltage sensor has no statistics */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, reading_get(FAKE_SENSOR_IDX_VOLTAGE));
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+}
+
+int scmi_sensor_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scmi_sensor_stats_start);
+    RUN_TEST(test_scmi_sensor_stats_start_disabled);
+    RUN_TEST(test_scmi_sensor_stats_reading);
+    RUN_TEST(test_scmi_sensor_stats_reading_async);
+    RUN_TEST(test_scmi_sensor_stats_reading_failed);
+    RUN_TEST(test_scmi_sensor_stats_reading_no_histogram);
+
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return scmi_sensor_test_main();
+}
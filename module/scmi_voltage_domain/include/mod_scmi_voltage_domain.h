@@ -15,6 +15,11 @@
 
 #include <mod_voltage_domain.h>
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+#endif
+
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -93,6 +98,22 @@ struct mod_scmi_voltd_agent {
     uint32_t domain_count;
 };
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+/*!
+ * \brief Voltage domain statistics configuration.
+ *
+ * \details The level statistics of a voltage domain track its architectural
+ *      mode, with the level identifiers given by ::mod_voltd_mode_id.
+ */
+struct mod_scmi_voltd_stats_config {
+    /*! Flag indicating that statistics are collected for this domain */
+    bool stats_collected;
+
+    /*! Histogram of the voltage levels set, in microvolts */
+    struct mod_stats_histogram_config level_histogram;
+};
+#endif
+
 /*!
  * \brief Module configuration.
  */
@@ -105,6 +126,18 @@ struct mod_scmi_voltd_config {
 
     /*! Number of agents in \ref agent_table */
     size_t agent_count;
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /*!
+     * \brief Pointer to the table of voltage domain statistics
+     *      configurations.
+     *
+     * \details The table is indexed by voltage domain and has one entry for
+     *      each element of the \c voltage_domain module. Statistics are not
+     *      collected if this is \c NULL.
+     */
+    const struct mod_scmi_voltd_stats_config *stats_table;
+#endif
 };
 
 /*!
@@ -32,6 +32,10 @@
 #    include <mod_resource_perms.h>
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+#    include <mod_stats.h>
+#endif
+
 struct voltd_operations {
     /*
      * Service identifier currently requesting operation from this voltage
@@ -40,6 +44,23 @@ struct voltd_operations {
     fwk_id_t service_id;
 };
 
+/*
+ * Voltage levels of a domain, in the format of the DESCRIBE_LEVELS response.
+ */
+struct voltd_level_table {
+    /* Status of the voltage domain queries used to build the table */
+    int status;
+
+    /* Type of the levels, discrete list or linear range */
+    enum mod_voltd_voltage_level_type level_type;
+
+    /* Number of entries in the levels table */
+    unsigned int level_count;
+
+    /* Discrete levels, or minimum, maximum and step of a linear range */
+    int32_t *levels;
+};
+
 struct scmi_voltd_ctx {
     /*! SCMI Voltage Domain Module Configuration */
     const struct mod_scmi_voltd_config *config;
@@ -62,10 +83,18 @@ struct scmi_voltd_ctx {
     /* Pointer to a table of domain operations */
     struct voltd_operations *voltd_ops;
 
+    /* Pointer to a table of domain voltage levels, built at start */
+    struct voltd_level_table *level_tables;
+
 #ifdef BUILD_HAS_MOD_RESOURCE_PERMS
     /* SCMI Resource Permissions API */
     const struct mod_res_permissions_api *res_perms_api;
 #endif
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    /* Statistics module API */
+    const struct mod_stats_api *stats_api;
+#endif
 };
 
 /*
@@ -378,6 +407,66 @@ static int scmi_voltd_config_get_handler(fwk_id_t service_id,
     return scmi_voltd_ctx.scmi_api->respond(service_id, &outmsg, outmsg_size);
 }
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+static const struct mod_scmi_voltd_stats_config *get_stats_config(
+    fwk_id_t voltd_id)
+{
+    const struct mod_scmi_voltd_stats_config *stats_config;
+
+    if (scmi_voltd_ctx.config->stats_table == NULL) {
+        return NULL;
+    }
+
+    stats_config =
+        &scmi_voltd_ctx.config->stats_table[fwk_id_get_element_idx(voltd_id)];
+
+    return stats_config->stats_collected ? stats_config : NULL;
+}
+
+static void scmi_voltd_update_mode_stats(fwk_id_t voltd_id, uint8_t mode_id)
+{
+    int status;
+
+    if (get_stats_config(voltd_id) == NULL) {
+        return;
+    }
+
+    status = scmi_voltd_ctx.stats_api->update_domain(
+        fwk_module_id_scmi_voltage_domain,
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_SCMI_VOLTAGE_DOMAIN,
+            fwk_id_get_element_idx(voltd_id)),
+        (uint32_t)mode_id);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-VOLT] %s @%d", __func__, __LINE__);
+    }
+}
+
+static void scmi_voltd_update_level_stats(fwk_id_t voltd_id, int32_t level_uv)
+{
+    int status;
+    const struct mod_scmi_voltd_stats_config *stats_config;
+
+    stats_config = get_stats_config(voltd_id);
+    if ((stats_config == NULL) ||
+        (stats_config->level_histogram.bucket_count == 0)) {
+        return;
+    }
+
+    /* Negative levels are counted in the first bucket */
+    status = scmi_voltd_ctx.stats_api->record_histogram(
+        fwk_module_id_scmi_voltage_domain,
+        FWK_ID_ELEMENT(
+            FWK_MODULE_IDX_SCMI_VOLTAGE_DOMAIN,
+            fwk_id_get_element_idx(voltd_id)),
+        MOD_STATS_HISTOGRAM_VALUE,
+        (level_uv < 0) ? 0 : (uint64_t)level_uv);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_DEBUG("[SCMI-VOLT] %s @%d", __func__, __LINE__);
+    }
+}
+#endif
+
 static int scmi_voltd_config_set_handler(fwk_id_t service_id,
     const uint32_t *payload)
 {
@@ -434,6 +523,11 @@ static int scmi_voltd_config_set_handler(fwk_id_t service_id,
 
         if (status == FWK_SUCCESS) {
             outmsg.status = SCMI_SUCCESS;
+#ifdef BUILD_HAS_MOD_STATISTICS
+            if (mode_type == (uint8_t)MOD_VOLTD_MODE_TYPE_ARCH) {
+                scmi_voltd_update_mode_stats(device->element_id, mode_id);
+            }
+#endif
         } else {
             outmsg.status = SCMI_INVALID_PARAMETERS;
         }
@@ -506,6 +600,9 @@ static int scmi_voltd_level_set_handler(fwk_id_t service_id,
     switch (status) {
     case FWK_SUCCESS:
         outmsg.status = SCMI_SUCCESS;
+#ifdef BUILD_HAS_MOD_STATISTICS
+        scmi_voltd_update_level_stats(device->element_id, inmsg->voltage_level);
+#endif
         break;
     case FWK_E_RANGE:
         outmsg.status = SCMI_INVALID_PARAMETERS;
@@ -532,12 +629,12 @@ static int scmi_voltd_describe_levels_handler(fwk_id_t service_id,
         .status = SCMI_GENERIC_ERROR,
     };
     const struct mod_scmi_from_protocol_api *scmi_api = scmi_voltd_ctx.scmi_api;
-    const struct mod_voltd_api *voltd_api = scmi_voltd_ctx.voltd_api;
+    const struct voltd_level_table *level_table = NULL;
     size_t payload_size = sizeof(outmsg);
     size_t max_payload_size = 0;
     size_t max_level_items = 0;
-    struct mod_voltd_info info = { };
     uint32_t level_index = 0;
+    unsigned int level_count = 0;
 
     inmsg = (const struct scmi_voltd_describe_levels_a2p*)(void *)payload;
     level_index = inmsg->level_index;
@@ -561,18 +658,18 @@ static int scmi_voltd_describe_levels_handler(fwk_id_t service_id,
     else
         max_level_items = (max_payload_size - sizeof(outmsg)) / sizeof(int32_t);
 
-    status = voltd_api->get_info(device->element_id, &info);
-    if (status != FWK_SUCCESS)
+    level_table = &scmi_voltd_ctx.level_tables[fwk_id_get_element_idx(
+        device->element_id)];
+    if (level_table->status != FWK_SUCCESS) {
+        status = level_table->status;
         goto exit;
+    }
 
-    if (info.level_range.level_type == MOD_VOLTD_VOLTAGE_LEVEL_DISCRETE) {
+    if (level_table->level_type == MOD_VOLTD_VOLTAGE_LEVEL_DISCRETE) {
         /* The domain has a discrete list of voltage levels */
-        int32_t level_uv = 0;
-        unsigned int i = 0;
-        unsigned int level_count = 0;
         unsigned int remaining_levels;
 
-        if (level_index >= info.level_range.level_count) {
+        if (level_index >= level_table->level_count) {
             outmsg.status = SCMI_OUT_OF_RANGE;
             goto exit;
         }
@@ -584,32 +681,16 @@ static int scmi_voltd_describe_levels_handler(fwk_id_t service_id,
         }
 
         level_count = FWK_MIN(max_level_items,
-                              info.level_range.level_count - level_index);
+                              level_table->level_count - level_index);
 
-        remaining_levels = (info.level_range.level_count - level_index) -
+        remaining_levels = (level_table->level_count - level_index) -
                            level_count;
 
         /* Set number of returned levels in the message payload */
         outmsg.flags = SCMI_VOLTD_LEVEL_LIST_FLAGS(level_count,
                                                    remaining_levels);
-
-        /* Set each level entry in the payload to the related voltage level */
-        for (i = 0; i < level_count; i++, payload_size += sizeof(level_uv)) {
-            status = voltd_api->get_level_from_index(device->element_id,
-                                                     level_index + i, &level_uv);
-            if (status != FWK_SUCCESS)
-                goto exit;
-
-            status = scmi_api->write_payload(service_id, payload_size,
-                                             &level_uv, sizeof(level_uv));
-            if (status != FWK_SUCCESS)
-                goto exit;
-        }
     } else {
         /* The voltage domain has a linear level stepping */
-        int32_t voltd_range[3] = { info.level_range.min_uv,
-                                   info.level_range.max_uv,
-                                   info.level_range.step_uv };
 
         /* Is the payload area large enough to return the complete triplet? */
         if (max_level_items < 3) {
@@ -617,15 +698,20 @@ static int scmi_voltd_describe_levels_handler(fwk_id_t service_id,
             goto exit;
         }
 
+        level_index = 0;
+        level_count = 3;
+
         outmsg.flags = SCMI_VOLTD_LEVEL_RANGE_FLAGS;
+    }
 
-        status = scmi_api->write_payload(service_id, payload_size,
-                                         &voltd_range, sizeof(voltd_range));
-        if (status != FWK_SUCCESS)
-            goto exit;
+    /* Copy the requested window of the levels table in a single write */
+    status = scmi_api->write_payload(service_id, payload_size,
+                                     &level_table->levels[level_index],
+                                     level_count * sizeof(int32_t));
+    if (status != FWK_SUCCESS)
+        goto exit;
 
-        payload_size += sizeof(voltd_range);
-    }
+    payload_size += level_count * sizeof(int32_t);
 
     outmsg.status = SCMI_SUCCESS;
     status = scmi_api->write_payload(service_id, 0, &outmsg, sizeof(outmsg));
@@ -748,6 +834,16 @@ static int scmi_voltd_bind(fwk_id_t id, unsigned int round)
         return status;
 #endif
 
+#ifdef BUILD_HAS_MOD_STATISTICS
+    if (scmi_voltd_ctx.config->stats_table != NULL) {
+        status = fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_STATISTICS),
+                                 mod_stats_api_id_stats,
+                                 &scmi_voltd_ctx.stats_api);
+        if (status != FWK_SUCCESS)
+            return status;
+    }
+#endif
+
     return fwk_module_bind(FWK_ID_MODULE(FWK_MODULE_IDX_VOLTAGE_DOMAIN),
                            FWK_ID_API(FWK_MODULE_IDX_VOLTAGE_DOMAIN, 0),
                            &scmi_voltd_ctx.voltd_api);
@@ -764,11 +860,156 @@ static int scmi_voltd_process_bind_request(fwk_id_t source_id,
     return FWK_SUCCESS;
 }
 
+static void scmi_voltd_build_level_table(unsigned int voltd_idx)
+{
+    int status = 0;
+    unsigned int i = 0;
+    struct mod_voltd_info info = { };
+    struct voltd_level_table *level_table = NULL;
+    int32_t *levels = NULL;
+    fwk_id_t voltd_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE_DOMAIN,
+                                       voltd_idx);
+
+    level_table = &scmi_voltd_ctx.level_tables[voltd_idx];
+
+    level_table->status = scmi_voltd_ctx.voltd_api->get_info(voltd_id, &info);
+    if (level_table->status != FWK_SUCCESS)
+        return;
+
+    if (info.level_range.level_type == MOD_VOLTD_VOLTAGE_LEVEL_DISCRETE) {
+        levels = fwk_mm_calloc(
+            (unsigned int)info.level_range.level_count, sizeof(int32_t));
+
+        for (i = 0; i < info.level_range.level_count; i++) {
+            status = scmi_voltd_ctx.voltd_api->get_level_from_index(voltd_id,
+                                                                    i,
+                                                                    &levels[i]);
+            if (status != FWK_SUCCESS) {
+                fwk_mm_free(levels);
+                level_table->status = status;
+                return;
+            }
+        }
+
+        level_table->level_count = (unsigned int)info.level_range.level_count;
+    } else {
+        levels = fwk_mm_calloc(3, sizeof(int32_t));
+
+        levels[0] = info.level_range.min_uv;
+        levels[1] = info.level_range.max_uv;
+        levels[2] = info.level_range.step_uv;
+
+        level_table->level_count = 3;
+    }
+
+    level_table->level_type = info.level_range.level_type;
+    level_table->levels = levels;
+}
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+static int scmi_voltd_stats_start(void)
+{
+    const struct mod_scmi_voltd_stats_config *stats_config;
+    int status = 0;
+    int stats_domains = 0;
+    unsigned int i = 0;
+    uint8_t mode_type, mode_id;
+    fwk_id_t domain_id;
+
+    if (scmi_voltd_ctx.config->stats_table == NULL)
+        return FWK_SUCCESS;
+
+    /* Count how many voltage domains have statistics */
+    for (i = 0; i < (unsigned int)scmi_voltd_ctx.voltd_devices; i++) {
+        if (scmi_voltd_ctx.config->stats_table[i].stats_collected)
+            stats_domains++;
+    }
+
+    status = scmi_voltd_ctx.stats_api->init_stats(
+        fwk_module_id_scmi_voltage_domain,
+        MOD_STATS_SIGNATURE_VOLT,
+        scmi_voltd_ctx.voltd_devices,
+        stats_domains);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    for (i = 0; i < (unsigned int)scmi_voltd_ctx.voltd_devices; i++) {
+        stats_config = &scmi_voltd_ctx.config->stats_table[i];
+        if (!stats_config->stats_collected)
+            continue;
+
+        /* One level for each architectural mode */
+        domain_id = FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI_VOLTAGE_DOMAIN, i);
+        status = scmi_voltd_ctx.stats_api->add_domain(
+            fwk_module_id_scmi_voltage_domain,
+            domain_id,
+            (int)MOD_VOLTD_MODE_ID_ON + 1);
+        if (status != FWK_SUCCESS)
+            return status;
+
+        if (stats_config->level_histogram.bucket_count != 0) {
+            status = scmi_voltd_ctx.stats_api->add_histogram(
+                fwk_module_id_scmi_voltage_domain,
+                domain_id,
+                MOD_STATS_HISTOGRAM_VALUE,
+                stats_config->level_histogram.min_value,
+                stats_config->level_histogram.bucket_width,
+                stats_config->level_histogram.bucket_count);
+            if (status != FWK_SUCCESS)
+                return status;
+        }
+    }
+
+    status = scmi_voltd_ctx.stats_api->start_stats(
+        fwk_module_id_scmi_voltage_domain);
+    if (status != FWK_SUCCESS)
+        return status;
+
+    /* Start from the mode the domains are in */
+    for (i = 0; i < (unsigned int)scmi_voltd_ctx.voltd_devices; i++) {
+        if (!scmi_voltd_ctx.config->stats_table[i].stats_collected)
+            continue;
+
+        status = scmi_voltd_ctx.voltd_api->get_config(
+            FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE_DOMAIN, i),
+            &mode_type,
+            &mode_id);
+        if ((status == FWK_SUCCESS) &&
+            (mode_type == (uint8_t)MOD_VOLTD_MODE_TYPE_ARCH)) {
+            scmi_voltd_update_mode_stats(
+                FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE_DOMAIN, i), mode_id);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
+static int scmi_voltd_start(fwk_id_t id)
+{
+    unsigned int i = 0;
+
+    /* Tables for VOLTAGE_DOMAIN_DESCRIBE_LEVELS */
+    scmi_voltd_ctx.level_tables =
+        fwk_mm_calloc((unsigned int)scmi_voltd_ctx.voltd_devices,
+                      sizeof(struct voltd_level_table));
+
+    for (i = 0; i < (unsigned int)scmi_voltd_ctx.voltd_devices; i++)
+        scmi_voltd_build_level_table(i);
+
+#ifdef BUILD_HAS_MOD_STATISTICS
+    return scmi_voltd_stats_start();
+#else
+    return FWK_SUCCESS;
+#endif
+}
+
 /* SCMI Voltage Domain Management Protocol Definition */
 const struct fwk_module module_scmi_voltage_domain = {
     .api_count = 1,
     .type = FWK_MODULE_TYPE_PROTOCOL,
     .init = scmi_voltd_init,
     .bind = scmi_voltd_bind,
+    .start = scmi_voltd_start,
     .process_bind_request = scmi_voltd_process_bind_request,
 };
@@ -0,0 +1,73 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_scmi_voltage_domain.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module_idx.h>
+
+enum fake_agent_idx {
+    FAKE_AGENT_IDX_OSPM,
+    FAKE_AGENT_IDX_COUNT,
+};
+
+enum fake_voltd_idx {
+    FAKE_VOLTD_IDX_CPU,
+    FAKE_VOLTD_IDX_GPU,
+    FAKE_VOLTD_IDX_IO,
+    FAKE_VOLTD_IDX_COUNT,
+};
+
+#define FAKE_VOLTD_ID(IDX) FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE_DOMAIN, IDX)
+
+#define FAKE_SERVICE_ID FWK_ID_ELEMENT(FWK_MODULE_IDX_SCMI, FAKE_AGENT_IDX_OSPM)
+
+static struct mod_scmi_voltd_device fake_device_table[FAKE_VOLTD_IDX_COUNT] = {
+    [FAKE_VOLTD_IDX_CPU] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_VOLTAGE_DOMAIN, FAKE_VOLTD_IDX_CPU),
+    },
+    [FAKE_VOLTD_IDX_GPU] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_VOLTAGE_DOMAIN, FAKE_VOLTD_IDX_GPU),
+    },
+    [FAKE_VOLTD_IDX_IO] = {
+        .element_id = FWK_ID_ELEMENT_INIT(
+            FWK_MODULE_IDX_VOLTAGE_DOMAIN, FAKE_VOLTD_IDX_IO),
+    },
+};
+
+static const struct mod_scmi_voltd_agent fake_agent_table
+    [FAKE_AGENT_IDX_COUNT] = {
+    [FAKE_AGENT_IDX_OSPM] = {
+        .device_table = fake_device_table,
+        .domain_count = FWK_ARRAY_SIZE(fake_device_table),
+    },
+};
+
+/* Statistics of the CPU domain, with a histogram, and of the GPU domain */
+static const struct mod_scmi_voltd_stats_config fake_stats_table
+    [FAKE_VOLTD_IDX_COUNT] = {
+    [FAKE_VOLTD_IDX_CPU] = {
+        .stats_collected = true,
+        .level_histogram = {
+            .min_value = 600000,
+            .bucket_width = 50000,
+            .bucket_count = 10,
+        },
+    },
+    [FAKE_VOLTD_IDX_GPU] = {
+        .stats_collected = true,
+    },
+};
+
+static const struct mod_scmi_voltd_config fake_config = {
+    .agent_table = fake_agent_table,
+    .agent_count = FWK_ARRAY_SIZE(fake_agent_table),
+    .stats_table = fake_stats_table,
+};
@@ -0,0 +1,436 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <mod_scmi.h>
+#include <mod_stats.h>
+#include <mod_voltage_domain.h>
+
+#include <fwk_element.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_scmi_voltage_domain.h"
+
+/* Highest number of calls to the statistics API recorded by a test */
+#define MAX_RECORD_COUNT 16
+
+struct stats_record {
+    /* Index of the domain */
+    unsigned int domain_idx;
+
+    /* Level set, or histogram the sample is recorded in */
+    uint32_t level_or_type;
+
+    /* Number of levels, or value of the sample */
+    uint64_t value;
+};
+
+/* Calls made to the statistics API */
+static struct stats_record added_domains[MAX_RECORD_COUNT];
+static unsigned int added_domain_count;
+static struct stats_record added_histograms[MAX_RECORD_COUNT];
+static unsigned int added_histogram_count;
+static struct stats_record updated_domains[MAX_RECORD_COUNT];
+static unsigned int updated_domain_count;
+static struct stats_record recorded_samples[MAX_RECORD_COUNT];
+static unsigned int recorded_sample_count;
+static uint32_t init_signature;
+static int init_domain_count;
+static int init_used_domains;
+static bool stats_started;
+
+/* Last response sent to the agent */
+static int32_t respond_status;
+
+/* Status returned by the fake voltage domain module */
+static int voltd_status;
+
+/* Modes reported by the fake voltage domain module */
+static uint8_t voltd_mode_types[FAKE_VOLTD_IDX_COUNT];
+static uint8_t voltd_mode_ids[FAKE_VOLTD_IDX_COUNT];
+
+static int fake_init_stats(
+    fwk_id_t module_id,
+    uint32_t signature,
+    int domain_count,
+    int used_domains)
+{
+    TEST_ASSERT_TRUE(
+        fwk_id_is_equal(module_id, fwk_module_id_scmi_voltage_domain));
+
+    init_signature = signature;
+    init_domain_count = domain_count;
+    init_used_domains = used_domains;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_start_stats(fwk_id_t module_id)
+{
+    stats_started = true;
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    int level_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_domain_count);
+
+    added_domains[added_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .value = (uint64_t)level_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_update_domain(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    uint32_t level_id)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, updated_domain_count);
+
+    updated_domains[updated_domain_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = level_id,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_add_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t min_value,
+    uint64_t bucket_width,
+    unsigned int bucket_count)
+{
+    TEST_ASSERT_FALSE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, added_histogram_count);
+
+    added_histograms[added_histogram_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = bucket_count,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static int fake_record_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t value)
+{
+    TEST_ASSERT_TRUE(stats_started);
+    TEST_ASSERT_LESS_THAN(MAX_RECORD_COUNT, recorded_sample_count);
+
+    recorded_samples[recorded_sample_count++] = (struct stats_record){
+        .domain_idx = fwk_id_get_element_idx(domain_id),
+        .level_or_type = (uint32_t)type,
+        .value = value,
+    };
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_stats_api fake_stats_api = {
+    .init_stats = fake_init_stats,
+    .start_stats = fake_start_stats,
+    .add_domain = fake_add_domain,
+    .update_domain = fake_update_domain,
+    .add_histogram = fake_add_histogram,
+    .record_histogram = fake_record_histogram,
+};
+
+static int fake_get_agent_id(fwk_id_t service_id, unsigned int *agent_id)
+{
+    *agent_id = fwk_id_get_element_idx(service_id);
+
+    return FWK_SUCCESS;
+}
+
+static int fake_respond(fwk_id_t service_id, const void *payload, size_t size)
+{
+    respond_status = *(const int32_t *)payload;
+
+    return FWK_SUCCESS;
+}
+
+static const struct mod_scmi_from_protocol_api fake_scmi_api = {
+    .get_agent_id = fake_get_agent_id,
+    .respond = fake_respond,
+};
+
+static int fake_voltd_set_level(fwk_id_t voltd_id, int32_t level_uv)
+{
+    return voltd_status;
+}
+
+static int fake_voltd_set_config(
+    fwk_id_t voltd_id,
+    uint8_t mode_type,
+    uint8_t mode_id)
+{
+    return voltd_status;
+}
+
+static int fake_voltd_get_config(
+    fwk_id_t voltd_id,
+    uint8_t *mode_type,
+    uint8_t *mode_id)
+{
+    *mode_type = voltd_mode_types[fwk_id_get_element_idx(voltd_id)];
+    *mode_id = voltd_mode_ids[fwk_id_get_element_idx(voltd_id)];
+
+    return voltd_status;
+}
+
+static const struct mod_voltd_api fake_voltd_api = {
+    .set_level = fake_voltd_set_level,
+    .set_config = fake_voltd_set_config,
+    .get_config = fake_voltd_get_config,
+};
+
+void setUp(void)
+{
+    memset(&scmi_voltd_ctx, 0, sizeof(scmi_voltd_ctx));
+
+    scmi_voltd_ctx.config = &fake_config;
+    scmi_voltd_ctx.agent_table = fake_config.agent_table;
+    scmi_voltd_ctx.voltd_devices = FAKE_VOLTD_IDX_COUNT;
+    scmi_voltd_ctx.scmi_api = &fake_scmi_api;
+    scmi_voltd_ctx.voltd_api = &fake_voltd_api;
+    scmi_voltd_ctx.stats_api = &fake_stats_api;
+
+    fwk_module_is_valid_element_id_IgnoreAndReturn(true);
+
+    added_domain_count = 0;
+    added_histogram_count = 0;
+    updated_domain_count = 0;
+    recorded_sample_count = 0;
+    init_signature = 0;
+    init_domain_count = 0;
+    init_used_domains = 0;
+    stats_started = false;
+    respond_status = SCMI_GENERIC_ERROR;
+    voltd_status = FWK_SUCCESS;
+
+    memset(voltd_mode_types, MOD_VOLTD_MODE_TYPE_ARCH, sizeof(voltd_mode_types));
+    memset(voltd_mode_ids, MOD_VOLTD_MODE_ID_OFF, sizeof(voltd_mode_ids));
+}
+
+void tearDown(void)
+{
+}
+
+static void start_stats(void)
+{
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_voltd_stats_start());
+
+    updated_domain_count = 0;
+}
+
+static int level_set(enum fake_voltd_idx voltd_idx, int32_t level_uv)
+{
+    struct scmi_voltd_level_set_a2p payload = {
+        .domain_id = voltd_idx,
+        .voltage_level = level_uv,
+    };
+
+    return scmi_voltd_level_set_handler(
+        FAKE_SERVICE_ID, (const uint32_t *)&payload);
+}
+
+static int config_set(enum fake_voltd_idx voltd_idx, uint32_t config)
+{
+    struct scmi_voltd_config_set_a2p payload = {
+        .domain_id = voltd_idx,
+        .config = config,
+    };
+
+    return scmi_voltd_config_set_handler(
+        FAKE_SERVICE_ID, (const uint32_t *)&payload);
+}
+
+void test_scmi_voltd_stats_start(void)
+{
+    voltd_mode_ids[FAKE_VOLTD_IDX_CPU] = MOD_VOLTD_MODE_ID_ON;
+    voltd_mode_types[FAKE_VOLTD_IDX_GPU] = MOD_VOLTD_MODE_TYPE_IMPL;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_voltd_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(MOD_STATS_SIGNATURE_VOLT, init_signature);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_COUNT, init_domain_count);
+    TEST_ASSERT_EQUAL(2, init_used_domains);
+    TEST_ASSERT_TRUE(stats_started);
+
+    /* One level for each architectural mode */
+    TEST_ASSERT_EQUAL(2, added_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_CPU, added_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(2, added_domains[0].value);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_GPU, added_domains[1].domain_idx);
+    TEST_ASSERT_EQUAL(2, added_domains[1].value);
+
+    TEST_ASSERT_EQUAL(1, added_histogram_count);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_CPU, added_histograms[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, added_histograms[0].level_or_type);
+    TEST_ASSERT_EQUAL(10, added_histograms[0].value);
+
+    /* Only the domains in an architectural mode start from it */
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_CPU, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(MOD_VOLTD_MODE_ID_ON, updated_domains[0].level_or_type);
+}
+
+void test_scmi_voltd_stats_start_disabled(void)
+{
+    struct mod_scmi_voltd_config config = fake_config;
+
+    config.stats_table = NULL;
+    scmi_voltd_ctx.config = &config;
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, scmi_voltd_stats_start());
+
+    TEST_ASSERT_EQUAL_HEX32(0, init_signature);
+    TEST_ASSERT_FALSE(stats_started);
+}
+
+void test_scmi_voltd_stats_level_set(void)
+{
+    start_stats();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, level_set(FAKE_VOLTD_IDX_CPU, 850000));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_status);
+
+    TEST_ASSERT_EQUAL(1, recorded_sample_count);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_CPU, recorded_samples[0].domain_idx);
+    TEST_ASSERT_EQUAL(
+        MOD_STATS_HISTOGRAM_VALUE, recorded_samples[0].level_or_type);
+    TEST_ASSERT_EQUAL(850000, recorded_samples[0].value);
+}
+
+void test_scmi_voltd_stats_level_set_negative(void)
+{
+    start_stats();
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, level_set(FAKE_VOLTD_IDX_CPU, -1000));
+
+    TEST_ASSERT_EQUAL(1, recorded_sample_count);
+    TEST_ASSERT_EQUAL(0, recorded_samples[0].value);
+}
+
+void test_scmi_voltd_stats_level_set_failed(void)
+{
+    start_stats();
+
+    voltd_status = FWK_E_RANGE;
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, level_set(FAKE_VOLTD_IDX_CPU, 850000));
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, respond_status);
+
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+}
+
+void test_scmi_voltd_stats_level_set_no_histogram(void)
+{
+    start_stats();
+
+    /* GPU has statistics without a histogram, IO has none */
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, level_set(FAKE_VOLTD_IDX_GPU, 850000));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, level_set(FAKE_VOLTD_IDX_IO, 850000));
+
+    TEST_ASSERT_EQUAL(0, recorded_sample_count);
+}
+
+void test_scmi_voltd_stats_config_set(void)
+{
+    start_stats();
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        config_set(
+            FAKE_VOLTD_IDX_GPU,
+            SCMI_VOLTD_MODE_TYPE_ARCH | SCMI_VOLTD_MODE_ID_ON));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_status);
+
+    TEST_ASSERT_EQUAL(1, updated_domain_count);
+    TEST_ASSERT_EQUAL(FAKE_VOLTD_IDX_GPU, updated_domains[0].domain_idx);
+    TEST_ASSERT_EQUAL(MOD_VOLTD_MODE_ID_ON, updated_domains[0].level_or_type);
+
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        config_set(
+            FAKE_VOLTD_IDX_GPU,
+            SCMI_VOLTD_MODE_TYPE_ARCH | SCMI_VOLTD_MODE_ID_OFF));
+
+    TEST_ASSERT_EQUAL(2, updated_domain_count);
+    TEST_ASSERT_EQUAL(MOD_VOLTD_MODE_ID_OFF, updated_domains[1].level_or_type);
+}
+
+void test_scmi_voltd_stats_config_set_impl(void)
+{
+    start_stats();
+
+    /* Implementation defined modes are not tracked */
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        config_set(FAKE_VOLTD_IDX_GPU, SCMI_VOLTD_MODE_TYPE_IMPL | 0x1));
+    TEST_ASSERT_EQUAL(SCMI_SUCCESS, respond_status);
+
+    TEST_ASSERT_EQUAL(0, updated_domain_count);
+}
+
+void test_scmi_voltd_stats_config_set_failed(void)
+{
+    start_stats();
+
+    voltd_status = FWK_E_DEVICE;
+    TEST_ASSERT_EQUAL(
+        FWK_SUCCESS,
+        config_set(
+            FAKE_VOLTD_IDX_GPU,
+            SCMI_VOLTD_MODE_TYPE_ARCH | SCMI_VOLTD_MODE_ID_ON));
+    TEST_ASSERT_EQUAL(SCMI_INVALID_PARAMETERS, respond_status);
+
+    TEST_ASSERT_EQUAL(0, updated_domain_count);
+}
+
+int scmi_voltage_domain_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_scmi_voltd_stats_start);
+    RUN_TEST(test_scmi_voltd_stats_start_disabled);
+    RUN_TEST(test_scmi_voltd_stats_level_set);
+    RUN_TEST(test_scmi_voltd_stats_level_set_negative);
+    RUN_TEST(test_scmi_voltd_stats_level_set_failed);
+    RUN_TEST(test_scmi_voltd_stats_level_set_no_histogram);
+    RUN_TEST(test_scmi_voltd_stats_config_set);
+    RUN_TEST(test_scmi_voltd_stats_config_set_impl);
+    RUN_TEST(test_scmi_voltd_stats_config_set_failed);
+
+    return UNITY_END();
+}
+
+int main(void)
+{
+    return scmi_voltage_domain_test_main();
+}
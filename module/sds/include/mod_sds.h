@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -10,6 +10,8 @@
 
 #include <fwk_element.h>
 #include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_module.h>
 #include <fwk_module_idx.h>
 
 #include <stdbool.h>
@@ -54,6 +56,69 @@
 /*! Mask for the major version field. */
 #define MOD_SDS_ID_VERSION_MAJOR_MASK 0xFF000000
 
+/*!
+ * \brief Header of a live Shared Data Structure.
+ *
+ * \details Live structures are intended for data that is published often,
+ *      such as telemetry. Their content starts with this header, followed by
+ *      two buffers, each made of a ::mod_sds_live_buffer_header and the
+ *      payload. The SCP only ever writes to the buffer that is not currently
+ *      published, and then flips ::mod_sds_live_header::sequence to it.
+ *
+ *      A reader obtains a consistent snapshot by:
+ *      1. Reading `sequence`. If it is zero, nothing has been published yet.
+ *      2. Reading the `generation` of buffer `sequence % 2`.
+ *      3. Copying the payload of that buffer.
+ *      4. Reading the `generation` of that buffer again.
+ *
+ *      The snapshot is valid if both reads of `generation` are equal to
+ *      `sequence`. Otherwise the buffer was being rewritten during the copy
+ *      and the reader should start again.
+ */
+struct mod_sds_live_header {
+    /*!
+     * \brief Generation of the most recently published buffer.
+     *
+     * \details The published buffer is the one at index `sequence % 2`. Zero
+     *      indicates that no data has been published yet.
+     */
+    uint32_t sequence;
+
+    /*! Reserved */
+    uint32_t reserved;
+};
+
+/*!
+ * \brief Header of each buffer of a live Shared Data Structure.
+ */
+struct mod_sds_live_buffer_header {
+    /*!
+     * \brief Generation of the data held in the buffer.
+     *
+     * \details Set to zero while the buffer is being written.
+     */
+    uint32_t generation;
+
+    /*! Reserved */
+    uint32_t reserved;
+};
+
+/*!
+ * \brief Size, in bytes, of each buffer of a live Shared Data Structure with
+ *      a payload of the given size.
+ */
+#define MOD_SDS_LIVE_BUFFER_SIZE(PAYLOAD_SIZE) \
+    (sizeof(struct mod_sds_live_buffer_header) + \
+     FWK_ALIGN_NEXT((PAYLOAD_SIZE), 8))
+
+/*!
+ * \brief Total size, in bytes, of a live Shared Data Structure with a payload
+ *      of the given size.
+ */
+#define MOD_SDS_LIVE_STRUCT_SIZE(PAYLOAD_SIZE) \
+    (sizeof(struct mod_sds_live_header) + \
+     (2 * MOD_SDS_LIVE_BUFFER_SIZE(PAYLOAD_SIZE)))
+
 /*!
  * \brief Element descriptor that describes an SDS region that will be
  *      automatically created during module initialization.
@@ -88,7 +153,10 @@ struct mod_sds_structure_desc {
     /*! Identifier of the SDS region containing the structure. */
     uint32_t region_id;
 
-    /*! Size, in bytes, of the structure. */
+    /*!
+     * Size, in bytes, of the structure. For live structures, this is the size
+     * of the payload of each buffer.
+     */
     size_t size;
 
     /*!
@@ -101,6 +169,14 @@ struct mod_sds_structure_desc {
 
     /*! Set the valid flag in the structure if true. */
     bool finalize;
+
+    /*!
+     * Create the structure as a double-buffered live structure, updated
+     * through ::mod_sds_api::struct_publish. See ::mod_sds_live_header for
+     * its layout. If a payload is given, it is published as the first
+     * generation.
+     */
+    bool live;
 };
 
 /*!
@@ -121,8 +197,30 @@ struct mod_sds_config {
     /*! Identifier of the clock that this module depends on */
     fwk_id_t clock_id;
 #endif
+
+#ifdef BUILD_HAS_BOOT_PROFILE
+    /*!
+     * Identifier of the structure the boot-time profile of the modules is
+     * published to, or zero to not publish it. The structure holds one
+     * ::fwk_module_boot_profile per module, in the order of the module indices,
+     * and must be at least ::MOD_SDS_BOOT_PROFILE_SIZE bytes.
+     *
+     * The profile is published by the deferred start function of this module.
+     * The deferred start time is only available for the modules with a lower
+     * index than this module.
+     */
+    uint32_t boot_profile_struct_id;
+#endif
 };
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+/*!
+ * \brief Size of the boot-time profile structure.
+ */
+#    define MOD_SDS_BOOT_PROFILE_SIZE \
+        (sizeof(struct fwk_module_boot_profile) * FWK_MODULE_IDX_COUNT)
+#endif
+
 /*!
  * \brief SDS notification indices.
  */
@@ -226,6 +324,32 @@ struct mod_sds_api {
      * \retval ::FWK_E_STATE The structure has already been finalized.
      */
     int (*struct_finalize)(uint32_t structure_id);
+
+    /*!
+     * \brief Publish a new snapshot of a live Shared Data Structure.
+     *
+     * \details Write the data into the buffer of the structure that is not
+     *      currently published, then make it the published buffer. Readers
+     *      never observe a partially written snapshot as long as they follow
+     *      the protocol described in ::mod_sds_live_header.
+     *
+     * \param structure_id The identifier of the live Shared Data Structure to
+     *      publish to.
+     *
+     * \param data Pointer to the payload to publish.
+     *
+     * \param size Size, in bytes, of the payload.
+     *
+     * \retval ::FWK_SUCCESS The snapshot was successfully published.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered:
+     *      - The `data` parameter was a null pointer value.
+     *      - The `size` parameter was zero.
+     *      - An invalid structure identifier was provided.
+     *      - The structure is not a live structure.
+     * \retval ::FWK_E_RANGE The payload does not fit in the structure buffers.
+     */
+    int (*struct_publish)(uint32_t structure_id, const void *data,
+                          size_t size);
 };
 
 /*!
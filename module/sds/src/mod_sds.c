@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,8 +21,10 @@
 #include <fwk_notification.h>
 #include <fwk_status.h>
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 /* Arbitrary, 16 bit value that indicates a valid SDS Memory Region */
 #define REGION_SIGNATURE 0xAA7A
@@ -102,6 +104,24 @@ struct region_descriptor {
     uint32_t region_size;
 };
 
+/* Entry of the structure directory, mapping a structure ID to its location */
+struct directory_entry {
+    /* Structure identifier. Zero marks an unused entry. */
+    uint32_t id;
+
+    /* Index of the SDS Memory Region holding the structure */
+    uint32_t region_idx;
+
+    /* Offset of the Structure Header from the base of its region, in bytes */
+    uint32_t offset;
+
+    /* Size of the structure content, in bytes */
+    uint32_t size;
+
+    /* Whether the structure is a double-buffered live structure */
+    bool live;
+};
+
 /* Module context structure*/
 struct sds_ctx {
     struct {
@@ -111,6 +131,23 @@ struct sds_ctx {
         /* Pointer to the next free memory address in the SDS Memory Region. */
         volatile char *free_mem_base;
     } *regions;
+
+    /*
+     * RAM copy of the location of every structure in the SDS Memory Regions,
+     * indexed by a hash of the structure ID. This table is rebuilt every time
+     * the regions are initialized, and avoids walking the shared memory on
+     * every access.
+     */
+    struct directory_entry *directory;
+
+    /* Number of entries in the directory, always a power of two */
+    unsigned int directory_size;
+
+    /* Number of entries allocated for the directory */
+    unsigned int directory_capacity;
+
+    /* Number of bits used to index the directory */
+    unsigned int directory_bits;
 };
 
 /* Module context */
@@ -173,6 +210,172 @@ static int validate_structure_access(
     return FWK_SUCCESS;
 }
 
+/*
+ * Fibonacci hashing of a structure ID into a directory index. The upper bits of
+ * the product are used as they depend on every bit of the identifier.
+ */
+static unsigned int directory_hash(uint32_t structure_id)
+{
+    return (unsigned int)((structure_id * UINT32_C(0x9E3779B1)) >>
+                          (32U - ctx.directory_bits));
+}
+
+/*
+ * Find the directory entry for a given structure ID, or the unused entry where
+ * it would be inserted if the structure is not present. NULL is returned if the
+ * structure is not present and the directory is full.
+ */
+static struct directory_entry *directory_find(uint32_t structure_id)
+{
+    struct directory_entry *entry;
+    unsigned int idx;
+    unsigned int probe;
+
+    idx = directory_hash(structure_id);
+
+    for (probe = 0; probe < ctx.directory_size; probe++) {
+        entry = &ctx.directory[idx];
+        if ((entry->id == structure_id) || (entry->id == 0)) {
+            return entry;
+        }
+
+        idx = (idx + 1) & (ctx.directory_size - 1);
+    }
+
+    return NULL;
+}
+
+static int directory_insert(
+    uint32_t structure_id,
+    unsigned int region_idx,
+    uint32_t offset,
+    uint32_t size)
+{
+    struct directory_entry *entry;
+
+    entry = directory_find(structure_id);
+    if (entry == NULL) {
+        return FWK_E_NOMEM;
+    }
+
+    if (entry->id != 0) {
+        /* Keep the first occurrence, as a region walk would */
+        return FWK_SUCCESS;
+    }
+
+    *entry = (struct directory_entry){
+        .id = structure_id,
+        .region_idx = (uint32_t)region_idx,
+        .offset = offset,
+        .size = size,
+    };
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Build the structure directory from the contents of the SDS Memory Regions,
+ * discarding any previous contents as the regions may have been recreated.
+ * The directory is sized so that, once every element structure has been
+ * allocated, it is at most half full. The table is only reallocated when the
+ * regions hold more structures than it was allocated for.
+ */
+static int directory_build(unsigned int element_count)
+{
+    const struct mod_sds_config *config;
+    volatile struct region_descriptor *region_desc;
+    volatile struct structure_header *header;
+    unsigned int region_idx, struct_idx;
+    unsigned int struct_count = element_count;
+    uint32_t offset;
+    int status;
+
+    config = fwk_module_get_data(fwk_module_id_sds);
+
+    for (region_idx = 0; region_idx < config->region_count; region_idx++) {
+        region_desc = (volatile struct region_descriptor *)(
+            config->regions[region_idx].base);
+        struct_count += region_desc->structure_count;
+    }
+
+    ctx.directory_bits = 1;
+    while ((1U << ctx.directory_bits) < (2 * struct_count)) {
+        ctx.directory_bits++;
+    }
+
+    ctx.directory_size = 1U << ctx.directory_bits;
+    if (ctx.directory_size > ctx.directory_capacity) {
+        if (ctx.directory != NULL) {
+            fwk_mm_free(ctx.directory);
+        }
+        ctx.directory =
+            fwk_mm_calloc(ctx.directory_size, sizeof(ctx.directory[0]));
+        ctx.directory_capacity = ctx.directory_size;
+    } else {
+        memset(ctx.directory, 0, ctx.directory_size * sizeof(ctx.directory[0]));
+    }
+
+    for (region_idx = 0; region_idx < config->region_count; region_idx++) {
+        region_desc = (volatile struct region_descriptor *)(
+            config->regions[region_idx].base);
+
+        /* Headers have already been validated when initializing the region */
+        offset = (uint32_t)sizeof(struct region_descriptor);
+        for (struct_idx = 0; struct_idx < region_desc->structure_count;
+             struct_idx++) {
+            header = (volatile struct structure_header *)(
+                (volatile char *)region_desc + offset);
+
+            status =
+                directory_insert(header->id, region_idx, offset, header->size);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+
+            offset += header->size;
+            offset += (uint32_t)sizeof(struct structure_header);
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * Look up a structure through the directory. This is equivalent to
+ * get_structure_info() once the directory has been built.
+ */
+static int directory_get_structure_info(
+    uint32_t structure_id,
+    struct structure_header *header,
+    volatile char **structure_base)
+{
+    const struct mod_sds_config *config;
+    const struct directory_entry *entry;
+    volatile struct structure_header *current_header;
+
+    entry = directory_find(structure_id);
+    if ((entry == NULL) || (entry->id != structure_id)) {
+        return FWK_E_PARAM;
+    }
+
+    config = fwk_module_get_data(fwk_module_id_sds);
+
+    current_header = (volatile struct structure_header *)(
+        (volatile char *)config->regions[entry->region_idx].base +
+        entry->offset);
+    fwk_assert(current_header->id == structure_id);
+    fwk_assert(current_header->size == entry->size);
+
+    if (structure_base != NULL) {
+        *structure_base =
+            ((volatile char *)current_header + sizeof(struct structure_header));
+    }
+
+    *header = *current_header;
+
+    return FWK_SUCCESS;
+}
+
 /*
  * Search the SDS Memory Region(s) for a given structure ID and return a
  * copy of the Structure Header that holds its information. Optionally, a
@@ -189,6 +392,9 @@ static int validate_structure_access(
  * from this function.
  *
  * If a structure with the given ID is not present then FWK_E_PARAM is returned.
+ *
+ * Once the SDS Memory Regions have been initialized, the lookup is served by
+ * the structure directory rather than by walking the regions.
  */
 static int get_structure_info(uint32_t structure_id,
                               struct structure_header *header,
@@ -200,6 +406,11 @@ static int get_structure_info(uint32_t structure_id,
    volatile struct region_descriptor *region_desc;
    volatile char *region_base;
 
+    if (ctx.directory != NULL) {
+        return directory_get_structure_info(
+            structure_id, header, structure_base);
+    }
+
     config = fwk_module_get_data(fwk_module_id_sds);
     fwk_assert(config != NULL);
 
@@ -290,8 +501,20 @@ static int struct_alloc(const struct mod_sds_structure_desc *struct_desc)
         goto exit;
     }
 
-    /* Create the Structure Header */
     header = (volatile struct structure_header *)(*free_mem_base);
+
+    if (ctx.directory != NULL) {
+        status = directory_insert(
+            struct_desc->id,
+            region_idx,
+            (uint32_t)((uintptr_t)header - (uintptr_t)region_desc),
+            padded_size);
+        if (status != FWK_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    /* Create the Structure Header */
     header->id = struct_desc->id;
     header->size = padded_size;
     header->valid = false;
@@ -461,9 +684,112 @@ static int struct_finalize(uint32_t structure_id)
     return FWK_SUCCESS;
 }
 
+static int struct_publish(uint32_t structure_id, const void *data,
+                          size_t size)
+{
+    const struct mod_sds_config *config;
+    const struct directory_entry *entry;
+    volatile char *structure_base;
+    volatile struct mod_sds_live_header *live;
+    volatile struct mod_sds_live_buffer_header *buffer;
+    volatile char *payload;
+    size_t buffer_size;
+    uint32_t generation;
+
+    if (ctx.directory == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    entry = directory_find(structure_id);
+    if ((entry == NULL) || (entry->id != structure_id) || !entry->live) {
+        return FWK_E_PARAM;
+    }
+
+    buffer_size = (entry->size - sizeof(struct mod_sds_live_header)) / 2;
+    if (size > (buffer_size - sizeof(struct mod_sds_live_buffer_header))) {
+        return FWK_E_RANGE;
+    }
+
+    config = fwk_module_get_data(fwk_module_id_sds);
+    structure_base = (volatile char *)config->regions[entry->region_idx].base +
+        entry->offset + sizeof(struct structure_header);
+
+    live = (volatile struct mod_sds_live_header *)structure_base;
+
+    /*
+     * The new generation always lands in the buffer that is not currently
+     * published. Zero is reserved to mark buffers being written, so skip it
+     * while keeping the parity alternating when the counter wraps.
+     */
+    generation = live->sequence + 1;
+    if (generation == 0) {
+        generation = 2;
+    }
+
+    buffer = (volatile struct mod_sds_live_buffer_header *)(
+        structure_base + sizeof(struct mod_sds_live_header) +
+        ((generation % 2) * buffer_size));
+    payload = (volatile char *)buffer + sizeof(*buffer);
+
+    buffer->generation = 0;
+    atomic_thread_fence(memory_order_seq_cst);
+
+    for (size_t i = 0; i < size; i++) {
+        payload[i] = ((const char *)data)[i];
+    }
+
+    atomic_thread_fence(memory_order_seq_cst);
+    buffer->generation = generation;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    live->sequence = generation;
+
+    return FWK_SUCCESS;
+}
+
 static int struct_init(const struct mod_sds_structure_desc *struct_desc)
 {
     int status = FWK_SUCCESS;
+    struct mod_sds_structure_desc live_desc;
+    struct directory_entry *entry;
+
+    if (struct_desc->live) {
+        /* Allocate room for the header and both buffers */
+        live_desc = *struct_desc;
+        live_desc.size = MOD_SDS_LIVE_STRUCT_SIZE(struct_desc->size);
+
+        if (!structure_exists(live_desc.id)) {
+            status = struct_alloc(&live_desc);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+
+        entry = directory_find(live_desc.id);
+        if ((entry == NULL) || (entry->id != live_desc.id)) {
+            return FWK_E_DATA;
+        }
+
+        if (entry->size != live_desc.size) {
+            return FWK_E_DATA; /* Existing structure has a different layout */
+        }
+
+        entry->live = true;
+
+        if (struct_desc->payload != NULL) {
+            status = struct_publish(
+                struct_desc->id, struct_desc->payload, struct_desc->size);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+
+        if (struct_desc->finalize) {
+            status = struct_finalize(struct_desc->id);
+        }
+
+        return status;
+    }
 
     /* If the structure does not already exist, allocate it. */
     if (!structure_exists(struct_desc->id)) {
@@ -522,6 +848,16 @@ static int init_sds(void)
     }
 
     element_count = fwk_module_get_element_count(fwk_module_id_sds);
+
+    /*
+     * The regions may have been recreated since the last initialization, in
+     * which case the existing directory entries are stale.
+     */
+    status = directory_build((unsigned int)element_count);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
     for (element_idx = 0; element_idx < element_count; ++element_idx) {
         struct_desc = fwk_module_get_data(fwk_id_build_element_id(
             fwk_module_id_sds, (unsigned int)element_idx));
@@ -591,10 +927,25 @@ static int sds_struct_finalize(uint32_t structure_id)
     return struct_finalize(structure_id);
 }
 
+static int sds_struct_publish(uint32_t structure_id, const void *data,
+                              size_t size)
+{
+    if (data == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (size == 0) {
+        return FWK_E_PARAM;
+    }
+
+    return struct_publish(structure_id, data, size);
+}
+
 static const struct mod_sds_api module_api = {
     .struct_write = sds_struct_write,
     .struct_read = sds_struct_read,
     .struct_finalize = sds_struct_finalize,
+    .struct_publish = sds_struct_publish,
 };
 
 /*
@@ -695,6 +1046,40 @@ static int sds_process_notification(
 }
 #endif
 
+#ifdef BUILD_HAS_BOOT_PROFILE
+static int sds_deferred_start(fwk_id_t id)
+{
+    const struct mod_sds_config *config;
+    struct fwk_module_boot_profile profile;
+    unsigned int module_idx;
+    int status;
+
+    config = fwk_module_get_data(fwk_module_id_sds);
+    if (config->boot_profile_struct_id == 0) {
+        return FWK_SUCCESS;
+    }
+
+    for (module_idx = 0; module_idx < FWK_MODULE_IDX_COUNT; module_idx++) {
+        status =
+            fwk_module_get_boot_profile(FWK_ID_MODULE(module_idx), &profile);
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+
+        status = struct_write(
+            config->boot_profile_struct_id,
+            module_idx * sizeof(profile),
+            &profile,
+            sizeof(profile));
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
+    }
+
+    return struct_finalize(config->boot_profile_struct_id);
+}
+#endif
+
 /* Module descriptor */
 const struct fwk_module module_sds = {
     .type = FWK_MODULE_TYPE_SERVICE,
@@ -705,6 +1090,9 @@ const struct fwk_module module_sds = {
     .element_init = sds_element_init,
     .process_bind_request = sds_process_bind_request,
     .start = sds_start,
+#ifdef BUILD_HAS_BOOT_PROFILE
+    .deferred_start = sds_deferred_start,
+#endif
 #ifdef BUILD_HAS_MOD_CLOCK
     .process_notification = sds_process_notification
 #endif
@@ -0,0 +1,69 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_sds.h>
+
+#include <fwk_macros.h>
+
+#include <stdint.h>
+
+#define FAKE_SDS_REGION_SIZE 256
+
+#define FAKE_SDS_STRUCT_ID(IDX) \
+    ((UINT32_C(1) << MOD_SDS_ID_VERSION_MAJOR_POS) | (IDX))
+
+enum fake_sds_struct_idx {
+    FAKE_SDS_STRUCT_IDX_FIRST = 1,
+    FAKE_SDS_STRUCT_IDX_SECOND,
+    FAKE_SDS_STRUCT_IDX_LIVE,
+    FAKE_SDS_STRUCT_IDX_COUNT,
+};
+
+static uint64_t fake_sds_region[FAKE_SDS_REGION_SIZE / sizeof(uint64_t)];
+
+static const struct mod_sds_region_desc fake_sds_region_desc[] = {
+    {
+        .base = fake_sds_region,
+        .size = sizeof(fake_sds_region),
+    },
+};
+
+static const struct mod_sds_config fake_sds_config = {
+    .regions = fake_sds_region_desc,
+    .region_count = FWK_ARRAY_SIZE(fake_sds_region_desc),
+};
+
+static const uint32_t fake_sds_payload = UINT32_C(0xCAFEF00D);
+
+static const struct mod_sds_structure_desc fake_sds_struct_desc[] = {
+    {
+        .id = FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_FIRST),
+        .size = 8,
+    },
+    {
+        .id = FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_SECOND),
+        .size = sizeof(fake_sds_payload),
+        .payload = &fake_sds_payload,
+        .finalize = true,
+    },
+};
+
+static const uint64_t fake_sds_live_payload = UINT64_C(0x0123456789ABCDEF);
+
+static const struct mod_sds_structure_desc fake_sds_live_struct_desc[] = {
+    {
+        .id = FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_FIRST),
+        .size = 8,
+    },
+    {
+        .id = FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE),
+        .size = sizeof(fake_sds_live_payload),
+        .payload = &fake_sds_live_payload,
+        .finalize = true,
+        .live = true,
+    },
+};
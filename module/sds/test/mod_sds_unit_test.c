@@ -0,0 +1,363 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+#include <Mockfwk_notification.h>
+
+#include <mod_sds.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+
+#include UNIT_TEST_SRC
+#include "config_sds.h"
+
+/* Element descriptors returned by the fwk_module_get_data() stub */
+static const struct mod_sds_structure_desc *test_struct_desc;
+
+static const void *get_data_callback(fwk_id_t id, int cmock_num_calls)
+{
+    if (fwk_id_is_type(id, FWK_ID_TYPE_MODULE)) {
+        return &fake_sds_config;
+    }
+
+    return &test_struct_desc[fwk_id_get_element_idx(id)];
+}
+
+static void init_sds_expect(
+    const struct mod_sds_structure_desc *struct_desc,
+    unsigned int struct_count)
+{
+    test_struct_desc = struct_desc;
+
+    fwk_module_get_element_count_ExpectAnyArgsAndReturn((int)struct_count);
+    fwk_notification_notify_ExpectAnyArgsAndReturn(FWK_SUCCESS);
+}
+
+static void live_buffer_read(
+    unsigned int buffer_idx,
+    struct mod_sds_live_buffer_header *header,
+    uint64_t *payload)
+{
+    int status;
+    unsigned int offset = sizeof(struct mod_sds_live_header) +
+        (buffer_idx * MOD_SDS_LIVE_BUFFER_SIZE(sizeof(*payload)));
+
+    status = sds_struct_read(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE),
+        offset,
+        header,
+        sizeof(*header));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = sds_struct_read(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE),
+        offset + sizeof(*header),
+        payload,
+        sizeof(*payload));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+static uint32_t live_sequence_read(void)
+{
+    int status;
+    struct mod_sds_live_header header;
+
+    status = sds_struct_read(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE),
+        0,
+        &header,
+        sizeof(header));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    return header.sequence;
+}
+
+void setUp(void)
+{
+    memset(&ctx, 0, sizeof(ctx));
+    memset(fake_sds_region, 0, sizeof(fake_sds_region));
+
+    fwk_module_get_data_Stub(get_data_callback);
+
+    ctx.regions = fwk_mm_calloc(
+        fake_sds_config.region_count, sizeof(ctx.regions[0]));
+}
+
+void tearDown(void)
+{
+    fwk_mm_free(ctx.directory);
+    fwk_mm_free(ctx.regions);
+}
+
+void test_init_sds_builds_directory(void)
+{
+    int status;
+    uint32_t data = 0;
+    const struct directory_entry *entry;
+
+    init_sds_expect(fake_sds_struct_desc, FWK_ARRAY_SIZE(fake_sds_struct_desc));
+
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_NOT_NULL(ctx.directory);
+
+    entry = directory_find(fake_sds_struct_desc[0].id);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(fake_sds_struct_desc[0].id, entry->id);
+    TEST_ASSERT_EQUAL(sizeof(struct region_descriptor), entry->offset);
+
+    entry = directory_find(fake_sds_struct_desc[1].id);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(fake_sds_struct_desc[1].id, entry->id);
+
+    status = sds_struct_read(
+        fake_sds_struct_desc[1].id, 0, &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(fake_sds_payload, data);
+}
+
+void test_init_sds_rebuilds_directory_after_region_loss(void)
+{
+    int status;
+    uint32_t data = 0;
+    const struct directory_entry *entry;
+
+    init_sds_expect(fake_sds_struct_desc, FWK_ARRAY_SIZE(fake_sds_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /*
+     * The region is lost while the clock is stopped, and is recreated with
+     * only the second structure, which now sits first in the region.
+     */
+    memset(fake_sds_region, 0, sizeof(fake_sds_region));
+
+    init_sds_expect(&fake_sds_struct_desc[1], 1);
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_FALSE(structure_exists(fake_sds_struct_desc[0].id));
+
+    entry = directory_find(fake_sds_struct_desc[1].id);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL(fake_sds_struct_desc[1].id, entry->id);
+    TEST_ASSERT_EQUAL(sizeof(struct region_descriptor), entry->offset);
+
+    status = sds_struct_read(
+        fake_sds_struct_desc[1].id, 0, &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_EQUAL(fake_sds_payload, data);
+}
+
+void test_init_sds_keeps_directory_of_existing_region(void)
+{
+    int status;
+    struct directory_entry *directory;
+
+    for (unsigned int count = 0; count < 2; count++) {
+        init_sds_expect(
+            fake_sds_struct_desc, FWK_ARRAY_SIZE(fake_sds_struct_desc));
+        status = init_sds();
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    directory = ctx.directory;
+
+    /*
+     * The structures already exist and are found through the rebuilt
+     * directory, which is large enough to be reused.
+     */
+    init_sds_expect(fake_sds_struct_desc, FWK_ARRAY_SIZE(fake_sds_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL_PTR(directory, ctx.directory);
+    TEST_ASSERT_TRUE(structure_exists(fake_sds_struct_desc[0].id));
+    TEST_ASSERT_TRUE(structure_exists(fake_sds_struct_desc[1].id));
+}
+
+void test_directory_insert_full(void)
+{
+    int status;
+    uint32_t idx;
+
+    ctx.directory_bits = 1;
+    ctx.directory_size = 2;
+    ctx.directory_capacity = 2;
+    ctx.directory = fwk_mm_calloc(2, sizeof(ctx.directory[0]));
+
+    for (idx = 1; idx <= 2; idx++) {
+        status = directory_insert(FAKE_SDS_STRUCT_ID(idx), 0, 0, 8);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    TEST_ASSERT_NULL(directory_find(FAKE_SDS_STRUCT_ID(3)));
+
+    status = directory_insert(FAKE_SDS_STRUCT_ID(3), 0, 0, 8);
+    TEST_ASSERT_EQUAL(FWK_E_NOMEM, status);
+
+    /* Structures already present are still found */
+    status = directory_insert(FAKE_SDS_STRUCT_ID(1), 0, 0, 8);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void test_struct_alloc_directory_full(void)
+{
+    int status;
+    const struct mod_sds_structure_desc struct_desc = {
+        .id = FAKE_SDS_STRUCT_ID(3),
+        .size = 8,
+    };
+
+    init_sds_expect(fake_sds_struct_desc, FWK_ARRAY_SIZE(fake_sds_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Fill every unused entry of the directory */
+    for (unsigned int idx = 0; idx < ctx.directory_size; idx++) {
+        if (ctx.directory[idx].id == 0) {
+            ctx.directory[idx].id = FAKE_SDS_STRUCT_ID(0x100 + idx);
+        }
+    }
+
+    status = struct_alloc(&struct_desc);
+    TEST_ASSERT_EQUAL(FWK_E_NOMEM, status);
+    TEST_ASSERT_EQUAL(
+        FWK_ARRAY_SIZE(fake_sds_struct_desc),
+        ((struct region_descriptor *)fake_sds_region)->structure_count);
+}
+
+void test_struct_publish_alternates_buffers(void)
+{
+    int status;
+    uint64_t data = UINT64_C(0xFEDCBA9876543210);
+    uint64_t payload;
+    struct mod_sds_live_buffer_header header;
+
+    init_sds_expect(
+        fake_sds_live_struct_desc, FWK_ARRAY_SIZE(fake_sds_live_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The initial payload is published as the first generation */
+    TEST_ASSERT_EQUAL(1, live_sequence_read());
+    live_buffer_read(1, &header, &payload);
+    TEST_ASSERT_EQUAL(1, header.generation);
+    TEST_ASSERT_EQUAL_UINT64(fake_sds_live_payload, payload);
+
+    status = sds_struct_publish(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE), &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(2, live_sequence_read());
+    live_buffer_read(0, &header, &payload);
+    TEST_ASSERT_EQUAL(2, header.generation);
+    TEST_ASSERT_EQUAL_UINT64(data, payload);
+
+    /* The previously published buffer is left untouched */
+    live_buffer_read(1, &header, &payload);
+    TEST_ASSERT_EQUAL(1, header.generation);
+    TEST_ASSERT_EQUAL_UINT64(fake_sds_live_payload, payload);
+}
+
+void test_struct_publish_sequence_wrap(void)
+{
+    int status;
+    uint64_t data = UINT64_C(0xFEDCBA9876543210);
+    uint64_t payload;
+    struct mod_sds_live_header live = {
+        .sequence = UINT32_MAX,
+    };
+    struct mod_sds_live_buffer_header header;
+
+    init_sds_expect(
+        fake_sds_live_struct_desc, FWK_ARRAY_SIZE(fake_sds_live_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = sds_struct_write(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE), 0, &live, sizeof(live));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = sds_struct_publish(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE), &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /*
+     * Zero is skipped, and the new generation still lands in the buffer
+     * opposite to the one published with the odd generation UINT32_MAX.
+     */
+    TEST_ASSERT_EQUAL(2, live_sequence_read());
+    live_buffer_read(0, &header, &payload);
+    TEST_ASSERT_EQUAL(2, header.generation);
+    TEST_ASSERT_EQUAL_UINT64(data, payload);
+}
+
+void test_struct_publish_oversized(void)
+{
+    int status;
+    uint8_t data[sizeof(fake_sds_live_payload) + 1] = { 0 };
+
+    init_sds_expect(
+        fake_sds_live_struct_desc, FWK_ARRAY_SIZE(fake_sds_live_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = sds_struct_publish(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_LIVE), data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_E_RANGE, status);
+
+    /* Nothing was published */
+    TEST_ASSERT_EQUAL(1, live_sequence_read());
+}
+
+void test_struct_publish_not_live(void)
+{
+    int status;
+    uint64_t data = 0;
+
+    init_sds_expect(
+        fake_sds_live_struct_desc, FWK_ARRAY_SIZE(fake_sds_live_struct_desc));
+    status = init_sds();
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = sds_struct_publish(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_FIRST), &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = sds_struct_publish(
+        FAKE_SDS_STRUCT_ID(FAKE_SDS_STRUCT_IDX_SECOND), &data, sizeof(data));
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+}
+
+int sds_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_init_sds_builds_directory);
+    RUN_TEST(test_init_sds_rebuilds_directory_after_region_loss);
+    RUN_TEST(test_init_sds_keeps_directory_of_existing_region);
+    RUN_TEST(test_directory_insert_full);
+    RUN_TEST(test_struct_alloc_directory_full);
+    RUN_TEST(test_struct_publish_alternates_buffers);
+    RUN_TEST(test_struct_publish_sequence_wrap);
+    RUN_TEST(test_struct_publish_oversized);
+    RUN_TEST(test_struct_publish_not_live);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return sds_test_main();
+}
+#endif
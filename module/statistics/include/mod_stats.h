@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,8 +17,8 @@
 
 /*!
  * \ingroup GroupModules
- * \defgroup GroupStatistics Statistics for Performance and Power domains
- *      of operating level changes
+ * \defgroup GroupStatistics Statistics for Performance, Power, Clock,
+ *      Voltage and Sensor domains of operating level changes
  * \{
  */
 
@@ -27,6 +27,31 @@
  * \{
  */
 
+/*!
+ * \brief Region signature for performance domain statistics ('PERF').
+ */
+#define MOD_STATS_SIGNATURE_PERF UINT32_C(0x50455246)
+
+/*!
+ * \brief Region signature for power domain statistics ('POWR').
+ */
+#define MOD_STATS_SIGNATURE_POWR UINT32_C(0x504F5752)
+
+/*!
+ * \brief Region signature for clock domain statistics ('CLCK').
+ */
+#define MOD_STATS_SIGNATURE_CLCK UINT32_C(0x434C434B)
+
+/*!
+ * \brief Region signature for voltage domain statistics ('VOLT').
+ */
+#define MOD_STATS_SIGNATURE_VOLT UINT32_C(0x564F4C54)
+
+/*!
+ * \brief Region signature for sensor statistics ('SENS').
+ */
+#define MOD_STATS_SIGNATURE_SENS UINT32_C(0x53454E53)
+
 /*!
  * \brief Statistics memory region information.
  */
@@ -58,6 +83,22 @@ struct mod_stats_map {
      * offset calculation, since it can be modified by OSPM */
     uint32_t *se_curr_level;
 
+    /*! Array which contains a sequence counter for each domain. The counter
+     * is odd while the domain statistics are being updated after a level
+     * change, and even otherwise. It lets the periodic update run without
+     * masking interrupts. */
+    volatile uint32_t *se_seq;
+
+    /*! Array which contains, for each domain, the value of the sequence
+     * counter when the domain was last visited by the periodic update.
+     * Domains which have not changed level since then are skipped. */
+    uint32_t *se_sweep_seq;
+
+    /*! Array which contains, for each domain, the histograms added to it.
+     * There are ::MOD_STATS_HISTOGRAM_TYPE_COUNT entries per domain, NULL
+     * when the histogram of that type is not collected. */
+    struct mod_stats_histogram **se_histograms;
+
     /*! An array of pointers to the domain statistics table. Every domain
      * has its own table when statistics collection is set for it. */
     struct mod_stats_domain_stats_data *se_stats[];
@@ -104,6 +145,12 @@ enum mod_stats_mode {
  * \brief Statistics context.
  */
 struct mod_stats_info {
+    /*! Index of the module which registered these statistics */
+    unsigned int module_idx;
+
+    /*! Next registered module in the statistics registry */
+    struct mod_stats_info *next;
+
     /*! type_signature - private copy which should be the same as in shared
      * memory description header describing type of statistics region. */
     uint32_t type_signature;
@@ -135,7 +182,8 @@ struct mod_stats_info {
  *      specification
  */
 struct mod_stats_desc_header {
-    /*! Signature - 0x50455246 (‘PERF’) or 0x504F5752 ('POWR'). */
+    /*! Signature of the region, e.g. 0x50455246 (‘PERF’) or 0x504F5752
+     * ('POWR'). */
     uint32_t signature;
 
     /*! The revision value aligned with the SCMI specification. */
@@ -193,7 +241,12 @@ struct FWK_PACKED mod_stats_domain_stats_data {
     uint32_t extended_stats_offset;
 
     /*! Holds time stamp when the last performance or power level has been
-     * changed. Value is in microseconds.*/
+     * changed. Value is in microseconds.
+     *
+     * The residency of the current level is only accounted for up to this
+     * time stamp. Readers compute the live residency of the current level
+     * by adding the time elapsed since this time stamp to its
+     * 'total_residency_us'. */
     uint64_t ts_last_change_us;
 
     /*! Beginning of the statistics region with information for each
@@ -201,6 +254,76 @@ struct FWK_PACKED mod_stats_domain_stats_data {
     struct mod_stats_level_stats level[];
 };
 
+/*!
+ * \brief Histogram types.
+ */
+enum mod_stats_histogram_type {
+    /*! Distribution of the time taken by level transitions, in
+     * microseconds */
+    MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+
+    /*! Distribution of the values taken by the domain (e.g. clock rates,
+     * voltages or sensor readings) */
+    MOD_STATS_HISTOGRAM_VALUE,
+
+    /*! Number of histogram types */
+    MOD_STATS_HISTOGRAM_TYPE_COUNT,
+};
+
+/*!
+ * \brief Histogram extended statistics data
+ *
+ * \details Histograms are placed in the extended statistics area of the
+ *      domain and chained through 'next_offset'. The first one is pointed to
+ *      by 'extended_stats_offset' of the domain statistics data.
+ *
+ *      Buckets are linear: the bucket 'n' counts the samples in
+ *      [min_value + n * bucket_width, min_value + (n + 1) * bucket_width).
+ *      Samples below 'min_value' are counted in the first bucket and samples
+ *      beyond the last bucket are counted in the last one.
+ */
+struct FWK_PACKED mod_stats_histogram {
+    /*! Histogram type, as defined by ::mod_stats_histogram_type. */
+    uint16_t type;
+
+    /*! Number of buckets in the histogram. */
+    uint16_t bucket_count;
+
+    /*! Offset to the next extended statistics section, using the same
+     * origin as 'domain_offset'. 0 if this is the last one. */
+    uint32_t next_offset;
+
+    /*! Lower limit of the first bucket. */
+    uint64_t min_value;
+
+    /*! Width of each bucket. */
+    uint64_t bucket_width;
+
+    /*! Total number of samples recorded in the histogram. */
+    uint64_t sample_count;
+
+    /*! Number of samples recorded in each bucket. */
+    uint64_t bucket[];
+};
+
+/*!
+ * \brief Histogram configuration.
+ *
+ * \details Used by the modules providing statistics to describe the
+ *      histograms to add to a domain. See ::mod_stats_histogram for the
+ *      meaning of the fields.
+ */
+struct mod_stats_histogram_config {
+    /*! Lower limit of the first bucket. */
+    uint64_t min_value;
+
+    /*! Width of each bucket. */
+    uint64_t bucket_width;
+
+    /*! Number of buckets, 0 if the histogram is not collected. */
+    unsigned int bucket_count;
+};
+
 /*!
  * \}
  */
@@ -218,12 +341,24 @@ struct mod_stats_api {
     /*!
      * \brief Initialize statistics for a given module.
      *
+     * \details This registers the module with the statistics module. Any
+     *      module may register, once, and picks the signature of its
+     *      statistics region.
+     *
      * \param module_id Element identifier of the module.
+     * \param signature Signature of the statistics region, e.g.
+     *      ::MOD_STATS_SIGNATURE_PERF or ::MOD_STATS_SIGNATURE_CLCK.
      * \param domain_count Total number of domains in this module.
      * \param used_domains Total number of domains that have statistics.
+     *
+     * \retval ::FWK_SUCCESS The statistics have been initialized.
+     * \retval ::FWK_E_PARAM The signature is zero.
+     * \retval ::FWK_E_STATE The module has already been registered.
+     * \retval ::FWK_E_NOMEM The statistics region is too small.
      */
     int (*init_stats)(
         fwk_id_t module_id,
+        uint32_t signature,
         int domain_count,
         int used_domains);
 
@@ -258,6 +393,51 @@ struct mod_stats_api {
         fwk_id_t domain_id,
         uint32_t level_id);
 
+    /*!
+     * \brief Add a histogram to the statistics of a domain.
+     *
+     * \note Histograms must be added after the domain and before the
+     *      statistics of the module are started.
+     *
+     * \param module_id Element identifier of the module.
+     * \param domain_id Element identifier of the domain.
+     * \param type Histogram type.
+     * \param min_value Lower limit of the first bucket.
+     * \param bucket_width Width of each bucket.
+     * \param bucket_count Number of buckets.
+     *
+     * \retval ::FWK_SUCCESS The histogram has been added.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_STATE The histogram already exists or the statistics
+     *      have already been started.
+     * \retval ::FWK_E_NOMEM The statistics region is too small.
+     */
+    int (*add_histogram)(
+        fwk_id_t module_id,
+        fwk_id_t domain_id,
+        enum mod_stats_histogram_type type,
+        uint64_t min_value,
+        uint64_t bucket_width,
+        unsigned int bucket_count);
+
+    /*!
+     * \brief Record a sample in a histogram of a domain.
+     *
+     * \param module_id Element identifier of the module.
+     * \param domain_id Element identifier of the domain.
+     * \param type Histogram type.
+     * \param value Sample value.
+     *
+     * \retval ::FWK_SUCCESS The sample has been recorded.
+     * \retval ::FWK_E_PARAM An invalid parameter was encountered.
+     * \retval ::FWK_E_SUPPORT The histogram is not collected for the domain.
+     */
+    int (*record_histogram)(
+        fwk_id_t module_id,
+        fwk_id_t domain_id,
+        enum mod_stats_histogram_type type,
+        uint64_t value);
+
     /*!
      * \brief Get low and high addresses of statistics in AP address space
      *          with length of the memory region
@@ -9,7 +9,6 @@
 #include <mod_timer.h>
 
 #include <fwk_assert.h>
-#include <fwk_interrupt.h>
 #include <fwk_log.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
@@ -18,10 +17,7 @@
 #include <fwk_string.h>
 #include <fwk_time.h>
 
-/* 'PERF' = 0x50455246 in SCP little-endian */
-#define STATS_SIGN_PERF 0x50455246
-/* 'POWR' = 0x504F5752 in SCP little-endian */
-#define STATS_SIGN_POWR 0x504F5752
+#include <stdatomic.h>
 
 #define STATS_UPDATE_PERIOD_MS  100
 
@@ -32,11 +28,8 @@ struct mod_stats_ctx {
     /* Offset of the available memory in the statistics region */
     uint32_t avail_mem_offset;
 
-    /* Context of performance statistics */
-    struct mod_stats_info *perf_stats;
-
-    /* Context of power domain statistics */
-    struct mod_stats_info *power_stats;
+    /* Registry of the modules which have initialized statistics */
+    struct mod_stats_info *registry;
 
     /* Alarm API for periodic shared memory updates */
     const struct mod_timer_alarm_api *alarm_api;
@@ -46,53 +39,84 @@ static struct mod_stats_ctx stats_ctx;
 
 static struct mod_stats_info *get_module_stats_info(fwk_id_t module_id)
 {
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        return stats_ctx.perf_stats;
-    }
+    struct mod_stats_info *stats;
+    unsigned int module_idx = fwk_id_get_module_idx(module_id);
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        return stats_ctx.power_stats;
+    for (stats = stats_ctx.registry; stats != NULL; stats = stats->next) {
+        if (stats->module_idx == module_idx) {
+            return stats;
+        }
     }
 
     return NULL;
 }
 
-static int set_module_stats_info(fwk_id_t module_id,
-    struct mod_stats_info *stats)
+static void register_module_stats(struct mod_stats_info *stats)
+{
+    struct mod_stats_info **entry = &stats_ctx.registry;
+
+    /*
+     * The registry is walked from the periodic update, so the new entry is
+     * only linked once it is fully set up.
+     */
+    while (*entry != NULL) {
+        entry = &(*entry)->next;
+    }
+
+    stats->next = NULL;
+    *entry = stats;
+}
+
+static int get_domain_stats_id(struct mod_stats_info *stats, fwk_id_t domain_id)
 {
-    int ret = FWK_E_PARAM;
+    uint32_t idx = fwk_id_get_element_idx(domain_id);
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        stats_ctx.perf_stats = stats;
-        stats->type_signature = STATS_SIGN_PERF;
-        ret = FWK_SUCCESS;
+    if ((int)idx >= stats->context->se_total_num) {
+        return FWK_E_PARAM;
     }
 
-    if (fwk_id_get_module_idx(module_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        stats_ctx.power_stats = stats;
-        stats->type_signature = STATS_SIGN_POWR;
-        ret = FWK_SUCCESS;
+    return stats->context->se_index_map[idx];
+}
+
+static int allocate_shared_section(
+    struct mod_stats_info *stats,
+    uint32_t size,
+    void **section,
+    uint32_t *offset)
+{
+    if (size > (stats_ctx.config->stats_region_size -
+        stats_ctx.avail_mem_offset)) {
+        FWK_LOG_ERR("[STATS]: Error, size of statistics region too small");
+        return FWK_E_NOMEM;
     }
 
-    return ret;
+    /* Offset from the beginning of statistics header used by AP */
+    *offset = stats_ctx.avail_mem_offset - stats->desc_header_offset;
+
+    /* Address used in SCP in the shared region */
+    *section = (void *)(stats_ctx.config->scp_stats_addr +
+                        stats_ctx.avail_mem_offset);
+
+    /* Shrink the free space in the shared region */
+    stats_ctx.avail_mem_offset += size;
+
+    stats->used_mem_size += size;
+
+    return FWK_SUCCESS;
 }
 
 static int allocate_domain_stats(fwk_id_t module_id,
     fwk_id_t domain_id,
     int level_count)
 {
-    struct mod_stats_desc_header *desc_header;
     struct mod_stats_info *stats;
     struct mod_stats_map *se_map;
-    uintptr_t scp_stats_addr;
+    void *section;
     uint32_t stats_offset;
     uint32_t stats_size;
     int stats_id;
     uint32_t idx;
+    int status;
 
     stats = get_module_stats_info(module_id);
     if (stats == NULL) {
@@ -100,7 +124,6 @@ static int allocate_domain_stats(fwk_id_t module_id,
     }
 
     idx = fwk_id_get_element_idx(domain_id);
-    desc_header = stats->desc_header;
 
     stats_id = stats->context->last_stats_id++;
     fwk_assert(stats_id < stats->context->se_used_num);
@@ -114,36 +137,24 @@ static int allocate_domain_stats(fwk_id_t module_id,
     stats_size = sizeof(struct mod_stats_level_stats) * level_count;
     stats_size += sizeof(struct mod_stats_domain_stats_data);
 
-    if (stats_size > (stats_ctx.config->stats_region_size -
-        stats_ctx.avail_mem_offset)) {
-        FWK_LOG_ERR("[STATS]: Error, size of statistics region too small");
+    status = allocate_shared_section(
+        stats, stats_size, &section, &stats_offset);
+    if (status != FWK_SUCCESS) {
         stats->mode = STATS_INTERNAL_ERROR;
-        return FWK_E_NOMEM;
+        return status;
     }
 
     se_map = stats->context->se_stats_map;
-    se_map->se_level_count[idx] = level_count;
-    se_map->se_curr_level[idx] = 0;
-
-    /* Offset from the beginning of statistics header used by AP */
-    stats_offset = stats_ctx.avail_mem_offset - stats->desc_header_offset;
-    desc_header->domain_offset[idx] = stats_offset;
-
-    /* Address used in SCP to get domain statistics in the shared region */
-    scp_stats_addr = stats_ctx.config->scp_stats_addr +
-                     stats_ctx.avail_mem_offset;
-    se_map->se_stats[idx] = (struct mod_stats_domain_stats_data *)
-                            scp_stats_addr;
-
-    /* Shrink the free space in the shared region */
-    stats_ctx.avail_mem_offset += stats_size;
+    se_map->se_level_count[stats_id] = level_count;
+    se_map->se_curr_level[stats_id] = 0;
+    se_map->se_stats[stats_id] = section;
 
-    stats->used_mem_size += stats_size;
+    stats->desc_header->domain_offset[idx] = stats_offset;
 
     FWK_LOG_DEBUG(
         "[STATS]: stats addr %lx, stats_size=%luB",
-        (uint32_t)scp_stats_addr,
-        stats_size);
+        (unsigned long)(uintptr_t)section,
+        (unsigned long)stats_size);
 
     return FWK_SUCCESS;
 }
@@ -210,11 +221,19 @@ _allocate_stats_context(int domain_count, int used_domains)
         (int *)fwk_mm_calloc((size_t)used_domains, sizeof(int));
     se_map->se_curr_level =
         (uint32_t *)fwk_mm_calloc((size_t)used_domains, sizeof(uint32_t));
+    se_map->se_seq =
+        (uint32_t *)fwk_mm_calloc((size_t)used_domains, sizeof(uint32_t));
+    se_map->se_sweep_seq =
+        (uint32_t *)fwk_mm_calloc((size_t)used_domains, sizeof(uint32_t));
+    se_map->se_histograms = fwk_mm_calloc(
+        (size_t)used_domains * MOD_STATS_HISTOGRAM_TYPE_COUNT,
+        sizeof(struct mod_stats_histogram *));
 
     return stats;
 }
 
 static int stats_init_module(fwk_id_t module_id,
+    uint32_t signature,
     int domain_count,
     int used_domains)
 {
@@ -226,10 +245,17 @@ static int stats_init_module(fwk_id_t module_id,
         domain_count,
         used_domains);
 
-    stats = _allocate_stats_context(domain_count, used_domains);
-    ret = set_module_stats_info(module_id, stats);
+    if (signature == 0) {
+        return FWK_E_PARAM;
+    }
+
+    if (get_module_stats_info(module_id) != NULL) {
+        return FWK_E_STATE;
+    }
 
-    fwk_assert(ret == FWK_SUCCESS);
+    stats = _allocate_stats_context(domain_count, used_domains);
+    stats->module_idx = fwk_id_get_module_idx(module_id);
+    stats->type_signature = signature;
 
     ret = _allocate_header(stats, domain_count);
     if (ret != FWK_SUCCESS) {
@@ -239,6 +265,8 @@ static int stats_init_module(fwk_id_t module_id,
     stats->desc_header->signature = stats->type_signature;
     stats->desc_header->domain_count = (uint16_t)domain_count;
 
+    register_module_stats(stats);
+
     return FWK_SUCCESS;
 }
 
@@ -348,9 +376,8 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
     struct mod_stats_info *stats;
     struct mod_stats_map *se_map;
     uint64_t ts_now_us;
-    uint32_t old_level_id, idx;
+    uint32_t old_level_id, idx, seq;
     int stats_id;
-    unsigned int flags;
 
     stats = get_module_stats_info(module_id);
     if (stats == NULL) {
@@ -375,9 +402,17 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
         return FWK_E_PARAM;
     }
 
-    ts_now_us = _get_curret_ts_us();
+    /*
+     * Mark the domain as being updated so that the periodic update, which
+     * runs from interrupt context, leaves it alone. The time stamp must be
+     * taken afterwards so that it can never precede a time stamp written by
+     * the periodic update.
+     */
+    seq = se_map->se_seq[stats_id];
+    se_map->se_seq[stats_id] = seq + 1;
+    atomic_signal_fence(memory_order_seq_cst);
 
-    flags = fwk_interrupt_global_disable();
+    ts_now_us = _get_curret_ts_us();
 
     /* Update old performance level statistics */
     old_level_id = se_map->se_curr_level[stats_id];
@@ -392,7 +427,121 @@ stats_update_domain(fwk_id_t module_id, fwk_id_t domain_id, uint32_t level_id)
     domain_stats->curr_level_id = (uint16_t)level_id;
     se_map->se_curr_level[stats_id] = level_id;
 
-    fwk_interrupt_global_enable(flags);
+    atomic_signal_fence(memory_order_seq_cst);
+    se_map->se_seq[stats_id] = seq + 2;
+
+    return FWK_SUCCESS;
+}
+
+static int stats_add_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t min_value,
+    uint64_t bucket_width,
+    unsigned int bucket_count)
+{
+    struct mod_stats_domain_stats_data *domain_stats;
+    struct mod_stats_histogram **histogram;
+    struct mod_stats_info *stats;
+    void *section;
+    uint32_t offset, size;
+    int stats_id, status;
+
+    if ((type >= MOD_STATS_HISTOGRAM_TYPE_COUNT) || (bucket_width == 0) ||
+        (bucket_count == 0) || (bucket_count > UINT16_MAX)) {
+        return FWK_E_PARAM;
+    }
+
+    stats = get_module_stats_info(module_id);
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (stats->mode != STATS_SETUP) {
+        return FWK_E_STATE;
+    }
+
+    stats_id = get_domain_stats_id(stats, domain_id);
+    if (stats_id < 0) {
+        return FWK_E_PARAM;
+    }
+
+    histogram = &stats->context->se_stats_map
+                     ->se_histograms[stats_id * MOD_STATS_HISTOGRAM_TYPE_COUNT +
+                                     type];
+    if (*histogram != NULL) {
+        return FWK_E_STATE;
+    }
+
+    size = sizeof(struct mod_stats_histogram);
+    size += bucket_count * sizeof(uint64_t);
+
+    status = allocate_shared_section(stats, size, &section, &offset);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    *histogram = section;
+    (*histogram)->type = (uint16_t)type;
+    (*histogram)->bucket_count = (uint16_t)bucket_count;
+    (*histogram)->min_value = min_value;
+    (*histogram)->bucket_width = bucket_width;
+
+    /* Insert the histogram at the head of the extended statistics chain */
+    domain_stats = stats->context->se_stats_map->se_stats[stats_id];
+    (*histogram)->next_offset = domain_stats->extended_stats_offset;
+    domain_stats->extended_stats_offset = offset;
+
+    return FWK_SUCCESS;
+}
+
+static int stats_record_histogram(
+    fwk_id_t module_id,
+    fwk_id_t domain_id,
+    enum mod_stats_histogram_type type,
+    uint64_t value)
+{
+    struct mod_stats_histogram *histogram;
+    struct mod_stats_info *stats;
+    uint64_t bucket;
+    int stats_id;
+
+    if (type >= MOD_STATS_HISTOGRAM_TYPE_COUNT) {
+        return FWK_E_PARAM;
+    }
+
+    stats = get_module_stats_info(module_id);
+    if (stats == NULL) {
+        return FWK_E_PARAM;
+    }
+
+    if (stats->mode != STATS_INITIALIZED) {
+        return FWK_E_SUPPORT;
+    }
+
+    stats_id = get_domain_stats_id(stats, domain_id);
+    if (stats_id < 0) {
+        return FWK_E_SUPPORT;
+    }
+
+    histogram = stats->context->se_stats_map
+                    ->se_histograms[stats_id * MOD_STATS_HISTOGRAM_TYPE_COUNT +
+                                    type];
+    if (histogram == NULL) {
+        return FWK_E_SUPPORT;
+    }
+
+    bucket = 0;
+    if (value > histogram->min_value) {
+        bucket = (value - histogram->min_value) / histogram->bucket_width;
+        if (bucket >= histogram->bucket_count) {
+            bucket = histogram->bucket_count - 1U;
+        }
+    }
+
+    histogram->bucket[bucket]++;
+    histogram->sample_count++;
 
     return FWK_SUCCESS;
 }
@@ -430,69 +579,68 @@ static const struct mod_stats_api mod_statistics_api = {
     .start_stats = stats_start_module,
     .add_domain = stats_add_domain,
     .update_domain = stats_update_domain,
+    .add_histogram = stats_add_histogram,
+    .record_histogram = stats_record_histogram,
     .get_statistics_desc = get_statistics_desc,
 };
 
-static void update_all_domains_current_level(fwk_id_t module_id)
+static void update_all_domains_current_level(
+    struct mod_stats_info *stats,
+    uint64_t ts_now_us)
 {
     struct mod_stats_domain_stats_data *domain_stats;
     struct mod_stats_level_stats *level_stats;
-    struct mod_stats_info *stats;
     struct mod_stats_map *se_map;
-    uint64_t ts_now_us, delta_t;
-    uint32_t curr_level_id;
-    fwk_id_t domain_id;
-    int stats_id, i;
-    unsigned int flags;
-
-    stats = get_module_stats_info(module_id);
-    if (stats == NULL) {
-        return;
-    }
+    uint32_t curr_level_id, seq;
+    int stats_id;
 
     if (stats->mode != STATS_INITIALIZED) {
         return;
     }
 
-    for (i = 0; i < stats->context->se_total_num; i++) {
-        domain_id = FWK_ID_ELEMENT(fwk_id_get_module_idx(module_id), i);
-        domain_stats = get_domain_section_data(module_id, domain_id);
-        if (domain_stats == NULL) {
+    se_map = stats->context->se_stats_map;
+
+    for (stats_id = 0; stats_id < stats->context->se_used_num; stats_id++) {
+        seq = se_map->se_seq[stats_id];
+
+        /*
+         * Skip domains which are in the middle of a level change, as it will
+         * account for the residency itself, and domains which have not
+         * changed level since the last update, as readers can compute their
+         * live residency from the time stamp of the last change.
+         */
+        if (((seq & 1U) != 0U) || (seq == se_map->se_sweep_seq[stats_id])) {
             continue;
         }
 
-        se_map = stats->context->se_stats_map;
-        stats_id = stats->context->se_index_map[i];
+        se_map->se_sweep_seq[stats_id] = seq;
 
-        flags = fwk_interrupt_global_disable();
-
-        ts_now_us = _get_curret_ts_us();
+        domain_stats = se_map->se_stats[stats_id];
+        if ((domain_stats == NULL) ||
+            (ts_now_us < domain_stats->ts_last_change_us)) {
+            continue;
+        }
 
         /* Update current operation level statistics */
-        delta_t = ts_now_us - domain_stats->ts_last_change_us;
-
         curr_level_id = se_map->se_curr_level[stats_id];
         level_stats = &domain_stats->level[curr_level_id];
-        level_stats->total_residency_us += delta_t;
+        level_stats->total_residency_us +=
+            ts_now_us - domain_stats->ts_last_change_us;
         domain_stats->ts_last_change_us = ts_now_us;
-
-        fwk_interrupt_global_enable(flags);
     }
-
 }
 
 static void periodic_update_callback(uintptr_t param)
 {
-    /* Update current level stats in all tracked domains in the perf module */
-    update_all_domains_current_level(fwk_module_id_scmi_perf);
+    struct mod_stats_info *stats;
 
-    /* Update current level stats in all tracked domains in the power module */
-    update_all_domains_current_level(fwk_module_id_scmi_power_domain);
-}
+    /* A single time stamp is used for all the domains in this update */
+    uint64_t ts_now_us = _get_curret_ts_us();
 
-static int register_module_stats(fwk_id_t module_id)
-{
-    return FWK_SUCCESS;
+    /* Update current level stats in all tracked domains of every module */
+    for (stats = stats_ctx.registry; stats != NULL; stats = stats->next) {
+        update_all_domains_current_level(stats, ts_now_us);
+    }
 }
 
 static int stats_init(fwk_id_t module_id, unsigned int element_count,
@@ -581,21 +729,13 @@ static int process_bind_request(fwk_id_t source_id,
         return FWK_E_PARAM;
     }
 
+    /*
+     * Any module may bind to the statistics API. Modules register their
+     * statistics when they call init_stats().
+     */
     *api = &mod_statistics_api;
 
-    /* Request from SCMI Performance domain statistics */
-    if (fwk_id_get_module_idx(source_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_perf)) {
-        return register_module_stats(fwk_module_id_scmi_perf);
-    }
-
-    /* Request from SCMI Power domain statistics*/
-    if (fwk_id_get_module_idx(source_id) ==
-        fwk_id_get_module_idx(fwk_module_id_scmi_power_domain)) {
-        return register_module_stats(fwk_module_id_scmi_power_domain);
-    }
-
-    return FWK_E_PARAM;
+    return FWK_SUCCESS;
 }
 
 const struct fwk_module module_statistics = {
@@ -0,0 +1,38 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <mod_stats.h>
+
+#include <fwk_id.h>
+#include <fwk_module_idx.h>
+
+#include <stdint.h>
+
+#define FAKE_STATS_REGION_SIZE 1024
+
+#define FAKE_STATS_AP_ADDR UINT64_C(0x80000000)
+
+/* Domains of the fake clock module, only the first two have statistics */
+enum fake_clock_idx {
+    FAKE_CLOCK_IDX_CPU,
+    FAKE_CLOCK_IDX_GPU,
+    FAKE_CLOCK_IDX_IO,
+    FAKE_CLOCK_IDX_COUNT,
+};
+
+#define FAKE_CLOCK_STATS_COUNT 2
+
+#define FAKE_CLOCK_LEVEL_COUNT 3
+
+static uint64_t fake_stats_region[FAKE_STATS_REGION_SIZE / sizeof(uint64_t)];
+
+static const struct mod_stats_config_info fake_stats_config = {
+    .ap_stats_addr = FAKE_STATS_AP_ADDR,
+    .scp_stats_addr = (uintptr_t)fake_stats_region,
+    .stats_region_size = sizeof(fake_stats_region),
+    .alarm_id = FWK_ID_NONE_INIT,
+};
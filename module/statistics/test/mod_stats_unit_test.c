@@ -0,0 +1,419 @@
+/*
+ * Arm SCP/MCP Software
+ * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "scp_unity.h"
+#include "unity.h"
+
+#include <Mockfwk_module.h>
+
+#include <mod_stats.h>
+
+#include <fwk_id.h>
+#include <fwk_macros.h>
+#include <fwk_time.h>
+
+#include UNIT_TEST_SRC
+#include "config_stats.h"
+
+static uint64_t fake_ts_us;
+
+static fwk_timestamp_t fake_timestamp(const void *ctx)
+{
+    return FWK_US(fake_ts_us);
+}
+
+struct fwk_time_driver fmw_time_driver(const void **ctx)
+{
+    return (struct fwk_time_driver){
+        .timestamp = fake_timestamp,
+    };
+}
+
+static fwk_id_t clock_id(unsigned int idx)
+{
+    return FWK_ID_ELEMENT(FWK_MODULE_IDX_CLOCK, idx);
+}
+
+static struct mod_stats_domain_stats_data *clock_domain_stats(unsigned int idx)
+{
+    return get_domain_section_data(fwk_module_id_clock, clock_id(idx));
+}
+
+static struct mod_stats_histogram *histogram_at(
+    struct mod_stats_info *stats,
+    uint32_t offset)
+{
+    return (struct mod_stats_histogram *)((uintptr_t)stats->desc_header +
+                                          offset);
+}
+
+static void clock_stats_setup(void)
+{
+    int status;
+
+    status = stats_init_module(
+        fwk_module_id_clock,
+        MOD_STATS_SIGNATURE_CLCK,
+        FAKE_CLOCK_IDX_COUNT,
+        FAKE_CLOCK_STATS_COUNT);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = stats_add_domain(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        FAKE_CLOCK_LEVEL_COUNT);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = stats_add_domain(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_GPU),
+        FAKE_CLOCK_LEVEL_COUNT);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void setUp(void)
+{
+    int status;
+
+    memset(&stats_ctx, 0, sizeof(stats_ctx));
+
+    fake_ts_us = 0;
+
+    status = stats_init(fwk_module_id_statistics, 0, &fake_stats_config);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+}
+
+void tearDown(void)
+{
+}
+
+void test_init_stats_registers_any_module(void)
+{
+    int status;
+    struct mod_stats_info *clock_stats;
+    struct mod_stats_info *voltage_stats;
+
+    clock_stats_setup();
+
+    status = stats_init_module(
+        fwk_module_id_voltage, MOD_STATS_SIGNATURE_VOLT, 1, 1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    clock_stats = get_module_stats_info(fwk_module_id_clock);
+    voltage_stats = get_module_stats_info(fwk_module_id_voltage);
+    TEST_ASSERT_NOT_NULL(clock_stats);
+    TEST_ASSERT_NOT_NULL(voltage_stats);
+
+    /* Modules are linked in the order they registered */
+    TEST_ASSERT_EQUAL_PTR(clock_stats, stats_ctx.registry);
+    TEST_ASSERT_EQUAL_PTR(voltage_stats, clock_stats->next);
+
+    TEST_ASSERT_EQUAL_PTR(fake_stats_region, clock_stats->desc_header);
+    TEST_ASSERT_EQUAL_HEX32(
+        MOD_STATS_SIGNATURE_CLCK, clock_stats->desc_header->signature);
+    TEST_ASSERT_EQUAL(
+        FAKE_CLOCK_IDX_COUNT, clock_stats->desc_header->domain_count);
+    TEST_ASSERT_EQUAL_HEX32(
+        MOD_STATS_SIGNATURE_VOLT, voltage_stats->desc_header->signature);
+    TEST_ASSERT_EQUAL(1, voltage_stats->desc_header->domain_count);
+}
+
+void test_init_stats_invalid(void)
+{
+    int status;
+
+    status = stats_init_module(fwk_module_id_clock, 0, 1, 1);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+    TEST_ASSERT_NULL(stats_ctx.registry);
+
+    status = stats_init_module(
+        fwk_module_id_clock, MOD_STATS_SIGNATURE_CLCK, 1, 1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = stats_init_module(
+        fwk_module_id_clock, MOD_STATS_SIGNATURE_CLCK, 1, 1);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+}
+
+void test_periodic_update_walks_registry(void)
+{
+    int status;
+    struct mod_stats_domain_stats_data *cpu_stats;
+    struct mod_stats_domain_stats_data *volt_stats;
+
+    clock_stats_setup();
+
+    status = stats_init_module(
+        fwk_module_id_voltage, MOD_STATS_SIGNATURE_VOLT, 1, 1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = stats_add_domain(
+        fwk_module_id_voltage, FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE, 0), 2);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_start_module(fwk_module_id_clock));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_start_module(fwk_module_id_voltage));
+
+    fake_ts_us = 100;
+    status = stats_update_domain(
+        fwk_module_id_clock, clock_id(FAKE_CLOCK_IDX_CPU), 1);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    fake_ts_us = 300;
+    periodic_update_callback(0);
+
+    cpu_stats = clock_domain_stats(FAKE_CLOCK_IDX_CPU);
+    TEST_ASSERT_EQUAL(1, cpu_stats->curr_level_id);
+    TEST_ASSERT_EQUAL(1, cpu_stats->level[1].usage_count);
+    TEST_ASSERT_EQUAL(100, cpu_stats->level[0].total_residency_us);
+    TEST_ASSERT_EQUAL(200, cpu_stats->level[1].total_residency_us);
+    TEST_ASSERT_EQUAL(300, cpu_stats->ts_last_change_us);
+
+    /* The voltage domain has not changed level, so it is left alone */
+    volt_stats = get_domain_section_data(
+        fwk_module_id_voltage, FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE, 0));
+    TEST_ASSERT_EQUAL(0, volt_stats->level[0].total_residency_us);
+    TEST_ASSERT_EQUAL(0, volt_stats->ts_last_change_us);
+}
+
+void test_add_histogram(void)
+{
+    int status;
+    struct mod_stats_info *stats;
+    struct mod_stats_domain_stats_data *cpu_stats;
+    struct mod_stats_histogram *histogram;
+
+    clock_stats_setup();
+
+    stats = get_module_stats_info(fwk_module_id_clock);
+    cpu_stats = clock_domain_stats(FAKE_CLOCK_IDX_CPU);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    TEST_ASSERT_NOT_EQUAL(0, cpu_stats->extended_stats_offset);
+
+    histogram = histogram_at(stats, cpu_stats->extended_stats_offset);
+    TEST_ASSERT_EQUAL(MOD_STATS_HISTOGRAM_TRANSITION_LATENCY, histogram->type);
+    TEST_ASSERT_EQUAL(4, histogram->bucket_count);
+    TEST_ASSERT_EQUAL(10, histogram->bucket_width);
+    TEST_ASSERT_EQUAL(0, histogram->next_offset);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        1000,
+        500,
+        8);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* The newest histogram is first in the chain */
+    histogram = histogram_at(stats, cpu_stats->extended_stats_offset);
+    TEST_ASSERT_EQUAL(MOD_STATS_HISTOGRAM_VALUE, histogram->type);
+    TEST_ASSERT_EQUAL(8, histogram->bucket_count);
+    TEST_ASSERT_EQUAL(1000, histogram->min_value);
+
+    histogram = histogram_at(stats, histogram->next_offset);
+    TEST_ASSERT_EQUAL(MOD_STATS_HISTOGRAM_TRANSITION_LATENCY, histogram->type);
+    TEST_ASSERT_EQUAL(0, histogram->next_offset);
+
+    /* The other domain is not affected */
+    TEST_ASSERT_EQUAL(
+        0, clock_domain_stats(FAKE_CLOCK_IDX_GPU)->extended_stats_offset);
+}
+
+void test_add_histogram_invalid(void)
+{
+    int status;
+
+    clock_stats_setup();
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_TYPE_COUNT,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        0,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        0);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* No statistics are collected for this domain */
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_IO),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* The module has not registered */
+    status = stats_add_histogram(
+        fwk_module_id_voltage,
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_VOLTAGE, 0),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_PARAM, status);
+
+    /* More buckets than the region can hold */
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        FAKE_STATS_REGION_SIZE / sizeof(uint64_t));
+    TEST_ASSERT_EQUAL(FWK_E_NOMEM, status);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_start_module(fwk_module_id_clock));
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_GPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        0,
+        10,
+        4);
+    TEST_ASSERT_EQUAL(FWK_E_STATE, status);
+}
+
+void test_record_histogram(void)
+{
+    int status;
+    struct mod_stats_info *stats;
+    struct mod_stats_histogram *histogram;
+    const uint64_t samples[] = { 3, 10, 15, 25, 39, 1000 };
+    const uint64_t expected_buckets[] = { 3, 1, 1, 1 };
+
+    clock_stats_setup();
+
+    status = stats_add_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        10,
+        10,
+        FWK_ARRAY_SIZE(expected_buckets));
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+
+    /* Samples are only recorded once the statistics are started */
+    status = stats_record_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        samples[0]);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+
+    TEST_ASSERT_EQUAL(FWK_SUCCESS, stats_start_module(fwk_module_id_clock));
+
+    for (unsigned int i = 0; i < FWK_ARRAY_SIZE(samples); i++) {
+        status = stats_record_histogram(
+            fwk_module_id_clock,
+            clock_id(FAKE_CLOCK_IDX_CPU),
+            MOD_STATS_HISTOGRAM_VALUE,
+            samples[i]);
+        TEST_ASSERT_EQUAL(FWK_SUCCESS, status);
+    }
+
+    stats = get_module_stats_info(fwk_module_id_clock);
+    histogram = histogram_at(
+        stats, clock_domain_stats(FAKE_CLOCK_IDX_CPU)->extended_stats_offset);
+
+    /*
+     * Samples below the first bucket land in it, and samples beyond the last
+     * bucket land in the last one.
+     */
+    TEST_ASSERT_EQUAL(FWK_ARRAY_SIZE(samples), histogram->sample_count);
+    TEST_ASSERT_EQUAL_MEMORY(
+        expected_buckets, histogram->bucket, sizeof(expected_buckets));
+
+    status = stats_record_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_CPU),
+        MOD_STATS_HISTOGRAM_TRANSITION_LATENCY,
+        samples[0]);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+
+    status = stats_record_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_GPU),
+        MOD_STATS_HISTOGRAM_VALUE,
+        samples[0]);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+
+    status = stats_record_histogram(
+        fwk_module_id_clock,
+        clock_id(FAKE_CLOCK_IDX_IO),
+        MOD_STATS_HISTOGRAM_VALUE,
+        samples[0]);
+    TEST_ASSERT_EQUAL(FWK_E_SUPPORT, status);
+}
+
+int stats_test_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_init_stats_registers_any_module);
+    RUN_TEST(test_init_stats_invalid);
+    RUN_TEST(test_periodic_update_walks_registry);
+    RUN_TEST(test_add_histogram);
+    RUN_TEST(test_add_histogram_invalid);
+    RUN_TEST(test_record_histogram);
+
+    return UNITY_END();
+}
+
+#if !defined(TEST_ON_TARGET)
+int main(void)
+{
+    return stats_test_main();
+}
+#endif
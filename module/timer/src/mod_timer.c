@@ -22,6 +22,10 @@
 #include <fwk_module_idx.h>
 #include <fwk_status.h>
 
+#ifdef BUILD_HAS_DEBUGGER
+#    include <cli.h>
+#endif
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
@@ -38,6 +42,12 @@ struct timer_dev_ctx {
     struct alarm_sub_element_ctx *alarm_pool;
     /* Queue of active alarms */
     struct fwk_dlist alarms_active;
+#ifdef BUILD_HAS_DEBUGGER
+    /* Number of alarms in the pool */
+    unsigned int alarm_count;
+    /* Number of timer interrupts handled */
+    uint32_t isr_count;
+#endif
 };
 
 /* Alarm item context (sub-element) */
@@ -60,11 +70,20 @@ struct alarm_sub_element_ctx {
     bool bound;
     /* Flag indicating if this alarm is started */
     bool started;
+#ifdef BUILD_HAS_DEBUGGER
+    /* Number of times the alarm callback has been executed */
+    uint32_t fire_count;
+#endif
 };
 
 /* Table of timer device context structures */
 static struct timer_dev_ctx *ctx_table;
 
+#ifdef BUILD_HAS_DEBUGGER
+/* Number of timer devices */
+static unsigned int dev_count;
+#endif
+
 /*
  * Forward declarations
  */
@@ -564,6 +583,11 @@ static void timer_isr(uintptr_t ctx_ptr)
 
     alarm->activated = false;
 
+#ifdef BUILD_HAS_DEBUGGER
+    ctx->isr_count++;
+    alarm->fire_count++;
+#endif
+
     /* Execute the callback function */
     alarm->callback(alarm->param);
 
@@ -584,6 +608,55 @@ static void timer_isr(uintptr_t ctx_ptr)
     _configure_timer_with_next_alarm(ctx);
 }
 
+#ifdef BUILD_HAS_DEBUGGER
+/*
+ * Debugger CLI command printing the timer interrupt and alarm counters.
+ */
+static const char timer_perf_call[] = "timerperf";
+static const char timer_perf_help[] =
+    "  Prints the timer interrupt and alarm counters.\n"
+    "    Usage: timerperf [reset]";
+static int32_t timer_perf_f(int32_t argc, char **argv)
+{
+    struct alarm_sub_element_ctx *alarm;
+    struct timer_dev_ctx *ctx;
+    unsigned int dev_idx, alarm_idx;
+    bool reset = (argc > 1) && (strcmp(argv[1], "reset") == 0);
+
+    for (dev_idx = 0; dev_idx < dev_count; dev_idx++) {
+        ctx = &ctx_table[dev_idx];
+
+        if (reset) {
+            ctx->isr_count = 0;
+        } else {
+            cli_printf(
+                NONE,
+                "Timer %u: %u interrupts\n",
+                dev_idx,
+                (unsigned int)ctx->isr_count);
+        }
+
+        for (alarm_idx = 0; alarm_idx < ctx->alarm_count; alarm_idx++) {
+            alarm = &ctx->alarm_pool[alarm_idx];
+
+            if (reset) {
+                alarm->fire_count = 0;
+            } else if (alarm->bound) {
+                cli_printf(
+                    NONE,
+                    "  Alarm %u: %u fired, %s, period %u us\n",
+                    alarm_idx,
+                    (unsigned int)alarm->fire_count,
+                    alarm->started ? "started" : "stopped",
+                    (unsigned int)alarm->microseconds);
+            }
+        }
+    }
+
+    return FWK_SUCCESS;
+}
+#endif
+
 /*
  * Functions fulfilling the framework's module interface
  */
@@ -594,7 +667,14 @@ static int timer_init(fwk_id_t module_id,
 {
     ctx_table = fwk_mm_calloc(element_count, sizeof(struct timer_dev_ctx));
 
+#ifdef BUILD_HAS_DEBUGGER
+    dev_count = element_count;
+
+    return cli_command_register((cli_command_st){
+        timer_perf_call, timer_perf_help, &timer_perf_f, false });
+#else
     return FWK_SUCCESS;
+#endif
 }
 
 static int timer_device_init(fwk_id_t element_id, unsigned int alarm_count,
@@ -612,6 +692,10 @@ static int timer_device_init(fwk_id_t element_id, unsigned int alarm_count,
             fwk_mm_calloc(alarm_count, sizeof(struct alarm_sub_element_ctx));
     }
 
+#ifdef BUILD_HAS_DEBUGGER
+    ctx->alarm_count = alarm_count;
+#endif
+
     return FWK_SUCCESS;
 }
 
@@ -362,6 +362,21 @@ struct mod_transport_driver_input_api {
      *      errors.
      */
     int (*signal_message)(fwk_id_t channel_id);
+
+    /*!
+     * \brief Signal the incoming messages of a set of channels
+     *
+     * \details Used by the drivers to hand over all the doorbells found
+     *      pending in one interrupt. Every channel of the set is signalled,
+     *      even if signalling one of them fails.
+     *
+     * \param channel_ids Table of channel identifiers
+     * \param count Number of entries in the table
+     *
+     * \retval ::FWK_SUCCESS The operation succeeded.
+     * \return The first error returned when signalling a channel of the set.
+     */
+    int (*signal_messages)(const fwk_id_t *channel_ids, unsigned int count);
 };
 
 /*!
@@ -742,8 +742,27 @@ static int transport_signal_message(fwk_id_t channel_id)
     return transport_message_handler(channel_ctx);
 }
 
+static int transport_signal_messages(
+    const fwk_id_t *channel_ids,
+    unsigned int count)
+{
+    int status = FWK_SUCCESS;
+    int channel_status;
+    unsigned int idx;
+
+    for (idx = 0; idx < count; idx++) {
+        channel_status = transport_signal_message(channel_ids[idx]);
+        if ((channel_status != FWK_SUCCESS) && (status == FWK_SUCCESS)) {
+            status = channel_status;
+        }
+    }
+
+    return status;
+}
+
 static const struct mod_transport_driver_input_api driver_input_api = {
     .signal_message = transport_signal_message,
+    .signal_messages = transport_signal_messages,
 };
 
 static int transport_mailbox_init(struct transport_channel_ctx *channel_ctx)
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -226,11 +226,9 @@ enum juno_cdcel937_output_type {
 enum juno_cdcel937_module_ctx_state {
     JUNO_CDCEL937_DEVICE_IDLE = 0,
     JUNO_CDCEL937_DEVICE_SET_RATE_SET_BLOCK_ACCESS_LENGTH,
-    JUNO_CDCEL937_DEVICE_SET_RATE_READ_PLL_CONFIG,
     JUNO_CDCEL937_DEVICE_SET_RATE_WRITE_PLL_CONFIG,
     JUNO_CDCEL937_DEVICE_SET_RATE_COMPLETE,
     JUNO_CDCEL937_DEVICE_GET_RATE_SET_BLOCK_ACCESS_LENGTH,
-    JUNO_CDCEL937_DEVICE_GET_RATE_READ_PLL_CONFIG,
     JUNO_CDCEL937_DEVICE_GET_RATE_COMPLETE,
 
     #if USE_OUTPUT_Y1
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -36,6 +36,9 @@ static struct juno_cdcel937_dev_ctx *ctx_table;
  */
 static uint8_t i2c_transmit[16];
 
+/* Transactions of the I2C batch reading a configuration */
+static struct mod_i2c_request i2c_requests[2];
+
 /*
  * Helper functions
  */
@@ -97,10 +100,9 @@ static int output_type_from_output_id(
 
     }
 }
-static int set_block_access_length(struct juno_cdcel937_dev_ctx *ctx,
-                                   uint8_t length)
+/* Build the 2-byte command setting the block access length */
+static int build_block_access_length(uint8_t length, uint8_t *command)
 {
-    int status;
     struct cfg_reg6 config6;
 
     if (length == 0) {
@@ -115,11 +117,25 @@ static int set_block_access_length(struct juno_cdcel937_dev_ctx *ctx,
     write_field(config6.reg, CFG_REG6_BCOUNT, (uint8_t)length);
     write_field(config6.reg, CFG_REG6_EEWRITE, 0);
 
-    i2c_transmit[0] = (JUNO_CDCEL937_TRANSFER_MODE_BYTE |
-                      ((JUNO_CDCEL937_BASE_CFG_REG + 0x6) &
-                      JUNO_CDCEL937_I2C_BYTE_OFFSET_MASK));
+    command[0] = (JUNO_CDCEL937_TRANSFER_MODE_BYTE |
+                 ((JUNO_CDCEL937_BASE_CFG_REG + 0x6) &
+                 JUNO_CDCEL937_I2C_BYTE_OFFSET_MASK));
+
+    command[1] = config6.reg[0];
+
+    return FWK_SUCCESS;
+}
+
+#if USE_OUTPUT_Y1
+static int set_block_access_length(struct juno_cdcel937_dev_ctx *ctx,
+                                   uint8_t length)
+{
+    int status;
 
-    i2c_transmit[1] = config6.reg[0];
+    status = build_block_access_length(length, i2c_transmit);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
 
     status = module_ctx.i2c_api->transmit_as_controller(
         module_config->i2c_hal_id,
@@ -132,6 +148,7 @@ static int set_block_access_length(struct juno_cdcel937_dev_ctx *ctx,
 
     return status;
 }
+#endif
 
 static int write_configuration(struct juno_cdcel937_dev_ctx *ctx,
                                uint8_t base,
@@ -166,6 +183,10 @@ static int write_configuration(struct juno_cdcel937_dev_ctx *ctx,
     return status;
 }
 
+/*
+ * The block access length is set and the configuration read in a single I2C
+ * batch, which completes with one response event.
+ */
 static int read_configuration(struct juno_cdcel937_dev_ctx *ctx,
                               uint8_t base,
                               struct pll_cfg_reg *config)
@@ -177,17 +198,33 @@ static int read_configuration(struct juno_cdcel937_dev_ctx *ctx,
         return FWK_E_RANGE;
     }
 
-    i2c_transmit[0] = (JUNO_CDCEL937_TRANSFER_MODE_BLOCK |
+    status = build_block_access_length(block_access_length, &i2c_transmit[0]);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    i2c_transmit[2] = (JUNO_CDCEL937_TRANSFER_MODE_BLOCK |
                    (base & JUNO_CDCEL937_I2C_BYTE_OFFSET_MASK));
 
+    i2c_requests[0] = (struct mod_i2c_request) {
+        .target_address = ctx->config->target_address,
+        .transmit_data = &i2c_transmit[0],
+        .transmit_byte_count = 2,
+    };
+
     /* Returned data is preceded by a 1 byte header */
-    status = module_ctx.i2c_api->transmit_then_receive_as_controller(
+    i2c_requests[1] = (struct mod_i2c_request) {
+        .target_address = ctx->config->target_address,
+        .transmit_data = &i2c_transmit[2],
+        .receive_data = config->reg,
+        .transmit_byte_count = 1,
+        .receive_byte_count = block_access_length + 1,
+    };
+
+    status = module_ctx.i2c_api->transfer_batch_as_controller(
         module_config->i2c_hal_id,
-        ctx->config->target_address,
-        i2c_transmit,
-        config->reg,
-        1,
-        block_access_length + 1);
+        i2c_requests,
+        (uint8_t)FWK_ARRAY_SIZE(i2c_requests));
     if (status != FWK_PENDING) {
         return FWK_E_DEVICE;
     }
@@ -607,19 +644,6 @@ static int get_rate_y1_calc(struct juno_cdcel937_dev_ctx *ctx)
 }
 #endif
 
-static int rate_set_block_access_length(struct juno_cdcel937_dev_ctx *ctx)
-{
-    int status;
-    const uint8_t block_access_length = 8;
-
-    status = set_block_access_length(ctx, block_access_length);
-    if (status != FWK_PENDING) {
-        return FWK_E_DEVICE;
-    }
-
-    return status;
-}
-
 static int get_rate_read_pll_config(struct juno_cdcel937_dev_ctx *ctx)
 {
     int status;
@@ -966,22 +990,6 @@ static int juno_cdcel937_process_event(const struct fwk_event *event,
 
     switch (ctx->state) {
     case JUNO_CDCEL937_DEVICE_SET_RATE_SET_BLOCK_ACCESS_LENGTH:
-        status = rate_set_block_access_length(ctx);
-        if (status == FWK_PENDING) {
-            ctx->state =
-                JUNO_CDCEL937_DEVICE_SET_RATE_READ_PLL_CONFIG;
-            return FWK_SUCCESS;
-        }
-
-        break;
-
-    case JUNO_CDCEL937_DEVICE_SET_RATE_READ_PLL_CONFIG:
-        /* check I2C request */
-        if ((param->status != FWK_PENDING) &&
-            (param->status != FWK_SUCCESS)) {
-            status = param->status;
-            break;
-        }
         status = set_rate_read_pll_config(ctx);
         if (status == FWK_PENDING) {
             ctx->state =
@@ -1033,19 +1041,19 @@ static int juno_cdcel937_process_event(const struct fwk_event *event,
                 return FWK_SUCCESS;
             }
         } else {
-            status = rate_set_block_access_length(ctx);
+            status = get_rate_read_pll_config(ctx);
             if (status == FWK_PENDING) {
                 ctx->state =
-                    JUNO_CDCEL937_DEVICE_GET_RATE_READ_PLL_CONFIG;
+                    JUNO_CDCEL937_DEVICE_GET_RATE_COMPLETE;
                 return FWK_SUCCESS;
             }
         }
 
         #else
-        status = rate_set_block_access_length(ctx);
+        status = get_rate_read_pll_config(ctx);
         if (status == FWK_PENDING) {
             ctx->state =
-                JUNO_CDCEL937_DEVICE_GET_RATE_READ_PLL_CONFIG;
+                JUNO_CDCEL937_DEVICE_GET_RATE_COMPLETE;
             return FWK_SUCCESS;
         }
 
@@ -1103,17 +1111,13 @@ static int juno_cdcel937_process_event(const struct fwk_event *event,
         break;
     #endif
 
-    case JUNO_CDCEL937_DEVICE_GET_RATE_READ_PLL_CONFIG:
-        status = get_rate_read_pll_config(ctx);
-        if (status == FWK_PENDING) {
-            ctx->state =
-                JUNO_CDCEL937_DEVICE_GET_RATE_COMPLETE;
-            return FWK_SUCCESS;
-        }
-
-        break;
-
     case JUNO_CDCEL937_DEVICE_GET_RATE_COMPLETE:
+        /* check I2C request */
+        if ((param->status != FWK_PENDING) &&
+            (param->status != FWK_SUCCESS)) {
+            status = param->status;
+            break;
+        }
         status = get_rate_calc(ctx);
         ctx->rate_hz = ctx->rate;
         ctx->rate_set = true;
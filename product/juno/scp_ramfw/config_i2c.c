@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -49,6 +49,8 @@ static const struct fwk_element i2c_element_table[] = {
             .driver_id = FWK_ID_ELEMENT_INIT(FWK_MODULE_IDX_DW_APB_I2C, 0),
             .api_id = FWK_ID_API_INIT(FWK_MODULE_IDX_DW_APB_I2C,
                 MOD_DW_APB_I2C_API_IDX_DRIVER),
+            /* One request for each XRP7724 and CDCEL937 element */
+            .request_queue_length = 11,
         },
     },
     [1] = {0},
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -26,6 +26,8 @@
 
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #define NUM_SLICES          9
@@ -33,6 +35,19 @@
 #define NUM_DATA_PATTERNS   5
 #define DCI_FIFO_SIZE       20
 
+/* Per data slice registers holding the training results of a rank */
+#define TRAINING_DATA_REG_FIRST  82
+#define TRAINING_DATA_REG_LAST   142
+#define TRAINING_DATA_REG_COUNT \
+    (TRAINING_DATA_REG_LAST - TRAINING_DATA_REG_FIRST + 1)
+#define SC_PHY_MANUAL_UPDATE_REG 2310
+
+#define NUM_DDR_PHYS  2
+#define NUM_RANKS_MAX 2
+
+/* Bit of the MR6 direct command address enabling VrefDQ training */
+#define MR6_VREFDQ_TRAINING_ENABLE UINT32_C(0x80)
+
 struct wrdq_eye {
     uint16_t min;
     uint8_t min_found;
@@ -80,6 +95,12 @@ uint32_t rd_data[DCI_FIFO_SIZE];
 uint8_t wrrd_passes[NUM_SLICES][NUM_BITS_PER_SLICE];
 uint16_t DEFAULT_DELAY = 0x240;
 
+/*
+ * MR6 direct command address programmed by write eye training for each rank,
+ * zero if write eye training has not been run.
+ */
+static uint32_t trained_vrefdq_mr6_addr[NUM_DDR_PHYS][NUM_RANKS_MAX];
+
 /*
  * Functions fulfilling this module's interface
  */
@@ -219,6 +240,38 @@ static void delay_ms(uint32_t ms)
     }
 }
 
+static struct mod_dmc620_reg *get_dmc(fwk_id_t element_id)
+{
+    switch (fwk_id_get_element_idx(element_id)) {
+    case 0:
+        return (struct mod_dmc620_reg *)SCP_DMC0;
+    case 1:
+        return (struct mod_dmc620_reg *)SCP_DMC1;
+    default:
+        fwk_unexpected();
+        return NULL;
+    }
+}
+
+static void set_vrefdq_mr6(struct mod_dmc620_reg *dmc, uint32_t rank,
+    uint32_t direct_addr)
+{
+    uint32_t direct_cmd;
+
+    direct_cmd = ((1 << rank) << 16) | (0x6 << 8) | 1;
+
+    /* Enter VrefDQ training, set the value and exit VrefDQ training */
+    dmc->DIRECT_ADDR = direct_addr | MR6_VREFDQ_TRAINING_ENABLE;
+    dmc->DIRECT_CMD = direct_cmd;
+    delay_ms(1);
+    dmc->DIRECT_ADDR = direct_addr | MR6_VREFDQ_TRAINING_ENABLE;
+    dmc->DIRECT_CMD = direct_cmd;
+    delay_ms(1);
+    dmc->DIRECT_ADDR = direct_addr & ~MR6_VREFDQ_TRAINING_ENABLE;
+    dmc->DIRECT_CMD = direct_cmd;
+    delay_ms(1);
+}
+
 uint32_t dci_write_dram(struct mod_dmc620_reg *dmc, uint32_t *scp_address,
     uint32_t size_32, uint32_t rank, uint32_t bank)
 {
@@ -388,17 +441,10 @@ static int write_eye_detect_single_rank(fwk_id_t element_id,
     struct mod_dmc620_reg *dmc = NULL;
     uint32_t ddr_phy_base = 0;
 
-    fwk_assert(rank < 2);
+    fwk_assert(rank < NUM_RANKS_MAX);
     dmc_id = fwk_id_get_element_idx(element_id);
-    if (dmc_id == 0) {
-        dmc = (struct mod_dmc620_reg *)SCP_DMC0;
-        ddr_phy_base = SCP_DDR_PHY0;
-    } else if (dmc_id == 1) {
-        dmc = (struct mod_dmc620_reg *)SCP_DMC1;
-        ddr_phy_base = SCP_DDR_PHY1;
-    } else {
-        fwk_unexpected();
-    }
+    dmc = get_dmc(element_id);
+    ddr_phy_base = (dmc_id == 0) ? SCP_DDR_PHY0 : SCP_DDR_PHY1;
 
     best_vrefdq_mr6 = -1;
     for (slice = 0; slice < NUM_SLICES; slice++) {
@@ -689,6 +735,8 @@ static int write_eye_detect_single_rank(fwk_id_t element_id,
             dmc->DIRECT_ADDR = direct_addr;
             dmc->DIRECT_CMD = direct_cmd;
             delay_ms(wait_ms);
+
+            trained_vrefdq_mr6_addr[dmc_id][rank] = direct_addr;
         }
 
         for (slice = 0; slice < NUM_SLICES; slice++) {
@@ -760,16 +808,36 @@ static int write_eye_detect(fwk_id_t element_id, struct dimm_info *info,
     return status;
 }
 
+static void set_per_rank_post_training_values(uint32_t phy_addr,
+    struct dimm_info *info)
+{
+    uint32_t i;
+    uint32_t h;
+    uint32_t value;
+    uint32_t temp;
+
+    for (h = 0; h < info->number_of_ranks; h++) {
+        for (i = 0; i < 9; i++) {
+            value = *(uint32_t *)(phy_addr + (4 * (9 + (i * 256))));
+            temp = value;
+            value = (value & 0xFFFCFFFF) | (h << 16);
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = value;
+            value = *(uint32_t *)(phy_addr + (4 * (17 + (i * 256))));
+            value = (value & 0xFFFF00FF) | 0x100;
+            *(uint32_t *)(phy_addr + (4 * (17 + (i * 256)))) = value;
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = temp;
+        }
+    }
+}
+
 static int n1sdp_ddr_phy_post_training_configure(fwk_id_t element_id,
     struct dimm_info *info)
 {
     int status;
     const struct mod_n1sdp_ddr_phy_element_config *element_config;
     uint32_t i;
-    uint32_t h;
     uint32_t phy_addr;
     uint32_t value;
-    uint32_t temp;
     uint32_t rddqs_latency_adjust_value;
     uint32_t rddqs_gate_secondary_delay_value;
     uint32_t rddqs_x4_latency_adjust_value;
@@ -857,18 +925,7 @@ static int n1sdp_ddr_phy_post_training_configure(fwk_id_t element_id,
         FWK_LOG_INFO("[DDR-PHY] PASS!");
     }
 
-    for (h = 0; h < info->number_of_ranks; h++) {
-        for (i = 0; i < 9; i++) {
-            value = *(uint32_t *)(phy_addr + (4 * (9 + (i * 256))));
-            temp = value;
-            value = (value & 0xFFFCFFFF) | (h << 16);
-            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = value;
-            value = *(uint32_t *)(phy_addr + (4 * (17 + (i * 256))));
-            value = (value & 0xFFFF00FF) | 0x100;
-            *(uint32_t *)(phy_addr + (4 * (17 + (i * 256)))) = value;
-            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = temp;
-        }
-    }
+    set_per_rank_post_training_values(phy_addr, info);
 
     return FWK_SUCCESS;
 }
@@ -1144,6 +1201,119 @@ static int n1sdp_phy_obs_regs(fwk_id_t element_id,
     return n1sdp_read_eye_phy_obs_regs(element_id, info);
 }
 
+static size_t n1sdp_ddr_phy_get_training_data_size(fwk_id_t element_id,
+    struct dimm_info *info)
+{
+    fwk_assert(info != NULL);
+
+    /* Per slice registers of every rank, then the MR6 address of each rank */
+    return info->number_of_ranks * (NUM_SLICES * TRAINING_DATA_REG_COUNT + 1) *
+        sizeof(uint32_t);
+}
+
+static int n1sdp_ddr_phy_save_training_data(fwk_id_t element_id,
+    struct dimm_info *info, void *data)
+{
+    const struct mod_n1sdp_ddr_phy_element_config *element_config;
+    unsigned int element_idx;
+    uint32_t *saved;
+    uint32_t i;
+    uint32_t j;
+    uint32_t h;
+    uint32_t phy_addr;
+    uint32_t value;
+    uint32_t temp;
+
+    fwk_assert(info != NULL);
+    fwk_assert(data != NULL);
+    fwk_assert(info->number_of_ranks <= NUM_RANKS_MAX);
+
+    element_config = fwk_module_get_data(element_id);
+    element_idx = fwk_id_get_element_idx(element_id);
+    phy_addr = (uint32_t)element_config->ddr;
+    saved = data;
+
+    for (h = 0; h < info->number_of_ranks; h++) {
+        for (i = 0; i < NUM_SLICES; i++) {
+            value = *(uint32_t *)(phy_addr + (4 * (9 + (i * 256))));
+            temp = value;
+            value = (value & 0xFFFCFFFF) | (h << 16);
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = value;
+            for (j = TRAINING_DATA_REG_FIRST; j <= TRAINING_DATA_REG_LAST;
+                 j++) {
+                *saved++ = *(uint32_t *)(phy_addr + (4 * (j + (i * 256))));
+            }
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = temp;
+        }
+    }
+
+    for (h = 0; h < info->number_of_ranks; h++) {
+        *saved++ = trained_vrefdq_mr6_addr[element_idx][h];
+    }
+
+    return FWK_SUCCESS;
+}
+
+static int n1sdp_ddr_phy_restore_training_data(fwk_id_t element_id,
+    struct dimm_info *info, const void *data)
+{
+    const struct mod_n1sdp_ddr_phy_element_config *element_config;
+    const uint32_t *saved;
+    struct mod_dmc620_reg *dmc;
+    unsigned int element_idx;
+    uint32_t i;
+    uint32_t j;
+    uint32_t h;
+    uint32_t phy_addr;
+    uint32_t value;
+    uint32_t temp;
+
+    fwk_assert(info != NULL);
+    fwk_assert(data != NULL);
+    fwk_assert(info->number_of_ranks <= NUM_RANKS_MAX);
+
+    element_config = fwk_module_get_data(element_id);
+    element_idx = fwk_id_get_element_idx(element_id);
+    phy_addr = (uint32_t)element_config->ddr;
+    dmc = get_dmc(element_id);
+    saved = data;
+
+    FWK_LOG_INFO(
+        "[DDR-PHY] Restoring training data at 0x%" PRIX32, phy_addr);
+
+    for (h = 0; h < info->number_of_ranks; h++) {
+        for (i = 0; i < NUM_SLICES; i++) {
+            value = *(uint32_t *)(phy_addr + (4 * (9 + (i * 256))));
+            temp = value;
+            value = (value & 0xFFFCFFFF) | (h << 16);
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = value;
+            for (j = TRAINING_DATA_REG_FIRST; j <= TRAINING_DATA_REG_LAST;
+                 j++) {
+                *(uint32_t *)(phy_addr + (4 * (j + (i * 256)))) = *saved++;
+            }
+            *(uint32_t *)(phy_addr + (4 * (9 + (i * 256)))) = temp;
+        }
+    }
+
+    /* Apply the restored delays */
+    value = *(uint32_t *)(phy_addr + (4 * SC_PHY_MANUAL_UPDATE_REG));
+    value |= 1;
+    *(uint32_t *)(phy_addr + (4 * SC_PHY_MANUAL_UPDATE_REG)) = value;
+
+    /* Program the DRAM VrefDQ selected by write eye training */
+    for (h = 0; h < info->number_of_ranks; h++) {
+        value = *saved++;
+        if (value != 0) {
+            set_vrefdq_mr6(dmc, h, value);
+        }
+        trained_vrefdq_mr6_addr[element_idx][h] = value;
+    }
+
+    set_per_rank_post_training_values(phy_addr, info);
+
+    return FWK_SUCCESS;
+}
+
 static struct mod_dmc_ddr_phy_api n1sdp_ddr_phy_api = {
     .configure = n1sdp_ddr_phy_config,
     .post_training_configure = n1sdp_ddr_phy_post_training_configure,
@@ -1151,6 +1321,9 @@ static struct mod_dmc_ddr_phy_api n1sdp_ddr_phy_api = {
     .wrlvl_phy_obs_regs = n1sdp_wrlvl_phy_obs_regs,
     .read_gate_phy_obs_regs = n1sdp_read_gate_phy_obs_regs,
     .phy_obs_regs = n1sdp_phy_obs_regs,
+    .get_training_data_size = n1sdp_ddr_phy_get_training_data_size,
+    .save_training_data = n1sdp_ddr_phy_save_training_data,
+    .restore_training_data = n1sdp_ddr_phy_restore_training_data,
 };
 
 /*
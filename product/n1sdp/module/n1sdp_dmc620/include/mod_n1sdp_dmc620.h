@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -15,6 +15,7 @@
 #include <fwk_macros.h>
 #include <fwk_module.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -770,6 +771,60 @@ struct mod_dmc_ddr_phy_api {
     int (*phy_obs_regs)(fwk_id_t element_id,
                         uint32_t rank,
                         struct dimm_info *info);
+
+    /*!
+     * \brief Get the size of the training data of a DDR physical device
+     *
+     * \note This function is optional and can be set to NULL if the device
+     *      does not support saving its training data.
+     *
+     * \param element_id Element identifier corresponding to the device.
+     * \param info Pointer to DIMM information.
+     *
+     * \return Size in bytes of the data saved by ::save_training_data.
+     */
+    size_t (*get_training_data_size)(fwk_id_t element_id,
+                                     struct dimm_info *info);
+
+    /*!
+     * \brief Save the training results of a DDR physical device
+     *
+     * \note This function is optional and can be set to NULL if the device
+     *      does not support saving its training data.
+     *
+     * \param element_id Element identifier corresponding to the device.
+     * \param info Pointer to DIMM information.
+     * \param[out] data Buffer of ::get_training_data_size bytes.
+     *
+     * \retval ::FWK_SUCCESS if the operation succeed.
+     * \return one of the error code otherwise.
+     */
+    int (*save_training_data)(fwk_id_t element_id,
+                              struct dimm_info *info,
+                              void *data);
+
+    /*!
+     * \brief Restore the training results of a DDR physical device
+     *
+     * \details Called instead of the training sequence and
+     *      ::post_training_configure, after the device has been configured,
+     *      with data saved by ::save_training_data for the same DIMMs and
+     *      speed. It must also reapply the DRAM and device settings made by
+     *      ::post_training_configure.
+     *
+     * \note This function is optional and can be set to NULL if the device
+     *      does not support saving its training data.
+     *
+     * \param element_id Element identifier corresponding to the device.
+     * \param info Pointer to DIMM information.
+     * \param data Buffer of ::get_training_data_size bytes.
+     *
+     * \retval ::FWK_SUCCESS if the operation succeed.
+     * \return one of the error code otherwise.
+     */
+    int (*restore_training_data)(fwk_id_t element_id,
+                                 struct dimm_info *info,
+                                 const void *data);
 };
 
 /*!
@@ -808,6 +863,17 @@ struct mod_dmc620_module_config {
     fwk_id_t ddr_api_id;
     /*! DDR operating frequency */
     uint16_t ddr_speed;
+    /*!
+     * \brief Base address of a retained memory region where the training
+     *      data of the DDR PHYs is saved.
+     *
+     * \details When the saved data matches the connected DIMMs and the
+     *      operating frequency, it is restored instead of training the
+     *      memories again. Set to 0 to always train the memories.
+     */
+    uintptr_t training_data_base;
+    /*! Size of the training data region */
+    size_t training_data_size;
 };
 
 /*!
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,6 +20,7 @@
 #include <fwk_status.h>
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -824,3 +825,23 @@ int dimm_spd_calculate_dimm_size_gb(uint32_t *size_gb)
     *size_gb = size / FWK_GIB;
     return FWK_SUCCESS;
 }
+
+uint32_t dimm_spd_hash(void)
+{
+    const uint8_t *byte;
+    uint32_t hash = UINT32_C(2166136261);
+    size_t i;
+
+    /* FNV-1a over the raw SPD data of both DIMMs */
+    byte = (const uint8_t *)&ddr4_dimm0;
+    for (i = 0; i < sizeof(ddr4_dimm0); i++) {
+        hash = (hash ^ byte[i]) * UINT32_C(16777619);
+    }
+
+    byte = (const uint8_t *)&ddr4_dimm1;
+    for (i = 0; i < sizeof(ddr4_dimm1); i++) {
+        hash = (hash ^ byte[i]) * UINT32_C(16777619);
+    }
+
+    return hash;
+}
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -497,4 +497,12 @@ int dimm_spd_t_act_window(uint32_t *value);
  */
 int dimm_spd_calculate_dimm_size_gb(uint32_t *size_gb);
 
+/*
+ * Brief - Function to calculate a hash of the SPD data of the DIMMs
+ *
+ * retval - Hash of the SPD data, including the module serial numbers, read
+ *          by dimm_spd_init_check()
+ */
+uint32_t dimm_spd_hash(void);
+
 #endif /* DIMM_SPD_H */
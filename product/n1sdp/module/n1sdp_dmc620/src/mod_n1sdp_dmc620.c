@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2019-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -35,10 +35,45 @@
 /* DMC-620 register specific definitions */
 #define DDR_TRAIN_TWO_RANKS          0
 
+/* Identifier of valid saved training data ("DDRT") */
+#define DDR_TRAINING_DATA_MAGIC      UINT32_C(0x54524444)
+
+/*
+ * Training data layout, stored in retained memory.
+ */
+struct ddr_training_data {
+    /* DDR_TRAINING_DATA_MAGIC if the data is valid */
+    uint32_t magic;
+
+    /* Hash of the SPD data of the DIMMs the data was trained with */
+    uint32_t dimm_hash;
+
+    /* Checksum of the fields below and of the PHY data */
+    uint32_t checksum;
+
+    /* Size of the data of each PHY */
+    uint32_t phy_data_size;
+
+    /* Number of PHYs */
+    uint32_t phy_count;
+
+    /* Speed and number of ranks the data was trained with */
+    uint16_t speed;
+    uint8_t number_of_ranks;
+    uint8_t reserved;
+
+    /* Data of each PHY, in DMC element order */
+    uint8_t data[];
+};
+
 static struct mod_dmc_ddr_phy_api *ddr_phy_api;
 static struct mod_timer_api *timer_api;
 static struct mod_cdns_i2c_controller_api_polled *i2c_api;
 static struct dimm_info ddr_info;
+static unsigned int dmc_count;
+static struct ddr_training_data *training_data;
+static size_t training_data_capacity;
+static bool training_data_restored;
 
 /*
  * DMC-620 interrupt handling functions
@@ -345,187 +380,394 @@ static int dmc620_poll_dmc_status(struct mod_dmc620_reg *dmc)
                            &wait_data);
 }
 
-static int ddr_training(struct mod_dmc620_reg *dmc,
-    fwk_id_t ddr_id, struct dimm_info *info)
+static const struct mod_dmc620_element_config *dmc620_get_element_config(
+    unsigned int dmc_idx)
+{
+    return fwk_module_get_data(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_N1SDP_DMC620, dmc_idx));
+}
+
+static struct mod_dmc620_reg *dmc620_get_reg(unsigned int dmc_idx)
 {
+    return (struct mod_dmc620_reg *)dmc620_get_element_config(dmc_idx)->dmc;
+}
+
+static fwk_id_t dmc620_get_ddr_id(unsigned int dmc_idx)
+{
+    return dmc620_get_element_config(dmc_idx)->ddr_id;
+}
+
+/*
+ * The training commands are issued to all the DMCs before polling them, so
+ * the memories of all the channels are trained in parallel.
+ */
+
+static bool ddr_training_wait_condition(void *data)
+{
+    struct dmc620_wait_condition_data wait_data;
+    unsigned int dmc_idx;
+
+    fwk_assert(data != NULL);
+
+    wait_data.stage = *(enum dmc620_config_stage *)data;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        wait_data.dmc = dmc620_get_reg(dmc_idx);
+        if (!dmc620_wait_condition(&wait_data)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int ddr_training_poll_status(void)
+{
+    enum dmc620_config_stage stage;
+    int status;
+
+    stage = DMC620_CONFIG_STAGE_TRAINING_MGR_ACTIVE;
+    status = timer_api->wait(FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
+                             DMC_TRAINING_TIMEOUT,
+                             ddr_training_wait_condition,
+                             &stage);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_INFO("[DDR] FAIL");
+        return status;
+    }
+
+    stage = DMC620_CONFIG_STAGE_TRAINING_M0_IDLE;
+    status = timer_api->wait(FWK_ID_ELEMENT(FWK_MODULE_IDX_TIMER, 0),
+                             DMC_TRAINING_TIMEOUT,
+                             ddr_training_wait_condition,
+                             &stage);
+    if (status != FWK_SUCCESS) {
+        FWK_LOG_INFO("[DDR] FAIL");
+        return status;
+    }
+
+    FWK_LOG_INFO("[DDR] PASS");
+
+    return FWK_SUCCESS;
+}
+
+static void ddr_training_clear_interrupts(void)
+{
+    struct mod_dmc620_reg *dmc;
+    unsigned int dmc_idx;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        dmc = dmc620_get_reg(dmc_idx);
+
+        /* Clear interrupt status if any */
+        if (dmc->INTERRUPT_STATUS != 0) {
+            dmc->INTERRUPT_CLR = 0xFFFFFFFF;
+        }
+    }
+}
+
+static void ddr_training_command(uint32_t addr, uint32_t cmd)
+{
+    struct mod_dmc620_reg *dmc;
+    unsigned int dmc_idx;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        dmc = dmc620_get_reg(dmc_idx);
+        dmc->DIRECT_ADDR = addr;
+        dmc->DIRECT_CMD = cmd;
+    }
+}
+
+static void ddr_training_select_side(bool side_b)
+{
+    struct mod_dmc620_reg *dmc;
+    unsigned int dmc_idx;
     uint32_t value;
-    int i;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        dmc = dmc620_get_reg(dmc_idx);
+
+        /* Set read level control parameter */
+        value = dmc->RDLVL_CONTROL_NEXT;
+        if (side_b) {
+            value |= (0x03 << 9) | (0 << 16);
+        } else {
+            value = (value & 0xFFFFF9FF) | (0 << 16);
+        }
+        dmc->RDLVL_CONTROL_NEXT = value;
+    }
+}
+
+static void ddr_training_obs_regs(
+    int (*obs_regs)(fwk_id_t, uint32_t, struct dimm_info *))
+{
+    unsigned int dmc_idx;
     int j;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        for (j = 1; j <= ddr_info.number_of_ranks; j++) {
+            obs_regs(dmc620_get_ddr_id(dmc_idx), j, &ddr_info);
+        }
+    }
+}
+
+static int ddr_training(void)
+{
+    struct mod_dmc620_reg *dmc;
+    unsigned int dmc_idx;
+    uint32_t ranks;
+    int i;
     int status;
 
     FWK_LOG_INFO("[DDR] Training DDR memories...");
 
+    ranks = (uint32_t)ddr_info.ranks_to_train << 16;
+
     for (i = 1; i <= ddr_info.number_of_ranks; i++) {
         FWK_LOG_INFO("[DDR] Write leveling rank %d... ", i);
 
-        /* Clear interrupt status if any */
-        if (dmc->INTERRUPT_STATUS != 0) {
-            dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-        }
+        ddr_training_clear_interrupts();
 
         /* Set training command */
-        dmc->DIRECT_ADDR = DDR_ADDR_TRAIN_TYPE_WR_LVL;
-        if (dmc->DIRECT_ADDR != DDR_ADDR_TRAIN_TYPE_WR_LVL) {
-            for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-                ddr_phy_api->wrlvl_phy_obs_regs(ddr_id, j, info);
+        for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+            dmc = dmc620_get_reg(dmc_idx);
+            dmc->DIRECT_ADDR = DDR_ADDR_TRAIN_TYPE_WR_LVL;
+            if (dmc->DIRECT_ADDR != DDR_ADDR_TRAIN_TYPE_WR_LVL) {
+                ddr_training_obs_regs(ddr_phy_api->wrlvl_phy_obs_regs);
+                return FWK_E_DEVICE;
             }
-            return FWK_E_DEVICE;
         }
-        dmc->DIRECT_CMD  = ((1 << (i + 15)) | 0x000A);
-        status = ddr_poll_training_status(dmc);
+        for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+            dmc = dmc620_get_reg(dmc_idx);
+            dmc->DIRECT_CMD = ((1 << (i + 15)) | 0x000A);
+        }
+
+        status = ddr_training_poll_status();
         if (status != FWK_SUCCESS) {
-            for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-                ddr_phy_api->wrlvl_phy_obs_regs(ddr_id, j, info);
-            }
+            ddr_training_obs_regs(ddr_phy_api->wrlvl_phy_obs_regs);
             return status;
         }
-        ddr_phy_api->wrlvl_phy_obs_regs(ddr_id, i, info);
+        for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+            ddr_phy_api->wrlvl_phy_obs_regs(
+                dmc620_get_ddr_id(dmc_idx), i, &ddr_info);
+        }
+    }
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        ddr_phy_api->verify_phy_status(
+            dmc620_get_ddr_id(dmc_idx), DDR_ADDR_TRAIN_TYPE_WR_LVL, &ddr_info);
     }
-    ddr_phy_api->verify_phy_status(ddr_id, DDR_ADDR_TRAIN_TYPE_WR_LVL, info);
 
     FWK_LOG_INFO("[DDR] Read gate training");
-    /* Clear interrupt status if any */
-    if (dmc->INTERRUPT_STATUS != 0) {
-        dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-    }
+    ddr_training_clear_interrupts();
 
     FWK_LOG_INFO("[DDR] A side...");
 
-    /* Set read level control parameter */
-    value = dmc->RDLVL_CONTROL_NEXT;
-    value = (value & 0xFFFFF9FF) | (0 << 16);
-    dmc->RDLVL_CONTROL_NEXT = value;
+    ddr_training_select_side(false);
     /* Update */
-    dmc->DIRECT_ADDR = 0;
-    value = ((ddr_info.ranks_to_train << 16) | 0x000C);
-    dmc->DIRECT_CMD  = value;
+    ddr_training_command(0, ranks | 0x000C);
 
     /* Run training on slices 0-9 */
-    dmc->DIRECT_ADDR = (DDR_ADDR_TRAIN_TYPE_RD_GATE |
-                        (0x3FFFF << DDR_ADDR_DATA_SLICES_POS));
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000A);
+    ddr_training_command(
+        (DDR_ADDR_TRAIN_TYPE_RD_GATE | (0x3FFFF << DDR_ADDR_DATA_SLICES_POS)),
+        ranks | 0x000A);
 
-    status = ddr_poll_training_status(dmc);
+    status = ddr_training_poll_status();
     if (status != FWK_SUCCESS) {
-        for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-            ddr_phy_api->read_gate_phy_obs_regs(ddr_id, j, info);
-        }
+        ddr_training_obs_regs(ddr_phy_api->read_gate_phy_obs_regs);
         return status;
     }
 
-    /* Clear interrupt status if any */
-    if (dmc->INTERRUPT_STATUS != 0) {
-        dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-    }
+    ddr_training_clear_interrupts();
 
 #if DDR_TRAIN_TWO_RANKS
     FWK_LOG_INFO("[DDR] B side...");
 
-    /* Set write leveling parameters */
-    value = dmc->RDLVL_CONTROL_NEXT;
-    value |= (0x03 << 9) | (0 << 16);
-    dmc->RDLVL_CONTROL_NEXT = value;
+    ddr_training_select_side(true);
     /* Update */
-    dmc->DIRECT_ADDR = 0;
-    dmc->DIRECT_CMD  = 0x0001000C;
+    ddr_training_command(0, 0x0001000C);
 
     /* Run training on slices 10-17 */
-    dmc->DIRECT_ADDR = (DDR_ADDR_TRAIN_TYPE_RD_GATE |
-                        (0x3FFFF << DDR_ADDR_DATA_SLICES_POS));
-    dmc->DIRECT_CMD  = DDR_CMD_TRAIN_RANK_1;
+    ddr_training_command(
+        (DDR_ADDR_TRAIN_TYPE_RD_GATE | (0x3FFFF << DDR_ADDR_DATA_SLICES_POS)),
+        DDR_CMD_TRAIN_RANK_1);
 
-    status = ddr_poll_training_status(dmc);
+    status = ddr_training_poll_status();
     if (status != FWK_SUCCESS)
         return status;
 #endif
 
-    for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-        ddr_phy_api->read_gate_phy_obs_regs(ddr_id, j, info);
-    }
+    ddr_training_obs_regs(ddr_phy_api->read_gate_phy_obs_regs);
 
     FWK_LOG_INFO("[DDR] Read eye training");
-
-    /* Clear interrupt status if any */
-    if (dmc->INTERRUPT_STATUS != 0) {
-        dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-    }
+    ddr_training_clear_interrupts();
 
     FWK_LOG_INFO("[DDR] A side...");
 
-    /* Set write leveling parameters */
-    value = dmc->RDLVL_CONTROL_NEXT;
-    value = (value & 0xFFFFF9FF) | (0 << 16);
-    dmc->RDLVL_CONTROL_NEXT = value;
-
+    ddr_training_select_side(false);
     /* Update */
-    dmc->DIRECT_ADDR = 0;
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000C);
+    ddr_training_command(0, ranks | 0x000C);
 
     /* Run training on slices 0-9 */
-    dmc->DIRECT_ADDR = (DDR_ADDR_TRAIN_TYPE_RD_EYE |
-                        (0x201FF << DDR_ADDR_DATA_SLICES_POS));
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000A);
+    ddr_training_command(
+        (DDR_ADDR_TRAIN_TYPE_RD_EYE | (0x201FF << DDR_ADDR_DATA_SLICES_POS)),
+        ranks | 0x000A);
 
-    status = ddr_poll_training_status(dmc);
+    status = ddr_training_poll_status();
     if (status != FWK_SUCCESS) {
-        for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-            ddr_phy_api->phy_obs_regs(ddr_id, j, info);
-        }
+        ddr_training_obs_regs(ddr_phy_api->phy_obs_regs);
         return status;
     }
 
-    /* Clear interrupt status if any */
-    if (dmc->INTERRUPT_STATUS != 0) {
-        dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-    }
+    ddr_training_clear_interrupts();
 
     FWK_LOG_INFO("[DDR] B side...");
 
-    /* Set write leveling parameters */
-    value = dmc->RDLVL_CONTROL_NEXT;
-    value |= (0x03 << 9) | (0 << 16);
-    dmc->RDLVL_CONTROL_NEXT = value;
+    ddr_training_select_side(true);
     /* Update */
-    dmc->DIRECT_ADDR = 0;
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000C);
+    ddr_training_command(0, ranks | 0x000C);
 
     /* Run training on slices 10-17 */
-    dmc->DIRECT_ADDR = (DDR_ADDR_TRAIN_TYPE_RD_EYE |
-                        (0x1FE00 << DDR_ADDR_DATA_SLICES_POS));
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000A);
+    ddr_training_command(
+        (DDR_ADDR_TRAIN_TYPE_RD_EYE | (0x1FE00 << DDR_ADDR_DATA_SLICES_POS)),
+        ranks | 0x000A);
 
-    status = ddr_poll_training_status(dmc);
+    status = ddr_training_poll_status();
     if (status != FWK_SUCCESS) {
-        for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-            ddr_phy_api->phy_obs_regs(ddr_id, j, info);
-        }
+        ddr_training_obs_regs(ddr_phy_api->phy_obs_regs);
         return status;
     }
 
-    /* Clear interrupt status if any */
-    if (dmc->INTERRUPT_STATUS != 0) {
-        dmc->INTERRUPT_CLR = 0xFFFFFFFF;
-    }
+    ddr_training_clear_interrupts();
 
     FWK_LOG_INFO("[DDR] MC initiated update...");
 
-    dmc->DIRECT_ADDR = 0;
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000A);
+    ddr_training_command(0, ranks | 0x000A);
 
-    status = ddr_poll_training_status(dmc);
+    status = ddr_training_poll_status();
     if (status != FWK_SUCCESS) {
         return status;
     }
 
-    dmc->DIRECT_CMD  = ((ddr_info.ranks_to_train << 16) | 0x000C);
-
-    for (j = 1; j <= ddr_info.number_of_ranks; j++) {
-        ddr_phy_api->phy_obs_regs(ddr_id, j, info);
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        dmc = dmc620_get_reg(dmc_idx);
+        dmc->DIRECT_CMD = ranks | 0x000C;
     }
 
+    ddr_training_obs_regs(ddr_phy_api->phy_obs_regs);
+
     return FWK_SUCCESS;
 }
 
+/*
+ * Training data saved in retained memory
+ */
+
+static bool ddr_training_data_supported(void)
+{
+    return (training_data != NULL) &&
+        (ddr_phy_api->get_training_data_size != NULL) &&
+        (ddr_phy_api->save_training_data != NULL) &&
+        (ddr_phy_api->restore_training_data != NULL);
+}
+
+static uint32_t ddr_training_data_checksum(size_t phy_data_size)
+{
+    const uint8_t *byte = (const uint8_t *)&training_data->phy_data_size;
+    const uint8_t *end = &training_data->data[phy_data_size * dmc_count];
+    uint32_t hash = UINT32_C(2166136261);
+
+    /* FNV-1a over the saved parameters and data */
+    while (byte < end) {
+        hash = (hash ^ *byte++) * UINT32_C(16777619);
+    }
+
+    return hash;
+}
+
+static bool ddr_training_data_valid(void)
+{
+    size_t phy_data_size;
+
+    if (!ddr_training_data_supported()) {
+        return false;
+    }
+
+    phy_data_size =
+        ddr_phy_api->get_training_data_size(dmc620_get_ddr_id(0), &ddr_info);
+
+    if ((training_data->magic != DDR_TRAINING_DATA_MAGIC) ||
+        (training_data->phy_data_size != phy_data_size) ||
+        (training_data->phy_count != dmc_count) ||
+        ((sizeof(*training_data) + (phy_data_size * dmc_count)) >
+         training_data_capacity) ||
+        (training_data->speed != ddr_info.speed) ||
+        (training_data->number_of_ranks != ddr_info.number_of_ranks) ||
+        (training_data->dimm_hash != dimm_spd_hash()) ||
+        (training_data->checksum != ddr_training_data_checksum(phy_data_size))) {
+        return false;
+    }
+
+    return true;
+}
+
+static int ddr_training_data_restore(unsigned int dmc_idx)
+{
+    FWK_LOG_INFO("[DDR] Restoring saved training data");
+
+    return ddr_phy_api->restore_training_data(
+        dmc620_get_ddr_id(dmc_idx),
+        &ddr_info,
+        &training_data->data[dmc_idx * training_data->phy_data_size]);
+}
+
+/*
+ * Invalidate the saved training data, so that it is not used again if it
+ * cannot be saved after the next training.
+ */
+static void ddr_training_data_invalidate(void)
+{
+    training_data->magic = 0;
+}
+
+static void ddr_training_data_save(void)
+{
+    size_t phy_data_size;
+    unsigned int dmc_idx;
+    int status;
+
+    if (!ddr_training_data_supported()) {
+        return;
+    }
+
+    phy_data_size =
+        ddr_phy_api->get_training_data_size(dmc620_get_ddr_id(0), &ddr_info);
+    if ((sizeof(*training_data) + (phy_data_size * dmc_count)) >
+        training_data_capacity) {
+        FWK_LOG_WARN("[DDR] Training data region too small, not saved");
+        return;
+    }
+
+    training_data->magic = 0;
+
+    for (dmc_idx = 0; dmc_idx < dmc_count; dmc_idx++) {
+        status = ddr_phy_api->save_training_data(
+            dmc620_get_ddr_id(dmc_idx),
+            &ddr_info,
+            &training_data->data[dmc_idx * phy_data_size]);
+        if (status != FWK_SUCCESS) {
+            return;
+        }
+    }
+
+    training_data->dimm_hash = dimm_spd_hash();
+    training_data->phy_data_size = (uint32_t)phy_data_size;
+    training_data->phy_count = dmc_count;
+    training_data->speed = ddr_info.speed;
+    training_data->number_of_ranks = ddr_info.number_of_ranks;
+    training_data->checksum = ddr_training_data_checksum(phy_data_size);
+    training_data->magic = DDR_TRAINING_DATA_MAGIC;
+}
+
 static int dmc620_verify_phy_status(fwk_id_t ddr_id)
 {
     int status;
@@ -878,6 +1120,11 @@ static int dmc620_post_init(void)
     count = fwk_module_get_element_count(
         FWK_ID_MODULE(FWK_MODULE_IDX_N1SDP_DMC620));
     for (i = 0; i < count; i++) {
+        /* The training status is not available for restored training data */
+        if (training_data_restored) {
+            break;
+        }
+
         id = FWK_ID_ELEMENT(FWK_MODULE_IDX_N1SDP_DMC620, i);
         element_config = fwk_module_get_data(id);
 
@@ -900,10 +1147,39 @@ static int dmc620_post_init(void)
     return FWK_SUCCESS;
 }
 
+static int dmc620_ready(struct mod_dmc620_reg *dmc)
+{
+    int status;
+
+    FWK_LOG_INFO("[DDR] Enable DIMM refresh...");
+    status = enable_dimm_refresh(dmc);
+    if (status != FWK_SUCCESS) {
+        return status;
+    }
+
+    /* Switch to READY */
+    FWK_LOG_INFO("[DDR] Setting DMC to READY mode");
+
+    dmc->MEMC_CMD = MOD_DMC620_MEMC_CMD_GO;
+
+    while ((dmc->MEMC_STATUS & MOD_DMC620_MEMC_CMD) != MOD_DMC620_MEMC_CMD_GO)
+        continue;
+
+    FWK_LOG_INFO("[DDR] DMC init done.");
+
+    return FWK_SUCCESS;
+}
+
+/*
+ * The memories are trained once all the DMCs are configured, or the saved
+ * training data is restored instead when it matches the connected DIMMs. The
+ * memories are trained if the saved data cannot be restored to a PHY.
+ */
 static int dmc620_config(struct mod_dmc620_reg *dmc, fwk_id_t ddr_id)
 {
     int status;
     int dmc_id;
+    unsigned int i;
     uint32_t value;
 
     dmc_id = fwk_id_get_element_idx(ddr_id);
@@ -1175,40 +1451,55 @@ static int dmc620_config(struct mod_dmc620_reg *dmc, fwk_id_t ddr_id)
         return status;
     }
 
-    status = ddr_training(dmc, ddr_id, &ddr_info);
-    if (status != FWK_SUCCESS) {
-        return status;
+    if (dmc_id == 0) {
+        training_data_restored = ddr_training_data_valid();
     }
 
-    status = ddr_phy_api->post_training_configure(ddr_id, &ddr_info);
-    if (status != FWK_SUCCESS) {
-        return status;
+    if (training_data_restored) {
+        status = ddr_training_data_restore(dmc_id);
+        if (status != FWK_SUCCESS) {
+            /*
+             * The DMCs are kept in CONFIG mode until the last one is
+             * configured, so all the memories can still be trained.
+             */
+            FWK_LOG_WARN("[DDR] Training data not restored, training");
+            ddr_training_data_invalidate();
+            training_data_restored = false;
+        }
     }
 
-    FWK_LOG_INFO("[DDR] Enable DIMM refresh...");
-    status = enable_dimm_refresh(dmc);
-    if (status != FWK_SUCCESS) {
-        return status;
+    if (dmc_id != (int)(dmc_count - 1)) {
+        return FWK_SUCCESS;
     }
 
-    /* Switch to READY */
-    FWK_LOG_INFO("[DDR] Setting DMC to READY mode");
-
-    dmc->MEMC_CMD = MOD_DMC620_MEMC_CMD_GO;
-
-    while ((dmc->MEMC_STATUS & MOD_DMC620_MEMC_CMD) != MOD_DMC620_MEMC_CMD_GO)
-        continue;
+    if (!training_data_restored) {
+        /* All the DMCs are configured, train their memories together */
+        status = ddr_training();
+        if (status != FWK_SUCCESS) {
+            return status;
+        }
 
-    FWK_LOG_INFO("[DDR] DMC init done.");
+        for (i = 0; i < dmc_count; i++) {
+            status = ddr_phy_api->post_training_configure(
+                dmc620_get_ddr_id(i), &ddr_info);
+            if (status != FWK_SUCCESS) {
+                return status;
+            }
+        }
+    }
 
-    if (dmc_id == 1) {
-        status = dmc620_post_init();
+    for (i = 0; i < dmc_count; i++) {
+        status = dmc620_ready(dmc620_get_reg(i));
         if (status != FWK_SUCCESS) {
             return status;
         }
     }
 
-    return FWK_SUCCESS;
+    if (!training_data_restored) {
+        ddr_training_data_save();
+    }
+
+    return dmc620_post_init();
 }
 
 /* Memory Information API */
@@ -1243,6 +1534,14 @@ static int mod_dmc620_init(fwk_id_t module_id, unsigned int element_count,
         (struct mod_dmc620_module_config *)config;
 
     ddr_info.speed = mod_config->ddr_speed;
+    dmc_count = element_count;
+
+    if (mod_config->training_data_base != 0) {
+        training_data =
+            (struct ddr_training_data *)mod_config->training_data_base;
+        training_data_capacity = mod_config->training_data_size;
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2020-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,7 +14,9 @@
  */
 static const struct mod_debugger_cli_module_config debugger_cli_data = {
     .alarm_id = FWK_ID_SUB_ELEMENT_INIT(FWK_MODULE_IDX_TIMER, 0, 1),
-    .poll_period = 100
+    .poll_period = 100,
+    /* Run with Ctrl-B to inspect the firmware without pausing it */
+    .batch = "uptime;perf;checkpoint list",
 };
 
 /*
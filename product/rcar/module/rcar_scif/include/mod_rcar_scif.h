@@ -11,6 +11,7 @@
 
 #include <fwk_id.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -44,6 +45,26 @@ struct mod_rcar_scif_element_cfg {
      * \brief Reference clock in Hertz.
      */
     uint64_t clock_rate_hz;
+
+    /*!
+     * \brief Size of the transmit buffer in bytes.
+     *
+     * \details When set to a value other than zero, characters written to the
+     *      device are queued in a transmit buffer of this size and drained into
+     *      the transmit FIFO by the transmit FIFO data empty interrupt.
+     *
+     * \note If set to zero, characters are written directly to the transmit
+     *      FIFO.
+     */
+    size_t tx_buffer_size;
+
+    /*!
+     * \brief Interrupt number of the device.
+     *
+     * \note Only used if ::mod_rcar_scif_element_cfg::tx_buffer_size is not
+     *      zero.
+     */
+    unsigned int irq;
 };
 
 /*!
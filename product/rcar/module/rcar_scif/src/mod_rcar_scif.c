@@ -14,17 +14,30 @@
 #include <mod_rcar_scif.h>
 #include <mod_rcar_system.h>
 
+#include <fwk_interrupt.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
 #include <fwk_notification.h>
+#include <fwk_ring.h>
 #include <fwk_status.h>
 
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 struct mod_rcar_scif_element_ctx {
     /* Whether the device has an open file stream */
     bool open;
+
+    /* Whether transmitted characters are queued in the transmit buffer */
+    bool tx_buffered;
+
+    /* Whether the transmit interrupt is available to drain the buffer */
+    bool tx_irq_ready;
+
+    /* Transmit buffer drained by the transmit interrupt */
+    struct fwk_ring tx_ring;
 };
 
 static struct mod_rcar_scif_ctx {
@@ -52,9 +65,21 @@ static int mod_rcar_scif_init_ctx(struct mod_rcar_scif_ctx *ctx)
         return FWK_E_NOMEM;
 
     for (size_t i = 0; i < element_count; i++) {
+        const struct mod_rcar_scif_element_cfg *cfg =
+            fwk_module_get_data(FWK_ID_ELEMENT(FWK_MODULE_IDX_RCAR_SCIF, i));
+
         ctx->elements[i] = (struct mod_rcar_scif_element_ctx){
             .open = false,
         };
+
+        if (cfg->tx_buffer_size > 0) {
+            fwk_ring_init(
+                &ctx->elements[i].tx_ring,
+                fwk_mm_alloc(cfg->tx_buffer_size, sizeof(char)),
+                cfg->tx_buffer_size);
+
+            ctx->elements[i].tx_buffered = true;
+        }
     }
 
     mod_rcar_scif_ctx.initialized = true;
@@ -135,16 +160,78 @@ static int mod_rcar_scif_resume(void)
     return mod_rcar_scif_set_baud_rate(current_cfg);
 }
 
-static void mod_rcar_scif_putch(fwk_id_t id, char c)
+/*
+ * Move as many queued characters as possible from the transmit buffer into the
+ * transmit FIFO, and keep the transmit interrupt enabled for as long as there
+ * are characters left in the buffer. Must be called with interrupts disabled
+ * or from the interrupt handler.
+ */
+static void mod_rcar_scif_tx_drain(
+    struct mod_rcar_scif_element_ctx *ctx,
+    struct scif_reg *reg)
+{
+    char ch;
+
+    while (!fwk_ring_is_empty(&ctx->tx_ring) &&
+           (GET_SCFDR_T(reg) < FIFO_FULL)) {
+        (void)fwk_ring_pop(&ctx->tx_ring, &ch, sizeof(ch));
+
+        reg->SCFTDR = ch;
+    }
+
+    /* Acknowledge the transmit FIFO data empty condition */
+    reg->SCFSR &= ~SCFSR_TDFE;
+
+    if (fwk_ring_is_empty(&ctx->tx_ring) || !ctx->tx_irq_ready)
+        reg->SCSCR &= ~SCSCR_TIE_MASK;
+    else
+        reg->SCSCR |= SCSCR_TIE_EN;
+}
+
+static void mod_rcar_scif_isr(uintptr_t element_idx)
 {
+    fwk_id_t id = FWK_ID_ELEMENT(FWK_MODULE_IDX_RCAR_SCIF, element_idx);
     const struct mod_rcar_scif_element_cfg *cfg = fwk_module_get_data(id);
+
+    mod_rcar_scif_tx_drain(
+        &mod_rcar_scif_ctx.elements[element_idx], (void *)cfg->reg_base);
+}
+
+static bool mod_rcar_scif_putch(fwk_id_t id, char c)
+{
+    const struct mod_rcar_scif_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_rcar_scif_element_ctx *ctx =
+        &mod_rcar_scif_ctx.elements[fwk_id_get_element_idx(id)];
     struct scif_reg *reg = (void *)cfg->reg_base;
+    unsigned int flags;
+    bool queued = true;
 
-    /* Check if the transmit FIFO is full */
-    while (GET_SCFDR_T(reg) >= FIFO_FULL)
-        continue;
+    if (!ctx->tx_buffered) {
+        /* Check if the transmit FIFO is full */
+        if (GET_SCFDR_T(reg) >= FIFO_FULL)
+            return false;
 
-    reg->SCFTDR = c;
+        reg->SCFTDR = c;
+
+        return true;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    mod_rcar_scif_tx_drain(ctx, reg);
+
+    if (fwk_ring_is_empty(&ctx->tx_ring) && (GET_SCFDR_T(reg) < FIFO_FULL))
+        reg->SCFTDR = c;
+    else if (!fwk_ring_is_full(&ctx->tx_ring))
+        (void)fwk_ring_push(&ctx->tx_ring, &c, sizeof(c));
+    else
+        queued = false;
+
+    mod_rcar_scif_tx_drain(ctx, reg);
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return queued;
 }
 
 static bool mod_rcar_scif_getch(fwk_id_t id, char *ch)
@@ -155,7 +242,16 @@ static bool mod_rcar_scif_getch(fwk_id_t id, char *ch)
 static void mod_rcar_scif_flush(fwk_id_t id)
 {
     const struct mod_rcar_scif_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_rcar_scif_element_ctx *ctx =
+        &mod_rcar_scif_ctx.elements[fwk_id_get_element_idx(id)];
     struct scif_reg *reg = (void *)cfg->reg_base;
+    unsigned int flags;
+
+    while (ctx->tx_buffered && !fwk_ring_is_empty(&ctx->tx_ring)) {
+        flags = fwk_interrupt_global_disable();
+        mod_rcar_scif_tx_drain(ctx, reg);
+        (void)fwk_interrupt_global_enable(flags);
+    }
 
     /* Check if the transmit data is available */
     while (GET_SCFDR_T(reg))
@@ -186,6 +282,40 @@ static int mod_rcar_scif_element_init(
 
 static int mod_rcar_scif_start(fwk_id_t id)
 {
+    int status;
+    const struct mod_rcar_scif_element_cfg *cfg;
+    struct mod_rcar_scif_element_ctx *ctx;
+    unsigned int flags;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
+        return FWK_SUCCESS;
+
+    cfg = fwk_module_get_data(id);
+    if (cfg->tx_buffer_size == 0)
+        return FWK_SUCCESS;
+
+    /*
+     * Until now, queued characters have only been drained when new ones were
+     * written. From here on the transmit interrupt takes over.
+     */
+    status = fwk_interrupt_set_isr_param(
+        cfg->irq, mod_rcar_scif_isr, (uintptr_t)fwk_id_get_element_idx(id));
+    if (!fwk_expect(status == FWK_SUCCESS))
+        return FWK_E_HANDLER;
+
+    ctx = &mod_rcar_scif_ctx.elements[fwk_id_get_element_idx(id)];
+    ctx->tx_irq_ready = true;
+
+    status = fwk_interrupt_enable(cfg->irq);
+    if (!fwk_expect(status == FWK_SUCCESS))
+        return FWK_E_HANDLER;
+
+    if (ctx->open) {
+        flags = fwk_interrupt_global_disable();
+        mod_rcar_scif_tx_drain(ctx, (void *)cfg->reg_base);
+        (void)fwk_interrupt_global_enable(flags);
+    }
+
     return FWK_SUCCESS;
 }
 
@@ -245,7 +375,8 @@ static int mod_rcar_scif_io_putch(const struct fwk_io_stream *stream, char ch)
 
     fwk_assert(ctx->open);
 
-    mod_rcar_scif_putch(stream->id, ch);
+    if (!mod_rcar_scif_putch(stream->id, ch))
+        return FWK_E_BUSY;
 
     return FWK_SUCCESS;
 }
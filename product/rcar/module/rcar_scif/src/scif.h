@@ -76,6 +76,9 @@ struct scif_reg {
 #define MSTP310 (1 << 10)
 #define MSTP26 (1 << 6)
 
+#define SCSCR_TIE_MASK (1 << 7)
+#define SCSCR_TIE_DIS (0x0000)
+#define SCSCR_TIE_EN (0x0080)
 #define SCSCR_TE_MASK (1 << 5)
 #define SCSCR_TE_DIS (0x0000)
 #define SCSCR_TE_EN (0x0020)
@@ -92,6 +95,7 @@ struct scif_reg {
 #endif
 
 #define SCFSR_INIT_DATA (0x0000)
+#define SCFSR_TDFE (0x0020)
 
 #define SCFCR_TFRST_EN (0x0004)
 #define SCFCR_RFRS_EN (0x0002)
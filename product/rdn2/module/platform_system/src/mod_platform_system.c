@@ -235,19 +235,23 @@ static int update_isolated_mpid_list_in_sds(void)
 
 static void ppu_cores_isr(unsigned int first, uint32_t status)
 {
-    unsigned int core_idx;
+    unsigned int core_count = platform_get_core_count();
 
-    while (status != 0) {
-        core_idx = __builtin_ctz(status);
-        status &= ~(1 << core_idx);
+    if (first >= core_count) {
+        return;
+    }
 
-        if ((first + core_idx) >= platform_get_core_count()) {
-            continue;
-        }
+    /* Ignore the status bits of the cores that are not present */
+    if ((core_count - first) < 32) {
+        status &= (UINT32_C(1) << (core_count - first)) - 1;
+    }
 
-        platform_system_ctx.ppu_v1_isr_api->ppu_interrupt_handler(
-            FWK_ID_ELEMENT(FWK_MODULE_IDX_PPU_V1, first + core_idx));
+    if (status == 0) {
+        return;
     }
+
+    platform_system_ctx.ppu_v1_isr_api->ppu_interrupt_handler_batch(
+        FWK_ID_ELEMENT(FWK_MODULE_IDX_PPU_V1, first), status);
 }
 
 static void ppu_cores_isr_0(void)
@@ -1,6 +1,6 @@
 /*
  * Arm SCP/MCP Software
- * Copyright (c) 2018-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 #define MOD_F_UART3_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -56,6 +57,25 @@ struct mod_f_uart3_element_cfg {
 
     /*! Divider latch table index */
     enum mod_f_uart3_baud_rate baud_rate;
+
+    /*!
+     * \brief Size of the transmit buffer in bytes.
+     *
+     * \details When set to a value other than zero, characters written to the
+     *      device are queued in a transmit buffer of this size and drained by
+     *      the transmitter holding register empty interrupt.
+     *
+     * \note If set to zero, characters are written directly to the device.
+     */
+    size_t tx_buffer_size;
+
+    /*!
+     * \brief Interrupt number of the device.
+     *
+     * \note Only used if ::mod_f_uart3_element_cfg::tx_buffer_size is not
+     *      zero.
+     */
+    unsigned int irq;
 };
 
 /*!
@@ -54,6 +54,7 @@ struct f_uart3_dla_reg {
 #define F_UART3_IIR_ID_MODEM (uint32_t(0x0))
 
 /* FIFO Control Register */
+#define F_UART3_FCR_FIFOE ((uint32_t)(0x1 << 0))
 #define F_UART3_FCR_RXFRST ((uint32_t)(0x1 << 1))
 #define F_UART3_FCR_TXFRST ((uint32_t)(0x1 << 2))
 #define F_UART3_FCR_DMA ((uint32_t)(0x1 << 3))
@@ -65,6 +66,9 @@ struct f_uart3_dla_reg {
 #define F_UART3_FCR_RCVR_8B ((uint32_t)(0x2 << 6))
 #define F_UART3_FCR_RCVR_14B ((uint32_t)(0x3 << 6))
 
+/* Depth of the transmit FIFO */
+#define F_UART3_TX_FIFO_DEPTH 16
+
 /* Line Control Register */
 #define F_UART3_LCR_WLS ((uint32_t)(0x3 << 0))
 #define F_UART3_LCR_STB ((uint32_t)(0x3 << 2))
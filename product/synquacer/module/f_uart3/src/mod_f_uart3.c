@@ -9,18 +9,30 @@
 
 #include <mod_f_uart3.h>
 
+#include <fwk_interrupt.h>
 #include <fwk_mm.h>
 #include <fwk_module.h>
 #include <fwk_module_idx.h>
+#include <fwk_ring.h>
 #include <fwk_status.h>
 
 #include <fmw_cmsis.h>
 
 #include <stdbool.h>
+#include <stdint.h>
 
 struct mod_f_uart3_element_ctx {
     /* Whether the device has an open file stream */
     bool open;
+
+    /* Whether transmitted characters are queued in the transmit buffer */
+    bool tx_buffered;
+
+    /* Whether the transmit interrupt is available to drain the buffer */
+    bool tx_irq_ready;
+
+    /* Transmit buffer drained by the transmit interrupt */
+    struct fwk_ring tx_ring;
 };
 
 static struct mod_f_uart3_ctx {
@@ -81,9 +93,21 @@ static int mod_f_uart3_init_ctx(struct mod_f_uart3_ctx *ctx)
         return FWK_E_NOMEM;
 
     for (size_t i = 0; i < element_count; i++) {
+        const struct mod_f_uart3_element_cfg *cfg =
+            fwk_module_get_data(FWK_ID_ELEMENT(FWK_MODULE_IDX_F_UART3, i));
+
         ctx->elements[i] = (struct mod_f_uart3_element_ctx){
             .open = false, /* Assume the device is always powered */
         };
+
+        if (cfg->tx_buffer_size > 0) {
+            fwk_ring_init(
+                &ctx->elements[i].tx_ring,
+                fwk_mm_alloc(cfg->tx_buffer_size, sizeof(char)),
+                cfg->tx_buffer_size);
+
+            ctx->elements[i].tx_buffered = true;
+        }
     }
 
     mod_f_uart3_ctx.initialized = true;
@@ -132,30 +156,116 @@ static void mod_f_uart3_enable(fwk_id_t id)
 
     __DSB();
 
-    /* FIFO Reset */
-    reg->IIR_FCR = (F_UART3_FCR_RXFRST | F_UART3_FCR_TXFRST);
+    /*
+     * FIFO Reset. The FIFOs are enabled when transmitted characters are
+     * buffered so that the transmit interrupt can refill a whole FIFO.
+     */
+    if (cfg->tx_buffer_size > 0) {
+        reg->IIR_FCR =
+            (F_UART3_FCR_FIFOE | F_UART3_FCR_RXFRST | F_UART3_FCR_TXFRST);
+    } else {
+        reg->IIR_FCR = (F_UART3_FCR_RXFRST | F_UART3_FCR_TXFRST);
+    }
 
     __DSB();
 }
 
-static void mod_f_uart3_putch(fwk_id_t id, char ch)
+/*
+ * Refill the transmit FIFO from the transmit buffer once it is empty, and keep
+ * the transmitter holding register empty interrupt enabled for as long as there
+ * are characters left in the buffer. Must be called with interrupts disabled
+ * or from the interrupt handler.
+ */
+static void mod_f_uart3_tx_drain(
+    struct mod_f_uart3_element_ctx *ctx,
+    struct f_uart3_reg *reg)
+{
+    unsigned int count;
+    char ch;
+
+    if ((reg->LSR & F_UART3_LSR_THRE) != 0x0) {
+        for (count = 0; (count < F_UART3_TX_FIFO_DEPTH) &&
+             !fwk_ring_is_empty(&ctx->tx_ring);
+             count++) {
+            (void)fwk_ring_pop(&ctx->tx_ring, &ch, sizeof(ch));
+
+            reg->RFR_TFR = ch;
+        }
+    }
+
+    if (fwk_ring_is_empty(&ctx->tx_ring) || !ctx->tx_irq_ready)
+        reg->IER &= ~F_UART3_IER_ETBEI;
+    else
+        reg->IER |= F_UART3_IER_ETBEI;
+}
+
+static void mod_f_uart3_isr(uintptr_t element_idx)
+{
+    fwk_id_t id = FWK_ID_ELEMENT(FWK_MODULE_IDX_F_UART3, element_idx);
+    const struct mod_f_uart3_element_cfg *cfg = fwk_module_get_data(id);
+    struct f_uart3_reg *reg = (void *)cfg->reg_base;
+
+    /* Reading the identification register clears the THRE interrupt */
+    (void)reg->IIR_FCR;
+
+    mod_f_uart3_tx_drain(&mod_f_uart3_ctx.elements[element_idx], reg);
+}
+
+static bool mod_f_uart3_putch(fwk_id_t id, char ch)
 {
     const struct mod_f_uart3_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_f_uart3_element_ctx *ctx =
+        &mod_f_uart3_ctx.elements[fwk_id_get_element_idx(id)];
 
     struct f_uart3_reg *reg = (void *)cfg->reg_base;
 
-    while ((reg->LSR & F_UART3_LSR_THRE) == 0x0)
-        continue;
+    unsigned int flags;
+    bool queued = true;
+
+    if (!ctx->tx_buffered) {
+        if ((reg->LSR & F_UART3_LSR_THRE) == 0x0)
+            return false;
 
-    reg->RFR_TFR = ch;
+        reg->RFR_TFR = ch;
+
+        return true;
+    }
+
+    flags = fwk_interrupt_global_disable();
+
+    mod_f_uart3_tx_drain(ctx, reg);
+
+    if (fwk_ring_is_empty(&ctx->tx_ring) &&
+        ((reg->LSR & F_UART3_LSR_THRE) != 0x0))
+        reg->RFR_TFR = ch;
+    else if (!fwk_ring_is_full(&ctx->tx_ring))
+        (void)fwk_ring_push(&ctx->tx_ring, &ch, sizeof(ch));
+    else
+        queued = false;
+
+    mod_f_uart3_tx_drain(ctx, reg);
+
+    (void)fwk_interrupt_global_enable(flags);
+
+    return queued;
 }
 
 static void mod_f_uart3_flush(fwk_id_t id)
 {
     const struct mod_f_uart3_element_cfg *cfg = fwk_module_get_data(id);
+    struct mod_f_uart3_element_ctx *ctx =
+        &mod_f_uart3_ctx.elements[fwk_id_get_element_idx(id)];
 
     struct f_uart3_reg *reg = (void *)cfg->reg_base;
 
+    unsigned int flags;
+
+    while (ctx->tx_buffered && !fwk_ring_is_empty(&ctx->tx_ring)) {
+        flags = fwk_interrupt_global_disable();
+        mod_f_uart3_tx_drain(ctx, reg);
+        (void)fwk_interrupt_global_enable(flags);
+    }
+
     while ((reg->LSR & F_UART3_LSR_TEMT) == 0x0)
         continue;
 }
@@ -179,6 +289,45 @@ static int mod_f_uart3_element_init(
     return FWK_SUCCESS;
 }
 
+static int mod_f_uart3_start(fwk_id_t id)
+{
+    int status;
+    const struct mod_f_uart3_element_cfg *cfg;
+    struct mod_f_uart3_element_ctx *ctx;
+    unsigned int flags;
+
+    if (!fwk_id_is_type(id, FWK_ID_TYPE_ELEMENT))
+        return FWK_SUCCESS;
+
+    cfg = fwk_module_get_data(id);
+    if (cfg->tx_buffer_size == 0)
+        return FWK_SUCCESS;
+
+    /*
+     * Until now, queued characters have only been drained when new ones were
+     * written. From here on the transmit interrupt takes over.
+     */
+    status = fwk_interrupt_set_isr_param(
+        cfg->irq, mod_f_uart3_isr, (uintptr_t)fwk_id_get_element_idx(id));
+    if (!fwk_expect(status == FWK_SUCCESS))
+        return FWK_E_HANDLER;
+
+    ctx = &mod_f_uart3_ctx.elements[fwk_id_get_element_idx(id)];
+    ctx->tx_irq_ready = true;
+
+    status = fwk_interrupt_enable(cfg->irq);
+    if (!fwk_expect(status == FWK_SUCCESS))
+        return FWK_E_HANDLER;
+
+    if (ctx->open) {
+        flags = fwk_interrupt_global_disable();
+        mod_f_uart3_tx_drain(ctx, (void *)cfg->reg_base);
+        (void)fwk_interrupt_global_enable(flags);
+    }
+
+    return FWK_SUCCESS;
+}
+
 static int mod_f_uart3_io_open(const struct fwk_io_stream *stream)
 {
     int status;
@@ -212,7 +361,8 @@ int mod_f_uart3_io_putch(const struct fwk_io_stream *stream, char ch)
 
     fwk_assert(ctx->open);
 
-    mod_f_uart3_putch(stream->id, ch);
+    if (!mod_f_uart3_putch(stream->id, ch))
+        return FWK_E_BUSY;
 
     return FWK_SUCCESS;
 }
@@ -239,6 +389,7 @@ const struct fwk_module module_f_uart3 = {
 
     .init = mod_f_uart3_init,
     .element_init = mod_f_uart3_element_init,
+    .start = mod_f_uart3_start,
 
     .adapter =
         (struct fwk_io_adapter){
@@ -57,6 +57,7 @@ list(APPEND SCP_MODULES "scmi-system-power")
 list(APPEND SCP_MODULES "dvfs")
 list(APPEND SCP_MODULES "scmi-clock")
 list(APPEND SCP_MODULES "scmi-perf")
+list(APPEND SCP_MODULES "scmi-batch")
 list(APPEND SCP_MODULES "mock-psu")
 list(APPEND SCP_MODULES "psu")
 list(APPEND SCP_MODULES "tc2-system")
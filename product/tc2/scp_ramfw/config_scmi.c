@@ -8,6 +8,7 @@
 #include "tc2_scmi.h"
 
 #include <mod_scmi.h>
+#include <mod_scmi_batch.h>
 #include <mod_transport.h>
 
 #include <fwk_element.h>
@@ -70,11 +71,12 @@ static const struct fwk_element *get_service_table(fwk_id_t module_id)
 
 #ifndef BUILD_HAS_MOD_RESOURCE_PERMS
 
-/* PSCI agent has no access to clock, perf and sensor protocol */
-static const uint32_t dis_protocol_list_psci[3] = {
+/* PSCI agent has no access to clock, perf, sensor and batch protocol */
+static const uint32_t dis_protocol_list_psci[4] = {
     MOD_SCMI_PROTOCOL_ID_SENSOR,
     MOD_SCMI_PROTOCOL_ID_CLOCK,
     MOD_SCMI_PROTOCOL_ID_PERF,
+    MOD_SCMI_PROTOCOL_ID_BATCH,
 };
 #endif
 
@@ -6,6 +6,7 @@
 #include "internal/Mockfwk_module_internal.h"
 
 static const char* CMockString_element_id = "element_id";
+static const char* CMockString_fwk_module_deferred_start = "fwk_module_deferred_start";
 static const char* CMockString_fwk_module_get_ctx = "fwk_module_get_ctx";
 static const char* CMockString_fwk_module_get_element_ctx = "fwk_module_get_element_ctx";
 static const char* CMockString_fwk_module_get_state = "fwk_module_get_state";
@@ -31,6 +32,14 @@ typedef struct _CMOCK_fwk_module_stop_CALL_INSTANCE
 
 } CMOCK_fwk_module_stop_CALL_INSTANCE;
 
+typedef struct _CMOCK_fwk_module_deferred_start_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  char ExpectAnyArgsBool;
+  int ReturnVal;
+
+} CMOCK_fwk_module_deferred_start_CALL_INSTANCE;
+
 typedef struct _CMOCK_fwk_module_get_ctx_CALL_INSTANCE
 {
   UNITY_LINE_TYPE LineNumber;
@@ -79,6 +88,10 @@ static struct Mockfwk_module_internalInstance
   CMOCK_fwk_module_stop_CALLBACK fwk_module_stop_CallbackFunctionPointer;
   int fwk_module_stop_CallbackCalls;
   CMOCK_MEM_INDEX_TYPE fwk_module_stop_CallInstance;
+  char fwk_module_deferred_start_CallbackBool;
+  CMOCK_fwk_module_deferred_start_CALLBACK fwk_module_deferred_start_CallbackFunctionPointer;
+  int fwk_module_deferred_start_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE fwk_module_deferred_start_CallInstance;
   char fwk_module_get_ctx_CallbackBool;
   CMOCK_fwk_module_get_ctx_CALLBACK fwk_module_get_ctx_CallbackFunctionPointer;
   int fwk_module_get_ctx_CallbackCalls;
@@ -125,6 +138,17 @@ void Mockfwk_module_internal_Verify(void)
     call_instance = CMOCK_GUTS_NONE;
     (void)call_instance;
   }
+  call_instance = Mock.fwk_module_deferred_start_CallInstance;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_fwk_module_deferred_start);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.fwk_module_deferred_start_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
   call_instance = Mock.fwk_module_get_ctx_CallInstance;
   if (CMOCK_GUTS_NONE != call_instance)
   {
@@ -278,6 +302,54 @@ void fwk_module_stop_Stub(CMOCK_fwk_module_stop_CALLBACK Callback)
   Mock.fwk_module_stop_CallbackFunctionPointer = Callback;
 }
 
+int fwk_module_deferred_start(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_fwk_module_deferred_start_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_fwk_module_deferred_start);
+  cmock_call_instance = (CMOCK_fwk_module_deferred_start_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.fwk_module_deferred_start_CallInstance);
+  Mock.fwk_module_deferred_start_CallInstance = CMock_Guts_MemNext(Mock.fwk_module_deferred_start_CallInstance);
+  if (!Mock.fwk_module_deferred_start_CallbackBool &&
+      Mock.fwk_module_deferred_start_CallbackFunctionPointer != NULL)
+  {
+    int cmock_cb_ret = Mock.fwk_module_deferred_start_CallbackFunctionPointer(Mock.fwk_module_deferred_start_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (Mock.fwk_module_deferred_start_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.fwk_module_deferred_start_CallbackFunctionPointer(Mock.fwk_module_deferred_start_CallbackCalls++);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void fwk_module_deferred_start_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fwk_module_deferred_start_CALL_INSTANCE));
+  CMOCK_fwk_module_deferred_start_CALL_INSTANCE* cmock_call_instance = (CMOCK_fwk_module_deferred_start_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fwk_module_deferred_start_CallInstance = CMock_Guts_MemChain(Mock.fwk_module_deferred_start_CallInstance, cmock_guts_index);
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExpectAnyArgsBool = (char)0;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void fwk_module_deferred_start_AddCallback(CMOCK_fwk_module_deferred_start_CALLBACK Callback)
+{
+  Mock.fwk_module_deferred_start_CallbackBool = (char)1;
+  Mock.fwk_module_deferred_start_CallbackFunctionPointer = Callback;
+}
+
+void fwk_module_deferred_start_Stub(CMOCK_fwk_module_deferred_start_CALLBACK Callback)
+{
+  Mock.fwk_module_deferred_start_CallbackBool = (char)0;
+  Mock.fwk_module_deferred_start_CallbackFunctionPointer = Callback;
+}
+
 struct fwk_module_context* fwk_module_get_ctx(fwk_id_t id)
 {
   UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
@@ -36,6 +36,12 @@ typedef int (* CMOCK_fwk_module_stop_CALLBACK)(int cmock_num_calls);
 void fwk_module_stop_AddCallback(CMOCK_fwk_module_stop_CALLBACK Callback);
 void fwk_module_stop_Stub(CMOCK_fwk_module_stop_CALLBACK Callback);
 #define fwk_module_stop_StubWithCallback fwk_module_stop_Stub
+#define fwk_module_deferred_start_ExpectAndReturn(cmock_retval) fwk_module_deferred_start_CMockExpectAndReturn(__LINE__, cmock_retval)
+void fwk_module_deferred_start_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int cmock_to_return);
+typedef int (* CMOCK_fwk_module_deferred_start_CALLBACK)(int cmock_num_calls);
+void fwk_module_deferred_start_AddCallback(CMOCK_fwk_module_deferred_start_CALLBACK Callback);
+void fwk_module_deferred_start_Stub(CMOCK_fwk_module_deferred_start_CALLBACK Callback);
+#define fwk_module_deferred_start_StubWithCallback fwk_module_deferred_start_Stub
 #define fwk_module_get_ctx_ExpectAnyArgsAndReturn(cmock_retval) fwk_module_get_ctx_CMockExpectAnyArgsAndReturn(__LINE__, cmock_retval)
 void fwk_module_get_ctx_CMockExpectAnyArgsAndReturn(UNITY_LINE_TYPE cmock_line, struct fwk_module_context* cmock_to_return);
 #define fwk_module_get_ctx_ExpectAndReturn(id, cmock_retval) fwk_module_get_ctx_CMockExpectAndReturn(__LINE__, id, cmock_retval)